@@ -135,8 +135,11 @@ void Config::load(json &config)
     // Tests
     ParseBool(config, "runKeccakScriptGenerator", "RUN_KECCAK_SCRIPT_GENERATOR", runKeccakScriptGenerator, false);
     ParseBool(config, "runSHA256ScriptGenerator", "RUN_SHA256_SCRIPT_GENERATOR", runSHA256ScriptGenerator, false);
+    ParseBool(config, "runChelpersOptimizer", "RUN_CHELPERS_OPTIMIZER", runChelpersOptimizer, false);
+    ParseBool(config, "runChelpersCompiler", "RUN_CHELPERS_COMPILER", runChelpersCompiler, false);
     ParseBool(config, "runKeccakTest", "RUN_KECCAK_TEST", runKeccakTest, false);
     ParseBool(config, "runStorageSMTest", "RUN_STORAGE_SM_TEST", runStorageSMTest, false);
+    ParseBool(config, "runMainSMCheckpointTest", "RUN_MAIN_SM_CHECKPOINT_TEST", runMainSMCheckpointTest, false);
     ParseBool(config, "runClimbKeySMTest", "RUN_CLIMBKEY_SM_TEST", runClimbKeySMTest, false);
     ParseBool(config, "runBinarySMTest", "RUN_BINARY_SM_TEST", runBinarySMTest, false);
     ParseBool(config, "runMemAlignSMTest", "RUN_MEM_ALIGN_SM_TEST", runMemAlignSMTest, false);
@@ -150,10 +153,15 @@ void Config::load(json &config)
     ParseBool(config, "runPageManagerTest", "RUN_PAGE_MANAGER_TEST", runPageManagerTest, false);
     ParseBool(config, "runKeyValueTreeTest", "RUN_KEY_VALUE_TREE_TEST", runKeyValueTreeTest, false);
     ParseBool(config, "runSMT64Test", "RUN_SMT64_TEST", runSMT64Test, false);
+    ParseBool(config, "runChelpersTest", "RUN_CHELPERS_TEST", runChelpersTest, false);
     ParseBool(config, "runUnitTest", "RUN_UNIT_TEST", runUnitTest, false);
 
     // Main SM executor
     ParseBool(config, "executeInParallel", "EXECUTE_IN_PARALLEL", executeInParallel, true);
+    ParseU64(config, "executorTaskGraphThreads", "EXECUTOR_TASK_GRAPH_THREADS", executorTaskGraphThreads, 16);
+    ParseU64(config, "executorTraceFillThreads", "EXECUTOR_TRACE_FILL_THREADS", executorTraceFillThreads, 8);
+    ParseBool(config, "executorParallelFinalWait", "EXECUTOR_PARALLEL_FINAL_WAIT", executorParallelFinalWait, true);
+    ParseU64(config, "executorCheckpointSteps", "EXECUTOR_CHECKPOINT_STEPS", executorCheckpointSteps, 0);
     ParseBool(config, "useMainExecGenerated", "USE_MAIN_EXEC_GENERATED", useMainExecGenerated, true);
     //ParseBool(config, "useMainExecC", "USE_MAIN_EXEC_C", useMainExecC, false);
     useMainExecC = false; // Do not use in production; under development
@@ -195,6 +203,7 @@ void Config::load(json &config)
     ParseString(config, "executorClientHost", "EXECUTOR_CLIENT_HOST", executorClientHost, "127.0.0.1");
     ParseU64(config, "executorClientLoops", "EXECUTOR_CLIENT_LOOPS", executorClientLoops, 1);
     ParseBool(config, "executorClientCheckNewStateRoot", "EXECUTOR_CLIENT_CHECK_NEW_STATE_ROOT", executorClientCheckNewStateRoot, false);
+    ParseBool(config, "executorClientCheckStream", "EXECUTOR_CLIENT_CHECK_STREAM", executorClientCheckStream, false);
     ParseBool(config, "executorClientResetDB", "EXECUTOR_CLIENT_RESET_DB", executorClientResetDB, false);
     ParseU16(config, "hashDBServerPort", "HASHDB_SERVER_PORT", hashDBServerPort, 50061);
     ParseString(config, "hashDBURL", "HASHDB_URL", hashDBURL, "local");
@@ -240,6 +249,8 @@ void Config::load(json &config)
     ParseString(config, "zkevmStarkInfo", "ZKEVM_STARK_INFO", zkevmStarkInfo, configPath + "/zkevm/zkevm.starkinfo.json");
     ParseString(config, "zkevmVerifier", "ZKEVM_VERIFIER", zkevmVerifier, configPath + "/zkevm/zkevm.verifier.dat");
     ParseString(config, "zkevmVerkey", "ZKEVM_VERKEY", zkevmVerkey, configPath + "/zkevm/zkevm.verkey.json");
+    ParseString(config, "zkevmStep42nsProgram", "ZKEVM_STEP42NS_PROGRAM", zkevmStep42nsProgram, "");
+    ParseBool(config, "useGenericChelpers", "USE_GENERIC_CHELPERS", useGenericChelpers, false);
     ParseString(config, "c12aConstPols", "C12A_CONST_POLS", c12aConstPols, configPath + "/c12a/c12a.const");
     ParseString(config, "c12aConstantsTree", "C12A_CONSTANTS_TREE", c12aConstantsTree, configPath + "/c12a/c12a.consttree");
     ParseString(config, "c12aExec", "C12A_EXEC", c12aExec, configPath + "/c12a/c12a.exec");
@@ -291,6 +302,7 @@ void Config::load(json &config)
     ParseBool(config, "dbReadOnly", "DB_READ_ONLY", dbReadOnly, false);
     ParseU64(config, "dbReadRetryCounter", "DB_READ_RETRY_COUNTER", dbReadRetryCounter, 10);
     ParseU64(config, "dbReadRetryDelay", "DB_READ_RETRY_DELAY", dbReadRetryDelay, 100*1000);
+    ParseU64(config, "dbReadPrefetchLevels", "DB_READ_PREFETCH_LEVELS", dbReadPrefetchLevels, 0);
 
     // State Manager
     ParseBool(config, "stateManager", "STATE_MANAGER", stateManager, true);
@@ -309,6 +321,14 @@ void Config::load(json &config)
     // Memory allocation
     ParseU64(config, "fullTracerTraceReserveSize", "FULL_TRACER_TRACE_RESERVE_SIZE", fullTracerTraceReserveSize, 256*1024);
 
+    // Stark prover
+    ParseU64(config, "starkLDEPipelineBlocks", "STARK_LDE_PIPELINE_BLOCKS", starkLDEPipelineBlocks, 0);
+    ParseBool(config, "starkSetupCache", "STARK_SETUP_CACHE", starkSetupCache, true);
+    ParseBool(config, "prefaultConstantsTree", "PREFAULT_CONSTANTS_TREE", prefaultConstantsTree, false);
+    ParseBool(config, "starkOutOfCore", "STARK_OUT_OF_CORE", starkOutOfCore, false);
+    ParseString(config, "starkOutOfCoreDirectory", "STARK_OUT_OF_CORE_DIRECTORY", starkOutOfCoreDirectory, "");
+    ParseBool(config, "proverExecutorPrefetch", "PROVER_EXECUTOR_PREFETCH", proverExecutorPrefetch, false);
+
     // ECRecover
     //ParseBool(config, "ECRecoverPrecalc", "ECRECOVER_PRECALC", ECRecoverPrecalc, false);
     ECRecoverPrecalc = false; // Do not use in production; under development
@@ -355,10 +375,16 @@ void Config::print(void)
         zklog.info("    runKeccakScriptGenerator=true");
     if (runSHA256ScriptGenerator)
         zklog.info("    runSHA256ScriptGenerator=true");
+    if (runChelpersOptimizer)
+        zklog.info("    runChelpersOptimizer=true");
+    if (runChelpersCompiler)
+        zklog.info("    runChelpersCompiler=true");
     if (runKeccakTest)
         zklog.info("    runKeccakTest=true");
     if (runStorageSMTest)
         zklog.info("    runStorageSMTest=true");
+    if (runMainSMCheckpointTest)
+        zklog.info("    runMainSMCheckpointTest=true");
     if (runClimbKeySMTest)
         zklog.info("    runClimbKeySMTest=true");
     if (runBinarySMTest)
@@ -386,10 +412,16 @@ void Config::print(void)
         zklog.info("    runKeyValueTreeTest=true");
     if (runSMT64Test)
         zklog.info("    runSMT64Test=true");
+    if (runChelpersTest)
+        zklog.info("    runChelpersTest=true");
     if (runUnitTest)
         zklog.info("    runUnitTest=true");
 
     zklog.info("    executeInParallel=" + to_string(executeInParallel));
+    zklog.info("    executorTaskGraphThreads=" + to_string(executorTaskGraphThreads));
+    zklog.info("    executorTraceFillThreads=" + to_string(executorTraceFillThreads));
+    zklog.info("    executorParallelFinalWait=" + to_string(executorParallelFinalWait));
+    zklog.info("    executorCheckpointSteps=" + to_string(executorCheckpointSteps));
     zklog.info("    useMainExecGenerated=" + to_string(useMainExecGenerated));
     zklog.info("    useMainExecC=" + to_string(useMainExecC));
 
@@ -439,6 +471,7 @@ void Config::print(void)
     zklog.info("    executorClientHost=" + executorClientHost);
     zklog.info("    executorClientLoops=" + to_string(executorClientLoops));
     zklog.info("    executorClientCheckNewStateRoot=" + to_string(executorClientCheckNewStateRoot));
+    zklog.info("    executorClientCheckStream=" + to_string(executorClientCheckStream));
     zklog.info("    executorClientResetDB=" + to_string(executorClientResetDB));
     zklog.info("    hashDBServerPort=" + to_string(hashDBServerPort));
     zklog.info("    hashDBURL=" + hashDBURL);
@@ -472,6 +505,8 @@ void Config::print(void)
     zklog.info("    finalVerkey=" + finalVerkey);
     zklog.info("    zkevmVerifier=" + zkevmVerifier);
     zklog.info("    zkevmVerkey=" + zkevmVerkey);
+    zklog.info("    zkevmStep42nsProgram=" + zkevmStep42nsProgram);
+    zklog.info("    useGenericChelpers=" + to_string(useGenericChelpers));
     zklog.info("    c12aVerkey=" + c12aVerkey);
     zklog.info("    recursive1Verifier=" + recursive1Verifier);
     zklog.info("    recursive1Verkey=" + recursive1Verkey);
@@ -504,6 +539,7 @@ void Config::print(void)
     zklog.info("    dbReadOnly=" + to_string(dbReadOnly));
     zklog.info("    dbReadRetryCounter=" + to_string(dbReadRetryCounter));
     zklog.info("    dbReadRetryDelay=" + to_string(dbReadRetryDelay));
+    zklog.info("    dbReadPrefetchLevels=" + to_string(dbReadPrefetchLevels));
     zklog.info("    stateManager=" + to_string(stateManager));
     zklog.info("    stateManagerPurge=" + to_string(stateManagerPurge));
     zklog.info("    cleanerPollingPeriod=" + to_string(cleanerPollingPeriod));
@@ -522,6 +558,12 @@ void Config::print(void)
     zklog.info("    dbProgramCacheSize=" + to_string(dbProgramCacheSize));
     zklog.info("    loadDBToMemTimeout=" + to_string(loadDBToMemTimeout));
     zklog.info("    fullTracerTraceReserveSize=" + to_string(fullTracerTraceReserveSize));
+    zklog.info("    starkLDEPipelineBlocks=" + to_string(starkLDEPipelineBlocks));
+    zklog.info("    starkSetupCache=" + to_string(starkSetupCache));
+    zklog.info("    prefaultConstantsTree=" + to_string(prefaultConstantsTree));
+    zklog.info("    starkOutOfCore=" + to_string(starkOutOfCore));
+    zklog.info("    starkOutOfCoreDirectory=" + starkOutOfCoreDirectory);
+    zklog.info("    proverExecutorPrefetch=" + to_string(proverExecutorPrefetch));
     zklog.info("    ECRecoverPrecalc=" + to_string(ECRecoverPrecalc));
     zklog.info("    ECRecoverPrecalcNThreads=" + to_string(ECRecoverPrecalcNThreads));
 }
@@ -690,6 +732,17 @@ bool Config::check (void)
         }
     }
 
+    if (runChelpersOptimizer && zkevmStep42nsProgram.empty())
+    {
+        zklog.error("runChelpersOptimizer=true but zkevmStep42nsProgram is empty");
+        bError = true;
+    }
+    if (generateProof() && !runChelpersOptimizer && !zkevmStep42nsProgram.empty() && !fileExists(zkevmStep42nsProgram))
+    {
+        zklog.error("file config.zkevmStep42nsProgram=" + zkevmStep42nsProgram + " does not exist; generate it with runChelpersOptimizer");
+        bError = true;
+    }
+
     if (hashDB64 && !stateManager)
     {
         zklog.error("hashDB64=true but stateManager=false");
@@ -32,8 +32,11 @@ public:
 
     bool runKeccakScriptGenerator;
     bool runSHA256ScriptGenerator;
+    bool runChelpersOptimizer;
+    bool runChelpersCompiler;
     bool runKeccakTest;
     bool runStorageSMTest;
+    bool runMainSMCheckpointTest;
     bool runClimbKeySMTest;
     bool runBinarySMTest;
     bool runMemAlignSMTest;
@@ -47,9 +50,14 @@ public:
     bool runPageManagerTest;
     bool runKeyValueTreeTest;
     bool runSMT64Test;
+    bool runChelpersTest;
     bool runUnitTest;
 
     bool executeInParallel;
+    uint64_t executorTaskGraphThreads; // Number of worker threads used to execute the secondary state machines task graph, which steal the chunks of the large state machines from each other
+    uint64_t executorTraceFillThreads; // Number of chunks the Binary, Arith, Storage, KeccakF and Sha256F executors split their commit pols into, to fill them in parallel
+    bool executorParallelFinalWait; // Fills in parallel the identical evaluations of the main SM while the ROM waits at finalWait, in prove mode
+    uint64_t executorCheckpointSteps; // If not 0, the native main SM executor takes a checkpoint every executorCheckpointSteps steps in a first pass, and then fills the segments between checkpoints in parallel, in prove mode
     bool useMainExecGenerated;
     bool useMainExecC;
 
@@ -81,6 +89,7 @@ public:
     string executorClientHost;
     uint64_t executorClientLoops;
     bool executorClientCheckNewStateRoot;
+    bool executorClientCheckStream;
     bool executorClientResetDB;
 
     // HashDB service
@@ -141,6 +150,8 @@ public:
     string recursive2Verifier;
     string recursivefVerifier;
     string zkevmVerkey;
+    string zkevmStep42nsProgram; // Optimized step42ns chelpers parser program, generated by runChelpersOptimizer
+    bool useGenericChelpers; // Evaluates the stark steps with the programs compiled by runChelpersCompiler
     string c12aVerkey;
     string recursive1Verkey;
     string recursive2Verkey;
@@ -180,6 +191,7 @@ public:
     bool dbReadOnly;
     uint64_t dbReadRetryCounter;
     uint64_t dbReadRetryDelay;
+    uint64_t dbReadPrefetchLevels;
 
     // State manager
     bool stateManager;
@@ -194,6 +206,14 @@ public:
     string proverName;
     uint64_t fullTracerTraceReserveSize;
 
+    // Stark prover
+    uint64_t starkLDEPipelineBlocks; // Number of column blocks used to overlap LDE and Merkle leaf hashing in Starks::genProof; 0 or 1 means disabled
+    bool prefaultConstantsTree; // Touches all the pages of the constant trees at startup, since the 2ns constant pols are read from them
+    bool starkSetupCache; // Maps x_n, x_2ns and zhInv from a <name>.setup.bin file next to every starkinfo, generating it if missing or invalid
+    bool starkOutOfCore; // Pages out the committed sections and Merkle tree nodes of Starks::genProof once they are cold, and reports the peak RSS and spill volume per stage
+    string starkOutOfCoreDirectory; // Directory of the file that backs the committed polynomials in out-of-core mode, if zkevmCmPols is not set
+    bool proverExecutorPrefetch; // Execute the next pending batch proof request into a second commit pols buffer while the current one is in its stark phases
+
     // EC Recover
     bool ECRecoverPrecalc;
     uint64_t ECRecoverPrecalcNThreads;
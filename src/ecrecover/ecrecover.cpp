@@ -27,6 +27,9 @@ mpz_class mulFnEc(const mpz_class &a, const mpz_class &b);
 mpz_class addFpEc(const mpz_class &a, const mpz_class &b);
 mpz_class sqFpEc(const mpz_class &a);
 
+bool ECRecoverScalars(const mpz_class &signature, const mpz_class &r, const mpz_class &s, int vParity,
+                      mpz_class &y, mpz_class &k1, mpz_class &k2);
+
 //
 // EC operations with affine format:
 //
@@ -98,15 +101,7 @@ inline void Jacobian2Affine(const RawFec::Element &x, const RawFec::Element &y,
 ECRecoverResult ECRecover(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_class &v, bool bPrecompiled, mpz_class &address)
 {
     // Set the ECRecover s upper limit
-    mpz_class ecrecover_s_upperlimit;
-    if (bPrecompiled)
-    {
-        ecrecover_s_upperlimit = FNEC_MINUS_ONE;
-    }
-    else
-    {
-        ecrecover_s_upperlimit = FNEC_DIV_TWO;
-    }
+    const mpz_class &ecrecover_s_upperlimit = bPrecompiled ? FNEC_MINUS_ONE : FNEC_DIV_TWO;
     // Check that r is in the range [1, FNEC-1]
     if (r == 0)
     {
@@ -131,10 +126,6 @@ ECRecoverResult ECRecover(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_
         return ECR_S_IS_TOO_BIG;
     }
 
-    // Calculate the inverse of r
-    mpz_class ecrecover_r_inv;
-    ecrecover_r_inv = invFnEc(r);
-
     // Calculate the parity of v
     int ecrecover_v_parity;
     if (v == 0x1b)
@@ -150,40 +141,14 @@ ECRecoverResult ECRecover(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_
         zklog.error("ECRecover() found invalid v=" + v.get_str(16));
         return ECR_V_INVALID;
     }
-    // Curve is y^2 = x^3 + 7  -->  Calculate y from x=r
-    mpz_class ecrecover_y;
-    mpz_class aux1, aux2, aux3, aux4;
-    aux1 = mulFpEc(r, r);
-    aux2 = mulFpEc(aux1, r);
-    aux1 = 7;
-    aux3 = addFpEc(aux2, aux1);
-
-    if (aux3 == 0)
-    {
-        ecrecover_y = 0;
-    }
-    else
-    {
-        sqrtF3mod4(ecrecover_y, aux3);
-        if (ecrecover_y == 0)
-        {
-            zklog.error("ECRecover() found y^2 without root=" + aux3.get_str(16));
-            return ECR_NO_SQRT_Y;
-        }
-    }
-    assert(ecrecover_y < FPEC);
-
-    // parity:
-    int bit0 = mpz_tstbit(ecrecover_y.get_mpz_t(), 0);
-    if (bit0 + ecrecover_v_parity - 1 == 0)
+    // Calculate y from x=r, and the scalars of the double point multiplication
+    mpz_class ecrecover_y, k1, k2;
+    if (!ECRecoverScalars(signature, r, s, ecrecover_v_parity, ecrecover_y, k1, k2))
     {
-        ecrecover_y = FPEC - ecrecover_y;
+        zklog.error("ECRecover() found y^2 without root for r=" + r.get_str(16));
+        return ECR_NO_SQRT_Y;
     }
 
-    // Calculate the point of the curve
-    mpz_class k1 = FNEC - mulFnEc(signature, ecrecover_r_inv);
-    mpz_class k2 = mulFnEc(s, ecrecover_r_inv);
-
     mpz_class p1_x = ECGX;
     mpz_class p1_y = ECGY;
 
@@ -229,15 +194,7 @@ ECRecoverResult ECRecover(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_
 int ECRecoverPrecalc(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_class &v, bool bPrecompiled, RawFec::Element* buffer, int nthreads){
 
     // Set the ECRecoverPrecalc s upper limit
-    mpz_class ecrecover_s_upperlimit;
-    if (bPrecompiled)
-    {
-        ecrecover_s_upperlimit = FNEC_MINUS_ONE;
-    }
-    else
-    {
-        ecrecover_s_upperlimit = FNEC_DIV_TWO;
-    }
+    const mpz_class &ecrecover_s_upperlimit = bPrecompiled ? FNEC_MINUS_ONE : FNEC_DIV_TWO;
     // Check that r is in the range [1, FNEC-1]
     if (r == 0)
     {
@@ -262,10 +219,6 @@ int ECRecoverPrecalc(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_class
         return -1;//ECR_S_IS_TOO_BIG;
     }
 
-    // Calculate the inverse of r
-    mpz_class ecrecover_r_inv;
-    ecrecover_r_inv = invFnEc(r);
-
     // Calculate the parity of v
     int ecrecover_v_parity;
     if (v == 0x1b)
@@ -281,40 +234,14 @@ int ECRecoverPrecalc(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_class
         zklog.error("ECRecoverPrecalc() found invalid v=" + v.get_str(16));
         return -1;//ECR_V_INVALID;
     }
-    // Curve is y^2 = x^3 + 7  -->  Calculate y from x=r
-    mpz_class ecrecover_y;
-    mpz_class aux1, aux2, aux3, aux4;
-    aux1 = mulFpEc(r, r);
-    aux2 = mulFpEc(aux1, r);
-    aux1 = 7;
-    aux3 = addFpEc(aux2, aux1);
-
-    if (aux3 == 0)
-    {
-        ecrecover_y = 0;
-    }
-    else
-    {
-        sqrtF3mod4(ecrecover_y, aux3);
-        if (ecrecover_y == 0)
-        {
-            zklog.error("ECRecoverPrecalc() found y^2 without root=" + aux3.get_str(16));
-            return -1;//ECR_NO_SQRT_Y;
-        }
-    }
-    assert(ecrecover_y < FPEC);
-
-    // parity:
-    int bit0 = mpz_tstbit(ecrecover_y.get_mpz_t(), 0);
-    if (bit0 + ecrecover_v_parity - 1 == 0)
+    // Calculate y from x=r, and the scalars of the double point multiplication
+    mpz_class ecrecover_y, k1, k2;
+    if (!ECRecoverScalars(signature, r, s, ecrecover_v_parity, ecrecover_y, k1, k2))
     {
-        ecrecover_y = FPEC - ecrecover_y;
+        zklog.error("ECRecoverPrecalc() found y^2 without root for r=" + r.get_str(16));
+        return -1;//ECR_NO_SQRT_Y;
     }
 
-    // Calculate the point of the curve
-    mpz_class k1 = FNEC - mulFnEc(signature, ecrecover_r_inv);
-    mpz_class k2 = mulFnEc(s, ecrecover_r_inv);
-
     mpz_class p1_x = ECGX;
     mpz_class p1_y = ECGY;
 
@@ -392,6 +319,64 @@ mpz_class sqFpEc(const mpz_class &a)
     return (a * a) % FPEC;
 }
 
+// Calculates the y coordinate of the curve point with x=r and the parity of v, and the scalars
+// k1 = -signature/r and k2 = s/r, so that the public key is k1*G + k2*(r,y); all the operations are done
+// with fixed width Montgomery arithmetic, since this is called for every transaction signature
+bool ECRecoverScalars(const mpz_class &signature, const mpz_class &r, const mpz_class &s, int vParity,
+                      mpz_class &y, mpz_class &k1, mpz_class &k2)
+{
+    const MontgomeryField &Fp = Secp256k1Fp();
+    const MontgomeryField &Fn = Secp256k1Fn();
+
+    U256 ur, us, uSignature, a, b, c;
+    ur.fromScalar(r);
+    us.fromScalar(s);
+    uSignature.fromScalar(signature);
+
+    // Curve is y^2 = x^3 + 7  -->  Calculate y from x=r
+    Fp.toMontgomery(a, ur);
+    Fp.square(b, a);
+    Fp.mul(b, b, a);
+    Fp.toMontgomery(c, U256(7));
+    Fp.add(b, b, c);
+    if (!Fp.sqrt3mod4(a, b))
+    {
+        return false;
+    }
+    U256 uy;
+    Fp.fromMontgomery(uy, a);
+
+    // parity:
+    if (int(uy.isOdd()) + vParity - 1 == 0)
+    {
+        a = Fp.p;
+        a.sub(uy);
+        uy = a;
+    }
+    uy.toScalar(y);
+
+    // Calculate the inverse of r, which is in the range [1, FNEC-1]
+    U256 rInv;
+    Fn.toMontgomery(a, ur);
+    Fn.inv(rInv, a);
+
+    // k1 = FNEC - signature/r
+    Fn.toMontgomery(a, uSignature);
+    Fn.mul(b, a, rInv);
+    Fn.fromMontgomery(c, b);
+    a = Fn.p;
+    a.sub(c);
+    a.toScalar(k1);
+
+    // k2 = s/r
+    Fn.toMontgomery(a, us);
+    Fn.mul(b, a, rInv);
+    Fn.fromMontgomery(c, b);
+    c.toScalar(k2);
+
+    return true;
+}
+
 //
 // EC operations with affine format:
 //
@@ -4,6 +4,7 @@
 #include <gmpxx.h>
 #include "ffiasm/fec.hpp"
 #include "scalar.hpp"
+#include "u256.hpp"
 
 typedef enum
 {
@@ -22,16 +23,24 @@ int ECRecoverPrecalc(mpz_class &signature, mpz_class &r, mpz_class &s, mpz_class
 
 // We use that p = 3 mod 4 => r = a^((p+1)/4) is a square root of a
 // https://www.rieselprime.de/ziki/Modular_square_root
-// n = p+1/4
+// If a has no square root, or it is not reduced modulo p, r = ScalarMask256
 inline void sqrtF3mod4(mpz_class& r, const mpz_class &a){
-    mpz_class auxa = a;
-    mpz_class n("0x3fffffffffffffffffffffffffffffffffffffffffffffffffffffffbfffff0c");
-    mpz_class p("0xFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F");
-    mpz_powm(r.get_mpz_t(), a.get_mpz_t(), n.get_mpz_t(), p.get_mpz_t());
-    if ((r * r) % p != auxa)
+    const MontgomeryField &Fp = Secp256k1Fp();
+    U256 ua, ma, mr;
+    if ((mpz_sizeinbase(a.get_mpz_t(), 2) > 256) || (sgn(a) < 0))
     {
         r = ScalarMask256;
+        return;
     }
+    ua.fromScalar(a);
+    Fp.toMontgomery(ma, ua);
+    if ((ua >= Fp.p) || !Fp.sqrt3mod4(mr, ma))
+    {
+        r = ScalarMask256;
+        return;
+    }
+    Fp.fromMontgomery(ua, mr);
+    ua.toScalar(r);
 }
 
 #endif
\ No newline at end of file
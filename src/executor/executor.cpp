@@ -15,6 +15,8 @@
 #include "main_sm/fork_9/main_exec_generated/main_exec_generated_fast.hpp"
 #include "timer.hpp"
 #include "zklog.hpp"
+#include "task_graph.hpp"
+#include "zkmax.hpp"
 
 // Reduced version: only 1 evaluation is allocated, and some asserts are disabled
 void Executor::process_batch (ProverRequest &proverRequest)
@@ -315,174 +317,6 @@ void Executor::process_batch (ProverRequest &proverRequest)
     }
 }
 
-class ExecutorContext
-{
-public:
-    Executor * pExecutor;
-    PROVER_FORK_NAMESPACE::MainExecRequired * pRequired;
-    PROVER_FORK_NAMESPACE::CommitPols * pCommitPols;
-};
-
-void* BinaryThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Binary State Machine
-    TimerStart(BINARY_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->binaryExecutor.execute(pExecutorContext->pRequired->Binary, pExecutorContext->pCommitPols->Binary);
-    TimerStopAndLog(BINARY_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* MemAlignThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the MemAlign State Machine
-    TimerStart(MEM_ALIGN_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->memAlignExecutor.execute(pExecutorContext->pRequired->MemAlign, pExecutorContext->pCommitPols->MemAlign);
-    TimerStopAndLog(MEM_ALIGN_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* MemoryThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Binary State Machine
-    TimerStart(MEMORY_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->memoryExecutor.execute(pExecutorContext->pRequired->Memory, pExecutorContext->pCommitPols->Mem);
-    TimerStopAndLog(MEMORY_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* ArithThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Binary State Machine
-    TimerStart(ARITH_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->arithExecutor.execute(pExecutorContext->pRequired->Arith, pExecutorContext->pCommitPols->Arith);
-    TimerStopAndLog(ARITH_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* PaddingPGThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Padding PG State Machine
-    TimerStart(PADDING_PG_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->paddingPGExecutor.execute(pExecutorContext->pRequired->PaddingPG, pExecutorContext->pCommitPols->PaddingPG, pExecutorContext->pRequired->PoseidonGFromPG);
-    TimerStopAndLog(PADDING_PG_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* StorageThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Storage State Machine
-    TimerStart(STORAGE_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->storageExecutor.execute(pExecutorContext->pRequired->Storage, pExecutorContext->pCommitPols->Storage, pExecutorContext->pRequired->PoseidonGFromST, pExecutorContext->pRequired->ClimbKey);
-    TimerStopAndLog(STORAGE_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* ClimbKeyThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the ClimbKey State Machine
-    TimerStart(CLIMB_KEY_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->climbKeyExecutor.execute(pExecutorContext->pRequired->ClimbKey, pExecutorContext->pCommitPols->ClimbKey);
-    TimerStopAndLog(CLIMB_KEY_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* PoseidonThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Poseidon G State Machine
-    TimerStart(POSEIDON_G_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->poseidonGExecutor.execute(pExecutorContext->pRequired->PoseidonG, pExecutorContext->pRequired->PoseidonGFromPG, pExecutorContext->pRequired->PoseidonGFromST, pExecutorContext->pCommitPols->PoseidonG);
-    TimerStopAndLog(POSEIDON_G_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* KeccakThread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Padding KK State Machine
-    TimerStart(PADDING_KK_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->paddingKKExecutor.execute(pExecutorContext->pRequired->PaddingKK, pExecutorContext->pCommitPols->PaddingKK, pExecutorContext->pRequired->PaddingKKBit);
-    TimerStopAndLog(PADDING_KK_SM_EXECUTE_THREAD);
-
-    // Execute the PaddingKKBit State Machine
-    TimerStart(PADDING_KK_BIT_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->paddingKKBitExecutor.execute(pExecutorContext->pRequired->PaddingKKBit, pExecutorContext->pCommitPols->PaddingKKBit, pExecutorContext->pRequired->Bits2Field);
-    TimerStopAndLog(PADDING_KK_BIT_SM_EXECUTE_THREAD);
-
-    // Execute the Bits2Field State Machine
-    TimerStart(BITS2FIELD_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->bits2FieldExecutor.execute(pExecutorContext->pRequired->Bits2Field, pExecutorContext->pCommitPols->Bits2Field, pExecutorContext->pRequired->KeccakF);
-    TimerStopAndLog(BITS2FIELD_SM_EXECUTE_THREAD);
-
-    // Execute the Keccak F State Machine
-    TimerStart(KECCAK_F_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->keccakFExecutor.execute(pExecutorContext->pRequired->KeccakF, pExecutorContext->pCommitPols->KeccakF);
-    TimerStopAndLog(KECCAK_F_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
-void* Sha256Thread (void* arg)
-{
-    // Get the context
-    ExecutorContext * pExecutorContext = (ExecutorContext *)arg;
-
-    // Execute the Padding SHA256 State Machine
-    TimerStart(PADDING_SHA256_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->paddingSha256Executor.execute(pExecutorContext->pRequired->PaddingSha256, pExecutorContext->pCommitPols->PaddingSha256, pExecutorContext->pRequired->PaddingSha256Bit);
-    TimerStopAndLog(PADDING_SHA256_SM_EXECUTE_THREAD);
-
-    // Execute the PaddingSha256Bit State Machine
-    TimerStart(PADDING_SHA256_BIT_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->paddingSha256BitExecutor.execute(pExecutorContext->pRequired->PaddingSha256Bit, pExecutorContext->pCommitPols->PaddingSha256Bit, pExecutorContext->pRequired->Bits2FieldSha256);
-    TimerStopAndLog(PADDING_SHA256_BIT_SM_EXECUTE_THREAD);
-
-    // Execute the Bits2FieldSha256 State Machine
-    TimerStart(BITS2FIELDSHA256_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->bits2FieldSha256Executor.execute(pExecutorContext->pRequired->Bits2FieldSha256, pExecutorContext->pCommitPols->Bits2FieldSha256, pExecutorContext->pRequired->Sha256F);
-    TimerStopAndLog(BITS2FIELDSHA256_SM_EXECUTE_THREAD);
-
-    // Execute the Sha256 F State Machine
-    TimerStart(SHA256_F_SM_EXECUTE_THREAD);
-    pExecutorContext->pExecutor->sha256FExecutor.execute(pExecutorContext->pRequired->Sha256F, pExecutorContext->pCommitPols->Sha256F);
-    TimerStopAndLog(SHA256_F_SM_EXECUTE_THREAD);
-
-    return NULL;
-}
-
 // Full version: all polynomials are evaluated, in all evaluations
 void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::CommitPols & commitPols)
 {
@@ -610,10 +444,6 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
     {
         // This instance will store all data required to execute the rest of State Machines
         PROVER_FORK_NAMESPACE::MainExecRequired required;
-        ExecutorContext executorContext;
-        executorContext.pExecutor = this;
-        executorContext.pCommitPols = &commitPols;
-        executorContext.pRequired = &required;
 
         // Execute the Main State Machine
         TimerStart(MAIN_EXECUTOR_EXECUTE);
@@ -644,61 +474,105 @@ void Executor::execute (ProverRequest &proverRequest, PROVER_FORK_NAMESPACE::Com
             return;
         }
 
-        // Execute the Storage State Machines
-        pthread_t storageThread;
-        pthread_create(&storageThread, NULL, StorageThread, &executorContext);
-
-        // Execute the Padding PG
-        pthread_t paddingPGThread;
-        pthread_create(&paddingPGThread, NULL, PaddingPGThread, &executorContext);
-
-        // Execute the Arith State Machine, in parallel
-        pthread_t arithThread;
-        pthread_create(&arithThread, NULL, ArithThread, &executorContext);
-
-        // Execute the Binary State Machine, in parallel
-        pthread_t binaryThread;
-        pthread_create(&binaryThread, NULL, BinaryThread, &executorContext);
-
-        // Execute the Mem Align State Machine, in parallel
-        pthread_t memAlignThread;
-        pthread_create(&memAlignThread, NULL, MemAlignThread, &executorContext);
-
-        // Execute the Memory State Machine, in parallel
-        pthread_t memoryThread;
-        pthread_create(&memoryThread, NULL, MemoryThread, &executorContext);
-
-        // Execute the PaddingKK, PaddingKKBit, Bits2Field, Keccak F
-        pthread_t keccakThread;
-        pthread_create(&keccakThread, NULL, KeccakThread, &executorContext);
-
-        // Execute the PaddingSha256, PaddingSha256Bit, Bits2FieldSha256, Sha256 F
-        pthread_t sha256Thread;
-        pthread_create(&sha256Thread, NULL, Sha256Thread, &executorContext);
-
-        // Wait for the Storage SM threads
-        pthread_join(storageThread, NULL);
-
-        // Execute the ClimKey State Machines (now that Storage is done)
-        pthread_t climbKeyThread;
-        pthread_create(&climbKeyThread, NULL, ClimbKeyThread, &executorContext);
-
-        // Wait for the PaddingPG SM threads
-        pthread_join(paddingPGThread, NULL);
-
-        // Execute the PoseidonG State Machine (now that Storage and PaddingPG are done)
-        pthread_t poseidonThread;
-        pthread_create(&poseidonThread, NULL, PoseidonThread, &executorContext);
-
-        // Wait for the parallel SM threads
-        pthread_join(binaryThread, NULL);
-        pthread_join(memAlignThread, NULL);
-        pthread_join(memoryThread, NULL);
-        pthread_join(arithThread, NULL);
-        pthread_join(poseidonThread, NULL);
-        pthread_join(keccakThread, NULL);
-        pthread_join(sha256Thread, NULL);
-        pthread_join(climbKeyThread, NULL);
+        // Execute the secondary state machines as a task graph, so that every one of them starts as soon as its
+        // inputs are ready instead of waiting for fixed joins; the large ones are split into chunks (ranges of rows
+        // for Binary and Arith, of slots for KeccakF and Sha256F, and of actions for Storage), which the idle workers
+        // steal, so that a long state machine, or the last one of a chain (padding -> bits -> permutation), does not
+        // bound the wall time, as reported by the critical path
+        TimerStart(SECONDARY_SM_EXECUTE);
+        TaskGraph taskGraph;
+        uint64_t nChunks = zkmax(config.executorTraceFillThreads, (uint64_t)1);
+
+        // Storage -> ClimbKey, and Storage + PaddingPG -> PoseidonG
+        uint64_t storageTask;
+        StorageChunks storageChunks;
+        if (nChunks > 1)
+        {
+            // Count the rows of every range of actions, join them to get their first rows, and then fill them
+            storageExecutor.split(required.Storage, nChunks, storageChunks);
+            uint64_t storageCountTask = taskGraph.addTask("StorageCount", storageChunks.countSize(), [&](uint64_t chunk) {
+                storageExecutor.count(required.Storage, storageChunks, chunk);
+            });
+            storageTask = taskGraph.addTask("StorageJoin", [&]() {
+                storageExecutor.join(required.Storage, storageChunks, required.PoseidonGFromST, required.ClimbKey);
+            }, {storageCountTask});
+            taskGraph.addTask("StorageFill", storageChunks.fillSize(), [&](uint64_t chunk) {
+                storageExecutor.fill(required.Storage, commitPols.Storage, storageChunks, chunk);
+            }, {storageTask});
+        }
+        else
+        {
+            storageTask = taskGraph.addTask("Storage", [&]() {
+                storageExecutor.execute(required.Storage, commitPols.Storage, required.PoseidonGFromST, required.ClimbKey);
+            });
+        }
+        uint64_t paddingPGTask = taskGraph.addTask("PaddingPG", [&]() {
+            paddingPGExecutor.execute(required.PaddingPG, commitPols.PaddingPG, required.PoseidonGFromPG);
+        });
+
+        // Binary and Arith actions are known before the graph runs, so they are split now
+        TraceChunks arithChunks = arithExecutor.split(required.Arith, nChunks);
+        taskGraph.addTask("Arith", arithChunks.size(), [&](uint64_t chunk) {
+            arithExecutor.execute(required.Arith, commitPols.Arith, arithChunks, chunk);
+        });
+        TraceChunks binaryChunks = binaryExecutor.split(required.Binary, nChunks);
+        taskGraph.addTask("Binary", binaryChunks.size(), [&](uint64_t chunk) {
+            binaryExecutor.execute(required.Binary, commitPols.Binary, binaryChunks, chunk);
+        });
+        taskGraph.addTask("MemAlign", [&]() {
+            memAlignExecutor.execute(required.MemAlign, commitPols.MemAlign);
+        });
+        taskGraph.addTask("Memory", [&]() {
+            memoryExecutor.execute(required.Memory, commitPols.Mem);
+        });
+
+        // PaddingKK -> PaddingKKBit -> Bits2Field -> KeccakF; the slots are only known when Bits2Field is done, so
+        // it splits them, and KeccakF chunks beyond the split ones do nothing
+        uint64_t paddingKKTask = taskGraph.addTask("PaddingKK", [&]() {
+            paddingKKExecutor.execute(required.PaddingKK, commitPols.PaddingKK, required.PaddingKKBit);
+        });
+        uint64_t paddingKKBitTask = taskGraph.addTask("PaddingKKBit", [&]() {
+            paddingKKBitExecutor.execute(required.PaddingKKBit, commitPols.PaddingKKBit, required.Bits2Field);
+        }, {paddingKKTask});
+        TraceChunks keccakFChunks(0, 1, 1);
+        uint64_t bits2FieldTask = taskGraph.addTask("Bits2Field", [&]() {
+            bits2FieldExecutor.execute(required.Bits2Field, commitPols.Bits2Field, required.KeccakF);
+            keccakFChunks = keccakFExecutor.split(required.KeccakF, commitPols.KeccakF, nChunks);
+        }, {paddingKKBitTask});
+        taskGraph.addTask("KeccakF", nChunks, [&](uint64_t chunk) {
+            if (chunk < keccakFChunks.size()) keccakFExecutor.execute(required.KeccakF, commitPols.KeccakF, keccakFChunks, chunk);
+        }, {bits2FieldTask});
+
+        // PaddingSha256 -> PaddingSha256Bit -> Bits2FieldSha256 -> Sha256F, split as KeccakF
+        uint64_t paddingSha256Task = taskGraph.addTask("PaddingSha256", [&]() {
+            paddingSha256Executor.execute(required.PaddingSha256, commitPols.PaddingSha256, required.PaddingSha256Bit);
+        });
+        uint64_t paddingSha256BitTask = taskGraph.addTask("PaddingSha256Bit", [&]() {
+            paddingSha256BitExecutor.execute(required.PaddingSha256Bit, commitPols.PaddingSha256Bit, required.Bits2FieldSha256);
+        }, {paddingSha256Task});
+        TraceChunks sha256FChunks(0, 1, 1);
+        uint64_t bits2FieldSha256Task = taskGraph.addTask("Bits2FieldSha256", [&]() {
+            bits2FieldSha256Executor.execute(required.Bits2FieldSha256, commitPols.Bits2FieldSha256, required.Sha256F);
+            sha256FChunks = sha256FExecutor.split(required.Sha256F, commitPols.Sha256F, nChunks);
+        }, {paddingSha256BitTask});
+        taskGraph.addTask("Sha256F", nChunks, [&](uint64_t chunk) {
+            if (chunk < sha256FChunks.size()) sha256FExecutor.execute(required.Sha256F, commitPols.Sha256F, sha256FChunks, chunk);
+        }, {bits2FieldSha256Task});
+
+        // ClimbKey inputs are generated by Storage
+        taskGraph.addTask("ClimbKey", [&]() {
+            climbKeyExecutor.execute(required.ClimbKey, commitPols.ClimbKey);
+        }, {storageTask});
+
+        // PoseidonG inputs are generated by the main SM, Storage and PaddingPG
+        taskGraph.addTask("PoseidonG", [&]() {
+            poseidonGExecutor.execute(required.PoseidonG, required.PoseidonGFromPG, required.PoseidonGFromST, commitPols.PoseidonG);
+        }, {storageTask, paddingPGTask});
+
+        taskGraph.run(config.executorTaskGraphThreads);
+        TimerStopAndLog(SECONDARY_SM_EXECUTE);
+
+        taskGraph.print("Executor::execute() secondary SMs", config.executorTimeStatistics);
 
     }
 }
\ No newline at end of file
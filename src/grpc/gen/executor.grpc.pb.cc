@@ -27,6 +27,7 @@ static const char* ExecutorService_method_names[] = {
   "/executor.v1.ExecutorService/ProcessBatchV2",
   "/executor.v1.ExecutorService/ProcessStatelessBatchV2",
   "/executor.v1.ExecutorService/GetFlushStatus",
+  "/executor.v1.ExecutorService/ProcessBatchV2Stream",
 };
 
 std::unique_ptr< ExecutorService::Stub> ExecutorService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -40,6 +41,7 @@ ExecutorService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& ch
   , rpcmethod_ProcessBatchV2_(ExecutorService_method_names[1], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ProcessStatelessBatchV2_(ExecutorService_method_names[2], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_GetFlushStatus_(ExecutorService_method_names[3], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_ProcessBatchV2Stream_(ExecutorService_method_names[4], ::grpc::internal::RpcMethod::SERVER_STREAMING, channel)
   {}
 
 ::grpc::Status ExecutorService::Stub::ProcessBatch(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequest& request, ::executor::v1::ProcessBatchResponse* response) {
@@ -154,6 +156,22 @@ void ExecutorService::Stub::experimental_async::GetFlushStatus(::grpc::ClientCon
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::executor::v1::GetFlushStatusResponse>::Create(channel_.get(), cq, rpcmethod_GetFlushStatus_, context, request, false);
 }
 
+::grpc::ClientReader< ::executor::v1::ProcessBatchResponseV2>* ExecutorService::Stub::ProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) {
+  return ::grpc_impl::internal::ClientReaderFactory< ::executor::v1::ProcessBatchResponseV2>::Create(channel_.get(), rpcmethod_ProcessBatchV2Stream_, context, request);
+}
+
+void ExecutorService::Stub::experimental_async::ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchResponseV2>* reactor) {
+  ::grpc_impl::internal::ClientCallbackReaderFactory< ::executor::v1::ProcessBatchResponseV2>::Create(stub_->channel_.get(), stub_->rpcmethod_ProcessBatchV2Stream_, context, request, reactor);
+}
+
+::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>* ExecutorService::Stub::AsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::executor::v1::ProcessBatchResponseV2>::Create(channel_.get(), cq, rpcmethod_ProcessBatchV2Stream_, context, request, true, tag);
+}
+
+::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>* ExecutorService::Stub::PrepareAsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncReaderFactory< ::executor::v1::ProcessBatchResponseV2>::Create(channel_.get(), cq, rpcmethod_ProcessBatchV2Stream_, context, request, false, nullptr);
+}
+
 ExecutorService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       ExecutorService_method_names[0],
@@ -195,6 +213,16 @@ ExecutorService::Service::Service() {
              ::executor::v1::GetFlushStatusResponse* resp) {
                return service->GetFlushStatus(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      ExecutorService_method_names[4],
+      ::grpc::internal::RpcMethod::SERVER_STREAMING,
+      new ::grpc::internal::ServerStreamingHandler< ExecutorService::Service, ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>(
+          [](ExecutorService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::executor::v1::ProcessBatchRequestV2* req,
+             ::grpc_impl::ServerWriter<::executor::v1::ProcessBatchResponseV2>* writer) {
+               return service->ProcessBatchV2Stream(ctx, req, writer);
+             }, this)));
 }
 
 ExecutorService::Service::~Service() {
@@ -228,6 +256,13 @@ ExecutorService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status ExecutorService::Service::ProcessBatchV2Stream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* writer) {
+  (void) context;
+  (void) request;
+  (void) writer;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace executor
 }  // namespace v1
@@ -66,6 +66,17 @@ class ExecutorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::GetFlushStatusResponse>> PrepareAsyncGetFlushStatus(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::GetFlushStatusResponse>>(PrepareAsyncGetFlushStatusRaw(context, request, cq));
     }
+    // / Processes a batch, streaming every block response as soon as it is finished; every message but the last one
+    // / contains only one entry in block_responses, and the last one contains the batch fields and no block responses
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponseV2>> ProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) {
+      return std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponseV2>>(ProcessBatchV2StreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponseV2>> AsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponseV2>>(AsyncProcessBatchV2StreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponseV2>> PrepareAsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponseV2>>(PrepareAsyncProcessBatchV2StreamRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -118,6 +129,13 @@ class ExecutorService final {
       #else
       virtual void GetFlushStatus(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::GetFlushStatusResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      // / Processes a batch, streaming every block response as soon as it is finished; every message but the last one
+      // / contains only one entry in block_responses, and the last one contains the batch fields and no block responses
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ClientReadReactor< ::executor::v1::ProcessBatchResponseV2>* reactor) = 0;
+      #else
+      virtual void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchResponseV2>* reactor) = 0;
+      #endif
     };
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     typedef class experimental_async_interface async_interface;
@@ -135,6 +153,9 @@ class ExecutorService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessStatelessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::GetFlushStatusResponse>* AsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::executor::v1::GetFlushStatusResponse>* PrepareAsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponseV2>* ProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponseV2>* AsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) = 0;
+    virtual ::grpc::ClientAsyncReaderInterface< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -167,6 +188,15 @@ class ExecutorService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::GetFlushStatusResponse>> PrepareAsyncGetFlushStatus(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::executor::v1::GetFlushStatusResponse>>(PrepareAsyncGetFlushStatusRaw(context, request, cq));
     }
+    std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchResponseV2>> ProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) {
+      return std::unique_ptr< ::grpc::ClientReader< ::executor::v1::ProcessBatchResponseV2>>(ProcessBatchV2StreamRaw(context, request));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>> AsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>>(AsyncProcessBatchV2StreamRaw(context, request, cq, tag));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>> PrepareAsyncProcessBatchV2Stream(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>>(PrepareAsyncProcessBatchV2StreamRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -218,6 +248,11 @@ class ExecutorService final {
       #else
       void GetFlushStatus(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::executor::v1::GetFlushStatusResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ClientReadReactor< ::executor::v1::ProcessBatchResponseV2>* reactor) override;
+      #else
+      void ProcessBatchV2Stream(::grpc::ClientContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::experimental::ClientReadReactor< ::executor::v1::ProcessBatchResponseV2>* reactor) override;
+      #endif
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -237,10 +272,14 @@ class ExecutorService final {
     ::grpc::ClientAsyncResponseReader< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessStatelessBatchV2Raw(::grpc::ClientContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::GetFlushStatusResponse>* AsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::executor::v1::GetFlushStatusResponse>* PrepareAsyncGetFlushStatusRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientReader< ::executor::v1::ProcessBatchResponseV2>* ProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request) override;
+    ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>* AsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq, void* tag) override;
+    ::grpc::ClientAsyncReader< ::executor::v1::ProcessBatchResponseV2>* PrepareAsyncProcessBatchV2StreamRaw(::grpc::ClientContext* context, const ::executor::v1::ProcessBatchRequestV2& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessBatchV2_;
     const ::grpc::internal::RpcMethod rpcmethod_ProcessStatelessBatchV2_;
     const ::grpc::internal::RpcMethod rpcmethod_GetFlushStatus_;
+    const ::grpc::internal::RpcMethod rpcmethod_ProcessBatchV2Stream_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -253,6 +292,9 @@ class ExecutorService final {
     virtual ::grpc::Status ProcessBatchV2(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response);
     virtual ::grpc::Status ProcessStatelessBatchV2(::grpc::ServerContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response);
     virtual ::grpc::Status GetFlushStatus(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::executor::v1::GetFlushStatusResponse* response);
+    // / Processes a batch, streaming every block response as soon as it is finished; every message but the last one
+    // / contains only one entry in block_responses, and the last one contains the batch fields and no block responses
+    virtual ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* writer);
   };
   template <class BaseClass>
   class WithAsyncMethod_ProcessBatch : public BaseClass {
@@ -334,7 +376,27 @@ class ExecutorService final {
       ::grpc::Service::RequestAsyncUnary(3, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_ProcessBatch<WithAsyncMethod_ProcessBatchV2<WithAsyncMethod_ProcessStatelessBatchV2<WithAsyncMethod_GetFlushStatus<Service > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodAsync(4);
+    }
+    ~WithAsyncMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatchV2Stream(::grpc::ServerContext* context, ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerAsyncWriter< ::executor::v1::ProcessBatchResponseV2>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(4, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_ProcessBatch<WithAsyncMethod_ProcessBatchV2<WithAsyncMethod_ProcessStatelessBatchV2<WithAsyncMethod_GetFlushStatus<WithAsyncMethod_ProcessBatchV2Stream<Service > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_ProcessBatch : public BaseClass {
    private:
@@ -523,11 +585,49 @@ class ExecutorService final {
     #endif
       { return nullptr; }
   };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_ProcessBatchV2Stream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(4,
+          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::executor::v1::ProcessBatchRequestV2* request) { return this->ProcessBatchV2Stream(context, request); }));
+    }
+    ~ExperimentalWithCallbackMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::executor::v1::ProcessBatchResponseV2>* ProcessBatchV2Stream(
+      ::grpc::CallbackServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::executor::v1::ProcessBatchResponseV2>* ProcessBatchV2Stream(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/)
+    #endif
+      { return nullptr; }
+  };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<Service > > > > CallbackService;
+  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<ExperimentalWithCallbackMethod_ProcessBatchV2Stream<Service > > > > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<Service > > > > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_ProcessBatch<ExperimentalWithCallbackMethod_ProcessBatchV2<ExperimentalWithCallbackMethod_ProcessStatelessBatchV2<ExperimentalWithCallbackMethod_GetFlushStatus<ExperimentalWithCallbackMethod_ProcessBatchV2Stream<Service > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_ProcessBatch : public BaseClass {
    private:
@@ -597,6 +697,23 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodGeneric(4);
+    }
+    ~WithGenericMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -677,6 +794,26 @@ class ExecutorService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodRaw(4);
+    }
+    ~WithRawMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestProcessBatchV2Stream(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncWriter< ::grpc::ByteBuffer>* writer, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncServerStreaming(4, context, request, writer, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -829,6 +966,44 @@ class ExecutorService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_ProcessBatchV2Stream() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(4,
+          new ::grpc_impl::internal::CallbackServerStreamingHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request) { return this->ProcessBatchV2Stream(context, request); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerWriteReactor< ::grpc::ByteBuffer>* ProcessBatchV2Stream(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #else
+    virtual ::grpc::experimental::ServerWriteReactor< ::grpc::ByteBuffer>* ProcessBatchV2Stream(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_ProcessBatch : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -937,8 +1112,35 @@ class ExecutorService final {
     virtual ::grpc::Status StreamedGetFlushStatus(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::executor::v1::GetFlushStatusResponse>* server_unary_streamer) = 0;
   };
   typedef WithStreamedUnaryMethod_ProcessBatch<WithStreamedUnaryMethod_ProcessBatchV2<WithStreamedUnaryMethod_ProcessStatelessBatchV2<WithStreamedUnaryMethod_GetFlushStatus<Service > > > > StreamedUnaryService;
-  typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_ProcessBatch<WithStreamedUnaryMethod_ProcessBatchV2<WithStreamedUnaryMethod_ProcessStatelessBatchV2<WithStreamedUnaryMethod_GetFlushStatus<Service > > > > StreamedService;
+  template <class BaseClass>
+  class WithSplitStreamingMethod_ProcessBatchV2Stream : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithSplitStreamingMethod_ProcessBatchV2Stream() {
+      ::grpc::Service::MarkMethodStreamed(4,
+        new ::grpc::internal::SplitServerStreamingHandler<
+          ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerSplitStreamer<
+                     ::executor::v1::ProcessBatchRequestV2, ::executor::v1::ProcessBatchResponseV2>* streamer) {
+                       return this->StreamedProcessBatchV2Stream(context,
+                         streamer);
+                  }));
+    }
+    ~WithSplitStreamingMethod_ProcessBatchV2Stream() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status ProcessBatchV2Stream(::grpc::ServerContext* /*context*/, const ::executor::v1::ProcessBatchRequestV2* /*request*/, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* /*writer*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with split streamed
+    virtual ::grpc::Status StreamedProcessBatchV2Stream(::grpc::ServerContext* context, ::grpc::ServerSplitStreamer< ::executor::v1::ProcessBatchRequestV2,::executor::v1::ProcessBatchResponseV2>* server_split_streamer) = 0;
+  };
+  typedef WithSplitStreamingMethod_ProcessBatchV2Stream<Service > SplitStreamedService;
+  typedef WithStreamedUnaryMethod_ProcessBatch<WithStreamedUnaryMethod_ProcessBatchV2<WithStreamedUnaryMethod_ProcessStatelessBatchV2<WithStreamedUnaryMethod_GetFlushStatus<WithSplitStreamingMethod_ProcessBatchV2Stream<Service > > > > > StreamedService;
 };
 
 }  // namespace v1
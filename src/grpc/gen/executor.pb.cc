@@ -1947,7 +1947,7 @@ const char descriptor_table_protodef_executor_2eproto[] PROTOBUF_SECTION_VARIABL
   "R\020r\022&\n\"EXECUTOR_ERROR_INVALID_DATA_STREA"
   "M\020s\022-\n)EXECUTOR_ERROR_INVALID_UPDATE_MER"
   "KLE_TREE\020t\0222\n.EXECUTOR_ERROR_SM_MAIN_INV"
-  "ALID_TX_STATUS_ERROR\020u2\205\003\n\017ExecutorServi"
+  "ALID_TX_STATUS_ERROR\020u2\352\003\n\017ExecutorServi"
   "ce\022U\n\014ProcessBatch\022 .executor.v1.Process"
   "BatchRequest\032!.executor.v1.ProcessBatchR"
   "esponse\"\000\022[\n\016ProcessBatchV2\022\".executor.v"
@@ -1957,9 +1957,11 @@ const char descriptor_table_protodef_executor_2eproto[] PROTOBUF_SECTION_VARIABL
   "BatchRequestV2\032#.executor.v1.ProcessBatc"
   "hResponseV2\"\000\022O\n\016GetFlushStatus\022\026.google"
   ".protobuf.Empty\032#.executor.v1.GetFlushSt"
-  "atusResponse\"\000B>Z<github.com/0xPolygonHe"
-  "rmez/zkevm-node/state/runtime/executorb\006"
-  "proto3"
+  "atusResponse\"\000\022c\n\024ProcessBatchV2Stream\022\""
+  ".executor.v1.ProcessBatchRequestV2\032#.exe"
+  "cutor.v1.ProcessBatchResponseV2\"\0000\001B>Z<g"
+  "ithub.com/0xPolygonHermez/zkevm-node/sta"
+  "te/runtime/executorb\006proto3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_executor_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
@@ -2012,7 +2014,7 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_exe
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_executor_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_executor_2eproto = {
-  false, false, descriptor_table_protodef_executor_2eproto, "executor.proto", 16566,
+  false, false, descriptor_table_protodef_executor_2eproto, "executor.proto", 16667,
   &descriptor_table_executor_2eproto_once, descriptor_table_executor_2eproto_sccs, descriptor_table_executor_2eproto_deps, 44, 1,
   schemas, file_default_instances, TableStruct_executor_2eproto::offsets,
   file_level_metadata_executor_2eproto, 44, file_level_enum_descriptors_executor_2eproto, file_level_service_descriptors_executor_2eproto,
@@ -41,6 +41,8 @@ static const char* HashDBService_method_names[] = {
   "/hashdb.v1.HashDBService/ReadTree",
   "/hashdb.v1.HashDBService/CancelBatch",
   "/hashdb.v1.HashDBService/ResetDB",
+  "/hashdb.v1.HashDBService/SetMany",
+  "/hashdb.v1.HashDBService/GetMany",
 };
 
 std::unique_ptr< HashDBService::Stub> HashDBService::NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options) {
@@ -68,6 +70,8 @@ HashDBService::Stub::Stub(const std::shared_ptr< ::grpc::ChannelInterface>& chan
   , rpcmethod_ReadTree_(HashDBService_method_names[15], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_CancelBatch_(HashDBService_method_names[16], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   , rpcmethod_ResetDB_(HashDBService_method_names[17], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_SetMany_(HashDBService_method_names[18], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
+  , rpcmethod_GetMany_(HashDBService_method_names[19], ::grpc::internal::RpcMethod::NORMAL_RPC, channel)
   {}
 
 ::grpc::Status HashDBService::Stub::GetLatestStateRoot(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::hashdb::v1::GetLatestStateRootResponse* response) {
@@ -574,6 +578,62 @@ void HashDBService::Stub::experimental_async::ResetDB(::grpc::ClientContext* con
   return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::ResetDBResponse>::Create(channel_.get(), cq, rpcmethod_ResetDB_, context, request, false);
 }
 
+::grpc::Status HashDBService::Stub::SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::hashdb::v1::SetManyResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_SetMany_, context, request, response);
+}
+
+void HashDBService::Stub::experimental_async::SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetMany_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_SetMany_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_SetMany_, context, request, response, reactor);
+}
+
+void HashDBService::Stub::experimental_async::SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_SetMany_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>* HashDBService::Stub::AsyncSetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::SetManyResponse>::Create(channel_.get(), cq, rpcmethod_SetMany_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>* HashDBService::Stub::PrepareAsyncSetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::SetManyResponse>::Create(channel_.get(), cq, rpcmethod_SetMany_, context, request, false);
+}
+
+::grpc::Status HashDBService::Stub::GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::hashdb::v1::GetManyResponse* response) {
+  return ::grpc::internal::BlockingUnaryCall(channel_.get(), rpcmethod_GetMany_, context, request, response);
+}
+
+void HashDBService::Stub::experimental_async::GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetMany_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, std::function<void(::grpc::Status)> f) {
+  ::grpc_impl::internal::CallbackUnaryCall(stub_->channel_.get(), stub_->rpcmethod_GetMany_, context, request, response, std::move(f));
+}
+
+void HashDBService::Stub::experimental_async::GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetMany_, context, request, response, reactor);
+}
+
+void HashDBService::Stub::experimental_async::GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) {
+  ::grpc_impl::internal::ClientCallbackUnaryFactory::Create(stub_->channel_.get(), stub_->rpcmethod_GetMany_, context, request, response, reactor);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>* HashDBService::Stub::AsyncGetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::GetManyResponse>::Create(channel_.get(), cq, rpcmethod_GetMany_, context, request, true);
+}
+
+::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>* HashDBService::Stub::PrepareAsyncGetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) {
+  return ::grpc_impl::internal::ClientAsyncResponseReaderFactory< ::hashdb::v1::GetManyResponse>::Create(channel_.get(), cq, rpcmethod_GetMany_, context, request, false);
+}
+
 HashDBService::Service::Service() {
   AddMethod(new ::grpc::internal::RpcServiceMethod(
       HashDBService_method_names[0],
@@ -755,6 +815,26 @@ HashDBService::Service::Service() {
              ::hashdb::v1::ResetDBResponse* resp) {
                return service->ResetDB(ctx, req, resp);
              }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      HashDBService_method_names[18],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::SetManyRequest, ::hashdb::v1::SetManyResponse>(
+          [](HashDBService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::hashdb::v1::SetManyRequest* req,
+             ::hashdb::v1::SetManyResponse* resp) {
+               return service->SetMany(ctx, req, resp);
+             }, this)));
+  AddMethod(new ::grpc::internal::RpcServiceMethod(
+      HashDBService_method_names[19],
+      ::grpc::internal::RpcMethod::NORMAL_RPC,
+      new ::grpc::internal::RpcMethodHandler< HashDBService::Service, ::hashdb::v1::GetManyRequest, ::hashdb::v1::GetManyResponse>(
+          [](HashDBService::Service* service,
+             ::grpc_impl::ServerContext* ctx,
+             const ::hashdb::v1::GetManyRequest* req,
+             ::hashdb::v1::GetManyResponse* resp) {
+               return service->GetMany(ctx, req, resp);
+             }, this)));
 }
 
 HashDBService::Service::~Service() {
@@ -886,6 +966,20 @@ HashDBService::Service::~Service() {
   return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
 }
 
+::grpc::Status HashDBService::Service::SetMany(::grpc::ServerContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
+::grpc::Status HashDBService::Service::GetMany(::grpc::ServerContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response) {
+  (void) context;
+  (void) request;
+  (void) response;
+  return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+}
+
 
 }  // namespace hashdb
 }  // namespace v1
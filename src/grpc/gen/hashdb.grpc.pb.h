@@ -35,6 +35,8 @@ namespace v1 {
 // Define all methods implementes by the gRPC
 // Get: get the value for a specific key
 // Set: set the value for a specific key
+// SetMany: set the values for a list of keys, sharing the tree descent
+// GetMany: get the values for a list of keys, sharing the tree descent
 // SetProgram: set the byte data for a specific key
 // GetProgram: get the byte data for a specific key
 // Flush: wait for all the pendings writes to the DB are done
@@ -172,6 +174,20 @@ class HashDBService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::ResetDBResponse>> PrepareAsyncResetDB(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::ResetDBResponse>>(PrepareAsyncResetDBRaw(context, request, cq));
     }
+    virtual ::grpc::Status SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::hashdb::v1::SetManyResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::SetManyResponse>> AsyncSetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::SetManyResponse>>(AsyncSetManyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::SetManyResponse>> PrepareAsyncSetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::SetManyResponse>>(PrepareAsyncSetManyRaw(context, request, cq));
+    }
+    virtual ::grpc::Status GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::hashdb::v1::GetManyResponse* response) = 0;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::GetManyResponse>> AsyncGetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::GetManyResponse>>(AsyncGetManyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::GetManyResponse>> PrepareAsyncGetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::GetManyResponse>>(PrepareAsyncGetManyRaw(context, request, cq));
+    }
     class experimental_async_interface {
      public:
       virtual ~experimental_async_interface() {}
@@ -391,6 +407,30 @@ class HashDBService final {
       #else
       virtual void ResetDB(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::ResetDBResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
       #endif
+      virtual void SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      virtual void GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, std::function<void(::grpc::Status)>) = 0;
+      virtual void GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, std::function<void(::grpc::Status)>) = 0;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      virtual void GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) = 0;
+      #else
+      virtual void GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) = 0;
+      #endif
     };
     #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
     typedef class experimental_async_interface async_interface;
@@ -436,6 +476,10 @@ class HashDBService final {
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::CancelBatchResponse>* PrepareAsyncCancelBatchRaw(::grpc::ClientContext* context, const ::hashdb::v1::CancelBatchRequest& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::ResetDBResponse>* AsyncResetDBRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
     virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::ResetDBResponse>* PrepareAsyncResetDBRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::SetManyResponse>* AsyncSetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::SetManyResponse>* PrepareAsyncSetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::GetManyResponse>* AsyncGetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) = 0;
+    virtual ::grpc::ClientAsyncResponseReaderInterface< ::hashdb::v1::GetManyResponse>* PrepareAsyncGetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) = 0;
   };
   class Stub final : public StubInterface {
    public:
@@ -566,6 +610,20 @@ class HashDBService final {
     std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::ResetDBResponse>> PrepareAsyncResetDB(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) {
       return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::ResetDBResponse>>(PrepareAsyncResetDBRaw(context, request, cq));
     }
+    ::grpc::Status SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::hashdb::v1::SetManyResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>> AsyncSetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>>(AsyncSetManyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>> PrepareAsyncSetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>>(PrepareAsyncSetManyRaw(context, request, cq));
+    }
+    ::grpc::Status GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::hashdb::v1::GetManyResponse* response) override;
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>> AsyncGetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>>(AsyncGetManyRaw(context, request, cq));
+    }
+    std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>> PrepareAsyncGetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) {
+      return std::unique_ptr< ::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>>(PrepareAsyncGetManyRaw(context, request, cq));
+    }
     class experimental_async final :
       public StubInterface::experimental_async_interface {
      public:
@@ -785,6 +843,30 @@ class HashDBService final {
       #else
       void ResetDB(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::ResetDBResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
       #endif
+      void SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, std::function<void(::grpc::Status)>) override;
+      void SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void SetMany(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void SetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::SetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      void GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, std::function<void(::grpc::Status)>) override;
+      void GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, std::function<void(::grpc::Status)>) override;
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetMany(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
+      #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      void GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, ::grpc::ClientUnaryReactor* reactor) override;
+      #else
+      void GetMany(::grpc::ClientContext* context, const ::grpc::ByteBuffer* request, ::hashdb::v1::GetManyResponse* response, ::grpc::experimental::ClientUnaryReactor* reactor) override;
+      #endif
      private:
       friend class Stub;
       explicit experimental_async(Stub* stub): stub_(stub) { }
@@ -832,6 +914,10 @@ class HashDBService final {
     ::grpc::ClientAsyncResponseReader< ::hashdb::v1::CancelBatchResponse>* PrepareAsyncCancelBatchRaw(::grpc::ClientContext* context, const ::hashdb::v1::CancelBatchRequest& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::hashdb::v1::ResetDBResponse>* AsyncResetDBRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
     ::grpc::ClientAsyncResponseReader< ::hashdb::v1::ResetDBResponse>* PrepareAsyncResetDBRaw(::grpc::ClientContext* context, const ::google::protobuf::Empty& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>* AsyncSetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::hashdb::v1::SetManyResponse>* PrepareAsyncSetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::SetManyRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>* AsyncGetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) override;
+    ::grpc::ClientAsyncResponseReader< ::hashdb::v1::GetManyResponse>* PrepareAsyncGetManyRaw(::grpc::ClientContext* context, const ::hashdb::v1::GetManyRequest& request, ::grpc::CompletionQueue* cq) override;
     const ::grpc::internal::RpcMethod rpcmethod_GetLatestStateRoot_;
     const ::grpc::internal::RpcMethod rpcmethod_Set_;
     const ::grpc::internal::RpcMethod rpcmethod_Get_;
@@ -850,6 +936,8 @@ class HashDBService final {
     const ::grpc::internal::RpcMethod rpcmethod_ReadTree_;
     const ::grpc::internal::RpcMethod rpcmethod_CancelBatch_;
     const ::grpc::internal::RpcMethod rpcmethod_ResetDB_;
+    const ::grpc::internal::RpcMethod rpcmethod_SetMany_;
+    const ::grpc::internal::RpcMethod rpcmethod_GetMany_;
   };
   static std::unique_ptr<Stub> NewStub(const std::shared_ptr< ::grpc::ChannelInterface>& channel, const ::grpc::StubOptions& options = ::grpc::StubOptions());
 
@@ -875,6 +963,8 @@ class HashDBService final {
     virtual ::grpc::Status ReadTree(::grpc::ServerContext* context, const ::hashdb::v1::ReadTreeRequest* request, ::hashdb::v1::ReadTreeResponse* response);
     virtual ::grpc::Status CancelBatch(::grpc::ServerContext* context, const ::hashdb::v1::CancelBatchRequest* request, ::hashdb::v1::CancelBatchResponse* response);
     virtual ::grpc::Status ResetDB(::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::hashdb::v1::ResetDBResponse* response);
+    virtual ::grpc::Status SetMany(::grpc::ServerContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response);
+    virtual ::grpc::Status GetMany(::grpc::ServerContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response);
   };
   template <class BaseClass>
   class WithAsyncMethod_GetLatestStateRoot : public BaseClass {
@@ -1236,7 +1326,47 @@ class HashDBService final {
       ::grpc::Service::RequestAsyncUnary(17, context, request, response, new_call_cq, notification_cq, tag);
     }
   };
-  typedef WithAsyncMethod_GetLatestStateRoot<WithAsyncMethod_Set<WithAsyncMethod_Get<WithAsyncMethod_SetProgram<WithAsyncMethod_GetProgram<WithAsyncMethod_LoadDB<WithAsyncMethod_LoadProgramDB<WithAsyncMethod_FinishTx<WithAsyncMethod_StartBlock<WithAsyncMethod_FinishBlock<WithAsyncMethod_Flush<WithAsyncMethod_GetFlushStatus<WithAsyncMethod_GetFlushData<WithAsyncMethod_ConsolidateState<WithAsyncMethod_Purge<WithAsyncMethod_ReadTree<WithAsyncMethod_CancelBatch<WithAsyncMethod_ResetDB<Service > > > > > > > > > > > > > > > > > > AsyncService;
+  template <class BaseClass>
+  class WithAsyncMethod_SetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_SetMany() {
+      ::grpc::Service::MarkMethodAsync(18);
+    }
+    ~WithAsyncMethod_SetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetMany(::grpc::ServerContext* context, ::hashdb::v1::SetManyRequest* request, ::grpc::ServerAsyncResponseWriter< ::hashdb::v1::SetManyResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithAsyncMethod_GetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithAsyncMethod_GetMany() {
+      ::grpc::Service::MarkMethodAsync(19);
+    }
+    ~WithAsyncMethod_GetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMany(::grpc::ServerContext* context, ::hashdb::v1::GetManyRequest* request, ::grpc::ServerAsyncResponseWriter< ::hashdb::v1::GetManyResponse>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  typedef WithAsyncMethod_GetLatestStateRoot<WithAsyncMethod_Set<WithAsyncMethod_Get<WithAsyncMethod_SetProgram<WithAsyncMethod_GetProgram<WithAsyncMethod_LoadDB<WithAsyncMethod_LoadProgramDB<WithAsyncMethod_FinishTx<WithAsyncMethod_StartBlock<WithAsyncMethod_FinishBlock<WithAsyncMethod_Flush<WithAsyncMethod_GetFlushStatus<WithAsyncMethod_GetFlushData<WithAsyncMethod_ConsolidateState<WithAsyncMethod_Purge<WithAsyncMethod_ReadTree<WithAsyncMethod_CancelBatch<WithAsyncMethod_ResetDB<WithAsyncMethod_SetMany<WithAsyncMethod_GetMany<Service > > > > > > > > > > > > > > > > > > > > AsyncService;
   template <class BaseClass>
   class ExperimentalWithCallbackMethod_GetLatestStateRoot : public BaseClass {
    private:
@@ -2083,11 +2213,105 @@ class HashDBService final {
     #endif
       { return nullptr; }
   };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_SetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_SetMany() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(18,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::hashdb::v1::SetManyRequest, ::hashdb::v1::SetManyResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response) { return this->SetMany(context, request, response); }));}
+    void SetMessageAllocatorFor_SetMany(
+        ::grpc::experimental::MessageAllocator< ::hashdb::v1::SetManyRequest, ::hashdb::v1::SetManyResponse>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(18);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(18);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::hashdb::v1::SetManyRequest, ::hashdb::v1::SetManyResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_SetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* SetMany(
+      ::grpc::CallbackServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* SetMany(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithCallbackMethod_GetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithCallbackMethod_GetMany() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodCallback(19,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::hashdb::v1::GetManyRequest, ::hashdb::v1::GetManyResponse>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response) { return this->GetMany(context, request, response); }));}
+    void SetMessageAllocatorFor_GetMany(
+        ::grpc::experimental::MessageAllocator< ::hashdb::v1::GetManyRequest, ::hashdb::v1::GetManyResponse>* allocator) {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::GetHandler(19);
+    #else
+      ::grpc::internal::MethodHandler* const handler = ::grpc::Service::experimental().GetHandler(19);
+    #endif
+      static_cast<::grpc_impl::internal::CallbackUnaryHandler< ::hashdb::v1::GetManyRequest, ::hashdb::v1::GetManyResponse>*>(handler)
+              ->SetMessageAllocator(allocator);
+    }
+    ~ExperimentalWithCallbackMethod_GetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetMany(
+      ::grpc::CallbackServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetMany(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/)
+    #endif
+      { return nullptr; }
+  };
   #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
-  typedef ExperimentalWithCallbackMethod_GetLatestStateRoot<ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_LoadDB<ExperimentalWithCallbackMethod_LoadProgramDB<ExperimentalWithCallbackMethod_FinishTx<ExperimentalWithCallbackMethod_StartBlock<ExperimentalWithCallbackMethod_FinishBlock<ExperimentalWithCallbackMethod_Flush<ExperimentalWithCallbackMethod_GetFlushStatus<ExperimentalWithCallbackMethod_GetFlushData<ExperimentalWithCallbackMethod_ConsolidateState<ExperimentalWithCallbackMethod_Purge<ExperimentalWithCallbackMethod_ReadTree<ExperimentalWithCallbackMethod_CancelBatch<ExperimentalWithCallbackMethod_ResetDB<Service > > > > > > > > > > > > > > > > > > CallbackService;
+  typedef ExperimentalWithCallbackMethod_GetLatestStateRoot<ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_LoadDB<ExperimentalWithCallbackMethod_LoadProgramDB<ExperimentalWithCallbackMethod_FinishTx<ExperimentalWithCallbackMethod_StartBlock<ExperimentalWithCallbackMethod_FinishBlock<ExperimentalWithCallbackMethod_Flush<ExperimentalWithCallbackMethod_GetFlushStatus<ExperimentalWithCallbackMethod_GetFlushData<ExperimentalWithCallbackMethod_ConsolidateState<ExperimentalWithCallbackMethod_Purge<ExperimentalWithCallbackMethod_ReadTree<ExperimentalWithCallbackMethod_CancelBatch<ExperimentalWithCallbackMethod_ResetDB<ExperimentalWithCallbackMethod_SetMany<ExperimentalWithCallbackMethod_GetMany<Service > > > > > > > > > > > > > > > > > > > > CallbackService;
   #endif
 
-  typedef ExperimentalWithCallbackMethod_GetLatestStateRoot<ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_LoadDB<ExperimentalWithCallbackMethod_LoadProgramDB<ExperimentalWithCallbackMethod_FinishTx<ExperimentalWithCallbackMethod_StartBlock<ExperimentalWithCallbackMethod_FinishBlock<ExperimentalWithCallbackMethod_Flush<ExperimentalWithCallbackMethod_GetFlushStatus<ExperimentalWithCallbackMethod_GetFlushData<ExperimentalWithCallbackMethod_ConsolidateState<ExperimentalWithCallbackMethod_Purge<ExperimentalWithCallbackMethod_ReadTree<ExperimentalWithCallbackMethod_CancelBatch<ExperimentalWithCallbackMethod_ResetDB<Service > > > > > > > > > > > > > > > > > > ExperimentalCallbackService;
+  typedef ExperimentalWithCallbackMethod_GetLatestStateRoot<ExperimentalWithCallbackMethod_Set<ExperimentalWithCallbackMethod_Get<ExperimentalWithCallbackMethod_SetProgram<ExperimentalWithCallbackMethod_GetProgram<ExperimentalWithCallbackMethod_LoadDB<ExperimentalWithCallbackMethod_LoadProgramDB<ExperimentalWithCallbackMethod_FinishTx<ExperimentalWithCallbackMethod_StartBlock<ExperimentalWithCallbackMethod_FinishBlock<ExperimentalWithCallbackMethod_Flush<ExperimentalWithCallbackMethod_GetFlushStatus<ExperimentalWithCallbackMethod_GetFlushData<ExperimentalWithCallbackMethod_ConsolidateState<ExperimentalWithCallbackMethod_Purge<ExperimentalWithCallbackMethod_ReadTree<ExperimentalWithCallbackMethod_CancelBatch<ExperimentalWithCallbackMethod_ResetDB<ExperimentalWithCallbackMethod_SetMany<ExperimentalWithCallbackMethod_GetMany<Service > > > > > > > > > > > > > > > > > > > > ExperimentalCallbackService;
   template <class BaseClass>
   class WithGenericMethod_GetLatestStateRoot : public BaseClass {
    private:
@@ -2395,6 +2619,40 @@ class HashDBService final {
     }
   };
   template <class BaseClass>
+  class WithGenericMethod_SetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_SetMany() {
+      ::grpc::Service::MarkMethodGeneric(18);
+    }
+    ~WithGenericMethod_SetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
+  class WithGenericMethod_GetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithGenericMethod_GetMany() {
+      ::grpc::Service::MarkMethodGeneric(19);
+    }
+    ~WithGenericMethod_GetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+  };
+  template <class BaseClass>
   class WithRawMethod_GetLatestStateRoot : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -2755,6 +3013,46 @@ class HashDBService final {
     }
   };
   template <class BaseClass>
+  class WithRawMethod_SetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_SetMany() {
+      ::grpc::Service::MarkMethodRaw(18);
+    }
+    ~WithRawMethod_SetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestSetMany(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(18, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
+  class WithRawMethod_GetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithRawMethod_GetMany() {
+      ::grpc::Service::MarkMethodRaw(19);
+    }
+    ~WithRawMethod_GetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    void RequestGetMany(::grpc::ServerContext* context, ::grpc::ByteBuffer* request, ::grpc::ServerAsyncResponseWriter< ::grpc::ByteBuffer>* response, ::grpc::CompletionQueue* new_call_cq, ::grpc::ServerCompletionQueue* notification_cq, void *tag) {
+      ::grpc::Service::RequestAsyncUnary(19, context, request, response, new_call_cq, notification_cq, tag);
+    }
+  };
+  template <class BaseClass>
   class ExperimentalWithRawCallbackMethod_GetLatestStateRoot : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -3439,6 +3737,82 @@ class HashDBService final {
       { return nullptr; }
   };
   template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_SetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_SetMany() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(18,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->SetMany(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_SetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status SetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* SetMany(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* SetMany(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
+  class ExperimentalWithRawCallbackMethod_GetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    ExperimentalWithRawCallbackMethod_GetMany() {
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+      ::grpc::Service::
+    #else
+      ::grpc::Service::experimental().
+    #endif
+        MarkMethodRawCallback(19,
+          new ::grpc_impl::internal::CallbackUnaryHandler< ::grpc::ByteBuffer, ::grpc::ByteBuffer>(
+            [this](
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+                   ::grpc::CallbackServerContext*
+    #else
+                   ::grpc::experimental::CallbackServerContext*
+    #endif
+                     context, const ::grpc::ByteBuffer* request, ::grpc::ByteBuffer* response) { return this->GetMany(context, request, response); }));
+    }
+    ~ExperimentalWithRawCallbackMethod_GetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable synchronous version of this method
+    ::grpc::Status GetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    #ifdef GRPC_CALLBACK_API_NONEXPERIMENTAL
+    virtual ::grpc::ServerUnaryReactor* GetMany(
+      ::grpc::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #else
+    virtual ::grpc::experimental::ServerUnaryReactor* GetMany(
+      ::grpc::experimental::CallbackServerContext* /*context*/, const ::grpc::ByteBuffer* /*request*/, ::grpc::ByteBuffer* /*response*/)
+    #endif
+      { return nullptr; }
+  };
+  template <class BaseClass>
   class WithStreamedUnaryMethod_GetLatestStateRoot : public BaseClass {
    private:
     void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
@@ -3924,9 +4298,63 @@ class HashDBService final {
     // replace default version of method with streamed unary
     virtual ::grpc::Status StreamedResetDB(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::google::protobuf::Empty,::hashdb::v1::ResetDBResponse>* server_unary_streamer) = 0;
   };
-  typedef WithStreamedUnaryMethod_GetLatestStateRoot<WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_LoadDB<WithStreamedUnaryMethod_LoadProgramDB<WithStreamedUnaryMethod_FinishTx<WithStreamedUnaryMethod_StartBlock<WithStreamedUnaryMethod_FinishBlock<WithStreamedUnaryMethod_Flush<WithStreamedUnaryMethod_GetFlushStatus<WithStreamedUnaryMethod_GetFlushData<WithStreamedUnaryMethod_ConsolidateState<WithStreamedUnaryMethod_Purge<WithStreamedUnaryMethod_ReadTree<WithStreamedUnaryMethod_CancelBatch<WithStreamedUnaryMethod_ResetDB<Service > > > > > > > > > > > > > > > > > > StreamedUnaryService;
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_SetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_SetMany() {
+      ::grpc::Service::MarkMethodStreamed(18,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::hashdb::v1::SetManyRequest, ::hashdb::v1::SetManyResponse>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::hashdb::v1::SetManyRequest, ::hashdb::v1::SetManyResponse>* streamer) {
+                       return this->StreamedSetMany(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_SetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status SetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::SetManyRequest* /*request*/, ::hashdb::v1::SetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedSetMany(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::hashdb::v1::SetManyRequest,::hashdb::v1::SetManyResponse>* server_unary_streamer) = 0;
+  };
+  template <class BaseClass>
+  class WithStreamedUnaryMethod_GetMany : public BaseClass {
+   private:
+    void BaseClassMustBeDerivedFromService(const Service* /*service*/) {}
+   public:
+    WithStreamedUnaryMethod_GetMany() {
+      ::grpc::Service::MarkMethodStreamed(19,
+        new ::grpc::internal::StreamedUnaryHandler<
+          ::hashdb::v1::GetManyRequest, ::hashdb::v1::GetManyResponse>(
+            [this](::grpc_impl::ServerContext* context,
+                   ::grpc_impl::ServerUnaryStreamer<
+                     ::hashdb::v1::GetManyRequest, ::hashdb::v1::GetManyResponse>* streamer) {
+                       return this->StreamedGetMany(context,
+                         streamer);
+                  }));
+    }
+    ~WithStreamedUnaryMethod_GetMany() override {
+      BaseClassMustBeDerivedFromService(this);
+    }
+    // disable regular version of this method
+    ::grpc::Status GetMany(::grpc::ServerContext* /*context*/, const ::hashdb::v1::GetManyRequest* /*request*/, ::hashdb::v1::GetManyResponse* /*response*/) override {
+      abort();
+      return ::grpc::Status(::grpc::StatusCode::UNIMPLEMENTED, "");
+    }
+    // replace default version of method with streamed unary
+    virtual ::grpc::Status StreamedGetMany(::grpc::ServerContext* context, ::grpc::ServerUnaryStreamer< ::hashdb::v1::GetManyRequest,::hashdb::v1::GetManyResponse>* server_unary_streamer) = 0;
+  };
+  typedef WithStreamedUnaryMethod_GetLatestStateRoot<WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_LoadDB<WithStreamedUnaryMethod_LoadProgramDB<WithStreamedUnaryMethod_FinishTx<WithStreamedUnaryMethod_StartBlock<WithStreamedUnaryMethod_FinishBlock<WithStreamedUnaryMethod_Flush<WithStreamedUnaryMethod_GetFlushStatus<WithStreamedUnaryMethod_GetFlushData<WithStreamedUnaryMethod_ConsolidateState<WithStreamedUnaryMethod_Purge<WithStreamedUnaryMethod_ReadTree<WithStreamedUnaryMethod_CancelBatch<WithStreamedUnaryMethod_ResetDB<WithStreamedUnaryMethod_SetMany<WithStreamedUnaryMethod_GetMany<Service > > > > > > > > > > > > > > > > > > > > StreamedUnaryService;
   typedef Service SplitStreamedService;
-  typedef WithStreamedUnaryMethod_GetLatestStateRoot<WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_LoadDB<WithStreamedUnaryMethod_LoadProgramDB<WithStreamedUnaryMethod_FinishTx<WithStreamedUnaryMethod_StartBlock<WithStreamedUnaryMethod_FinishBlock<WithStreamedUnaryMethod_Flush<WithStreamedUnaryMethod_GetFlushStatus<WithStreamedUnaryMethod_GetFlushData<WithStreamedUnaryMethod_ConsolidateState<WithStreamedUnaryMethod_Purge<WithStreamedUnaryMethod_ReadTree<WithStreamedUnaryMethod_CancelBatch<WithStreamedUnaryMethod_ResetDB<Service > > > > > > > > > > > > > > > > > > StreamedService;
+  typedef WithStreamedUnaryMethod_GetLatestStateRoot<WithStreamedUnaryMethod_Set<WithStreamedUnaryMethod_Get<WithStreamedUnaryMethod_SetProgram<WithStreamedUnaryMethod_GetProgram<WithStreamedUnaryMethod_LoadDB<WithStreamedUnaryMethod_LoadProgramDB<WithStreamedUnaryMethod_FinishTx<WithStreamedUnaryMethod_StartBlock<WithStreamedUnaryMethod_FinishBlock<WithStreamedUnaryMethod_Flush<WithStreamedUnaryMethod_GetFlushStatus<WithStreamedUnaryMethod_GetFlushData<WithStreamedUnaryMethod_ConsolidateState<WithStreamedUnaryMethod_Purge<WithStreamedUnaryMethod_ReadTree<WithStreamedUnaryMethod_CancelBatch<WithStreamedUnaryMethod_ResetDB<WithStreamedUnaryMethod_SetMany<WithStreamedUnaryMethod_GetMany<Service > > > > > > > > > > > > > > > > > > > > StreamedService;
 };
 
 }  // namespace v1
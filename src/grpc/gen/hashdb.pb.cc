@@ -19,6 +19,8 @@ extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Fea12_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetFlushDataResponse_NodesEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_GetFlushDataResponse_ProgramEntry_DoNotUse_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_GetResponse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetResponse_SiblingsEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_HashValueGL_hashdb_2eproto;
@@ -26,6 +28,8 @@ extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_LoadDBRequest_InputDbEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_LoadProgramDBRequest_InputProgramDbEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ResultCode_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto;
+extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_SetResponse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetResponse_SiblingsEntry_DoNotUse_hashdb_2eproto;
 extern PROTOBUF_INTERNAL_EXPORT_hashdb_2eproto ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_SiblingList_hashdb_2eproto;
@@ -207,6 +211,30 @@ class ResultCodeDefaultTypeInternal {
  public:
   ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<ResultCode> _instance;
 } _ResultCode_default_instance_;
+class SetManyRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetManyRequest> _instance;
+} _SetManyRequest_default_instance_;
+class GetManyRequestDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetManyRequest> _instance;
+} _GetManyRequest_default_instance_;
+class SetManyResponse_DbReadLogEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetManyResponse_DbReadLogEntry_DoNotUse> _instance;
+} _SetManyResponse_DbReadLogEntry_DoNotUse_default_instance_;
+class SetManyResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<SetManyResponse> _instance;
+} _SetManyResponse_default_instance_;
+class GetManyResponse_DbReadLogEntry_DoNotUseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetManyResponse_DbReadLogEntry_DoNotUse> _instance;
+} _GetManyResponse_DbReadLogEntry_DoNotUse_default_instance_;
+class GetManyResponseDefaultTypeInternal {
+ public:
+  ::PROTOBUF_NAMESPACE_ID::internal::ExplicitlyConstructed<GetManyResponse> _instance;
+} _GetManyResponse_default_instance_;
 }  // namespace v1
 }  // namespace hashdb
 static void InitDefaultsscc_info_CancelBatchRequest_hashdb_2eproto() {
@@ -455,6 +483,52 @@ static void InitDefaultsscc_info_GetLatestStateRootResponse_hashdb_2eproto() {
       &scc_info_Fea_hashdb_2eproto.base,
       &scc_info_ResultCode_hashdb_2eproto.base,}};
 
+static void InitDefaultsscc_info_GetManyRequest_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_GetManyRequest_default_instance_;
+    new (ptr) ::hashdb::v1::GetManyRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::GetManyRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetManyRequest_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetManyRequest_hashdb_2eproto}, {
+      &scc_info_Fea_hashdb_2eproto.base,}};
+
+static void InitDefaultsscc_info_GetManyResponse_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_GetManyResponse_default_instance_;
+    new (ptr) ::hashdb::v1::GetManyResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::GetManyResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<3> scc_info_GetManyResponse_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 3, 0, InitDefaultsscc_info_GetManyResponse_hashdb_2eproto}, {
+      &scc_info_GetResponse_hashdb_2eproto.base,
+      &scc_info_GetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto.base,
+      &scc_info_ResultCode_hashdb_2eproto.base,}};
+
+static void InitDefaultsscc_info_GetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_GetManyResponse_DbReadLogEntry_DoNotUse_default_instance_;
+    new (ptr) ::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse();
+  }
+  ::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_GetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_GetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto}, {
+      &scc_info_FeList_hashdb_2eproto.base,}};
+
 static void InitDefaultsscc_info_GetProgramRequest_hashdb_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -726,6 +800,54 @@ static void InitDefaultsscc_info_ResultCode_hashdb_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_ResultCode_hashdb_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_ResultCode_hashdb_2eproto}, {}};
 
+static void InitDefaultsscc_info_SetManyRequest_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_SetManyRequest_default_instance_;
+    new (ptr) ::hashdb::v1::SetManyRequest();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::SetManyRequest::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<2> scc_info_SetManyRequest_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 2, 0, InitDefaultsscc_info_SetManyRequest_hashdb_2eproto}, {
+      &scc_info_Fea_hashdb_2eproto.base,
+      &scc_info_KeyValue_hashdb_2eproto.base,}};
+
+static void InitDefaultsscc_info_SetManyResponse_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_SetManyResponse_default_instance_;
+    new (ptr) ::hashdb::v1::SetManyResponse();
+    ::PROTOBUF_NAMESPACE_ID::internal::OnShutdownDestroyMessage(ptr);
+  }
+  ::hashdb::v1::SetManyResponse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<4> scc_info_SetManyResponse_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 4, 0, InitDefaultsscc_info_SetManyResponse_hashdb_2eproto}, {
+      &scc_info_Fea_hashdb_2eproto.base,
+      &scc_info_SetResponse_hashdb_2eproto.base,
+      &scc_info_SetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto.base,
+      &scc_info_ResultCode_hashdb_2eproto.base,}};
+
+static void InitDefaultsscc_info_SetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto() {
+  GOOGLE_PROTOBUF_VERIFY_VERSION;
+
+  {
+    void* ptr = &::hashdb::v1::_SetManyResponse_DbReadLogEntry_DoNotUse_default_instance_;
+    new (ptr) ::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse();
+  }
+  ::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse::InitAsDefaultInstance();
+}
+
+::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<1> scc_info_SetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto =
+    {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 1, 0, InitDefaultsscc_info_SetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto}, {
+      &scc_info_FeList_hashdb_2eproto.base,}};
+
 static void InitDefaultsscc_info_SetProgramRequest_hashdb_2eproto() {
   GOOGLE_PROTOBUF_VERIFY_VERSION;
 
@@ -859,7 +981,7 @@ static void InitDefaultsscc_info_Version_hashdb_2eproto() {
 ::PROTOBUF_NAMESPACE_ID::internal::SCCInfo<0> scc_info_Version_hashdb_2eproto =
     {{ATOMIC_VAR_INIT(::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase::kUninitialized), 0, 0, InitDefaultsscc_info_Version_hashdb_2eproto}, {}};
 
-static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_hashdb_2eproto[44];
+static ::PROTOBUF_NAMESPACE_ID::Metadata file_level_metadata_hashdb_2eproto[50];
 static const ::PROTOBUF_NAMESPACE_ID::EnumDescriptor* file_level_enum_descriptors_hashdb_2eproto[2];
 static constexpr ::PROTOBUF_NAMESPACE_ID::ServiceDescriptor const** file_level_service_descriptors_hashdb_2eproto = nullptr;
 
@@ -1244,6 +1366,64 @@ const ::PROTOBUF_NAMESPACE_ID::uint32 TableStruct_hashdb_2eproto::offsets[] PROT
   ~0u,  // no _oneof_case_
   ~0u,  // no _weak_field_map_
   PROTOBUF_FIELD_OFFSET(::hashdb::v1::ResultCode, code_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, old_root_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, key_value_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, persistence_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, details_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, get_db_read_log_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, batch_uuid_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, tx_index_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyRequest, block_index_),
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyRequest, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyRequest, root_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyRequest, key_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyRequest, details_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyRequest, get_db_read_log_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyRequest, batch_uuid_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse, new_root_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse, set_response_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse, db_read_log_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::SetManyResponse, result_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse, _has_bits_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse, key_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse, value_),
+  0,
+  1,
+  ~0u,  // no _has_bits_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse, _internal_metadata_),
+  ~0u,  // no _extensions_
+  ~0u,  // no _oneof_case_
+  ~0u,  // no _weak_field_map_
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse, get_response_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse, db_read_log_),
+  PROTOBUF_FIELD_OFFSET(::hashdb::v1::GetManyResponse, result_),
 };
 static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) = {
   { 0, -1, sizeof(::hashdb::v1::Version)},
@@ -1290,6 +1470,12 @@ static const ::PROTOBUF_NAMESPACE_ID::internal::MigrationSchema schemas[] PROTOB
   { 362, -1, sizeof(::hashdb::v1::FeList)},
   { 368, -1, sizeof(::hashdb::v1::SiblingList)},
   { 374, -1, sizeof(::hashdb::v1::ResultCode)},
+  { 380, -1, sizeof(::hashdb::v1::SetManyRequest)},
+  { 393, -1, sizeof(::hashdb::v1::GetManyRequest)},
+  { 403, 410, sizeof(::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse)},
+  { 412, -1, sizeof(::hashdb::v1::SetManyResponse)},
+  { 421, 428, sizeof(::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse)},
+  { 430, -1, sizeof(::hashdb::v1::GetManyResponse)},
 };
 
 static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] = {
@@ -1337,6 +1523,12 @@ static ::PROTOBUF_NAMESPACE_ID::Message const * const file_default_instances[] =
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_FeList_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SiblingList_default_instance_),
   reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_ResultCode_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetManyRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetManyRequest_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetManyResponse_DbReadLogEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_SetManyResponse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetManyResponse_DbReadLogEntry_DoNotUse_default_instance_),
+  reinterpret_cast<const ::PROTOBUF_NAMESPACE_ID::Message*>(&::hashdb::v1::_GetManyResponse_default_instance_),
 };
 
 const char descriptor_table_protodef_hashdb_2eproto[] PROTOBUF_SECTION_VARIABLE(protodesc_cold) =
@@ -1466,49 +1658,75 @@ const char descriptor_table_protodef_hashdb_2eproto[] PROTOBUF_SECTION_VARIABLE(
   "NSPECIFIED\020\000\022\020\n\014CODE_SUCCESS\020\001\022\031\n\025CODE_D"
   "B_KEY_NOT_FOUND\020\002\022\021\n\rCODE_DB_ERROR\020\003\022\027\n\023"
   "CODE_INTERNAL_ERROR\020\004\022\036\n\032CODE_SMT_INVALI"
-  "D_DATA_SIZE\020\016*e\n\013Persistence\022!\n\035PERSISTE"
-  "NCE_CACHE_UNSPECIFIED\020\000\022\030\n\024PERSISTENCE_D"
-  "ATABASE\020\001\022\031\n\025PERSISTENCE_TEMPORARY\020\0022\237\n\n"
-  "\rHashDBService\022U\n\022GetLatestStateRoot\022\026.g"
-  "oogle.protobuf.Empty\032%.hashdb.v1.GetLate"
-  "stStateRootResponse\"\000\0226\n\003Set\022\025.hashdb.v1"
-  ".SetRequest\032\026.hashdb.v1.SetResponse\"\000\0226\n"
-  "\003Get\022\025.hashdb.v1.GetRequest\032\026.hashdb.v1."
-  "GetResponse\"\000\022K\n\nSetProgram\022\034.hashdb.v1."
-  "SetProgramRequest\032\035.hashdb.v1.SetProgram"
-  "Response\"\000\022K\n\nGetProgram\022\034.hashdb.v1.Get"
-  "ProgramRequest\032\035.hashdb.v1.GetProgramRes"
-  "ponse\"\000\022<\n\006LoadDB\022\030.hashdb.v1.LoadDBRequ"
-  "est\032\026.google.protobuf.Empty\"\000\022J\n\rLoadPro"
-  "gramDB\022\037.hashdb.v1.LoadProgramDBRequest\032"
-  "\026.google.protobuf.Empty\"\000\022@\n\010FinishTx\022\032."
-  "hashdb.v1.FinishTxRequest\032\026.google.proto"
-  "buf.Empty\"\000\022D\n\nStartBlock\022\034.hashdb.v1.St"
-  "artBlockRequest\032\026.google.protobuf.Empty\""
-  "\000\022F\n\013FinishBlock\022\035.hashdb.v1.FinishBlock"
-  "Request\032\026.google.protobuf.Empty\"\000\022<\n\005Flu"
-  "sh\022\027.hashdb.v1.FlushRequest\032\030.hashdb.v1."
-  "FlushResponse\"\000\022M\n\016GetFlushStatus\022\026.goog"
-  "le.protobuf.Empty\032!.hashdb.v1.GetFlushSt"
-  "atusResponse\"\000\022Q\n\014GetFlushData\022\036.hashdb."
-  "v1.GetFlushDataRequest\032\037.hashdb.v1.GetFl"
-  "ushDataResponse\"\000\022]\n\020ConsolidateState\022\"."
-  "hashdb.v1.ConsolidateStateRequest\032#.hash"
-  "db.v1.ConsolidateStateResponse\"\000\022<\n\005Purg"
-  "e\022\027.hashdb.v1.PurgeRequest\032\030.hashdb.v1.P"
-  "urgeResponse\"\000\022E\n\010ReadTree\022\032.hashdb.v1.R"
-  "eadTreeRequest\032\033.hashdb.v1.ReadTreeRespo"
-  "nse\"\000\022N\n\013CancelBatch\022\035.hashdb.v1.CancelB"
-  "atchRequest\032\036.hashdb.v1.CancelBatchRespo"
-  "nse\"\000\022\?\n\007ResetDB\022\026.google.protobuf.Empty"
-  "\032\032.hashdb.v1.ResetDBResponse\"\000B9Z7github"
-  ".com/0xPolygonHermez/zkevm-node/merkletr"
-  "ee/hashdbb\006proto3"
+  "D_DATA_SIZE\020\016\"\354\001\n\016SetManyRequest\022 \n\010old_"
+  "root\030\001 \001(\0132\016.hashdb.v1.Fea\022&\n\tkey_value\030"
+  "\002 \003(\0132\023.hashdb.v1.KeyValue\022+\n\013persistenc"
+  "e\030\003 \001(\0162\026.hashdb.v1.Persistence\022\017\n\007detai"
+  "ls\030\004 \001(\010\022\027\n\017get_db_read_log\030\005 \001(\010\022\022\n\nbat"
+  "ch_uuid\030\006 \001(\t\022\020\n\010tx_index\030\007 \001(\004\022\023\n\013block"
+  "_index\030\010 \001(\004\"\211\001\n\016GetManyRequest\022\034\n\004root\030"
+  "\001 \001(\0132\016.hashdb.v1.Fea\022\033\n\003key\030\002 \003(\0132\016.has"
+  "hdb.v1.Fea\022\017\n\007details\030\003 \001(\010\022\027\n\017get_db_re"
+  "ad_log\030\004 \001(\010\022\022\n\nbatch_uuid\030\005 \001(\t\"\215\002\n\017Set"
+  "ManyResponse\022 \n\010new_root\030\001 \001(\0132\016.hashdb."
+  "v1.Fea\022,\n\014set_response\030\002 \003(\0132\026.hashdb.v1"
+  ".SetResponse\022>\n\013db_read_log\030\003 \003(\0132).hash"
+  "db.v1.SetManyResponse.DbReadLogEntry\022%\n\006"
+  "result\030\004 \001(\0132\025.hashdb.v1.ResultCode\032C\n\016D"
+  "bReadLogEntry\022\013\n\003key\030\001 \001(\t\022 \n\005value\030\002 \001("
+  "\0132\021.hashdb.v1.FeList:\0028\001\"\353\001\n\017GetManyResp"
+  "onse\022,\n\014get_response\030\001 \003(\0132\026.hashdb.v1.G"
+  "etResponse\022>\n\013db_read_log\030\002 \003(\0132).hashdb"
+  ".v1.GetManyResponse.DbReadLogEntry\022%\n\006re"
+  "sult\030\003 \001(\0132\025.hashdb.v1.ResultCode\032C\n\016DbR"
+  "eadLogEntry\022\013\n\003key\030\001 \001(\t\022 \n\005value\030\002 \001(\0132"
+  "\021.hashdb.v1.FeList:\0028\001*e\n\013Persistence\022!\n"
+  "\035PERSISTENCE_CACHE_UNSPECIFIED\020\000\022\030\n\024PERS"
+  "ISTENCE_DATABASE\020\001\022\031\n\025PERSISTENCE_TEMPOR"
+  "ARY\020\0022\247\013\n\rHashDBService\022U\n\022GetLatestStat"
+  "eRoot\022\026.google.protobuf.Empty\032%.hashdb.v"
+  "1.GetLatestStateRootResponse\"\000\0226\n\003Set\022\025."
+  "hashdb.v1.SetRequest\032\026.hashdb.v1.SetResp"
+  "onse\"\000\0226\n\003Get\022\025.hashdb.v1.GetRequest\032\026.h"
+  "ashdb.v1.GetResponse\"\000\022K\n\nSetProgram\022\034.h"
+  "ashdb.v1.SetProgramRequest\032\035.hashdb.v1.S"
+  "etProgramResponse\"\000\022K\n\nGetProgram\022\034.hash"
+  "db.v1.GetProgramRequest\032\035.hashdb.v1.GetP"
+  "rogramResponse\"\000\022<\n\006LoadDB\022\030.hashdb.v1.L"
+  "oadDBRequest\032\026.google.protobuf.Empty\"\000\022J"
+  "\n\rLoadProgramDB\022\037.hashdb.v1.LoadProgramD"
+  "BRequest\032\026.google.protobuf.Empty\"\000\022@\n\010Fi"
+  "nishTx\022\032.hashdb.v1.FinishTxRequest\032\026.goo"
+  "gle.protobuf.Empty\"\000\022D\n\nStartBlock\022\034.has"
+  "hdb.v1.StartBlockRequest\032\026.google.protob"
+  "uf.Empty\"\000\022F\n\013FinishBlock\022\035.hashdb.v1.Fi"
+  "nishBlockRequest\032\026.google.protobuf.Empty"
+  "\"\000\022<\n\005Flush\022\027.hashdb.v1.FlushRequest\032\030.h"
+  "ashdb.v1.FlushResponse\"\000\022M\n\016GetFlushStat"
+  "us\022\026.google.protobuf.Empty\032!.hashdb.v1.G"
+  "etFlushStatusResponse\"\000\022Q\n\014GetFlushData\022"
+  "\036.hashdb.v1.GetFlushDataRequest\032\037.hashdb"
+  ".v1.GetFlushDataResponse\"\000\022]\n\020Consolidat"
+  "eState\022\".hashdb.v1.ConsolidateStateReque"
+  "st\032#.hashdb.v1.ConsolidateStateResponse\""
+  "\000\022<\n\005Purge\022\027.hashdb.v1.PurgeRequest\032\030.ha"
+  "shdb.v1.PurgeResponse\"\000\022E\n\010ReadTree\022\032.ha"
+  "shdb.v1.ReadTreeRequest\032\033.hashdb.v1.Read"
+  "TreeResponse\"\000\022N\n\013CancelBatch\022\035.hashdb.v"
+  "1.CancelBatchRequest\032\036.hashdb.v1.CancelB"
+  "atchResponse\"\000\022\?\n\007ResetDB\022\026.google.proto"
+  "buf.Empty\032\032.hashdb.v1.ResetDBResponse\"\000\022"
+  "B\n\007SetMany\022\031.hashdb.v1.SetManyRequest\032\032."
+  "hashdb.v1.SetManyResponse\"\000\022B\n\007GetMany\022\031"
+  ".hashdb.v1.GetManyRequest\032\032.hashdb.v1.Ge"
+  "tManyResponse\"\000B9Z7github.com/0xPolygonH"
+  "ermez/zkevm-node/merkletree/hashdbb\006prot"
+  "o3"
   ;
 static const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable*const descriptor_table_hashdb_2eproto_deps[1] = {
   &::descriptor_table_google_2fprotobuf_2fempty_2eproto,
 };
-static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_hashdb_2eproto_sccs[44] = {
+static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_hashdb_2eproto_sccs[50] = {
   &scc_info_CancelBatchRequest_hashdb_2eproto.base,
   &scc_info_CancelBatchResponse_hashdb_2eproto.base,
   &scc_info_ConsolidateStateRequest_hashdb_2eproto.base,
@@ -1526,6 +1744,9 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_has
   &scc_info_GetFlushDataResponse_ProgramEntry_DoNotUse_hashdb_2eproto.base,
   &scc_info_GetFlushStatusResponse_hashdb_2eproto.base,
   &scc_info_GetLatestStateRootResponse_hashdb_2eproto.base,
+  &scc_info_GetManyRequest_hashdb_2eproto.base,
+  &scc_info_GetManyResponse_hashdb_2eproto.base,
+  &scc_info_GetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto.base,
   &scc_info_GetProgramRequest_hashdb_2eproto.base,
   &scc_info_GetProgramResponse_hashdb_2eproto.base,
   &scc_info_GetRequest_hashdb_2eproto.base,
@@ -1544,6 +1765,9 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_has
   &scc_info_ReadTreeResponse_hashdb_2eproto.base,
   &scc_info_ResetDBResponse_hashdb_2eproto.base,
   &scc_info_ResultCode_hashdb_2eproto.base,
+  &scc_info_SetManyRequest_hashdb_2eproto.base,
+  &scc_info_SetManyResponse_hashdb_2eproto.base,
+  &scc_info_SetManyResponse_DbReadLogEntry_DoNotUse_hashdb_2eproto.base,
   &scc_info_SetProgramRequest_hashdb_2eproto.base,
   &scc_info_SetProgramResponse_hashdb_2eproto.base,
   &scc_info_SetRequest_hashdb_2eproto.base,
@@ -1556,10 +1780,10 @@ static ::PROTOBUF_NAMESPACE_ID::internal::SCCInfoBase*const descriptor_table_has
 };
 static ::PROTOBUF_NAMESPACE_ID::internal::once_flag descriptor_table_hashdb_2eproto_once;
 const ::PROTOBUF_NAMESPACE_ID::internal::DescriptorTable descriptor_table_hashdb_2eproto = {
-  false, false, descriptor_table_protodef_hashdb_2eproto, "hashdb.proto", 6537,
-  &descriptor_table_hashdb_2eproto_once, descriptor_table_hashdb_2eproto_sccs, descriptor_table_hashdb_2eproto_deps, 44, 1,
+  false, false, descriptor_table_protodef_hashdb_2eproto, "hashdb.proto", 7562,
+  &descriptor_table_hashdb_2eproto_once, descriptor_table_hashdb_2eproto_sccs, descriptor_table_hashdb_2eproto_deps, 50, 1,
   schemas, file_default_instances, TableStruct_hashdb_2eproto::offsets,
-  file_level_metadata_hashdb_2eproto, 44, file_level_enum_descriptors_hashdb_2eproto, file_level_service_descriptors_hashdb_2eproto,
+  file_level_metadata_hashdb_2eproto, 50, file_level_enum_descriptors_hashdb_2eproto, file_level_service_descriptors_hashdb_2eproto,
 };
 
 // Force running AddDescriptors() at dynamic initialization time.
@@ -12570,131 +12794,1592 @@ void ResultCode::InternalSwap(ResultCode* other) {
 }
 
 
-// @@protoc_insertion_point(namespace_scope)
-}  // namespace v1
-}  // namespace hashdb
-PROTOBUF_NAMESPACE_OPEN
-template<> PROTOBUF_NOINLINE ::hashdb::v1::Version* Arena::CreateMaybeMessage< ::hashdb::v1::Version >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::Version >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::SetRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::SetRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::SetProgramRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetProgramRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::SetProgramRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetProgramRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetProgramRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetProgramRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadDBRequest* Arena::CreateMaybeMessage< ::hashdb::v1::LoadDBRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::LoadDBRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadProgramDBRequest* Arena::CreateMaybeMessage< ::hashdb::v1::LoadProgramDBRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::LoadProgramDBRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::FlushRequest* Arena::CreateMaybeMessage< ::hashdb::v1::FlushRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::FlushRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::FinishTxRequest* Arena::CreateMaybeMessage< ::hashdb::v1::FinishTxRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::FinishTxRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::StartBlockRequest* Arena::CreateMaybeMessage< ::hashdb::v1::StartBlockRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::StartBlockRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::FinishBlockRequest* Arena::CreateMaybeMessage< ::hashdb::v1::FinishBlockRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::FinishBlockRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::ConsolidateStateRequest* Arena::CreateMaybeMessage< ::hashdb::v1::ConsolidateStateRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::ConsolidateStateRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::PurgeRequest* Arena::CreateMaybeMessage< ::hashdb::v1::PurgeRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::PurgeRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::ReadTreeRequest* Arena::CreateMaybeMessage< ::hashdb::v1::ReadTreeRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::ReadTreeRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::CancelBatchRequest* Arena::CreateMaybeMessage< ::hashdb::v1::CancelBatchRequest >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::CancelBatchRequest >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetLatestStateRootResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetLatestStateRootResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetLatestStateRootResponse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::SetResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::SetResponse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::SetProgramResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetProgramResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::SetProgramResponse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetProgramResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetProgramResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetProgramResponse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::FlushResponse* Arena::CreateMaybeMessage< ::hashdb::v1::FlushResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::FlushResponse >(arena);
-}
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushStatusResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushStatusResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushStatusResponse >(arena);
+// ===================================================================
+
+void SetManyRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_SetManyRequest_default_instance_._instance.get_mutable()->old_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse >(arena);
+class SetManyRequest::_Internal {
+ public:
+  static const ::hashdb::v1::Fea& old_root(const SetManyRequest* msg);
+};
+
+const ::hashdb::v1::Fea&
+SetManyRequest::_Internal::old_root(const SetManyRequest* msg) {
+  return *msg->old_root_;
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse >(arena);
+SetManyRequest::SetManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  key_value_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetManyRequest)
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataResponse >(arena);
+SetManyRequest::SetManyRequest(const SetManyRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      key_value_(from.key_value_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  if (from._internal_has_old_root()) {
+    old_root_ = new ::hashdb::v1::Fea(*from.old_root_);
+  } else {
+    old_root_ = nullptr;
+  }
+  ::memcpy(&persistence_, &from.persistence_,
+    static_cast<size_t>(reinterpret_cast<char*>(&block_index_) -
+    reinterpret_cast<char*>(&persistence_)) + sizeof(block_index_));
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetManyRequest)
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::ConsolidateStateResponse* Arena::CreateMaybeMessage< ::hashdb::v1::ConsolidateStateResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::ConsolidateStateResponse >(arena);
+
+void SetManyRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetManyRequest_hashdb_2eproto.base);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&old_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&block_index_) -
+      reinterpret_cast<char*>(&old_root_)) + sizeof(block_index_));
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::PurgeResponse* Arena::CreateMaybeMessage< ::hashdb::v1::PurgeResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::PurgeResponse >(arena);
+
+SetManyRequest::~SetManyRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.SetManyRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::ReadTreeResponse* Arena::CreateMaybeMessage< ::hashdb::v1::ReadTreeResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::ReadTreeResponse >(arena);
+
+void SetManyRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete old_root_;
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::CancelBatchResponse* Arena::CreateMaybeMessage< ::hashdb::v1::CancelBatchResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::CancelBatchResponse >(arena);
+
+void SetManyRequest::ArenaDtor(void* object) {
+  SetManyRequest* _this = reinterpret_cast< SetManyRequest* >(object);
+  (void)_this;
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::ResetDBResponse* Arena::CreateMaybeMessage< ::hashdb::v1::ResetDBResponse >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::ResetDBResponse >(arena);
+void SetManyRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::Fea* Arena::CreateMaybeMessage< ::hashdb::v1::Fea >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::Fea >(arena);
+void SetManyRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::Fea12* Arena::CreateMaybeMessage< ::hashdb::v1::Fea12 >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::Fea12 >(arena);
+const SetManyRequest& SetManyRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetManyRequest_hashdb_2eproto.base);
+  return *internal_default_instance();
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::HashValueGL* Arena::CreateMaybeMessage< ::hashdb::v1::HashValueGL >(Arena* arena) {
-  return Arena::CreateMessageInternal< ::hashdb::v1::HashValueGL >(arena);
+
+
+void SetManyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetManyRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  key_value_.Clear();
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && old_root_ != nullptr) {
+    delete old_root_;
+  }
+  old_root_ = nullptr;
+  ::memset(&persistence_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&block_index_) -
+      reinterpret_cast<char*>(&persistence_)) + sizeof(block_index_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
 }
-template<> PROTOBUF_NOINLINE ::hashdb::v1::KeyValue* Arena::CreateMaybeMessage< ::hashdb::v1::KeyValue >(Arena* arena) {
+
+const char* SetManyRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .hashdb.v1.Fea old_root = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_old_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .hashdb.v1.KeyValue key_value = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_key_value(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.Persistence persistence = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          ::PROTOBUF_NAMESPACE_ID::uint64 val = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+          _internal_set_persistence(static_cast<::hashdb::v1::Persistence>(val));
+        } else goto handle_unusual;
+        continue;
+      // bool details = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          details_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool get_db_read_log = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 40)) {
+          get_db_read_log_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string batch_uuid = 6;
+      case 6:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 50)) {
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.SetManyRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 tx_index = 7;
+      case 7:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 56)) {
+          tx_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // uint64 block_index = 8;
+      case 8:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 64)) {
+          block_index_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SetManyRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetManyRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .hashdb.v1.Fea old_root = 1;
+  if (this->has_old_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::old_root(this), target, stream);
+  }
+
+  // repeated .hashdb.v1.KeyValue key_value = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_key_value_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_key_value(i), target, stream);
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteEnumToArray(
+      3, this->_internal_persistence(), target);
+  }
+
+  // bool details = 4;
+  if (this->details() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->_internal_details(), target);
+  }
+
+  // bool get_db_read_log = 5;
+  if (this->get_db_read_log() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(5, this->_internal_get_db_read_log(), target);
+  }
+
+  // string batch_uuid = 6;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.SetManyRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        6, this->_internal_batch_uuid(), target);
+  }
+
+  // uint64 tx_index = 7;
+  if (this->tx_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(7, this->_internal_tx_index(), target);
+  }
+
+  // uint64 block_index = 8;
+  if (this->block_index() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteUInt64ToArray(8, this->_internal_block_index(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetManyRequest)
+  return target;
+}
+
+size_t SetManyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetManyRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.KeyValue key_value = 2;
+  total_size += 1UL * this->_internal_key_value_size();
+  for (const auto& msg : this->key_value_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string batch_uuid = 6;
+  if (this->batch_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
+  }
+
+  // .hashdb.v1.Fea old_root = 1;
+  if (this->has_old_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *old_root_);
+  }
+
+  // .hashdb.v1.Persistence persistence = 3;
+  if (this->persistence() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::EnumSize(this->_internal_persistence());
+  }
+
+  // bool details = 4;
+  if (this->details() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool get_db_read_log = 5;
+  if (this->get_db_read_log() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // uint64 tx_index = 7;
+  if (this->tx_index() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_tx_index());
+  }
+
+  // uint64 block_index = 8;
+  if (this->block_index() != 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::UInt64Size(
+        this->_internal_block_index());
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SetManyRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetManyRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SetManyRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetManyRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetManyRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetManyRequest)
+    MergeFrom(*source);
+  }
+}
+
+void SetManyRequest::MergeFrom(const SetManyRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetManyRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  key_value_.MergeFrom(from.key_value_);
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+  if (from.has_old_root()) {
+    _internal_mutable_old_root()->::hashdb::v1::Fea::MergeFrom(from._internal_old_root());
+  }
+  if (from.persistence() != 0) {
+    _internal_set_persistence(from._internal_persistence());
+  }
+  if (from.details() != 0) {
+    _internal_set_details(from._internal_details());
+  }
+  if (from.get_db_read_log() != 0) {
+    _internal_set_get_db_read_log(from._internal_get_db_read_log());
+  }
+  if (from.tx_index() != 0) {
+    _internal_set_tx_index(from._internal_tx_index());
+  }
+  if (from.block_index() != 0) {
+    _internal_set_block_index(from._internal_block_index());
+  }
+}
+
+void SetManyRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetManyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SetManyRequest::CopyFrom(const SetManyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetManyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetManyRequest::IsInitialized() const {
+  return true;
+}
+
+void SetManyRequest::InternalSwap(SetManyRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  key_value_.InternalSwap(&other->key_value_);
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetManyRequest, block_index_)
+      + sizeof(SetManyRequest::block_index_)
+      - PROTOBUF_FIELD_OFFSET(SetManyRequest, old_root_)>(
+          reinterpret_cast<char*>(&old_root_),
+          reinterpret_cast<char*>(&other->old_root_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetManyRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+void GetManyRequest::InitAsDefaultInstance() {
+  ::hashdb::v1::_GetManyRequest_default_instance_._instance.get_mutable()->root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+}
+class GetManyRequest::_Internal {
+ public:
+  static const ::hashdb::v1::Fea& root(const GetManyRequest* msg);
+};
+
+const ::hashdb::v1::Fea&
+GetManyRequest::_Internal::root(const GetManyRequest* msg) {
+  return *msg->root_;
+}
+GetManyRequest::GetManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  key_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetManyRequest)
+}
+GetManyRequest::GetManyRequest(const GetManyRequest& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      key_(from.key_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (!from._internal_batch_uuid().empty()) {
+    batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), from._internal_batch_uuid(),
+      GetArena());
+  }
+  if (from._internal_has_root()) {
+    root_ = new ::hashdb::v1::Fea(*from.root_);
+  } else {
+    root_ = nullptr;
+  }
+  ::memcpy(&details_, &from.details_,
+    static_cast<size_t>(reinterpret_cast<char*>(&get_db_read_log_) -
+    reinterpret_cast<char*>(&details_)) + sizeof(get_db_read_log_));
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetManyRequest)
+}
+
+void GetManyRequest::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetManyRequest_hashdb_2eproto.base);
+  batch_uuid_.UnsafeSetDefault(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  ::memset(&root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&get_db_read_log_) -
+      reinterpret_cast<char*>(&root_)) + sizeof(get_db_read_log_));
+}
+
+GetManyRequest::~GetManyRequest() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetManyRequest)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GetManyRequest::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  batch_uuid_.DestroyNoArena(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited());
+  if (this != internal_default_instance()) delete root_;
+}
+
+void GetManyRequest::ArenaDtor(void* object) {
+  GetManyRequest* _this = reinterpret_cast< GetManyRequest* >(object);
+  (void)_this;
+}
+void GetManyRequest::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GetManyRequest::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const GetManyRequest& GetManyRequest::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetManyRequest_hashdb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void GetManyRequest::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetManyRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  key_.Clear();
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  if (GetArena() == nullptr && root_ != nullptr) {
+    delete root_;
+  }
+  root_ = nullptr;
+  ::memset(&details_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&get_db_read_log_) -
+      reinterpret_cast<char*>(&details_)) + sizeof(get_db_read_log_));
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetManyRequest::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .hashdb.v1.Fea root = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .hashdb.v1.Fea key = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_key(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // bool details = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 24)) {
+          details_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // bool get_db_read_log = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 32)) {
+          get_db_read_log_ = ::PROTOBUF_NAMESPACE_ID::internal::ReadVarint64(&ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // string batch_uuid = 5;
+      case 5:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 42)) {
+          auto str = _internal_mutable_batch_uuid();
+          ptr = ::PROTOBUF_NAMESPACE_ID::internal::InlineGreedyStringParser(str, ptr, ctx);
+          CHK_(::PROTOBUF_NAMESPACE_ID::internal::VerifyUTF8(str, "hashdb.v1.GetManyRequest.batch_uuid"));
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetManyRequest::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetManyRequest)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .hashdb.v1.Fea root = 1;
+  if (this->has_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::root(this), target, stream);
+  }
+
+  // repeated .hashdb.v1.Fea key = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_key_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_key(i), target, stream);
+  }
+
+  // bool details = 3;
+  if (this->details() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(3, this->_internal_details(), target);
+  }
+
+  // bool get_db_read_log = 4;
+  if (this->get_db_read_log() != 0) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::WriteBoolToArray(4, this->_internal_get_db_read_log(), target);
+  }
+
+  // string batch_uuid = 5;
+  if (this->batch_uuid().size() > 0) {
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+      this->_internal_batch_uuid().data(), static_cast<int>(this->_internal_batch_uuid().length()),
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+      "hashdb.v1.GetManyRequest.batch_uuid");
+    target = stream->WriteStringMaybeAliased(
+        5, this->_internal_batch_uuid(), target);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetManyRequest)
+  return target;
+}
+
+size_t GetManyRequest::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetManyRequest)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.Fea key = 2;
+  total_size += 1UL * this->_internal_key_size();
+  for (const auto& msg : this->key_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // string batch_uuid = 5;
+  if (this->batch_uuid().size() > 0) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::StringSize(
+        this->_internal_batch_uuid());
+  }
+
+  // .hashdb.v1.Fea root = 1;
+  if (this->has_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *root_);
+  }
+
+  // bool details = 3;
+  if (this->details() != 0) {
+    total_size += 1 + 1;
+  }
+
+  // bool get_db_read_log = 4;
+  if (this->get_db_read_log() != 0) {
+    total_size += 1 + 1;
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetManyRequest::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetManyRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetManyRequest* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetManyRequest>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetManyRequest)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetManyRequest)
+    MergeFrom(*source);
+  }
+}
+
+void GetManyRequest::MergeFrom(const GetManyRequest& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetManyRequest)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  key_.MergeFrom(from.key_);
+  if (from.batch_uuid().size() > 0) {
+    _internal_set_batch_uuid(from._internal_batch_uuid());
+  }
+  if (from.has_root()) {
+    _internal_mutable_root()->::hashdb::v1::Fea::MergeFrom(from._internal_root());
+  }
+  if (from.details() != 0) {
+    _internal_set_details(from._internal_details());
+  }
+  if (from.get_db_read_log() != 0) {
+    _internal_set_get_db_read_log(from._internal_get_db_read_log());
+  }
+}
+
+void GetManyRequest::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetManyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetManyRequest::CopyFrom(const GetManyRequest& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetManyRequest)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetManyRequest::IsInitialized() const {
+  return true;
+}
+
+void GetManyRequest::InternalSwap(GetManyRequest* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  key_.InternalSwap(&other->key_);
+  batch_uuid_.Swap(&other->batch_uuid_, &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(GetManyRequest, get_db_read_log_)
+      + sizeof(GetManyRequest::get_db_read_log_)
+      - PROTOBUF_FIELD_OFFSET(GetManyRequest, root_)>(
+          reinterpret_cast<char*>(&root_),
+          reinterpret_cast<char*>(&other->root_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetManyRequest::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+SetManyResponse_DbReadLogEntry_DoNotUse::SetManyResponse_DbReadLogEntry_DoNotUse() {}
+SetManyResponse_DbReadLogEntry_DoNotUse::SetManyResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void SetManyResponse_DbReadLogEntry_DoNotUse::MergeFrom(const SetManyResponse_DbReadLogEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata SetManyResponse_DbReadLogEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void SetManyResponse_DbReadLogEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void SetManyResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_SetManyResponse_default_instance_._instance.get_mutable()->new_root_ = const_cast< ::hashdb::v1::Fea*>(
+      ::hashdb::v1::Fea::internal_default_instance());
+  ::hashdb::v1::_SetManyResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+      ::hashdb::v1::ResultCode::internal_default_instance());
+}
+class SetManyResponse::_Internal {
+ public:
+  static const ::hashdb::v1::Fea& new_root(const SetManyResponse* msg);
+  static const ::hashdb::v1::ResultCode& result(const SetManyResponse* msg);
+};
+
+const ::hashdb::v1::Fea&
+SetManyResponse::_Internal::new_root(const SetManyResponse* msg) {
+  return *msg->new_root_;
+}
+const ::hashdb::v1::ResultCode&
+SetManyResponse::_Internal::result(const SetManyResponse* msg) {
+  return *msg->result_;
+}
+SetManyResponse::SetManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  set_response_(arena),
+  db_read_log_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.SetManyResponse)
+}
+SetManyResponse::SetManyResponse(const SetManyResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      set_response_(from.set_response_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  db_read_log_.MergeFrom(from.db_read_log_);
+  if (from._internal_has_new_root()) {
+    new_root_ = new ::hashdb::v1::Fea(*from.new_root_);
+  } else {
+    new_root_ = nullptr;
+  }
+  if (from._internal_has_result()) {
+    result_ = new ::hashdb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.SetManyResponse)
+}
+
+void SetManyResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_SetManyResponse_hashdb_2eproto.base);
+  ::memset(&new_root_, 0, static_cast<size_t>(
+      reinterpret_cast<char*>(&result_) -
+      reinterpret_cast<char*>(&new_root_)) + sizeof(result_));
+}
+
+SetManyResponse::~SetManyResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.SetManyResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void SetManyResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete new_root_;
+  if (this != internal_default_instance()) delete result_;
+}
+
+void SetManyResponse::ArenaDtor(void* object) {
+  SetManyResponse* _this = reinterpret_cast< SetManyResponse* >(object);
+  (void)_this;
+}
+void SetManyResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void SetManyResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const SetManyResponse& SetManyResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_SetManyResponse_hashdb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void SetManyResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.SetManyResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  set_response_.Clear();
+  db_read_log_.Clear();
+  if (GetArena() == nullptr && new_root_ != nullptr) {
+    delete new_root_;
+  }
+  new_root_ = nullptr;
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* SetManyResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // .hashdb.v1.Fea new_root = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr = ctx->ParseMessage(_internal_mutable_new_root(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      // repeated .hashdb.v1.SetResponse set_response = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_set_response(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, .hashdb.v1.FeList> db_read_log = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&db_read_log_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<26>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.ResultCode result = 4;
+      case 4:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 34)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* SetManyResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.SetManyResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // .hashdb.v1.Fea new_root = 1;
+  if (this->has_new_root()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        1, _Internal::new_root(this), target, stream);
+  }
+
+  // repeated .hashdb.v1.SetResponse set_response = 2;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_set_response_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(2, this->_internal_set_response(i), target, stream);
+  }
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 3;
+  if (!this->_internal_db_read_log().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "hashdb.v1.SetManyResponse.DbReadLogEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_db_read_log().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_db_read_log().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_db_read_log().begin();
+          it != this->_internal_db_read_log().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = SetManyResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(3, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_db_read_log().begin();
+          it != this->_internal_db_read_log().end(); ++it) {
+        target = SetManyResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(3, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // .hashdb.v1.ResultCode result = 4;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        4, _Internal::result(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.SetManyResponse)
+  return target;
+}
+
+size_t SetManyResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.SetManyResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.SetResponse set_response = 2;
+  total_size += 1UL * this->_internal_set_response_size();
+  for (const auto& msg : this->set_response_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 3;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_db_read_log_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+      it = this->_internal_db_read_log().begin();
+      it != this->_internal_db_read_log().end(); ++it) {
+    total_size += SetManyResponse_DbReadLogEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // .hashdb.v1.Fea new_root = 1;
+  if (this->has_new_root()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *new_root_);
+  }
+
+  // .hashdb.v1.ResultCode result = 4;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void SetManyResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.SetManyResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const SetManyResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<SetManyResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.SetManyResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.SetManyResponse)
+    MergeFrom(*source);
+  }
+}
+
+void SetManyResponse::MergeFrom(const SetManyResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.SetManyResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  set_response_.MergeFrom(from.set_response_);
+  db_read_log_.MergeFrom(from.db_read_log_);
+  if (from.has_new_root()) {
+    _internal_mutable_new_root()->::hashdb::v1::Fea::MergeFrom(from._internal_new_root());
+  }
+  if (from.has_result()) {
+    _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
+}
+
+void SetManyResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.SetManyResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void SetManyResponse::CopyFrom(const SetManyResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.SetManyResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool SetManyResponse::IsInitialized() const {
+  return true;
+}
+
+void SetManyResponse::InternalSwap(SetManyResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  set_response_.InternalSwap(&other->set_response_);
+  db_read_log_.Swap(&other->db_read_log_);
+  ::PROTOBUF_NAMESPACE_ID::internal::memswap<
+      PROTOBUF_FIELD_OFFSET(SetManyResponse, result_)
+      + sizeof(SetManyResponse::result_)
+      - PROTOBUF_FIELD_OFFSET(SetManyResponse, new_root_)>(
+          reinterpret_cast<char*>(&new_root_),
+          reinterpret_cast<char*>(&other->new_root_));
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata SetManyResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// ===================================================================
+
+GetManyResponse_DbReadLogEntry_DoNotUse::GetManyResponse_DbReadLogEntry_DoNotUse() {}
+GetManyResponse_DbReadLogEntry_DoNotUse::GetManyResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+    : SuperType(arena) {}
+void GetManyResponse_DbReadLogEntry_DoNotUse::MergeFrom(const GetManyResponse_DbReadLogEntry_DoNotUse& other) {
+  MergeFromInternal(other);
+}
+::PROTOBUF_NAMESPACE_ID::Metadata GetManyResponse_DbReadLogEntry_DoNotUse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+void GetManyResponse_DbReadLogEntry_DoNotUse::MergeFrom(
+    const ::PROTOBUF_NAMESPACE_ID::Message& other) {
+  ::PROTOBUF_NAMESPACE_ID::Message::MergeFrom(other);
+}
+
+
+// ===================================================================
+
+void GetManyResponse::InitAsDefaultInstance() {
+  ::hashdb::v1::_GetManyResponse_default_instance_._instance.get_mutable()->result_ = const_cast< ::hashdb::v1::ResultCode*>(
+      ::hashdb::v1::ResultCode::internal_default_instance());
+}
+class GetManyResponse::_Internal {
+ public:
+  static const ::hashdb::v1::ResultCode& result(const GetManyResponse* msg);
+};
+
+const ::hashdb::v1::ResultCode&
+GetManyResponse::_Internal::result(const GetManyResponse* msg) {
+  return *msg->result_;
+}
+GetManyResponse::GetManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena)
+  : ::PROTOBUF_NAMESPACE_ID::Message(arena),
+  get_response_(arena),
+  db_read_log_(arena) {
+  SharedCtor();
+  RegisterArenaDtor(arena);
+  // @@protoc_insertion_point(arena_constructor:hashdb.v1.GetManyResponse)
+}
+GetManyResponse::GetManyResponse(const GetManyResponse& from)
+  : ::PROTOBUF_NAMESPACE_ID::Message(),
+      get_response_(from.get_response_) {
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  db_read_log_.MergeFrom(from.db_read_log_);
+  if (from._internal_has_result()) {
+    result_ = new ::hashdb::v1::ResultCode(*from.result_);
+  } else {
+    result_ = nullptr;
+  }
+  // @@protoc_insertion_point(copy_constructor:hashdb.v1.GetManyResponse)
+}
+
+void GetManyResponse::SharedCtor() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&scc_info_GetManyResponse_hashdb_2eproto.base);
+  result_ = nullptr;
+}
+
+GetManyResponse::~GetManyResponse() {
+  // @@protoc_insertion_point(destructor:hashdb.v1.GetManyResponse)
+  SharedDtor();
+  _internal_metadata_.Delete<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+void GetManyResponse::SharedDtor() {
+  GOOGLE_DCHECK(GetArena() == nullptr);
+  if (this != internal_default_instance()) delete result_;
+}
+
+void GetManyResponse::ArenaDtor(void* object) {
+  GetManyResponse* _this = reinterpret_cast< GetManyResponse* >(object);
+  (void)_this;
+}
+void GetManyResponse::RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena*) {
+}
+void GetManyResponse::SetCachedSize(int size) const {
+  _cached_size_.Set(size);
+}
+const GetManyResponse& GetManyResponse::default_instance() {
+  ::PROTOBUF_NAMESPACE_ID::internal::InitSCC(&::scc_info_GetManyResponse_hashdb_2eproto.base);
+  return *internal_default_instance();
+}
+
+
+void GetManyResponse::Clear() {
+// @@protoc_insertion_point(message_clear_start:hashdb.v1.GetManyResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  get_response_.Clear();
+  db_read_log_.Clear();
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+  _internal_metadata_.Clear<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>();
+}
+
+const char* GetManyResponse::_InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) {
+#define CHK_(x) if (PROTOBUF_PREDICT_FALSE(!(x))) goto failure
+  ::PROTOBUF_NAMESPACE_ID::Arena* arena = GetArena(); (void)arena;
+  while (!ctx->Done(&ptr)) {
+    ::PROTOBUF_NAMESPACE_ID::uint32 tag;
+    ptr = ::PROTOBUF_NAMESPACE_ID::internal::ReadTag(ptr, &tag);
+    CHK_(ptr);
+    switch (tag >> 3) {
+      // repeated .hashdb.v1.GetResponse get_response = 1;
+      case 1:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 10)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(_internal_add_get_response(), ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<10>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // map<string, .hashdb.v1.FeList> db_read_log = 2;
+      case 2:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 18)) {
+          ptr -= 1;
+          do {
+            ptr += 1;
+            ptr = ctx->ParseMessage(&db_read_log_, ptr);
+            CHK_(ptr);
+            if (!ctx->DataAvailable(ptr)) break;
+          } while (::PROTOBUF_NAMESPACE_ID::internal::ExpectTag<18>(ptr));
+        } else goto handle_unusual;
+        continue;
+      // .hashdb.v1.ResultCode result = 3;
+      case 3:
+        if (PROTOBUF_PREDICT_TRUE(static_cast<::PROTOBUF_NAMESPACE_ID::uint8>(tag) == 26)) {
+          ptr = ctx->ParseMessage(_internal_mutable_result(), ptr);
+          CHK_(ptr);
+        } else goto handle_unusual;
+        continue;
+      default: {
+      handle_unusual:
+        if ((tag & 7) == 4 || tag == 0) {
+          ctx->SetLastTag(tag);
+          goto success;
+        }
+        ptr = UnknownFieldParse(tag,
+            _internal_metadata_.mutable_unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(),
+            ptr, ctx);
+        CHK_(ptr != nullptr);
+        continue;
+      }
+    }  // switch
+  }  // while
+success:
+  return ptr;
+failure:
+  ptr = nullptr;
+  goto success;
+#undef CHK_
+}
+
+::PROTOBUF_NAMESPACE_ID::uint8* GetManyResponse::_InternalSerialize(
+    ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const {
+  // @@protoc_insertion_point(serialize_to_array_start:hashdb.v1.GetManyResponse)
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.GetResponse get_response = 1;
+  for (unsigned int i = 0,
+      n = static_cast<unsigned int>(this->_internal_get_response_size()); i < n; i++) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(1, this->_internal_get_response(i), target, stream);
+  }
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 2;
+  if (!this->_internal_db_read_log().empty()) {
+    typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_pointer
+        ConstPtr;
+    typedef ConstPtr SortItem;
+    typedef ::PROTOBUF_NAMESPACE_ID::internal::CompareByDerefFirst<SortItem> Less;
+    struct Utf8Check {
+      static void Check(ConstPtr p) {
+        ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(
+          p->first.data(), static_cast<int>(p->first.length()),
+          ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::SERIALIZE,
+          "hashdb.v1.GetManyResponse.DbReadLogEntry.key");
+      }
+    };
+
+    if (stream->IsSerializationDeterministic() &&
+        this->_internal_db_read_log().size() > 1) {
+      ::std::unique_ptr<SortItem[]> items(
+          new SortItem[this->_internal_db_read_log().size()]);
+      typedef ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::size_type size_type;
+      size_type n = 0;
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_db_read_log().begin();
+          it != this->_internal_db_read_log().end(); ++it, ++n) {
+        items[static_cast<ptrdiff_t>(n)] = SortItem(&*it);
+      }
+      ::std::sort(&items[0], &items[static_cast<ptrdiff_t>(n)], Less());
+      for (size_type i = 0; i < n; i++) {
+        target = GetManyResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(2, items[static_cast<ptrdiff_t>(i)]->first, items[static_cast<ptrdiff_t>(i)]->second, target, stream);
+        Utf8Check::Check(&(*items[static_cast<ptrdiff_t>(i)]));
+      }
+    } else {
+      for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+          it = this->_internal_db_read_log().begin();
+          it != this->_internal_db_read_log().end(); ++it) {
+        target = GetManyResponse_DbReadLogEntry_DoNotUse::Funcs::InternalSerialize(2, it->first, it->second, target, stream);
+        Utf8Check::Check(&(*it));
+      }
+    }
+  }
+
+  // .hashdb.v1.ResultCode result = 3;
+  if (this->has_result()) {
+    target = stream->EnsureSpace(target);
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::
+      InternalWriteMessage(
+        3, _Internal::result(this), target, stream);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    target = ::PROTOBUF_NAMESPACE_ID::internal::WireFormat::InternalSerializeUnknownFieldsToArray(
+        _internal_metadata_.unknown_fields<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(::PROTOBUF_NAMESPACE_ID::UnknownFieldSet::default_instance), target, stream);
+  }
+  // @@protoc_insertion_point(serialize_to_array_end:hashdb.v1.GetManyResponse)
+  return target;
+}
+
+size_t GetManyResponse::ByteSizeLong() const {
+// @@protoc_insertion_point(message_byte_size_start:hashdb.v1.GetManyResponse)
+  size_t total_size = 0;
+
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  // Prevent compiler warnings about cached_has_bits being unused
+  (void) cached_has_bits;
+
+  // repeated .hashdb.v1.GetResponse get_response = 1;
+  total_size += 1UL * this->_internal_get_response_size();
+  for (const auto& msg : this->get_response_) {
+    total_size +=
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(msg);
+  }
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 2;
+  total_size += 1 *
+      ::PROTOBUF_NAMESPACE_ID::internal::FromIntSize(this->_internal_db_read_log_size());
+  for (::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >::const_iterator
+      it = this->_internal_db_read_log().begin();
+      it != this->_internal_db_read_log().end(); ++it) {
+    total_size += GetManyResponse_DbReadLogEntry_DoNotUse::Funcs::ByteSizeLong(it->first, it->second);
+  }
+
+  // .hashdb.v1.ResultCode result = 3;
+  if (this->has_result()) {
+    total_size += 1 +
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::MessageSize(
+        *result_);
+  }
+
+  if (PROTOBUF_PREDICT_FALSE(_internal_metadata_.have_unknown_fields())) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::ComputeUnknownFieldsSize(
+        _internal_metadata_, total_size, &_cached_size_);
+  }
+  int cached_size = ::PROTOBUF_NAMESPACE_ID::internal::ToCachedSize(total_size);
+  SetCachedSize(cached_size);
+  return total_size;
+}
+
+void GetManyResponse::MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_merge_from_start:hashdb.v1.GetManyResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  const GetManyResponse* source =
+      ::PROTOBUF_NAMESPACE_ID::DynamicCastToGenerated<GetManyResponse>(
+          &from);
+  if (source == nullptr) {
+  // @@protoc_insertion_point(generalized_merge_from_cast_fail:hashdb.v1.GetManyResponse)
+    ::PROTOBUF_NAMESPACE_ID::internal::ReflectionOps::Merge(from, this);
+  } else {
+  // @@protoc_insertion_point(generalized_merge_from_cast_success:hashdb.v1.GetManyResponse)
+    MergeFrom(*source);
+  }
+}
+
+void GetManyResponse::MergeFrom(const GetManyResponse& from) {
+// @@protoc_insertion_point(class_specific_merge_from_start:hashdb.v1.GetManyResponse)
+  GOOGLE_DCHECK_NE(&from, this);
+  _internal_metadata_.MergeFrom<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(from._internal_metadata_);
+  ::PROTOBUF_NAMESPACE_ID::uint32 cached_has_bits = 0;
+  (void) cached_has_bits;
+
+  get_response_.MergeFrom(from.get_response_);
+  db_read_log_.MergeFrom(from.db_read_log_);
+  if (from.has_result()) {
+    _internal_mutable_result()->::hashdb::v1::ResultCode::MergeFrom(from._internal_result());
+  }
+}
+
+void GetManyResponse::CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) {
+// @@protoc_insertion_point(generalized_copy_from_start:hashdb.v1.GetManyResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+void GetManyResponse::CopyFrom(const GetManyResponse& from) {
+// @@protoc_insertion_point(class_specific_copy_from_start:hashdb.v1.GetManyResponse)
+  if (&from == this) return;
+  Clear();
+  MergeFrom(from);
+}
+
+bool GetManyResponse::IsInitialized() const {
+  return true;
+}
+
+void GetManyResponse::InternalSwap(GetManyResponse* other) {
+  using std::swap;
+  _internal_metadata_.Swap<::PROTOBUF_NAMESPACE_ID::UnknownFieldSet>(&other->_internal_metadata_);
+  get_response_.InternalSwap(&other->get_response_);
+  db_read_log_.Swap(&other->db_read_log_);
+  swap(result_, other->result_);
+}
+
+::PROTOBUF_NAMESPACE_ID::Metadata GetManyResponse::GetMetadata() const {
+  return GetMetadataStatic();
+}
+
+
+// @@protoc_insertion_point(namespace_scope)
+}  // namespace v1
+}  // namespace hashdb
+PROTOBUF_NAMESPACE_OPEN
+template<> PROTOBUF_NOINLINE ::hashdb::v1::Version* Arena::CreateMaybeMessage< ::hashdb::v1::Version >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::Version >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetProgramRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetProgramRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetProgramRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetProgramRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetProgramRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetProgramRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::LoadDBRequest_InputDbEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadDBRequest* Arena::CreateMaybeMessage< ::hashdb::v1::LoadDBRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::LoadDBRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::LoadProgramDBRequest_InputProgramDbEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::LoadProgramDBRequest* Arena::CreateMaybeMessage< ::hashdb::v1::LoadProgramDBRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::LoadProgramDBRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::FlushRequest* Arena::CreateMaybeMessage< ::hashdb::v1::FlushRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::FlushRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::FinishTxRequest* Arena::CreateMaybeMessage< ::hashdb::v1::FinishTxRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::FinishTxRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::StartBlockRequest* Arena::CreateMaybeMessage< ::hashdb::v1::StartBlockRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::StartBlockRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::FinishBlockRequest* Arena::CreateMaybeMessage< ::hashdb::v1::FinishBlockRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::FinishBlockRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::ConsolidateStateRequest* Arena::CreateMaybeMessage< ::hashdb::v1::ConsolidateStateRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::ConsolidateStateRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::PurgeRequest* Arena::CreateMaybeMessage< ::hashdb::v1::PurgeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::PurgeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::ReadTreeRequest* Arena::CreateMaybeMessage< ::hashdb::v1::ReadTreeRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::ReadTreeRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::CancelBatchRequest* Arena::CreateMaybeMessage< ::hashdb::v1::CancelBatchRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::CancelBatchRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetLatestStateRootResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetLatestStateRootResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetLatestStateRootResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetResponse_SiblingsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetResponse_DbReadLogEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse_SiblingsEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse_DbReadLogEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetProgramResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetProgramResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetProgramResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetProgramResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetProgramResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetProgramResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::FlushResponse* Arena::CreateMaybeMessage< ::hashdb::v1::FlushResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::FlushResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushStatusResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushStatusResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushStatusResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetFlushDataResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetFlushDataResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetFlushDataResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::ConsolidateStateResponse* Arena::CreateMaybeMessage< ::hashdb::v1::ConsolidateStateResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::ConsolidateStateResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::PurgeResponse* Arena::CreateMaybeMessage< ::hashdb::v1::PurgeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::PurgeResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::ReadTreeResponse* Arena::CreateMaybeMessage< ::hashdb::v1::ReadTreeResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::ReadTreeResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::CancelBatchResponse* Arena::CreateMaybeMessage< ::hashdb::v1::CancelBatchResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::CancelBatchResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::ResetDBResponse* Arena::CreateMaybeMessage< ::hashdb::v1::ResetDBResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::ResetDBResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::Fea* Arena::CreateMaybeMessage< ::hashdb::v1::Fea >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::Fea >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::Fea12* Arena::CreateMaybeMessage< ::hashdb::v1::Fea12 >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::Fea12 >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::HashValueGL* Arena::CreateMaybeMessage< ::hashdb::v1::HashValueGL >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::HashValueGL >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::KeyValue* Arena::CreateMaybeMessage< ::hashdb::v1::KeyValue >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hashdb::v1::KeyValue >(arena);
 }
 template<> PROTOBUF_NOINLINE ::hashdb::v1::FeList* Arena::CreateMaybeMessage< ::hashdb::v1::FeList >(Arena* arena) {
@@ -12706,6 +14391,24 @@ template<> PROTOBUF_NOINLINE ::hashdb::v1::SiblingList* Arena::CreateMaybeMessag
 template<> PROTOBUF_NOINLINE ::hashdb::v1::ResultCode* Arena::CreateMaybeMessage< ::hashdb::v1::ResultCode >(Arena* arena) {
   return Arena::CreateMessageInternal< ::hashdb::v1::ResultCode >(arena);
 }
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetManyRequest* Arena::CreateMaybeMessage< ::hashdb::v1::SetManyRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetManyRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetManyRequest* Arena::CreateMaybeMessage< ::hashdb::v1::GetManyRequest >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetManyRequest >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::SetManyResponse* Arena::CreateMaybeMessage< ::hashdb::v1::SetManyResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::SetManyResponse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage< ::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse >(arena);
+}
+template<> PROTOBUF_NOINLINE ::hashdb::v1::GetManyResponse* Arena::CreateMaybeMessage< ::hashdb::v1::GetManyResponse >(Arena* arena) {
+  return Arena::CreateMessageInternal< ::hashdb::v1::GetManyResponse >(arena);
+}
 PROTOBUF_NAMESPACE_CLOSE
 
 // @@protoc_insertion_point(global_scope)
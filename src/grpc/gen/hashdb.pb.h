@@ -52,7 +52,7 @@ struct TableStruct_hashdb_2eproto {
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::AuxillaryParseTableField aux[]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
-  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[44]
+  static const ::PROTOBUF_NAMESPACE_ID::internal::ParseTable schema[50]
     PROTOBUF_SECTION_VARIABLE(protodesc_cold);
   static const ::PROTOBUF_NAMESPACE_ID::internal::FieldMetadata field_metadata[];
   static const ::PROTOBUF_NAMESPACE_ID::internal::SerializationTable serialization_table[];
@@ -112,6 +112,15 @@ extern GetFlushStatusResponseDefaultTypeInternal _GetFlushStatusResponse_default
 class GetLatestStateRootResponse;
 class GetLatestStateRootResponseDefaultTypeInternal;
 extern GetLatestStateRootResponseDefaultTypeInternal _GetLatestStateRootResponse_default_instance_;
+class GetManyRequest;
+class GetManyRequestDefaultTypeInternal;
+extern GetManyRequestDefaultTypeInternal _GetManyRequest_default_instance_;
+class GetManyResponse;
+class GetManyResponseDefaultTypeInternal;
+extern GetManyResponseDefaultTypeInternal _GetManyResponse_default_instance_;
+class GetManyResponse_DbReadLogEntry_DoNotUse;
+class GetManyResponse_DbReadLogEntry_DoNotUseDefaultTypeInternal;
+extern GetManyResponse_DbReadLogEntry_DoNotUseDefaultTypeInternal _GetManyResponse_DbReadLogEntry_DoNotUse_default_instance_;
 class GetProgramRequest;
 class GetProgramRequestDefaultTypeInternal;
 extern GetProgramRequestDefaultTypeInternal _GetProgramRequest_default_instance_;
@@ -166,6 +175,15 @@ extern ResetDBResponseDefaultTypeInternal _ResetDBResponse_default_instance_;
 class ResultCode;
 class ResultCodeDefaultTypeInternal;
 extern ResultCodeDefaultTypeInternal _ResultCode_default_instance_;
+class SetManyRequest;
+class SetManyRequestDefaultTypeInternal;
+extern SetManyRequestDefaultTypeInternal _SetManyRequest_default_instance_;
+class SetManyResponse;
+class SetManyResponseDefaultTypeInternal;
+extern SetManyResponseDefaultTypeInternal _SetManyResponse_default_instance_;
+class SetManyResponse_DbReadLogEntry_DoNotUse;
+class SetManyResponse_DbReadLogEntry_DoNotUseDefaultTypeInternal;
+extern SetManyResponse_DbReadLogEntry_DoNotUseDefaultTypeInternal _SetManyResponse_DbReadLogEntry_DoNotUse_default_instance_;
 class SetProgramRequest;
 class SetProgramRequestDefaultTypeInternal;
 extern SetProgramRequestDefaultTypeInternal _SetProgramRequest_default_instance_;
@@ -213,6 +231,9 @@ template<> ::hashdb::v1::GetFlushDataResponse_NodesEntry_DoNotUse* Arena::Create
 template<> ::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse* Arena::CreateMaybeMessage<::hashdb::v1::GetFlushDataResponse_ProgramEntry_DoNotUse>(Arena*);
 template<> ::hashdb::v1::GetFlushStatusResponse* Arena::CreateMaybeMessage<::hashdb::v1::GetFlushStatusResponse>(Arena*);
 template<> ::hashdb::v1::GetLatestStateRootResponse* Arena::CreateMaybeMessage<::hashdb::v1::GetLatestStateRootResponse>(Arena*);
+template<> ::hashdb::v1::GetManyRequest* Arena::CreateMaybeMessage<::hashdb::v1::GetManyRequest>(Arena*);
+template<> ::hashdb::v1::GetManyResponse* Arena::CreateMaybeMessage<::hashdb::v1::GetManyResponse>(Arena*);
+template<> ::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage<::hashdb::v1::GetManyResponse_DbReadLogEntry_DoNotUse>(Arena*);
 template<> ::hashdb::v1::GetProgramRequest* Arena::CreateMaybeMessage<::hashdb::v1::GetProgramRequest>(Arena*);
 template<> ::hashdb::v1::GetProgramResponse* Arena::CreateMaybeMessage<::hashdb::v1::GetProgramResponse>(Arena*);
 template<> ::hashdb::v1::GetRequest* Arena::CreateMaybeMessage<::hashdb::v1::GetRequest>(Arena*);
@@ -231,6 +252,9 @@ template<> ::hashdb::v1::ReadTreeRequest* Arena::CreateMaybeMessage<::hashdb::v1
 template<> ::hashdb::v1::ReadTreeResponse* Arena::CreateMaybeMessage<::hashdb::v1::ReadTreeResponse>(Arena*);
 template<> ::hashdb::v1::ResetDBResponse* Arena::CreateMaybeMessage<::hashdb::v1::ResetDBResponse>(Arena*);
 template<> ::hashdb::v1::ResultCode* Arena::CreateMaybeMessage<::hashdb::v1::ResultCode>(Arena*);
+template<> ::hashdb::v1::SetManyRequest* Arena::CreateMaybeMessage<::hashdb::v1::SetManyRequest>(Arena*);
+template<> ::hashdb::v1::SetManyResponse* Arena::CreateMaybeMessage<::hashdb::v1::SetManyResponse>(Arena*);
+template<> ::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse* Arena::CreateMaybeMessage<::hashdb::v1::SetManyResponse_DbReadLogEntry_DoNotUse>(Arena*);
 template<> ::hashdb::v1::SetProgramRequest* Arena::CreateMaybeMessage<::hashdb::v1::SetProgramRequest>(Arena*);
 template<> ::hashdb::v1::SetProgramResponse* Arena::CreateMaybeMessage<::hashdb::v1::SetProgramResponse>(Arena*);
 template<> ::hashdb::v1::SetRequest* Arena::CreateMaybeMessage<::hashdb::v1::SetRequest>(Arena*);
@@ -7457,6 +7481,935 @@ class ResultCode PROTOBUF_FINAL :
   mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
   friend struct ::TableStruct_hashdb_2eproto;
 };
+// -------------------------------------------------------------------
+
+class SetManyRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.SetManyRequest) */ {
+ public:
+  inline SetManyRequest() : SetManyRequest(nullptr) {};
+  virtual ~SetManyRequest();
+
+  SetManyRequest(const SetManyRequest& from);
+  SetManyRequest(SetManyRequest&& from) noexcept
+    : SetManyRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline SetManyRequest& operator=(const SetManyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetManyRequest& operator=(SetManyRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SetManyRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SetManyRequest* internal_default_instance() {
+    return reinterpret_cast<const SetManyRequest*>(
+               &_SetManyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    44;
+
+  friend void swap(SetManyRequest& a, SetManyRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetManyRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetManyRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SetManyRequest* New() const final {
+    return CreateMaybeMessage<SetManyRequest>(nullptr);
+  }
+
+  SetManyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SetManyRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SetManyRequest& from);
+  void MergeFrom(const SetManyRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetManyRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.SetManyRequest";
+  }
+  protected:
+  explicit SetManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyValueFieldNumber = 2,
+    kBatchUuidFieldNumber = 6,
+    kOldRootFieldNumber = 1,
+    kPersistenceFieldNumber = 3,
+    kDetailsFieldNumber = 4,
+    kGetDbReadLogFieldNumber = 5,
+    kTxIndexFieldNumber = 7,
+    kBlockIndexFieldNumber = 8,
+  };
+  // repeated .hashdb.v1.KeyValue key_value = 2;
+  int key_value_size() const;
+  private:
+  int _internal_key_value_size() const;
+  public:
+  void clear_key_value();
+  ::hashdb::v1::KeyValue* mutable_key_value(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >*
+      mutable_key_value();
+  private:
+  const ::hashdb::v1::KeyValue& _internal_key_value(int index) const;
+  ::hashdb::v1::KeyValue* _internal_add_key_value();
+  public:
+  const ::hashdb::v1::KeyValue& key_value(int index) const;
+  ::hashdb::v1::KeyValue* add_key_value();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >&
+      key_value() const;
+
+  // string batch_uuid = 6;
+  void clear_batch_uuid();
+  const std::string& batch_uuid() const;
+  void set_batch_uuid(const std::string& value);
+  void set_batch_uuid(std::string&& value);
+  void set_batch_uuid(const char* value);
+  void set_batch_uuid(const char* value, size_t size);
+  std::string* mutable_batch_uuid();
+  std::string* release_batch_uuid();
+  void set_allocated_batch_uuid(std::string* batch_uuid);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_batch_uuid();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_batch_uuid(
+      std::string* batch_uuid);
+  private:
+  const std::string& _internal_batch_uuid() const;
+  void _internal_set_batch_uuid(const std::string& value);
+  std::string* _internal_mutable_batch_uuid();
+  public:
+
+  // .hashdb.v1.Fea old_root = 1;
+  bool has_old_root() const;
+  private:
+  bool _internal_has_old_root() const;
+  public:
+  void clear_old_root();
+  const ::hashdb::v1::Fea& old_root() const;
+  ::hashdb::v1::Fea* release_old_root();
+  ::hashdb::v1::Fea* mutable_old_root();
+  void set_allocated_old_root(::hashdb::v1::Fea* old_root);
+  private:
+  const ::hashdb::v1::Fea& _internal_old_root() const;
+  ::hashdb::v1::Fea* _internal_mutable_old_root();
+  public:
+  void unsafe_arena_set_allocated_old_root(
+      ::hashdb::v1::Fea* old_root);
+  ::hashdb::v1::Fea* unsafe_arena_release_old_root();
+
+  // .hashdb.v1.Persistence persistence = 3;
+  void clear_persistence();
+  ::hashdb::v1::Persistence persistence() const;
+  void set_persistence(::hashdb::v1::Persistence value);
+  private:
+  ::hashdb::v1::Persistence _internal_persistence() const;
+  void _internal_set_persistence(::hashdb::v1::Persistence value);
+  public:
+
+  // bool details = 4;
+  void clear_details();
+  bool details() const;
+  void set_details(bool value);
+  private:
+  bool _internal_details() const;
+  void _internal_set_details(bool value);
+  public:
+
+  // bool get_db_read_log = 5;
+  void clear_get_db_read_log();
+  bool get_db_read_log() const;
+  void set_get_db_read_log(bool value);
+  private:
+  bool _internal_get_db_read_log() const;
+  void _internal_set_get_db_read_log(bool value);
+  public:
+
+  // uint64 tx_index = 7;
+  void clear_tx_index();
+  ::PROTOBUF_NAMESPACE_ID::uint64 tx_index() const;
+  void set_tx_index(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_tx_index() const;
+  void _internal_set_tx_index(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // uint64 block_index = 8;
+  void clear_block_index();
+  ::PROTOBUF_NAMESPACE_ID::uint64 block_index() const;
+  void set_block_index(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  private:
+  ::PROTOBUF_NAMESPACE_ID::uint64 _internal_block_index() const;
+  void _internal_set_block_index(::PROTOBUF_NAMESPACE_ID::uint64 value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.SetManyRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue > key_value_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr batch_uuid_;
+  ::hashdb::v1::Fea* old_root_;
+  int persistence_;
+  bool details_;
+  bool get_db_read_log_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 tx_index_;
+  ::PROTOBUF_NAMESPACE_ID::uint64 block_index_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetManyRequest PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.GetManyRequest) */ {
+ public:
+  inline GetManyRequest() : GetManyRequest(nullptr) {};
+  virtual ~GetManyRequest();
+
+  GetManyRequest(const GetManyRequest& from);
+  GetManyRequest(GetManyRequest&& from) noexcept
+    : GetManyRequest() {
+    *this = ::std::move(from);
+  }
+
+  inline GetManyRequest& operator=(const GetManyRequest& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetManyRequest& operator=(GetManyRequest&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetManyRequest& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetManyRequest* internal_default_instance() {
+    return reinterpret_cast<const GetManyRequest*>(
+               &_GetManyRequest_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    45;
+
+  friend void swap(GetManyRequest& a, GetManyRequest& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetManyRequest* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetManyRequest* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetManyRequest* New() const final {
+    return CreateMaybeMessage<GetManyRequest>(nullptr);
+  }
+
+  GetManyRequest* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetManyRequest>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetManyRequest& from);
+  void MergeFrom(const GetManyRequest& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetManyRequest* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.GetManyRequest";
+  }
+  protected:
+  explicit GetManyRequest(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kKeyFieldNumber = 2,
+    kBatchUuidFieldNumber = 5,
+    kRootFieldNumber = 1,
+    kDetailsFieldNumber = 3,
+    kGetDbReadLogFieldNumber = 4,
+  };
+  // repeated .hashdb.v1.Fea key = 2;
+  int key_size() const;
+  private:
+  int _internal_key_size() const;
+  public:
+  void clear_key();
+  ::hashdb::v1::Fea* mutable_key(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::Fea >*
+      mutable_key();
+  private:
+  const ::hashdb::v1::Fea& _internal_key(int index) const;
+  ::hashdb::v1::Fea* _internal_add_key();
+  public:
+  const ::hashdb::v1::Fea& key(int index) const;
+  ::hashdb::v1::Fea* add_key();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::Fea >&
+      key() const;
+
+  // string batch_uuid = 5;
+  void clear_batch_uuid();
+  const std::string& batch_uuid() const;
+  void set_batch_uuid(const std::string& value);
+  void set_batch_uuid(std::string&& value);
+  void set_batch_uuid(const char* value);
+  void set_batch_uuid(const char* value, size_t size);
+  std::string* mutable_batch_uuid();
+  std::string* release_batch_uuid();
+  void set_allocated_batch_uuid(std::string* batch_uuid);
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  std::string* unsafe_arena_release_batch_uuid();
+  GOOGLE_PROTOBUF_RUNTIME_DEPRECATED("The unsafe_arena_ accessors for"
+  "    string fields are deprecated and will be removed in a"
+  "    future release.")
+  void unsafe_arena_set_allocated_batch_uuid(
+      std::string* batch_uuid);
+  private:
+  const std::string& _internal_batch_uuid() const;
+  void _internal_set_batch_uuid(const std::string& value);
+  std::string* _internal_mutable_batch_uuid();
+  public:
+
+  // .hashdb.v1.Fea root = 1;
+  bool has_root() const;
+  private:
+  bool _internal_has_root() const;
+  public:
+  void clear_root();
+  const ::hashdb::v1::Fea& root() const;
+  ::hashdb::v1::Fea* release_root();
+  ::hashdb::v1::Fea* mutable_root();
+  void set_allocated_root(::hashdb::v1::Fea* root);
+  private:
+  const ::hashdb::v1::Fea& _internal_root() const;
+  ::hashdb::v1::Fea* _internal_mutable_root();
+  public:
+  void unsafe_arena_set_allocated_root(
+      ::hashdb::v1::Fea* root);
+  ::hashdb::v1::Fea* unsafe_arena_release_root();
+
+  // bool details = 3;
+  void clear_details();
+  bool details() const;
+  void set_details(bool value);
+  private:
+  bool _internal_details() const;
+  void _internal_set_details(bool value);
+  public:
+
+  // bool get_db_read_log = 4;
+  void clear_get_db_read_log();
+  bool get_db_read_log() const;
+  void set_get_db_read_log(bool value);
+  private:
+  bool _internal_get_db_read_log() const;
+  void _internal_set_get_db_read_log(bool value);
+  public:
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.GetManyRequest)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::Fea > key_;
+  ::PROTOBUF_NAMESPACE_ID::internal::ArenaStringPtr batch_uuid_;
+  ::hashdb::v1::Fea* root_;
+  bool details_;
+  bool get_db_read_log_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class SetManyResponse_DbReadLogEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetManyResponse_DbReadLogEntry_DoNotUse, 
+    std::string, ::hashdb::v1::FeList,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<SetManyResponse_DbReadLogEntry_DoNotUse, 
+    std::string, ::hashdb::v1::FeList,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  SetManyResponse_DbReadLogEntry_DoNotUse();
+  SetManyResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const SetManyResponse_DbReadLogEntry_DoNotUse& other);
+  static const SetManyResponse_DbReadLogEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const SetManyResponse_DbReadLogEntry_DoNotUse*>(&_SetManyResponse_DbReadLogEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "hashdb.v1.SetManyResponse.DbReadLogEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[46];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class SetManyResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.SetManyResponse) */ {
+ public:
+  inline SetManyResponse() : SetManyResponse(nullptr) {};
+  virtual ~SetManyResponse();
+
+  SetManyResponse(const SetManyResponse& from);
+  SetManyResponse(SetManyResponse&& from) noexcept
+    : SetManyResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline SetManyResponse& operator=(const SetManyResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline SetManyResponse& operator=(SetManyResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const SetManyResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const SetManyResponse* internal_default_instance() {
+    return reinterpret_cast<const SetManyResponse*>(
+               &_SetManyResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    47;
+
+  friend void swap(SetManyResponse& a, SetManyResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(SetManyResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(SetManyResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline SetManyResponse* New() const final {
+    return CreateMaybeMessage<SetManyResponse>(nullptr);
+  }
+
+  SetManyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<SetManyResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const SetManyResponse& from);
+  void MergeFrom(const SetManyResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(SetManyResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.SetManyResponse";
+  }
+  protected:
+  explicit SetManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kSetResponseFieldNumber = 2,
+    kDbReadLogFieldNumber = 3,
+    kNewRootFieldNumber = 1,
+    kResultFieldNumber = 4,
+  };
+  // repeated .hashdb.v1.SetResponse set_response = 2;
+  int set_response_size() const;
+  private:
+  int _internal_set_response_size() const;
+  public:
+  void clear_set_response();
+  ::hashdb::v1::SetResponse* mutable_set_response(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >*
+      mutable_set_response();
+  private:
+  const ::hashdb::v1::SetResponse& _internal_set_response(int index) const;
+  ::hashdb::v1::SetResponse* _internal_add_set_response();
+  public:
+  const ::hashdb::v1::SetResponse& set_response(int index) const;
+  ::hashdb::v1::SetResponse* add_set_response();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >&
+      set_response() const;
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 3;
+  int db_read_log_size() const;
+  private:
+  int _internal_db_read_log_size() const;
+  public:
+  void clear_db_read_log();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+      _internal_db_read_log() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+      _internal_mutable_db_read_log();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+      db_read_log() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+      mutable_db_read_log();
+
+  // .hashdb.v1.Fea new_root = 1;
+  bool has_new_root() const;
+  private:
+  bool _internal_has_new_root() const;
+  public:
+  void clear_new_root();
+  const ::hashdb::v1::Fea& new_root() const;
+  ::hashdb::v1::Fea* release_new_root();
+  ::hashdb::v1::Fea* mutable_new_root();
+  void set_allocated_new_root(::hashdb::v1::Fea* new_root);
+  private:
+  const ::hashdb::v1::Fea& _internal_new_root() const;
+  ::hashdb::v1::Fea* _internal_mutable_new_root();
+  public:
+  void unsafe_arena_set_allocated_new_root(
+      ::hashdb::v1::Fea* new_root);
+  ::hashdb::v1::Fea* unsafe_arena_release_new_root();
+
+  // .hashdb.v1.ResultCode result = 4;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::hashdb::v1::ResultCode& result() const;
+  ::hashdb::v1::ResultCode* release_result();
+  ::hashdb::v1::ResultCode* mutable_result();
+  void set_allocated_result(::hashdb::v1::ResultCode* result);
+  private:
+  const ::hashdb::v1::ResultCode& _internal_result() const;
+  ::hashdb::v1::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::hashdb::v1::ResultCode* result);
+  ::hashdb::v1::ResultCode* unsafe_arena_release_result();
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.SetManyResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse > set_response_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      SetManyResponse_DbReadLogEntry_DoNotUse,
+      std::string, ::hashdb::v1::FeList,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > db_read_log_;
+  ::hashdb::v1::Fea* new_root_;
+  ::hashdb::v1::ResultCode* result_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
+// -------------------------------------------------------------------
+
+class GetManyResponse_DbReadLogEntry_DoNotUse : public ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<GetManyResponse_DbReadLogEntry_DoNotUse, 
+    std::string, ::hashdb::v1::FeList,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > {
+public:
+  typedef ::PROTOBUF_NAMESPACE_ID::internal::MapEntry<GetManyResponse_DbReadLogEntry_DoNotUse, 
+    std::string, ::hashdb::v1::FeList,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+    ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+    0 > SuperType;
+  GetManyResponse_DbReadLogEntry_DoNotUse();
+  GetManyResponse_DbReadLogEntry_DoNotUse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  void MergeFrom(const GetManyResponse_DbReadLogEntry_DoNotUse& other);
+  static const GetManyResponse_DbReadLogEntry_DoNotUse* internal_default_instance() { return reinterpret_cast<const GetManyResponse_DbReadLogEntry_DoNotUse*>(&_GetManyResponse_DbReadLogEntry_DoNotUse_default_instance_); }
+  static bool ValidateKey(std::string* s) {
+    return ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::VerifyUtf8String(s->data(), static_cast<int>(s->size()), ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::PARSE, "hashdb.v1.GetManyResponse.DbReadLogEntry.key");
+ }
+  static bool ValidateValue(void*) { return true; }
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& other) final;
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[48];
+  }
+
+  public:
+};
+
+// -------------------------------------------------------------------
+
+class GetManyResponse PROTOBUF_FINAL :
+    public ::PROTOBUF_NAMESPACE_ID::Message /* @@protoc_insertion_point(class_definition:hashdb.v1.GetManyResponse) */ {
+ public:
+  inline GetManyResponse() : GetManyResponse(nullptr) {};
+  virtual ~GetManyResponse();
+
+  GetManyResponse(const GetManyResponse& from);
+  GetManyResponse(GetManyResponse&& from) noexcept
+    : GetManyResponse() {
+    *this = ::std::move(from);
+  }
+
+  inline GetManyResponse& operator=(const GetManyResponse& from) {
+    CopyFrom(from);
+    return *this;
+  }
+  inline GetManyResponse& operator=(GetManyResponse&& from) noexcept {
+    if (GetArena() == from.GetArena()) {
+      if (this != &from) InternalSwap(&from);
+    } else {
+      CopyFrom(from);
+    }
+    return *this;
+  }
+
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* descriptor() {
+    return GetDescriptor();
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Descriptor* GetDescriptor() {
+    return GetMetadataStatic().descriptor;
+  }
+  static const ::PROTOBUF_NAMESPACE_ID::Reflection* GetReflection() {
+    return GetMetadataStatic().reflection;
+  }
+  static const GetManyResponse& default_instance();
+
+  static void InitAsDefaultInstance();  // FOR INTERNAL USE ONLY
+  static inline const GetManyResponse* internal_default_instance() {
+    return reinterpret_cast<const GetManyResponse*>(
+               &_GetManyResponse_default_instance_);
+  }
+  static constexpr int kIndexInFileMessages =
+    49;
+
+  friend void swap(GetManyResponse& a, GetManyResponse& b) {
+    a.Swap(&b);
+  }
+  inline void Swap(GetManyResponse* other) {
+    if (other == this) return;
+    if (GetArena() == other->GetArena()) {
+      InternalSwap(other);
+    } else {
+      ::PROTOBUF_NAMESPACE_ID::internal::GenericSwap(this, other);
+    }
+  }
+  void UnsafeArenaSwap(GetManyResponse* other) {
+    if (other == this) return;
+    GOOGLE_DCHECK(GetArena() == other->GetArena());
+    InternalSwap(other);
+  }
+
+  // implements Message ----------------------------------------------
+
+  inline GetManyResponse* New() const final {
+    return CreateMaybeMessage<GetManyResponse>(nullptr);
+  }
+
+  GetManyResponse* New(::PROTOBUF_NAMESPACE_ID::Arena* arena) const final {
+    return CreateMaybeMessage<GetManyResponse>(arena);
+  }
+  void CopyFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void MergeFrom(const ::PROTOBUF_NAMESPACE_ID::Message& from) final;
+  void CopyFrom(const GetManyResponse& from);
+  void MergeFrom(const GetManyResponse& from);
+  PROTOBUF_ATTRIBUTE_REINITIALIZES void Clear() final;
+  bool IsInitialized() const final;
+
+  size_t ByteSizeLong() const final;
+  const char* _InternalParse(const char* ptr, ::PROTOBUF_NAMESPACE_ID::internal::ParseContext* ctx) final;
+  ::PROTOBUF_NAMESPACE_ID::uint8* _InternalSerialize(
+      ::PROTOBUF_NAMESPACE_ID::uint8* target, ::PROTOBUF_NAMESPACE_ID::io::EpsCopyOutputStream* stream) const final;
+  int GetCachedSize() const final { return _cached_size_.Get(); }
+
+  private:
+  inline void SharedCtor();
+  inline void SharedDtor();
+  void SetCachedSize(int size) const final;
+  void InternalSwap(GetManyResponse* other);
+  friend class ::PROTOBUF_NAMESPACE_ID::internal::AnyMetadata;
+  static ::PROTOBUF_NAMESPACE_ID::StringPiece FullMessageName() {
+    return "hashdb.v1.GetManyResponse";
+  }
+  protected:
+  explicit GetManyResponse(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  private:
+  static void ArenaDtor(void* object);
+  inline void RegisterArenaDtor(::PROTOBUF_NAMESPACE_ID::Arena* arena);
+  public:
+
+  ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadata() const final;
+  private:
+  static ::PROTOBUF_NAMESPACE_ID::Metadata GetMetadataStatic() {
+    ::PROTOBUF_NAMESPACE_ID::internal::AssignDescriptors(&::descriptor_table_hashdb_2eproto);
+    return ::descriptor_table_hashdb_2eproto.file_level_metadata[kIndexInFileMessages];
+  }
+
+  public:
+
+  // nested types ----------------------------------------------------
+
+
+  // accessors -------------------------------------------------------
+
+  enum : int {
+    kGetResponseFieldNumber = 1,
+    kDbReadLogFieldNumber = 2,
+    kResultFieldNumber = 3,
+  };
+  // repeated .hashdb.v1.GetResponse get_response = 1;
+  int get_response_size() const;
+  private:
+  int _internal_get_response_size() const;
+  public:
+  void clear_get_response();
+  ::hashdb::v1::GetResponse* mutable_get_response(int index);
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >*
+      mutable_get_response();
+  private:
+  const ::hashdb::v1::GetResponse& _internal_get_response(int index) const;
+  ::hashdb::v1::GetResponse* _internal_add_get_response();
+  public:
+  const ::hashdb::v1::GetResponse& get_response(int index) const;
+  ::hashdb::v1::GetResponse* add_get_response();
+  const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >&
+      get_response() const;
+
+  // map<string, .hashdb.v1.FeList> db_read_log = 2;
+  int db_read_log_size() const;
+  private:
+  int _internal_db_read_log_size() const;
+  public:
+  void clear_db_read_log();
+  private:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+      _internal_db_read_log() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+      _internal_mutable_db_read_log();
+  public:
+  const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+      db_read_log() const;
+  ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+      mutable_db_read_log();
+
+  // .hashdb.v1.ResultCode result = 3;
+  bool has_result() const;
+  private:
+  bool _internal_has_result() const;
+  public:
+  void clear_result();
+  const ::hashdb::v1::ResultCode& result() const;
+  ::hashdb::v1::ResultCode* release_result();
+  ::hashdb::v1::ResultCode* mutable_result();
+  void set_allocated_result(::hashdb::v1::ResultCode* result);
+  private:
+  const ::hashdb::v1::ResultCode& _internal_result() const;
+  ::hashdb::v1::ResultCode* _internal_mutable_result();
+  public:
+  void unsafe_arena_set_allocated_result(
+      ::hashdb::v1::ResultCode* result);
+  ::hashdb::v1::ResultCode* unsafe_arena_release_result();
+
+  // @@protoc_insertion_point(class_scope:hashdb.v1.GetManyResponse)
+ private:
+  class _Internal;
+
+  template <typename T> friend class ::PROTOBUF_NAMESPACE_ID::Arena::InternalHelper;
+  typedef void InternalArenaConstructable_;
+  typedef void DestructorSkippable_;
+  ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse > get_response_;
+  ::PROTOBUF_NAMESPACE_ID::internal::MapField<
+      GetManyResponse_DbReadLogEntry_DoNotUse,
+      std::string, ::hashdb::v1::FeList,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_STRING,
+      ::PROTOBUF_NAMESPACE_ID::internal::WireFormatLite::TYPE_MESSAGE,
+      0 > db_read_log_;
+  ::hashdb::v1::ResultCode* result_;
+  mutable ::PROTOBUF_NAMESPACE_ID::internal::CachedSize _cached_size_;
+  friend struct ::TableStruct_hashdb_2eproto;
+};
 // ===================================================================
 
 
@@ -11877,22 +12830,273 @@ inline bool GetResponse::_internal_has_result() const {
 inline bool GetResponse::has_result() const {
   return _internal_has_result();
 }
-inline void GetResponse::clear_result() {
+inline void GetResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+}
+inline const ::hashdb::v1::ResultCode& GetResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
+}
+inline const ::hashdb::v1::ResultCode& GetResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetResponse.result)
+  return _internal_result();
+}
+inline void GetResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetResponse.result)
+}
+inline ::hashdb::v1::ResultCode* GetResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* GetResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* GetResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
+}
+inline ::hashdb::v1::ResultCode* GetResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetResponse.result)
+  return _internal_mutable_result();
+}
+inline void GetResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetResponse.result)
+}
+
+// -------------------------------------------------------------------
+
+// SetProgramResponse
+
+// .hashdb.v1.ResultCode result = 1;
+inline bool SetProgramResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
+}
+inline bool SetProgramResponse::has_result() const {
+  return _internal_has_result();
+}
+inline void SetProgramResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
+}
+inline const ::hashdb::v1::ResultCode& SetProgramResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
+}
+inline const ::hashdb::v1::ResultCode& SetProgramResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetProgramResponse.result)
+  return _internal_result();
+}
+inline void SetProgramResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetProgramResponse.result)
+}
+inline ::hashdb::v1::ResultCode* SetProgramResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* SetProgramResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.SetProgramResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* SetProgramResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
+}
+inline ::hashdb::v1::ResultCode* SetProgramResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetProgramResponse.result)
+  return _internal_mutable_result();
+}
+inline void SetProgramResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetProgramResponse.result)
+}
+
+// -------------------------------------------------------------------
+
+// GetProgramResponse
+
+// bytes data = 1;
+inline void GetProgramResponse::clear_data() {
+  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& GetProgramResponse::data() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetProgramResponse.data)
+  return _internal_data();
+}
+inline void GetProgramResponse::set_data(const std::string& value) {
+  _internal_set_data(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetProgramResponse.data)
+}
+inline std::string* GetProgramResponse::mutable_data() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetProgramResponse.data)
+  return _internal_mutable_data();
+}
+inline const std::string& GetProgramResponse::_internal_data() const {
+  return data_.Get();
+}
+inline void GetProgramResponse::_internal_set_data(const std::string& value) {
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void GetProgramResponse::set_data(std::string&& value) {
+  
+  data_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetProgramResponse.data)
+}
+inline void GetProgramResponse::set_data(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetProgramResponse.data)
+}
+inline void GetProgramResponse::set_data(const void* value,
+    size_t size) {
+  
+  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetProgramResponse.data)
+}
+inline std::string* GetProgramResponse::_internal_mutable_data() {
+  
+  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* GetProgramResponse::release_data() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetProgramResponse.data)
+  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void GetProgramResponse::set_allocated_data(std::string* data) {
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetProgramResponse.data)
+}
+inline std::string* GetProgramResponse::unsafe_arena_release_data() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetProgramResponse.data)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void GetProgramResponse::unsafe_arena_set_allocated_data(
+    std::string* data) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (data != nullptr) {
+    
+  } else {
+    
+  }
+  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      data, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetProgramResponse.data)
+}
+
+// .hashdb.v1.ResultCode result = 2;
+inline bool GetProgramResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
+}
+inline bool GetProgramResponse::has_result() const {
+  return _internal_has_result();
+}
+inline void GetProgramResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& GetResponse::_internal_result() const {
+inline const ::hashdb::v1::ResultCode& GetProgramResponse::_internal_result() const {
   const ::hashdb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
       &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& GetResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetResponse.result)
+inline const ::hashdb::v1::ResultCode& GetProgramResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetProgramResponse.result)
   return _internal_result();
 }
-inline void GetResponse::unsafe_arena_set_allocated_result(
+inline void GetProgramResponse::unsafe_arena_set_allocated_result(
     ::hashdb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -11903,23 +13107,23 @@ inline void GetResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetProgramResponse.result)
 }
-inline ::hashdb::v1::ResultCode* GetResponse::release_result() {
+inline ::hashdb::v1::ResultCode* GetProgramResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* GetResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.GetResponse.result)
+inline ::hashdb::v1::ResultCode* GetProgramResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetProgramResponse.result)
   
   ::hashdb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* GetResponse::_internal_mutable_result() {
+inline ::hashdb::v1::ResultCode* GetProgramResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
@@ -11927,11 +13131,11 @@ inline ::hashdb::v1::ResultCode* GetResponse::_internal_mutable_result() {
   }
   return result_;
 }
-inline ::hashdb::v1::ResultCode* GetResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetResponse.result)
+inline ::hashdb::v1::ResultCode* GetProgramResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetProgramResponse.result)
   return _internal_mutable_result();
 }
-inline void GetResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void GetProgramResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -11948,36 +13152,76 @@ inline void GetResponse::set_allocated_result(::hashdb::v1::ResultCode* result)
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetProgramResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// SetProgramResponse
+// FlushResponse
 
-// .hashdb.v1.ResultCode result = 1;
-inline bool SetProgramResponse::_internal_has_result() const {
+// uint64 flush_id = 1;
+inline void FlushResponse::clear_flush_id() {
+  flush_id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::_internal_flush_id() const {
+  return flush_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.FlushResponse.flush_id)
+  return _internal_flush_id();
+}
+inline void FlushResponse::_internal_set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  flush_id_ = value;
+}
+inline void FlushResponse::set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.FlushResponse.flush_id)
+}
+
+// uint64 stored_flush_id = 2;
+inline void FlushResponse::clear_stored_flush_id() {
+  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::_internal_stored_flush_id() const {
+  return stored_flush_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::stored_flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.FlushResponse.stored_flush_id)
+  return _internal_stored_flush_id();
+}
+inline void FlushResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  stored_flush_id_ = value;
+}
+inline void FlushResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_stored_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.FlushResponse.stored_flush_id)
+}
+
+// .hashdb.v1.ResultCode result = 3;
+inline bool FlushResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool SetProgramResponse::has_result() const {
+inline bool FlushResponse::has_result() const {
   return _internal_has_result();
 }
-inline void SetProgramResponse::clear_result() {
+inline void FlushResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& SetProgramResponse::_internal_result() const {
+inline const ::hashdb::v1::ResultCode& FlushResponse::_internal_result() const {
   const ::hashdb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
       &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& SetProgramResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.SetProgramResponse.result)
+inline const ::hashdb::v1::ResultCode& FlushResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.FlushResponse.result)
   return _internal_result();
 }
-inline void SetProgramResponse::unsafe_arena_set_allocated_result(
+inline void FlushResponse::unsafe_arena_set_allocated_result(
     ::hashdb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -11988,287 +13232,469 @@ inline void SetProgramResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetProgramResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.FlushResponse.result)
 }
-inline ::hashdb::v1::ResultCode* SetProgramResponse::release_result() {
+inline ::hashdb::v1::ResultCode* FlushResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* SetProgramResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.SetProgramResponse.result)
-  
-  ::hashdb::v1::ResultCode* temp = result_;
-  result_ = nullptr;
-  return temp;
+inline ::hashdb::v1::ResultCode* FlushResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.FlushResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* FlushResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
+}
+inline ::hashdb::v1::ResultCode* FlushResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.FlushResponse.result)
+  return _internal_mutable_result();
+}
+inline void FlushResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.FlushResponse.result)
+}
+
+// -------------------------------------------------------------------
+
+// GetFlushStatusResponse
+
+// uint64 stored_flush_id = 1;
+inline void GetFlushStatusResponse::clear_stored_flush_id() {
+  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_stored_flush_id() const {
+  return stored_flush_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::stored_flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.stored_flush_id)
+  return _internal_stored_flush_id();
+}
+inline void GetFlushStatusResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  stored_flush_id_ = value;
+}
+inline void GetFlushStatusResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_stored_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.stored_flush_id)
+}
+
+// uint64 storing_flush_id = 2;
+inline void GetFlushStatusResponse::clear_storing_flush_id() {
+  storing_flush_id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_storing_flush_id() const {
+  return storing_flush_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::storing_flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.storing_flush_id)
+  return _internal_storing_flush_id();
+}
+inline void GetFlushStatusResponse::_internal_set_storing_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  storing_flush_id_ = value;
+}
+inline void GetFlushStatusResponse::set_storing_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_storing_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.storing_flush_id)
+}
+
+// uint64 last_flush_id = 3;
+inline void GetFlushStatusResponse::clear_last_flush_id() {
+  last_flush_id_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_last_flush_id() const {
+  return last_flush_id_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::last_flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.last_flush_id)
+  return _internal_last_flush_id();
+}
+inline void GetFlushStatusResponse::_internal_set_last_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  last_flush_id_ = value;
+}
+inline void GetFlushStatusResponse::set_last_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_last_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.last_flush_id)
+}
+
+// uint64 pending_to_flush_nodes = 4;
+inline void GetFlushStatusResponse::clear_pending_to_flush_nodes() {
+  pending_to_flush_nodes_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_pending_to_flush_nodes() const {
+  return pending_to_flush_nodes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::pending_to_flush_nodes() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.pending_to_flush_nodes)
+  return _internal_pending_to_flush_nodes();
+}
+inline void GetFlushStatusResponse::_internal_set_pending_to_flush_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  pending_to_flush_nodes_ = value;
+}
+inline void GetFlushStatusResponse::set_pending_to_flush_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_pending_to_flush_nodes(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.pending_to_flush_nodes)
+}
+
+// uint64 pending_to_flush_program = 5;
+inline void GetFlushStatusResponse::clear_pending_to_flush_program() {
+  pending_to_flush_program_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_pending_to_flush_program() const {
+  return pending_to_flush_program_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::pending_to_flush_program() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.pending_to_flush_program)
+  return _internal_pending_to_flush_program();
+}
+inline void GetFlushStatusResponse::_internal_set_pending_to_flush_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  pending_to_flush_program_ = value;
+}
+inline void GetFlushStatusResponse::set_pending_to_flush_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_pending_to_flush_program(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.pending_to_flush_program)
+}
+
+// uint64 storing_nodes = 6;
+inline void GetFlushStatusResponse::clear_storing_nodes() {
+  storing_nodes_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_storing_nodes() const {
+  return storing_nodes_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::storing_nodes() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.storing_nodes)
+  return _internal_storing_nodes();
+}
+inline void GetFlushStatusResponse::_internal_set_storing_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  storing_nodes_ = value;
+}
+inline void GetFlushStatusResponse::set_storing_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_storing_nodes(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.storing_nodes)
+}
+
+// uint64 storing_program = 7;
+inline void GetFlushStatusResponse::clear_storing_program() {
+  storing_program_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_storing_program() const {
+  return storing_program_;
 }
-inline ::hashdb::v1::ResultCode* SetProgramResponse::_internal_mutable_result() {
-  
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
-    result_ = p;
-  }
-  return result_;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::storing_program() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.storing_program)
+  return _internal_storing_program();
 }
-inline ::hashdb::v1::ResultCode* SetProgramResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetProgramResponse.result)
-  return _internal_mutable_result();
+inline void GetFlushStatusResponse::_internal_set_storing_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  storing_program_ = value;
 }
-inline void SetProgramResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete result_;
-  }
-  if (result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
-    if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetProgramResponse.result)
+inline void GetFlushStatusResponse::set_storing_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_storing_program(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.storing_program)
 }
 
-// -------------------------------------------------------------------
-
-// GetProgramResponse
-
-// bytes data = 1;
-inline void GetProgramResponse::clear_data() {
-  data_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// string prover_id = 8;
+inline void GetFlushStatusResponse::clear_prover_id() {
+  prover_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline const std::string& GetProgramResponse::data() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetProgramResponse.data)
-  return _internal_data();
+inline const std::string& GetFlushStatusResponse::prover_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.prover_id)
+  return _internal_prover_id();
 }
-inline void GetProgramResponse::set_data(const std::string& value) {
-  _internal_set_data(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetProgramResponse.data)
+inline void GetFlushStatusResponse::set_prover_id(const std::string& value) {
+  _internal_set_prover_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.prover_id)
 }
-inline std::string* GetProgramResponse::mutable_data() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetProgramResponse.data)
-  return _internal_mutable_data();
+inline std::string* GetFlushStatusResponse::mutable_prover_id() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetFlushStatusResponse.prover_id)
+  return _internal_mutable_prover_id();
 }
-inline const std::string& GetProgramResponse::_internal_data() const {
-  return data_.Get();
+inline const std::string& GetFlushStatusResponse::_internal_prover_id() const {
+  return prover_id_.Get();
 }
-inline void GetProgramResponse::_internal_set_data(const std::string& value) {
+inline void GetFlushStatusResponse::_internal_set_prover_id(const std::string& value) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  prover_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void GetProgramResponse::set_data(std::string&& value) {
+inline void GetFlushStatusResponse::set_prover_id(std::string&& value) {
   
-  data_.Set(
+  prover_id_.Set(
     &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetFlushStatusResponse.prover_id)
 }
-inline void GetProgramResponse::set_data(const char* value) {
+inline void GetFlushStatusResponse::set_prover_id(const char* value) {
   GOOGLE_DCHECK(value != nullptr);
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+  prover_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
               GetArena());
-  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetFlushStatusResponse.prover_id)
 }
-inline void GetProgramResponse::set_data(const void* value,
+inline void GetFlushStatusResponse::set_prover_id(const char* value,
     size_t size) {
   
-  data_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+  prover_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
       reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetFlushStatusResponse.prover_id)
 }
-inline std::string* GetProgramResponse::_internal_mutable_data() {
+inline std::string* GetFlushStatusResponse::_internal_mutable_prover_id() {
   
-  return data_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+  return prover_id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline std::string* GetProgramResponse::release_data() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.GetProgramResponse.data)
-  return data_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline std::string* GetFlushStatusResponse::release_prover_id() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetFlushStatusResponse.prover_id)
+  return prover_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void GetProgramResponse::set_allocated_data(std::string* data) {
-  if (data != nullptr) {
+inline void GetFlushStatusResponse::set_allocated_prover_id(std::string* prover_id) {
+  if (prover_id != nullptr) {
     
   } else {
     
   }
-  data_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), data,
+  prover_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), prover_id,
       GetArena());
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetProgramResponse.data)
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetFlushStatusResponse.prover_id)
 }
-inline std::string* GetProgramResponse::unsafe_arena_release_data() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetProgramResponse.data)
+inline std::string* GetFlushStatusResponse::unsafe_arena_release_prover_id() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetFlushStatusResponse.prover_id)
   GOOGLE_DCHECK(GetArena() != nullptr);
   
-  return data_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+  return prover_id_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
       GetArena());
 }
-inline void GetProgramResponse::unsafe_arena_set_allocated_data(
-    std::string* data) {
+inline void GetFlushStatusResponse::unsafe_arena_set_allocated_prover_id(
+    std::string* prover_id) {
   GOOGLE_DCHECK(GetArena() != nullptr);
-  if (data != nullptr) {
+  if (prover_id != nullptr) {
     
   } else {
     
   }
-  data_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      data, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetProgramResponse.data)
+  prover_id_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      prover_id, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetFlushStatusResponse.prover_id)
 }
 
-// .hashdb.v1.ResultCode result = 2;
-inline bool GetProgramResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// GetFlushDataResponse
+
+// uint64 stored_flush_id = 1;
+inline void GetFlushDataResponse::clear_stored_flush_id() {
+  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
 }
-inline bool GetProgramResponse::has_result() const {
-  return _internal_has_result();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushDataResponse::_internal_stored_flush_id() const {
+  return stored_flush_id_;
 }
-inline void GetProgramResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
-  }
-  result_ = nullptr;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushDataResponse::stored_flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushDataResponse.stored_flush_id)
+  return _internal_stored_flush_id();
 }
-inline const ::hashdb::v1::ResultCode& GetProgramResponse::_internal_result() const {
-  const ::hashdb::v1::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
-      &::hashdb::v1::_ResultCode_default_instance_);
+inline void GetFlushDataResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  stored_flush_id_ = value;
 }
-inline const ::hashdb::v1::ResultCode& GetProgramResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetProgramResponse.result)
-  return _internal_result();
+inline void GetFlushDataResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_stored_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushDataResponse.stored_flush_id)
 }
-inline void GetProgramResponse::unsafe_arena_set_allocated_result(
-    ::hashdb::v1::ResultCode* result) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
-  }
-  result_ = result;
-  if (result) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetProgramResponse.result)
+
+// map<string, string> nodes = 2;
+inline int GetFlushDataResponse::_internal_nodes_size() const {
+  return nodes_.size();
 }
-inline ::hashdb::v1::ResultCode* GetProgramResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+inline int GetFlushDataResponse::nodes_size() const {
+  return _internal_nodes_size();
 }
-inline ::hashdb::v1::ResultCode* GetProgramResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.GetProgramResponse.result)
-  
-  ::hashdb::v1::ResultCode* temp = result_;
-  result_ = nullptr;
-  return temp;
+inline void GetFlushDataResponse::clear_nodes() {
+  nodes_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+GetFlushDataResponse::_internal_nodes() const {
+  return nodes_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+GetFlushDataResponse::nodes() const {
+  // @@protoc_insertion_point(field_map:hashdb.v1.GetFlushDataResponse.nodes)
+  return _internal_nodes();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+GetFlushDataResponse::_internal_mutable_nodes() {
+  return nodes_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+GetFlushDataResponse::mutable_nodes() {
+  // @@protoc_insertion_point(field_mutable_map:hashdb.v1.GetFlushDataResponse.nodes)
+  return _internal_mutable_nodes();
+}
+
+// map<string, string> program = 3;
+inline int GetFlushDataResponse::_internal_program_size() const {
+  return program_.size();
+}
+inline int GetFlushDataResponse::program_size() const {
+  return _internal_program_size();
+}
+inline void GetFlushDataResponse::clear_program() {
+  program_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+GetFlushDataResponse::_internal_program() const {
+  return program_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
+GetFlushDataResponse::program() const {
+  // @@protoc_insertion_point(field_map:hashdb.v1.GetFlushDataResponse.program)
+  return _internal_program();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+GetFlushDataResponse::_internal_mutable_program() {
+  return program_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
+GetFlushDataResponse::mutable_program() {
+  // @@protoc_insertion_point(field_mutable_map:hashdb.v1.GetFlushDataResponse.program)
+  return _internal_mutable_program();
+}
+
+// string nodes_state_root = 4;
+inline void GetFlushDataResponse::clear_nodes_state_root() {
+  nodes_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::hashdb::v1::ResultCode* GetProgramResponse::_internal_mutable_result() {
-  
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
-    result_ = p;
-  }
-  return result_;
+inline const std::string& GetFlushDataResponse::nodes_state_root() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+  return _internal_nodes_state_root();
 }
-inline ::hashdb::v1::ResultCode* GetProgramResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetProgramResponse.result)
-  return _internal_mutable_result();
+inline void GetFlushDataResponse::set_nodes_state_root(const std::string& value) {
+  _internal_set_nodes_state_root(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushDataResponse.nodes_state_root)
 }
-inline void GetProgramResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete result_;
-  }
-  if (result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
-    if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetProgramResponse.result)
+inline std::string* GetFlushDataResponse::mutable_nodes_state_root() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+  return _internal_mutable_nodes_state_root();
 }
-
-// -------------------------------------------------------------------
-
-// FlushResponse
-
-// uint64 flush_id = 1;
-inline void FlushResponse::clear_flush_id() {
-  flush_id_ = PROTOBUF_ULONGLONG(0);
+inline const std::string& GetFlushDataResponse::_internal_nodes_state_root() const {
+  return nodes_state_root_.Get();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::_internal_flush_id() const {
-  return flush_id_;
+inline void GetFlushDataResponse::_internal_set_nodes_state_root(const std::string& value) {
+  
+  nodes_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.FlushResponse.flush_id)
-  return _internal_flush_id();
+inline void GetFlushDataResponse::set_nodes_state_root(std::string&& value) {
+  
+  nodes_state_root_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetFlushDataResponse.nodes_state_root)
 }
-inline void FlushResponse::_internal_set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void GetFlushDataResponse::set_nodes_state_root(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
   
-  flush_id_ = value;
+  nodes_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetFlushDataResponse.nodes_state_root)
 }
-inline void FlushResponse::set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.FlushResponse.flush_id)
+inline void GetFlushDataResponse::set_nodes_state_root(const char* value,
+    size_t size) {
+  
+  nodes_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetFlushDataResponse.nodes_state_root)
 }
-
-// uint64 stored_flush_id = 2;
-inline void FlushResponse::clear_stored_flush_id() {
-  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
+inline std::string* GetFlushDataResponse::_internal_mutable_nodes_state_root() {
+  
+  return nodes_state_root_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::_internal_stored_flush_id() const {
-  return stored_flush_id_;
+inline std::string* GetFlushDataResponse::release_nodes_state_root() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+  return nodes_state_root_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 FlushResponse::stored_flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.FlushResponse.stored_flush_id)
-  return _internal_stored_flush_id();
+inline void GetFlushDataResponse::set_allocated_nodes_state_root(std::string* nodes_state_root) {
+  if (nodes_state_root != nullptr) {
+    
+  } else {
+    
+  }
+  nodes_state_root_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nodes_state_root,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetFlushDataResponse.nodes_state_root)
 }
-inline void FlushResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline std::string* GetFlushDataResponse::unsafe_arena_release_nodes_state_root() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+  GOOGLE_DCHECK(GetArena() != nullptr);
   
-  stored_flush_id_ = value;
+  return nodes_state_root_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
 }
-inline void FlushResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_stored_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.FlushResponse.stored_flush_id)
+inline void GetFlushDataResponse::unsafe_arena_set_allocated_nodes_state_root(
+    std::string* nodes_state_root) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (nodes_state_root != nullptr) {
+    
+  } else {
+    
+  }
+  nodes_state_root_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      nodes_state_root, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetFlushDataResponse.nodes_state_root)
 }
 
-// .hashdb.v1.ResultCode result = 3;
-inline bool FlushResponse::_internal_has_result() const {
+// .hashdb.v1.ResultCode result = 5;
+inline bool GetFlushDataResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool FlushResponse::has_result() const {
+inline bool GetFlushDataResponse::has_result() const {
   return _internal_has_result();
 }
-inline void FlushResponse::clear_result() {
+inline void GetFlushDataResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& FlushResponse::_internal_result() const {
+inline const ::hashdb::v1::ResultCode& GetFlushDataResponse::_internal_result() const {
   const ::hashdb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
       &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& FlushResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.FlushResponse.result)
+inline const ::hashdb::v1::ResultCode& GetFlushDataResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushDataResponse.result)
   return _internal_result();
 }
-inline void FlushResponse::unsafe_arena_set_allocated_result(
+inline void GetFlushDataResponse::unsafe_arena_set_allocated_result(
     ::hashdb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -12279,469 +13705,450 @@ inline void FlushResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.FlushResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetFlushDataResponse.result)
 }
-inline ::hashdb::v1::ResultCode* FlushResponse::release_result() {
+inline ::hashdb::v1::ResultCode* GetFlushDataResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* FlushResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.FlushResponse.result)
+inline ::hashdb::v1::ResultCode* GetFlushDataResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetFlushDataResponse.result)
   
   ::hashdb::v1::ResultCode* temp = result_;
   result_ = nullptr;
-  return temp;
-}
-inline ::hashdb::v1::ResultCode* FlushResponse::_internal_mutable_result() {
-  
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
-    result_ = p;
-  }
-  return result_;
-}
-inline ::hashdb::v1::ResultCode* FlushResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.FlushResponse.result)
-  return _internal_mutable_result();
-}
-inline void FlushResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete result_;
-  }
-  if (result) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
-    if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.FlushResponse.result)
-}
-
-// -------------------------------------------------------------------
-
-// GetFlushStatusResponse
-
-// uint64 stored_flush_id = 1;
-inline void GetFlushStatusResponse::clear_stored_flush_id() {
-  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_stored_flush_id() const {
-  return stored_flush_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::stored_flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.stored_flush_id)
-  return _internal_stored_flush_id();
-}
-inline void GetFlushStatusResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  stored_flush_id_ = value;
-}
-inline void GetFlushStatusResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_stored_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.stored_flush_id)
-}
-
-// uint64 storing_flush_id = 2;
-inline void GetFlushStatusResponse::clear_storing_flush_id() {
-  storing_flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_storing_flush_id() const {
-  return storing_flush_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::storing_flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.storing_flush_id)
-  return _internal_storing_flush_id();
-}
-inline void GetFlushStatusResponse::_internal_set_storing_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  storing_flush_id_ = value;
-}
-inline void GetFlushStatusResponse::set_storing_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_storing_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.storing_flush_id)
-}
-
-// uint64 last_flush_id = 3;
-inline void GetFlushStatusResponse::clear_last_flush_id() {
-  last_flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_last_flush_id() const {
-  return last_flush_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::last_flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.last_flush_id)
-  return _internal_last_flush_id();
-}
-inline void GetFlushStatusResponse::_internal_set_last_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  last_flush_id_ = value;
-}
-inline void GetFlushStatusResponse::set_last_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_last_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.last_flush_id)
-}
-
-// uint64 pending_to_flush_nodes = 4;
-inline void GetFlushStatusResponse::clear_pending_to_flush_nodes() {
-  pending_to_flush_nodes_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_pending_to_flush_nodes() const {
-  return pending_to_flush_nodes_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::pending_to_flush_nodes() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.pending_to_flush_nodes)
-  return _internal_pending_to_flush_nodes();
+  return temp;
 }
-inline void GetFlushStatusResponse::_internal_set_pending_to_flush_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline ::hashdb::v1::ResultCode* GetFlushDataResponse::_internal_mutable_result() {
   
-  pending_to_flush_nodes_ = value;
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
 }
-inline void GetFlushStatusResponse::set_pending_to_flush_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_pending_to_flush_nodes(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.pending_to_flush_nodes)
+inline ::hashdb::v1::ResultCode* GetFlushDataResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetFlushDataResponse.result)
+  return _internal_mutable_result();
+}
+inline void GetFlushDataResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetFlushDataResponse.result)
 }
 
-// uint64 pending_to_flush_program = 5;
-inline void GetFlushStatusResponse::clear_pending_to_flush_program() {
-  pending_to_flush_program_ = PROTOBUF_ULONGLONG(0);
+// -------------------------------------------------------------------
+
+// ConsolidateStateResponse
+
+// .hashdb.v1.Fea consolidated_state_root = 1;
+inline bool ConsolidateStateResponse::_internal_has_consolidated_state_root() const {
+  return this != internal_default_instance() && consolidated_state_root_ != nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_pending_to_flush_program() const {
-  return pending_to_flush_program_;
+inline bool ConsolidateStateResponse::has_consolidated_state_root() const {
+  return _internal_has_consolidated_state_root();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::pending_to_flush_program() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.pending_to_flush_program)
-  return _internal_pending_to_flush_program();
+inline void ConsolidateStateResponse::clear_consolidated_state_root() {
+  if (GetArena() == nullptr && consolidated_state_root_ != nullptr) {
+    delete consolidated_state_root_;
+  }
+  consolidated_state_root_ = nullptr;
 }
-inline void GetFlushStatusResponse::_internal_set_pending_to_flush_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  pending_to_flush_program_ = value;
+inline const ::hashdb::v1::Fea& ConsolidateStateResponse::_internal_consolidated_state_root() const {
+  const ::hashdb::v1::Fea* p = consolidated_state_root_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
+      &::hashdb::v1::_Fea_default_instance_);
 }
-inline void GetFlushStatusResponse::set_pending_to_flush_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_pending_to_flush_program(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.pending_to_flush_program)
+inline const ::hashdb::v1::Fea& ConsolidateStateResponse::consolidated_state_root() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
+  return _internal_consolidated_state_root();
 }
-
-// uint64 storing_nodes = 6;
-inline void GetFlushStatusResponse::clear_storing_nodes() {
-  storing_nodes_ = PROTOBUF_ULONGLONG(0);
+inline void ConsolidateStateResponse::unsafe_arena_set_allocated_consolidated_state_root(
+    ::hashdb::v1::Fea* consolidated_state_root) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(consolidated_state_root_);
+  }
+  consolidated_state_root_ = consolidated_state_root;
+  if (consolidated_state_root) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_storing_nodes() const {
-  return storing_nodes_;
+inline ::hashdb::v1::Fea* ConsolidateStateResponse::release_consolidated_state_root() {
+  auto temp = unsafe_arena_release_consolidated_state_root();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::storing_nodes() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.storing_nodes)
-  return _internal_storing_nodes();
+inline ::hashdb::v1::Fea* ConsolidateStateResponse::unsafe_arena_release_consolidated_state_root() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
+  
+  ::hashdb::v1::Fea* temp = consolidated_state_root_;
+  consolidated_state_root_ = nullptr;
+  return temp;
 }
-inline void GetFlushStatusResponse::_internal_set_storing_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline ::hashdb::v1::Fea* ConsolidateStateResponse::_internal_mutable_consolidated_state_root() {
   
-  storing_nodes_ = value;
+  if (consolidated_state_root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
+    consolidated_state_root_ = p;
+  }
+  return consolidated_state_root_;
 }
-inline void GetFlushStatusResponse::set_storing_nodes(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_storing_nodes(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.storing_nodes)
+inline ::hashdb::v1::Fea* ConsolidateStateResponse::mutable_consolidated_state_root() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
+  return _internal_mutable_consolidated_state_root();
+}
+inline void ConsolidateStateResponse::set_allocated_consolidated_state_root(::hashdb::v1::Fea* consolidated_state_root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete consolidated_state_root_;
+  }
+  if (consolidated_state_root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(consolidated_state_root);
+    if (message_arena != submessage_arena) {
+      consolidated_state_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, consolidated_state_root, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  consolidated_state_root_ = consolidated_state_root;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
 }
 
-// uint64 storing_program = 7;
-inline void GetFlushStatusResponse::clear_storing_program() {
-  storing_program_ = PROTOBUF_ULONGLONG(0);
+// uint64 flush_id = 2;
+inline void ConsolidateStateResponse::clear_flush_id() {
+  flush_id_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::_internal_storing_program() const {
-  return storing_program_;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::_internal_flush_id() const {
+  return flush_id_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushStatusResponse::storing_program() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.storing_program)
-  return _internal_storing_program();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.flush_id)
+  return _internal_flush_id();
 }
-inline void GetFlushStatusResponse::_internal_set_storing_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void ConsolidateStateResponse::_internal_set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  storing_program_ = value;
+  flush_id_ = value;
 }
-inline void GetFlushStatusResponse::set_storing_program(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_storing_program(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.storing_program)
+inline void ConsolidateStateResponse::set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.ConsolidateStateResponse.flush_id)
 }
 
-// string prover_id = 8;
-inline void GetFlushStatusResponse::clear_prover_id() {
-  prover_id_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
-}
-inline const std::string& GetFlushStatusResponse::prover_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushStatusResponse.prover_id)
-  return _internal_prover_id();
-}
-inline void GetFlushStatusResponse::set_prover_id(const std::string& value) {
-  _internal_set_prover_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushStatusResponse.prover_id)
+// uint64 stored_flush_id = 3;
+inline void ConsolidateStateResponse::clear_stored_flush_id() {
+  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
 }
-inline std::string* GetFlushStatusResponse::mutable_prover_id() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetFlushStatusResponse.prover_id)
-  return _internal_mutable_prover_id();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::_internal_stored_flush_id() const {
+  return stored_flush_id_;
 }
-inline const std::string& GetFlushStatusResponse::_internal_prover_id() const {
-  return prover_id_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::stored_flush_id() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.stored_flush_id)
+  return _internal_stored_flush_id();
 }
-inline void GetFlushStatusResponse::_internal_set_prover_id(const std::string& value) {
+inline void ConsolidateStateResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  prover_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+  stored_flush_id_ = value;
 }
-inline void GetFlushStatusResponse::set_prover_id(std::string&& value) {
-  
-  prover_id_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetFlushStatusResponse.prover_id)
+inline void ConsolidateStateResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_stored_flush_id(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.ConsolidateStateResponse.stored_flush_id)
 }
-inline void GetFlushStatusResponse::set_prover_id(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  prover_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetFlushStatusResponse.prover_id)
+
+// .hashdb.v1.ResultCode result = 4;
+inline bool ConsolidateStateResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
 }
-inline void GetFlushStatusResponse::set_prover_id(const char* value,
-    size_t size) {
-  
-  prover_id_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetFlushStatusResponse.prover_id)
+inline bool ConsolidateStateResponse::has_result() const {
+  return _internal_has_result();
 }
-inline std::string* GetFlushStatusResponse::_internal_mutable_prover_id() {
-  
-  return prover_id_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void ConsolidateStateResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
 }
-inline std::string* GetFlushStatusResponse::release_prover_id() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.GetFlushStatusResponse.prover_id)
-  return prover_id_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::hashdb::v1::ResultCode& ConsolidateStateResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline void GetFlushStatusResponse::set_allocated_prover_id(std::string* prover_id) {
-  if (prover_id != nullptr) {
+inline const ::hashdb::v1::ResultCode& ConsolidateStateResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.result)
+  return _internal_result();
+}
+inline void ConsolidateStateResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
     
   } else {
     
   }
-  prover_id_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), prover_id,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetFlushStatusResponse.prover_id)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ConsolidateStateResponse.result)
+}
+inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.ConsolidateStateResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
 }
-inline std::string* GetFlushStatusResponse::unsafe_arena_release_prover_id() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetFlushStatusResponse.prover_id)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::_internal_mutable_result() {
   
-  return prover_id_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
 }
-inline void GetFlushStatusResponse::unsafe_arena_set_allocated_prover_id(
-    std::string* prover_id) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (prover_id != nullptr) {
+inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.ConsolidateStateResponse.result)
+  return _internal_mutable_result();
+}
+inline void ConsolidateStateResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
     
   } else {
     
   }
-  prover_id_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      prover_id, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetFlushStatusResponse.prover_id)
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ConsolidateStateResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// -------------------------------------------------------------------
-
-// -------------------------------------------------------------------
-
-// GetFlushDataResponse
+// PurgeResponse
 
-// uint64 stored_flush_id = 1;
-inline void GetFlushDataResponse::clear_stored_flush_id() {
-  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushDataResponse::_internal_stored_flush_id() const {
-  return stored_flush_id_;
+// .hashdb.v1.ResultCode result = 1;
+inline bool PurgeResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 GetFlushDataResponse::stored_flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushDataResponse.stored_flush_id)
-  return _internal_stored_flush_id();
+inline bool PurgeResponse::has_result() const {
+  return _internal_has_result();
 }
-inline void GetFlushDataResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  stored_flush_id_ = value;
+inline void PurgeResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
 }
-inline void GetFlushDataResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_stored_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushDataResponse.stored_flush_id)
+inline const ::hashdb::v1::ResultCode& PurgeResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
 }
-
-// map<string, string> nodes = 2;
-inline int GetFlushDataResponse::_internal_nodes_size() const {
-  return nodes_.size();
+inline const ::hashdb::v1::ResultCode& PurgeResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.PurgeResponse.result)
+  return _internal_result();
 }
-inline int GetFlushDataResponse::nodes_size() const {
-  return _internal_nodes_size();
+inline void PurgeResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.PurgeResponse.result)
 }
-inline void GetFlushDataResponse::clear_nodes() {
-  nodes_.Clear();
+inline ::hashdb::v1::ResultCode* PurgeResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-GetFlushDataResponse::_internal_nodes() const {
-  return nodes_.GetMap();
+inline ::hashdb::v1::ResultCode* PurgeResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.PurgeResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-GetFlushDataResponse::nodes() const {
-  // @@protoc_insertion_point(field_map:hashdb.v1.GetFlushDataResponse.nodes)
-  return _internal_nodes();
+inline ::hashdb::v1::ResultCode* PurgeResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-GetFlushDataResponse::_internal_mutable_nodes() {
-  return nodes_.MutableMap();
+inline ::hashdb::v1::ResultCode* PurgeResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.PurgeResponse.result)
+  return _internal_mutable_result();
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-GetFlushDataResponse::mutable_nodes() {
-  // @@protoc_insertion_point(field_mutable_map:hashdb.v1.GetFlushDataResponse.nodes)
-  return _internal_mutable_nodes();
+inline void PurgeResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.PurgeResponse.result)
 }
 
-// map<string, string> program = 3;
-inline int GetFlushDataResponse::_internal_program_size() const {
-  return program_.size();
-}
-inline int GetFlushDataResponse::program_size() const {
-  return _internal_program_size();
+// -------------------------------------------------------------------
+
+// ReadTreeResponse
+
+// repeated .hashdb.v1.KeyValue key_value = 1;
+inline int ReadTreeResponse::_internal_key_value_size() const {
+  return key_value_.size();
 }
-inline void GetFlushDataResponse::clear_program() {
-  program_.Clear();
+inline int ReadTreeResponse::key_value_size() const {
+  return _internal_key_value_size();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-GetFlushDataResponse::_internal_program() const {
-  return program_.GetMap();
+inline void ReadTreeResponse::clear_key_value() {
+  key_value_.Clear();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >&
-GetFlushDataResponse::program() const {
-  // @@protoc_insertion_point(field_map:hashdb.v1.GetFlushDataResponse.program)
-  return _internal_program();
+inline ::hashdb::v1::KeyValue* ReadTreeResponse::mutable_key_value(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.ReadTreeResponse.key_value)
+  return key_value_.Mutable(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-GetFlushDataResponse::_internal_mutable_program() {
-  return program_.MutableMap();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >*
+ReadTreeResponse::mutable_key_value() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.ReadTreeResponse.key_value)
+  return &key_value_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, std::string >*
-GetFlushDataResponse::mutable_program() {
-  // @@protoc_insertion_point(field_mutable_map:hashdb.v1.GetFlushDataResponse.program)
-  return _internal_mutable_program();
+inline const ::hashdb::v1::KeyValue& ReadTreeResponse::_internal_key_value(int index) const {
+  return key_value_.Get(index);
 }
-
-// string nodes_state_root = 4;
-inline void GetFlushDataResponse::clear_nodes_state_root() {
-  nodes_state_root_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::hashdb::v1::KeyValue& ReadTreeResponse::key_value(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ReadTreeResponse.key_value)
+  return _internal_key_value(index);
 }
-inline const std::string& GetFlushDataResponse::nodes_state_root() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushDataResponse.nodes_state_root)
-  return _internal_nodes_state_root();
+inline ::hashdb::v1::KeyValue* ReadTreeResponse::_internal_add_key_value() {
+  return key_value_.Add();
 }
-inline void GetFlushDataResponse::set_nodes_state_root(const std::string& value) {
-  _internal_set_nodes_state_root(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+inline ::hashdb::v1::KeyValue* ReadTreeResponse::add_key_value() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.ReadTreeResponse.key_value)
+  return _internal_add_key_value();
 }
-inline std::string* GetFlushDataResponse::mutable_nodes_state_root() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetFlushDataResponse.nodes_state_root)
-  return _internal_mutable_nodes_state_root();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >&
+ReadTreeResponse::key_value() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.ReadTreeResponse.key_value)
+  return key_value_;
 }
-inline const std::string& GetFlushDataResponse::_internal_nodes_state_root() const {
-  return nodes_state_root_.Get();
+
+// repeated .hashdb.v1.HashValueGL hash_value = 2;
+inline int ReadTreeResponse::_internal_hash_value_size() const {
+  return hash_value_.size();
 }
-inline void GetFlushDataResponse::_internal_set_nodes_state_root(const std::string& value) {
-  
-  nodes_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline int ReadTreeResponse::hash_value_size() const {
+  return _internal_hash_value_size();
 }
-inline void GetFlushDataResponse::set_nodes_state_root(std::string&& value) {
-  
-  nodes_state_root_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+inline void ReadTreeResponse::clear_hash_value() {
+  hash_value_.Clear();
 }
-inline void GetFlushDataResponse::set_nodes_state_root(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  nodes_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+inline ::hashdb::v1::HashValueGL* ReadTreeResponse::mutable_hash_value(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.ReadTreeResponse.hash_value)
+  return hash_value_.Mutable(index);
 }
-inline void GetFlushDataResponse::set_nodes_state_root(const char* value,
-    size_t size) {
-  
-  nodes_state_root_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::HashValueGL >*
+ReadTreeResponse::mutable_hash_value() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.ReadTreeResponse.hash_value)
+  return &hash_value_;
 }
-inline std::string* GetFlushDataResponse::_internal_mutable_nodes_state_root() {
-  
-  return nodes_state_root_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::hashdb::v1::HashValueGL& ReadTreeResponse::_internal_hash_value(int index) const {
+  return hash_value_.Get(index);
 }
-inline std::string* GetFlushDataResponse::release_nodes_state_root() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.GetFlushDataResponse.nodes_state_root)
-  return nodes_state_root_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::hashdb::v1::HashValueGL& ReadTreeResponse::hash_value(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ReadTreeResponse.hash_value)
+  return _internal_hash_value(index);
 }
-inline void GetFlushDataResponse::set_allocated_nodes_state_root(std::string* nodes_state_root) {
-  if (nodes_state_root != nullptr) {
-    
-  } else {
-    
-  }
-  nodes_state_root_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), nodes_state_root,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+inline ::hashdb::v1::HashValueGL* ReadTreeResponse::_internal_add_hash_value() {
+  return hash_value_.Add();
 }
-inline std::string* GetFlushDataResponse::unsafe_arena_release_nodes_state_root() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetFlushDataResponse.nodes_state_root)
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  
-  return nodes_state_root_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+inline ::hashdb::v1::HashValueGL* ReadTreeResponse::add_hash_value() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.ReadTreeResponse.hash_value)
+  return _internal_add_hash_value();
 }
-inline void GetFlushDataResponse::unsafe_arena_set_allocated_nodes_state_root(
-    std::string* nodes_state_root) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (nodes_state_root != nullptr) {
-    
-  } else {
-    
-  }
-  nodes_state_root_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      nodes_state_root, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetFlushDataResponse.nodes_state_root)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::HashValueGL >&
+ReadTreeResponse::hash_value() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.ReadTreeResponse.hash_value)
+  return hash_value_;
 }
 
-// .hashdb.v1.ResultCode result = 5;
-inline bool GetFlushDataResponse::_internal_has_result() const {
+// .hashdb.v1.ResultCode result = 3;
+inline bool ReadTreeResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool GetFlushDataResponse::has_result() const {
+inline bool ReadTreeResponse::has_result() const {
   return _internal_has_result();
 }
-inline void GetFlushDataResponse::clear_result() {
+inline void ReadTreeResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& GetFlushDataResponse::_internal_result() const {
+inline const ::hashdb::v1::ResultCode& ReadTreeResponse::_internal_result() const {
   const ::hashdb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
       &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& GetFlushDataResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.GetFlushDataResponse.result)
+inline const ::hashdb::v1::ResultCode& ReadTreeResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ReadTreeResponse.result)
   return _internal_result();
 }
-inline void GetFlushDataResponse::unsafe_arena_set_allocated_result(
+inline void ReadTreeResponse::unsafe_arena_set_allocated_result(
     ::hashdb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -12752,23 +14159,23 @@ inline void GetFlushDataResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetFlushDataResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ReadTreeResponse.result)
 }
-inline ::hashdb::v1::ResultCode* GetFlushDataResponse::release_result() {
+inline ::hashdb::v1::ResultCode* ReadTreeResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* GetFlushDataResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.GetFlushDataResponse.result)
+inline ::hashdb::v1::ResultCode* ReadTreeResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.ReadTreeResponse.result)
   
   ::hashdb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* GetFlushDataResponse::_internal_mutable_result() {
+inline ::hashdb::v1::ResultCode* ReadTreeResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
@@ -12776,11 +14183,11 @@ inline ::hashdb::v1::ResultCode* GetFlushDataResponse::_internal_mutable_result(
   }
   return result_;
 }
-inline ::hashdb::v1::ResultCode* GetFlushDataResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetFlushDataResponse.result)
+inline ::hashdb::v1::ResultCode* ReadTreeResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.ReadTreeResponse.result)
   return _internal_mutable_result();
 }
-inline void GetFlushDataResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void ReadTreeResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -12797,157 +14204,36 @@ inline void GetFlushDataResponse::set_allocated_result(::hashdb::v1::ResultCode*
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetFlushDataResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ReadTreeResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// ConsolidateStateResponse
-
-// .hashdb.v1.Fea consolidated_state_root = 1;
-inline bool ConsolidateStateResponse::_internal_has_consolidated_state_root() const {
-  return this != internal_default_instance() && consolidated_state_root_ != nullptr;
-}
-inline bool ConsolidateStateResponse::has_consolidated_state_root() const {
-  return _internal_has_consolidated_state_root();
-}
-inline void ConsolidateStateResponse::clear_consolidated_state_root() {
-  if (GetArena() == nullptr && consolidated_state_root_ != nullptr) {
-    delete consolidated_state_root_;
-  }
-  consolidated_state_root_ = nullptr;
-}
-inline const ::hashdb::v1::Fea& ConsolidateStateResponse::_internal_consolidated_state_root() const {
-  const ::hashdb::v1::Fea* p = consolidated_state_root_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
-      &::hashdb::v1::_Fea_default_instance_);
-}
-inline const ::hashdb::v1::Fea& ConsolidateStateResponse::consolidated_state_root() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
-  return _internal_consolidated_state_root();
-}
-inline void ConsolidateStateResponse::unsafe_arena_set_allocated_consolidated_state_root(
-    ::hashdb::v1::Fea* consolidated_state_root) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(consolidated_state_root_);
-  }
-  consolidated_state_root_ = consolidated_state_root;
-  if (consolidated_state_root) {
-    
-  } else {
-    
-  }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
-}
-inline ::hashdb::v1::Fea* ConsolidateStateResponse::release_consolidated_state_root() {
-  auto temp = unsafe_arena_release_consolidated_state_root();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
-}
-inline ::hashdb::v1::Fea* ConsolidateStateResponse::unsafe_arena_release_consolidated_state_root() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
-  
-  ::hashdb::v1::Fea* temp = consolidated_state_root_;
-  consolidated_state_root_ = nullptr;
-  return temp;
-}
-inline ::hashdb::v1::Fea* ConsolidateStateResponse::_internal_mutable_consolidated_state_root() {
-  
-  if (consolidated_state_root_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
-    consolidated_state_root_ = p;
-  }
-  return consolidated_state_root_;
-}
-inline ::hashdb::v1::Fea* ConsolidateStateResponse::mutable_consolidated_state_root() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
-  return _internal_mutable_consolidated_state_root();
-}
-inline void ConsolidateStateResponse::set_allocated_consolidated_state_root(::hashdb::v1::Fea* consolidated_state_root) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete consolidated_state_root_;
-  }
-  if (consolidated_state_root) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(consolidated_state_root);
-    if (message_arena != submessage_arena) {
-      consolidated_state_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, consolidated_state_root, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  consolidated_state_root_ = consolidated_state_root;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ConsolidateStateResponse.consolidated_state_root)
-}
-
-// uint64 flush_id = 2;
-inline void ConsolidateStateResponse::clear_flush_id() {
-  flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::_internal_flush_id() const {
-  return flush_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.flush_id)
-  return _internal_flush_id();
-}
-inline void ConsolidateStateResponse::_internal_set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  flush_id_ = value;
-}
-inline void ConsolidateStateResponse::set_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.ConsolidateStateResponse.flush_id)
-}
-
-// uint64 stored_flush_id = 3;
-inline void ConsolidateStateResponse::clear_stored_flush_id() {
-  stored_flush_id_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::_internal_stored_flush_id() const {
-  return stored_flush_id_;
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 ConsolidateStateResponse::stored_flush_id() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.stored_flush_id)
-  return _internal_stored_flush_id();
-}
-inline void ConsolidateStateResponse::_internal_set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  stored_flush_id_ = value;
-}
-inline void ConsolidateStateResponse::set_stored_flush_id(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_stored_flush_id(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.ConsolidateStateResponse.stored_flush_id)
-}
+// CancelBatchResponse
 
-// .hashdb.v1.ResultCode result = 4;
-inline bool ConsolidateStateResponse::_internal_has_result() const {
+// .hashdb.v1.ResultCode result = 1;
+inline bool CancelBatchResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool ConsolidateStateResponse::has_result() const {
+inline bool CancelBatchResponse::has_result() const {
   return _internal_has_result();
 }
-inline void ConsolidateStateResponse::clear_result() {
+inline void CancelBatchResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& ConsolidateStateResponse::_internal_result() const {
+inline const ::hashdb::v1::ResultCode& CancelBatchResponse::_internal_result() const {
   const ::hashdb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
       &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& ConsolidateStateResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ConsolidateStateResponse.result)
+inline const ::hashdb::v1::ResultCode& CancelBatchResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.CancelBatchResponse.result)
   return _internal_result();
 }
-inline void ConsolidateStateResponse::unsafe_arena_set_allocated_result(
+inline void CancelBatchResponse::unsafe_arena_set_allocated_result(
     ::hashdb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -12958,23 +14244,23 @@ inline void ConsolidateStateResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ConsolidateStateResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.CancelBatchResponse.result)
 }
-inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::release_result() {
+inline ::hashdb::v1::ResultCode* CancelBatchResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.ConsolidateStateResponse.result)
+inline ::hashdb::v1::ResultCode* CancelBatchResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.CancelBatchResponse.result)
   
   ::hashdb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::_internal_mutable_result() {
+inline ::hashdb::v1::ResultCode* CancelBatchResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
@@ -12982,11 +14268,11 @@ inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::_internal_mutable_res
   }
   return result_;
 }
-inline ::hashdb::v1::ResultCode* ConsolidateStateResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.ConsolidateStateResponse.result)
+inline ::hashdb::v1::ResultCode* CancelBatchResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.CancelBatchResponse.result)
   return _internal_mutable_result();
 }
-inline void ConsolidateStateResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void CancelBatchResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -13003,36 +14289,36 @@ inline void ConsolidateStateResponse::set_allocated_result(::hashdb::v1::ResultC
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ConsolidateStateResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.CancelBatchResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// PurgeResponse
+// ResetDBResponse
 
 // .hashdb.v1.ResultCode result = 1;
-inline bool PurgeResponse::_internal_has_result() const {
+inline bool ResetDBResponse::_internal_has_result() const {
   return this != internal_default_instance() && result_ != nullptr;
 }
-inline bool PurgeResponse::has_result() const {
+inline bool ResetDBResponse::has_result() const {
   return _internal_has_result();
 }
-inline void PurgeResponse::clear_result() {
+inline void ResetDBResponse::clear_result() {
   if (GetArena() == nullptr && result_ != nullptr) {
     delete result_;
   }
   result_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& PurgeResponse::_internal_result() const {
+inline const ::hashdb::v1::ResultCode& ResetDBResponse::_internal_result() const {
   const ::hashdb::v1::ResultCode* p = result_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
       &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& PurgeResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.PurgeResponse.result)
+inline const ::hashdb::v1::ResultCode& ResetDBResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ResetDBResponse.result)
   return _internal_result();
 }
-inline void PurgeResponse::unsafe_arena_set_allocated_result(
+inline void ResetDBResponse::unsafe_arena_set_allocated_result(
     ::hashdb::v1::ResultCode* result) {
   if (GetArena() == nullptr) {
     delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
@@ -13043,23 +14329,23 @@ inline void PurgeResponse::unsafe_arena_set_allocated_result(
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.PurgeResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ResetDBResponse.result)
 }
-inline ::hashdb::v1::ResultCode* PurgeResponse::release_result() {
+inline ::hashdb::v1::ResultCode* ResetDBResponse::release_result() {
   auto temp = unsafe_arena_release_result();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* PurgeResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.PurgeResponse.result)
+inline ::hashdb::v1::ResultCode* ResetDBResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.ResetDBResponse.result)
   
   ::hashdb::v1::ResultCode* temp = result_;
   result_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* PurgeResponse::_internal_mutable_result() {
+inline ::hashdb::v1::ResultCode* ResetDBResponse::_internal_mutable_result() {
   
   if (result_ == nullptr) {
     auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
@@ -13067,11 +14353,11 @@ inline ::hashdb::v1::ResultCode* PurgeResponse::_internal_mutable_result() {
   }
   return result_;
 }
-inline ::hashdb::v1::ResultCode* PurgeResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.PurgeResponse.result)
+inline ::hashdb::v1::ResultCode* ResetDBResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.ResetDBResponse.result)
   return _internal_mutable_result();
 }
-inline void PurgeResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void ResetDBResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
     delete result_;
@@ -13088,1126 +14374,1734 @@ inline void PurgeResponse::set_allocated_result(::hashdb::v1::ResultCode* result
     
   }
   result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.PurgeResponse.result)
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ResetDBResponse.result)
+}
+
+// -------------------------------------------------------------------
+
+// Fea
+
+// uint64 fe0 = 1;
+inline void Fea::clear_fe0() {
+  fe0_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe0() const {
+  return fe0_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe0() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe0)
+  return _internal_fe0();
+}
+inline void Fea::_internal_set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe0_ = value;
+}
+inline void Fea::set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe0(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe0)
+}
+
+// uint64 fe1 = 2;
+inline void Fea::clear_fe1() {
+  fe1_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe1() const {
+  return fe1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe1() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe1)
+  return _internal_fe1();
+}
+inline void Fea::_internal_set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe1_ = value;
+}
+inline void Fea::set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe1(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe1)
+}
+
+// uint64 fe2 = 3;
+inline void Fea::clear_fe2() {
+  fe2_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe2() const {
+  return fe2_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe2() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe2)
+  return _internal_fe2();
+}
+inline void Fea::_internal_set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe2_ = value;
+}
+inline void Fea::set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe2(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe2)
+}
+
+// uint64 fe3 = 4;
+inline void Fea::clear_fe3() {
+  fe3_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe3() const {
+  return fe3_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe3() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe3)
+  return _internal_fe3();
+}
+inline void Fea::_internal_set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe3_ = value;
+}
+inline void Fea::set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe3(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe3)
+}
+
+// -------------------------------------------------------------------
+
+// Fea12
+
+// uint64 fe0 = 1;
+inline void Fea12::clear_fe0() {
+  fe0_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe0() const {
+  return fe0_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe0() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe0)
+  return _internal_fe0();
+}
+inline void Fea12::_internal_set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe0_ = value;
+}
+inline void Fea12::set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe0(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe0)
+}
+
+// uint64 fe1 = 2;
+inline void Fea12::clear_fe1() {
+  fe1_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe1() const {
+  return fe1_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe1() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe1)
+  return _internal_fe1();
+}
+inline void Fea12::_internal_set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe1_ = value;
+}
+inline void Fea12::set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe1(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe1)
+}
+
+// uint64 fe2 = 3;
+inline void Fea12::clear_fe2() {
+  fe2_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe2() const {
+  return fe2_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe2() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe2)
+  return _internal_fe2();
+}
+inline void Fea12::_internal_set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe2_ = value;
+}
+inline void Fea12::set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe2(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe2)
+}
+
+// uint64 fe3 = 4;
+inline void Fea12::clear_fe3() {
+  fe3_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe3() const {
+  return fe3_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe3() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe3)
+  return _internal_fe3();
+}
+inline void Fea12::_internal_set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe3_ = value;
+}
+inline void Fea12::set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe3(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe3)
+}
+
+// uint64 fe4 = 5;
+inline void Fea12::clear_fe4() {
+  fe4_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe4() const {
+  return fe4_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe4() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe4)
+  return _internal_fe4();
+}
+inline void Fea12::_internal_set_fe4(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe4_ = value;
+}
+inline void Fea12::set_fe4(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe4(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe4)
+}
+
+// uint64 fe5 = 6;
+inline void Fea12::clear_fe5() {
+  fe5_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe5() const {
+  return fe5_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe5() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe5)
+  return _internal_fe5();
+}
+inline void Fea12::_internal_set_fe5(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe5_ = value;
+}
+inline void Fea12::set_fe5(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe5(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe5)
+}
+
+// uint64 fe6 = 7;
+inline void Fea12::clear_fe6() {
+  fe6_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe6() const {
+  return fe6_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe6() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe6)
+  return _internal_fe6();
+}
+inline void Fea12::_internal_set_fe6(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe6_ = value;
+}
+inline void Fea12::set_fe6(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe6(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe6)
+}
+
+// uint64 fe7 = 8;
+inline void Fea12::clear_fe7() {
+  fe7_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe7() const {
+  return fe7_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe7() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe7)
+  return _internal_fe7();
+}
+inline void Fea12::_internal_set_fe7(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe7_ = value;
+}
+inline void Fea12::set_fe7(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe7(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe7)
 }
 
-// -------------------------------------------------------------------
-
-// ReadTreeResponse
-
-// repeated .hashdb.v1.KeyValue key_value = 1;
-inline int ReadTreeResponse::_internal_key_value_size() const {
-  return key_value_.size();
+// uint64 fe8 = 9;
+inline void Fea12::clear_fe8() {
+  fe8_ = PROTOBUF_ULONGLONG(0);
 }
-inline int ReadTreeResponse::key_value_size() const {
-  return _internal_key_value_size();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe8() const {
+  return fe8_;
 }
-inline void ReadTreeResponse::clear_key_value() {
-  key_value_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe8() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe8)
+  return _internal_fe8();
 }
-inline ::hashdb::v1::KeyValue* ReadTreeResponse::mutable_key_value(int index) {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.ReadTreeResponse.key_value)
-  return key_value_.Mutable(index);
+inline void Fea12::_internal_set_fe8(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe8_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >*
-ReadTreeResponse::mutable_key_value() {
-  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.ReadTreeResponse.key_value)
-  return &key_value_;
+inline void Fea12::set_fe8(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe8(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe8)
 }
-inline const ::hashdb::v1::KeyValue& ReadTreeResponse::_internal_key_value(int index) const {
-  return key_value_.Get(index);
+
+// uint64 fe9 = 10;
+inline void Fea12::clear_fe9() {
+  fe9_ = PROTOBUF_ULONGLONG(0);
 }
-inline const ::hashdb::v1::KeyValue& ReadTreeResponse::key_value(int index) const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ReadTreeResponse.key_value)
-  return _internal_key_value(index);
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe9() const {
+  return fe9_;
 }
-inline ::hashdb::v1::KeyValue* ReadTreeResponse::_internal_add_key_value() {
-  return key_value_.Add();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe9() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe9)
+  return _internal_fe9();
 }
-inline ::hashdb::v1::KeyValue* ReadTreeResponse::add_key_value() {
-  // @@protoc_insertion_point(field_add:hashdb.v1.ReadTreeResponse.key_value)
-  return _internal_add_key_value();
+inline void Fea12::_internal_set_fe9(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe9_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >&
-ReadTreeResponse::key_value() const {
-  // @@protoc_insertion_point(field_list:hashdb.v1.ReadTreeResponse.key_value)
-  return key_value_;
+inline void Fea12::set_fe9(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe9(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe9)
 }
 
-// repeated .hashdb.v1.HashValueGL hash_value = 2;
-inline int ReadTreeResponse::_internal_hash_value_size() const {
-  return hash_value_.size();
+// uint64 fe10 = 11;
+inline void Fea12::clear_fe10() {
+  fe10_ = PROTOBUF_ULONGLONG(0);
 }
-inline int ReadTreeResponse::hash_value_size() const {
-  return _internal_hash_value_size();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe10() const {
+  return fe10_;
 }
-inline void ReadTreeResponse::clear_hash_value() {
-  hash_value_.Clear();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe10() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe10)
+  return _internal_fe10();
 }
-inline ::hashdb::v1::HashValueGL* ReadTreeResponse::mutable_hash_value(int index) {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.ReadTreeResponse.hash_value)
-  return hash_value_.Mutable(index);
+inline void Fea12::_internal_set_fe10(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe10_ = value;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::HashValueGL >*
-ReadTreeResponse::mutable_hash_value() {
-  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.ReadTreeResponse.hash_value)
-  return &hash_value_;
+inline void Fea12::set_fe10(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe10(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe10)
 }
-inline const ::hashdb::v1::HashValueGL& ReadTreeResponse::_internal_hash_value(int index) const {
-  return hash_value_.Get(index);
+
+// uint64 fe11 = 12;
+inline void Fea12::clear_fe11() {
+  fe11_ = PROTOBUF_ULONGLONG(0);
 }
-inline const ::hashdb::v1::HashValueGL& ReadTreeResponse::hash_value(int index) const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ReadTreeResponse.hash_value)
-  return _internal_hash_value(index);
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe11() const {
+  return fe11_;
 }
-inline ::hashdb::v1::HashValueGL* ReadTreeResponse::_internal_add_hash_value() {
-  return hash_value_.Add();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe11() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe11)
+  return _internal_fe11();
 }
-inline ::hashdb::v1::HashValueGL* ReadTreeResponse::add_hash_value() {
-  // @@protoc_insertion_point(field_add:hashdb.v1.ReadTreeResponse.hash_value)
-  return _internal_add_hash_value();
+inline void Fea12::_internal_set_fe11(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  fe11_ = value;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::HashValueGL >&
-ReadTreeResponse::hash_value() const {
-  // @@protoc_insertion_point(field_list:hashdb.v1.ReadTreeResponse.hash_value)
-  return hash_value_;
+inline void Fea12::set_fe11(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_fe11(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe11)
 }
 
-// .hashdb.v1.ResultCode result = 3;
-inline bool ReadTreeResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+// -------------------------------------------------------------------
+
+// HashValueGL
+
+// .hashdb.v1.Fea hash = 1;
+inline bool HashValueGL::_internal_has_hash() const {
+  return this != internal_default_instance() && hash_ != nullptr;
 }
-inline bool ReadTreeResponse::has_result() const {
-  return _internal_has_result();
+inline bool HashValueGL::has_hash() const {
+  return _internal_has_hash();
 }
-inline void ReadTreeResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+inline void HashValueGL::clear_hash() {
+  if (GetArena() == nullptr && hash_ != nullptr) {
+    delete hash_;
   }
-  result_ = nullptr;
+  hash_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& ReadTreeResponse::_internal_result() const {
-  const ::hashdb::v1::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
-      &::hashdb::v1::_ResultCode_default_instance_);
+inline const ::hashdb::v1::Fea& HashValueGL::_internal_hash() const {
+  const ::hashdb::v1::Fea* p = hash_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
+      &::hashdb::v1::_Fea_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& ReadTreeResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ReadTreeResponse.result)
-  return _internal_result();
+inline const ::hashdb::v1::Fea& HashValueGL::hash() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.HashValueGL.hash)
+  return _internal_hash();
 }
-inline void ReadTreeResponse::unsafe_arena_set_allocated_result(
-    ::hashdb::v1::ResultCode* result) {
+inline void HashValueGL::unsafe_arena_set_allocated_hash(
+    ::hashdb::v1::Fea* hash) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(hash_);
   }
-  result_ = result;
-  if (result) {
+  hash_ = hash;
+  if (hash) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ReadTreeResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.HashValueGL.hash)
 }
-inline ::hashdb::v1::ResultCode* ReadTreeResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
+inline ::hashdb::v1::Fea* HashValueGL::release_hash() {
+  auto temp = unsafe_arena_release_hash();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* ReadTreeResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.ReadTreeResponse.result)
+inline ::hashdb::v1::Fea* HashValueGL::unsafe_arena_release_hash() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.HashValueGL.hash)
   
-  ::hashdb::v1::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::hashdb::v1::Fea* temp = hash_;
+  hash_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* ReadTreeResponse::_internal_mutable_result() {
+inline ::hashdb::v1::Fea* HashValueGL::_internal_mutable_hash() {
   
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
-    result_ = p;
+  if (hash_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
+    hash_ = p;
   }
-  return result_;
+  return hash_;
 }
-inline ::hashdb::v1::ResultCode* ReadTreeResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.ReadTreeResponse.result)
-  return _internal_mutable_result();
+inline ::hashdb::v1::Fea* HashValueGL::mutable_hash() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.HashValueGL.hash)
+  return _internal_mutable_hash();
 }
-inline void ReadTreeResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void HashValueGL::set_allocated_hash(::hashdb::v1::Fea* hash) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete result_;
+    delete hash_;
   }
-  if (result) {
+  if (hash) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(hash);
     if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
+      hash = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, hash, submessage_arena);
     }
     
   } else {
     
   }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ReadTreeResponse.result)
+  hash_ = hash;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.HashValueGL.hash)
 }
 
-// -------------------------------------------------------------------
-
-// CancelBatchResponse
-
-// .hashdb.v1.ResultCode result = 1;
-inline bool CancelBatchResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+// .hashdb.v1.Fea12 value = 2;
+inline bool HashValueGL::_internal_has_value() const {
+  return this != internal_default_instance() && value_ != nullptr;
 }
-inline bool CancelBatchResponse::has_result() const {
-  return _internal_has_result();
+inline bool HashValueGL::has_value() const {
+  return _internal_has_value();
 }
-inline void CancelBatchResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+inline void HashValueGL::clear_value() {
+  if (GetArena() == nullptr && value_ != nullptr) {
+    delete value_;
   }
-  result_ = nullptr;
+  value_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& CancelBatchResponse::_internal_result() const {
-  const ::hashdb::v1::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
-      &::hashdb::v1::_ResultCode_default_instance_);
+inline const ::hashdb::v1::Fea12& HashValueGL::_internal_value() const {
+  const ::hashdb::v1::Fea12* p = value_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea12*>(
+      &::hashdb::v1::_Fea12_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& CancelBatchResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.CancelBatchResponse.result)
-  return _internal_result();
+inline const ::hashdb::v1::Fea12& HashValueGL::value() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.HashValueGL.value)
+  return _internal_value();
 }
-inline void CancelBatchResponse::unsafe_arena_set_allocated_result(
-    ::hashdb::v1::ResultCode* result) {
+inline void HashValueGL::unsafe_arena_set_allocated_value(
+    ::hashdb::v1::Fea12* value) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value_);
   }
-  result_ = result;
-  if (result) {
+  value_ = value;
+  if (value) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.CancelBatchResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.HashValueGL.value)
 }
-inline ::hashdb::v1::ResultCode* CancelBatchResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
+inline ::hashdb::v1::Fea12* HashValueGL::release_value() {
+  auto temp = unsafe_arena_release_value();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* CancelBatchResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.CancelBatchResponse.result)
+inline ::hashdb::v1::Fea12* HashValueGL::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.HashValueGL.value)
   
-  ::hashdb::v1::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::hashdb::v1::Fea12* temp = value_;
+  value_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* CancelBatchResponse::_internal_mutable_result() {
+inline ::hashdb::v1::Fea12* HashValueGL::_internal_mutable_value() {
   
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
-    result_ = p;
+  if (value_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::Fea12>(GetArena());
+    value_ = p;
   }
-  return result_;
+  return value_;
 }
-inline ::hashdb::v1::ResultCode* CancelBatchResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.CancelBatchResponse.result)
-  return _internal_mutable_result();
+inline ::hashdb::v1::Fea12* HashValueGL::mutable_value() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.HashValueGL.value)
+  return _internal_mutable_value();
 }
-inline void CancelBatchResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void HashValueGL::set_allocated_value(::hashdb::v1::Fea12* value) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete result_;
+    delete value_;
   }
-  if (result) {
+  if (value) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(value);
     if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
+      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, value, submessage_arena);
     }
     
   } else {
     
   }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.CancelBatchResponse.result)
+  value_ = value;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.HashValueGL.value)
 }
 
 // -------------------------------------------------------------------
 
-// ResetDBResponse
+// KeyValue
 
-// .hashdb.v1.ResultCode result = 1;
-inline bool ResetDBResponse::_internal_has_result() const {
-  return this != internal_default_instance() && result_ != nullptr;
+// .hashdb.v1.Fea key = 1;
+inline bool KeyValue::_internal_has_key() const {
+  return this != internal_default_instance() && key_ != nullptr;
 }
-inline bool ResetDBResponse::has_result() const {
-  return _internal_has_result();
+inline bool KeyValue::has_key() const {
+  return _internal_has_key();
 }
-inline void ResetDBResponse::clear_result() {
-  if (GetArena() == nullptr && result_ != nullptr) {
-    delete result_;
+inline void KeyValue::clear_key() {
+  if (GetArena() == nullptr && key_ != nullptr) {
+    delete key_;
   }
-  result_ = nullptr;
+  key_ = nullptr;
 }
-inline const ::hashdb::v1::ResultCode& ResetDBResponse::_internal_result() const {
-  const ::hashdb::v1::ResultCode* p = result_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
-      &::hashdb::v1::_ResultCode_default_instance_);
+inline const ::hashdb::v1::Fea& KeyValue::_internal_key() const {
+  const ::hashdb::v1::Fea* p = key_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
+      &::hashdb::v1::_Fea_default_instance_);
 }
-inline const ::hashdb::v1::ResultCode& ResetDBResponse::result() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ResetDBResponse.result)
-  return _internal_result();
+inline const ::hashdb::v1::Fea& KeyValue::key() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.KeyValue.key)
+  return _internal_key();
 }
-inline void ResetDBResponse::unsafe_arena_set_allocated_result(
-    ::hashdb::v1::ResultCode* result) {
+inline void KeyValue::unsafe_arena_set_allocated_key(
+    ::hashdb::v1::Fea* key) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
   }
-  result_ = result;
-  if (result) {
+  key_ = key;
+  if (key) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.ResetDBResponse.result)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.KeyValue.key)
 }
-inline ::hashdb::v1::ResultCode* ResetDBResponse::release_result() {
-  auto temp = unsafe_arena_release_result();
+inline ::hashdb::v1::Fea* KeyValue::release_key() {
+  auto temp = unsafe_arena_release_key();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::ResultCode* ResetDBResponse::unsafe_arena_release_result() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.ResetDBResponse.result)
+inline ::hashdb::v1::Fea* KeyValue::unsafe_arena_release_key() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.KeyValue.key)
   
-  ::hashdb::v1::ResultCode* temp = result_;
-  result_ = nullptr;
+  ::hashdb::v1::Fea* temp = key_;
+  key_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::ResultCode* ResetDBResponse::_internal_mutable_result() {
+inline ::hashdb::v1::Fea* KeyValue::_internal_mutable_key() {
   
-  if (result_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
-    result_ = p;
+  if (key_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
+    key_ = p;
   }
-  return result_;
+  return key_;
 }
-inline ::hashdb::v1::ResultCode* ResetDBResponse::mutable_result() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.ResetDBResponse.result)
-  return _internal_mutable_result();
+inline ::hashdb::v1::Fea* KeyValue::mutable_key() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.KeyValue.key)
+  return _internal_mutable_key();
 }
-inline void ResetDBResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+inline void KeyValue::set_allocated_key(::hashdb::v1::Fea* key) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete result_;
+    delete key_;
   }
-  if (result) {
+  if (key) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
     if (message_arena != submessage_arena) {
-      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, result, submessage_arena);
+      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, key, submessage_arena);
     }
     
   } else {
     
   }
-  result_ = result;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.ResetDBResponse.result)
+  key_ = key;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.KeyValue.key)
 }
 
-// -------------------------------------------------------------------
-
-// Fea
-
-// uint64 fe0 = 1;
-inline void Fea::clear_fe0() {
-  fe0_ = PROTOBUF_ULONGLONG(0);
+// string value = 2;
+inline void KeyValue::clear_value() {
+  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe0() const {
-  return fe0_;
+inline const std::string& KeyValue::value() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.KeyValue.value)
+  return _internal_value();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe0() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe0)
-  return _internal_fe0();
+inline void KeyValue::set_value(const std::string& value) {
+  _internal_set_value(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.KeyValue.value)
 }
-inline void Fea::_internal_set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline std::string* KeyValue::mutable_value() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.KeyValue.value)
+  return _internal_mutable_value();
+}
+inline const std::string& KeyValue::_internal_value() const {
+  return value_.Get();
+}
+inline void KeyValue::_internal_set_value(const std::string& value) {
   
-  fe0_ = value;
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline void Fea::set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe0(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe0)
+inline void KeyValue::set_value(std::string&& value) {
+  
+  value_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.KeyValue.value)
 }
-
-// uint64 fe1 = 2;
-inline void Fea::clear_fe1() {
-  fe1_ = PROTOBUF_ULONGLONG(0);
+inline void KeyValue::set_value(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:hashdb.v1.KeyValue.value)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe1() const {
-  return fe1_;
+inline void KeyValue::set_value(const char* value,
+    size_t size) {
+  
+  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.KeyValue.value)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe1() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe1)
-  return _internal_fe1();
+inline std::string* KeyValue::_internal_mutable_value() {
+  
+  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void Fea::_internal_set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline std::string* KeyValue::release_value() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.KeyValue.value)
+  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void KeyValue::set_allocated_value(std::string* value) {
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.KeyValue.value)
+}
+inline std::string* KeyValue::unsafe_arena_release_value() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.KeyValue.value)
+  GOOGLE_DCHECK(GetArena() != nullptr);
   
-  fe1_ = value;
+  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
 }
-inline void Fea::set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe1(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe1)
+inline void KeyValue::unsafe_arena_set_allocated_value(
+    std::string* value) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (value != nullptr) {
+    
+  } else {
+    
+  }
+  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      value, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.KeyValue.value)
 }
 
-// uint64 fe2 = 3;
-inline void Fea::clear_fe2() {
-  fe2_ = PROTOBUF_ULONGLONG(0);
+// -------------------------------------------------------------------
+
+// FeList
+
+// repeated uint64 fe = 1;
+inline int FeList::_internal_fe_size() const {
+  return fe_.size();
+}
+inline int FeList::fe_size() const {
+  return _internal_fe_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe2() const {
-  return fe2_;
+inline void FeList::clear_fe() {
+  fe_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe2() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe2)
-  return _internal_fe2();
+inline ::PROTOBUF_NAMESPACE_ID::uint64 FeList::_internal_fe(int index) const {
+  return fe_.Get(index);
 }
-inline void Fea::_internal_set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe2_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 FeList::fe(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.FeList.fe)
+  return _internal_fe(index);
 }
-inline void Fea::set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe2(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe2)
+inline void FeList::set_fe(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  fe_.Set(index, value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.FeList.fe)
 }
-
-// uint64 fe3 = 4;
-inline void Fea::clear_fe3() {
-  fe3_ = PROTOBUF_ULONGLONG(0);
+inline void FeList::_internal_add_fe(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  fe_.Add(value);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::_internal_fe3() const {
-  return fe3_;
+inline void FeList::add_fe(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_fe(value);
+  // @@protoc_insertion_point(field_add:hashdb.v1.FeList.fe)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea::fe3() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea.fe3)
-  return _internal_fe3();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+FeList::_internal_fe() const {
+  return fe_;
 }
-inline void Fea::_internal_set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe3_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+FeList::fe() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.FeList.fe)
+  return _internal_fe();
 }
-inline void Fea::set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe3(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea.fe3)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+FeList::_internal_mutable_fe() {
+  return &fe_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+FeList::mutable_fe() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.FeList.fe)
+  return _internal_mutable_fe();
 }
 
 // -------------------------------------------------------------------
 
-// Fea12
+// SiblingList
 
-// uint64 fe0 = 1;
-inline void Fea12::clear_fe0() {
-  fe0_ = PROTOBUF_ULONGLONG(0);
+// repeated uint64 sibling = 1;
+inline int SiblingList::_internal_sibling_size() const {
+  return sibling_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe0() const {
-  return fe0_;
+inline int SiblingList::sibling_size() const {
+  return _internal_sibling_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe0() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe0)
-  return _internal_fe0();
+inline void SiblingList::clear_sibling() {
+  sibling_.Clear();
 }
-inline void Fea12::_internal_set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe0_ = value;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::_internal_sibling(int index) const {
+  return sibling_.Get(index);
 }
-inline void Fea12::set_fe0(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe0(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe0)
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::sibling(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SiblingList.sibling)
+  return _internal_sibling(index);
 }
-
-// uint64 fe1 = 2;
-inline void Fea12::clear_fe1() {
-  fe1_ = PROTOBUF_ULONGLONG(0);
+inline void SiblingList::set_sibling(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  sibling_.Set(index, value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SiblingList.sibling)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe1() const {
-  return fe1_;
+inline void SiblingList::_internal_add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  sibling_.Add(value);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe1() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe1)
-  return _internal_fe1();
+inline void SiblingList::add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_add_sibling(value);
+  // @@protoc_insertion_point(field_add:hashdb.v1.SiblingList.sibling)
 }
-inline void Fea12::_internal_set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe1_ = value;
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+SiblingList::_internal_sibling() const {
+  return sibling_;
 }
-inline void Fea12::set_fe1(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe1(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe1)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
+SiblingList::sibling() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.SiblingList.sibling)
+  return _internal_sibling();
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+SiblingList::_internal_mutable_sibling() {
+  return &sibling_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
+SiblingList::mutable_sibling() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.SiblingList.sibling)
+  return _internal_mutable_sibling();
 }
 
-// uint64 fe2 = 3;
-inline void Fea12::clear_fe2() {
-  fe2_ = PROTOBUF_ULONGLONG(0);
+// -------------------------------------------------------------------
+
+// ResultCode
+
+// .hashdb.v1.ResultCode.Code code = 1;
+inline void ResultCode::clear_code() {
+  code_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe2() const {
-  return fe2_;
+inline ::hashdb::v1::ResultCode_Code ResultCode::_internal_code() const {
+  return static_cast< ::hashdb::v1::ResultCode_Code >(code_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe2() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe2)
-  return _internal_fe2();
+inline ::hashdb::v1::ResultCode_Code ResultCode::code() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.ResultCode.code)
+  return _internal_code();
 }
-inline void Fea12::_internal_set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void ResultCode::_internal_set_code(::hashdb::v1::ResultCode_Code value) {
   
-  fe2_ = value;
+  code_ = value;
 }
-inline void Fea12::set_fe2(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe2(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe2)
+inline void ResultCode::set_code(::hashdb::v1::ResultCode_Code value) {
+  _internal_set_code(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.ResultCode.code)
 }
 
-// uint64 fe3 = 4;
-inline void Fea12::clear_fe3() {
-  fe3_ = PROTOBUF_ULONGLONG(0);
+// -------------------------------------------------------------------
+
+// SetManyRequest
+
+// .hashdb.v1.Fea old_root = 1;
+inline bool SetManyRequest::_internal_has_old_root() const {
+  return this != internal_default_instance() && old_root_ != nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe3() const {
-  return fe3_;
+inline bool SetManyRequest::has_old_root() const {
+  return _internal_has_old_root();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe3() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe3)
-  return _internal_fe3();
+inline void SetManyRequest::clear_old_root() {
+  if (GetArena() == nullptr && old_root_ != nullptr) {
+    delete old_root_;
+  }
+  old_root_ = nullptr;
 }
-inline void Fea12::_internal_set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe3_ = value;
+inline const ::hashdb::v1::Fea& SetManyRequest::_internal_old_root() const {
+  const ::hashdb::v1::Fea* p = old_root_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
+      &::hashdb::v1::_Fea_default_instance_);
 }
-inline void Fea12::set_fe3(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe3(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe3)
+inline const ::hashdb::v1::Fea& SetManyRequest::old_root() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.old_root)
+  return _internal_old_root();
 }
-
-// uint64 fe4 = 5;
-inline void Fea12::clear_fe4() {
-  fe4_ = PROTOBUF_ULONGLONG(0);
+inline void SetManyRequest::unsafe_arena_set_allocated_old_root(
+    ::hashdb::v1::Fea* old_root) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(old_root_);
+  }
+  old_root_ = old_root;
+  if (old_root) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetManyRequest.old_root)
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe4() const {
-  return fe4_;
+inline ::hashdb::v1::Fea* SetManyRequest::release_old_root() {
+  auto temp = unsafe_arena_release_old_root();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe4() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe4)
-  return _internal_fe4();
+inline ::hashdb::v1::Fea* SetManyRequest::unsafe_arena_release_old_root() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.SetManyRequest.old_root)
+  
+  ::hashdb::v1::Fea* temp = old_root_;
+  old_root_ = nullptr;
+  return temp;
 }
-inline void Fea12::_internal_set_fe4(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline ::hashdb::v1::Fea* SetManyRequest::_internal_mutable_old_root() {
   
-  fe4_ = value;
+  if (old_root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
+    old_root_ = p;
+  }
+  return old_root_;
 }
-inline void Fea12::set_fe4(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe4(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe4)
+inline ::hashdb::v1::Fea* SetManyRequest::mutable_old_root() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetManyRequest.old_root)
+  return _internal_mutable_old_root();
+}
+inline void SetManyRequest::set_allocated_old_root(::hashdb::v1::Fea* old_root) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete old_root_;
+  }
+  if (old_root) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(old_root);
+    if (message_arena != submessage_arena) {
+      old_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, old_root, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  old_root_ = old_root;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetManyRequest.old_root)
 }
 
-// uint64 fe5 = 6;
-inline void Fea12::clear_fe5() {
-  fe5_ = PROTOBUF_ULONGLONG(0);
+// repeated .hashdb.v1.KeyValue key_value = 2;
+inline int SetManyRequest::_internal_key_value_size() const {
+  return key_value_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe5() const {
-  return fe5_;
+inline int SetManyRequest::key_value_size() const {
+  return _internal_key_value_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe5() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe5)
-  return _internal_fe5();
+inline void SetManyRequest::clear_key_value() {
+  key_value_.Clear();
 }
-inline void Fea12::_internal_set_fe5(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe5_ = value;
+inline ::hashdb::v1::KeyValue* SetManyRequest::mutable_key_value(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetManyRequest.key_value)
+  return key_value_.Mutable(index);
 }
-inline void Fea12::set_fe5(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe5(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe5)
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >*
+SetManyRequest::mutable_key_value() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.SetManyRequest.key_value)
+  return &key_value_;
 }
-
-// uint64 fe6 = 7;
-inline void Fea12::clear_fe6() {
-  fe6_ = PROTOBUF_ULONGLONG(0);
+inline const ::hashdb::v1::KeyValue& SetManyRequest::_internal_key_value(int index) const {
+  return key_value_.Get(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe6() const {
-  return fe6_;
+inline const ::hashdb::v1::KeyValue& SetManyRequest::key_value(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.key_value)
+  return _internal_key_value(index);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe6() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe6)
-  return _internal_fe6();
+inline ::hashdb::v1::KeyValue* SetManyRequest::_internal_add_key_value() {
+  return key_value_.Add();
 }
-inline void Fea12::_internal_set_fe6(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe6_ = value;
+inline ::hashdb::v1::KeyValue* SetManyRequest::add_key_value() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.SetManyRequest.key_value)
+  return _internal_add_key_value();
 }
-inline void Fea12::set_fe6(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe6(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe6)
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::KeyValue >&
+SetManyRequest::key_value() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.SetManyRequest.key_value)
+  return key_value_;
 }
 
-// uint64 fe7 = 8;
-inline void Fea12::clear_fe7() {
-  fe7_ = PROTOBUF_ULONGLONG(0);
+// .hashdb.v1.Persistence persistence = 3;
+inline void SetManyRequest::clear_persistence() {
+  persistence_ = 0;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe7() const {
-  return fe7_;
+inline ::hashdb::v1::Persistence SetManyRequest::_internal_persistence() const {
+  return static_cast< ::hashdb::v1::Persistence >(persistence_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe7() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe7)
-  return _internal_fe7();
+inline ::hashdb::v1::Persistence SetManyRequest::persistence() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.persistence)
+  return _internal_persistence();
 }
-inline void Fea12::_internal_set_fe7(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void SetManyRequest::_internal_set_persistence(::hashdb::v1::Persistence value) {
   
-  fe7_ = value;
+  persistence_ = value;
 }
-inline void Fea12::set_fe7(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe7(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe7)
+inline void SetManyRequest::set_persistence(::hashdb::v1::Persistence value) {
+  _internal_set_persistence(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetManyRequest.persistence)
 }
 
-// uint64 fe8 = 9;
-inline void Fea12::clear_fe8() {
-  fe8_ = PROTOBUF_ULONGLONG(0);
+// bool details = 4;
+inline void SetManyRequest::clear_details() {
+  details_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe8() const {
-  return fe8_;
+inline bool SetManyRequest::_internal_details() const {
+  return details_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe8() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe8)
-  return _internal_fe8();
+inline bool SetManyRequest::details() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.details)
+  return _internal_details();
 }
-inline void Fea12::_internal_set_fe8(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void SetManyRequest::_internal_set_details(bool value) {
   
-  fe8_ = value;
+  details_ = value;
 }
-inline void Fea12::set_fe8(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe8(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe8)
+inline void SetManyRequest::set_details(bool value) {
+  _internal_set_details(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetManyRequest.details)
 }
 
-// uint64 fe9 = 10;
-inline void Fea12::clear_fe9() {
-  fe9_ = PROTOBUF_ULONGLONG(0);
+// bool get_db_read_log = 5;
+inline void SetManyRequest::clear_get_db_read_log() {
+  get_db_read_log_ = false;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe9() const {
-  return fe9_;
+inline bool SetManyRequest::_internal_get_db_read_log() const {
+  return get_db_read_log_;
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe9() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe9)
-  return _internal_fe9();
+inline bool SetManyRequest::get_db_read_log() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.get_db_read_log)
+  return _internal_get_db_read_log();
 }
-inline void Fea12::_internal_set_fe9(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void SetManyRequest::_internal_set_get_db_read_log(bool value) {
   
-  fe9_ = value;
+  get_db_read_log_ = value;
 }
-inline void Fea12::set_fe9(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe9(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe9)
+inline void SetManyRequest::set_get_db_read_log(bool value) {
+  _internal_set_get_db_read_log(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetManyRequest.get_db_read_log)
 }
 
-// uint64 fe10 = 11;
-inline void Fea12::clear_fe10() {
-  fe10_ = PROTOBUF_ULONGLONG(0);
-}
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe10() const {
-  return fe10_;
+// string batch_uuid = 6;
+inline void SetManyRequest::clear_batch_uuid() {
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe10() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe10)
-  return _internal_fe10();
+inline const std::string& SetManyRequest::batch_uuid() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.batch_uuid)
+  return _internal_batch_uuid();
 }
-inline void Fea12::_internal_set_fe10(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  
-  fe10_ = value;
+inline void SetManyRequest::set_batch_uuid(const std::string& value) {
+  _internal_set_batch_uuid(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetManyRequest.batch_uuid)
 }
-inline void Fea12::set_fe10(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe10(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe10)
+inline std::string* SetManyRequest::mutable_batch_uuid() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetManyRequest.batch_uuid)
+  return _internal_mutable_batch_uuid();
 }
-
-// uint64 fe11 = 12;
-inline void Fea12::clear_fe11() {
-  fe11_ = PROTOBUF_ULONGLONG(0);
+inline const std::string& SetManyRequest::_internal_batch_uuid() const {
+  return batch_uuid_.Get();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::_internal_fe11() const {
-  return fe11_;
+inline void SetManyRequest::_internal_set_batch_uuid(const std::string& value) {
+  
+  batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 Fea12::fe11() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.Fea12.fe11)
-  return _internal_fe11();
+inline void SetManyRequest::set_batch_uuid(std::string&& value) {
+  
+  batch_uuid_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.SetManyRequest.batch_uuid)
 }
-inline void Fea12::_internal_set_fe11(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+inline void SetManyRequest::set_batch_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
   
-  fe11_ = value;
+  batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:hashdb.v1.SetManyRequest.batch_uuid)
 }
-inline void Fea12::set_fe11(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_set_fe11(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.Fea12.fe11)
+inline void SetManyRequest::set_batch_uuid(const char* value,
+    size_t size) {
+  
+  batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.SetManyRequest.batch_uuid)
 }
-
-// -------------------------------------------------------------------
-
-// HashValueGL
-
-// .hashdb.v1.Fea hash = 1;
-inline bool HashValueGL::_internal_has_hash() const {
-  return this != internal_default_instance() && hash_ != nullptr;
+inline std::string* SetManyRequest::_internal_mutable_batch_uuid() {
+  
+  return batch_uuid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline bool HashValueGL::has_hash() const {
-  return _internal_has_hash();
+inline std::string* SetManyRequest::release_batch_uuid() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.SetManyRequest.batch_uuid)
+  return batch_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
 }
-inline void HashValueGL::clear_hash() {
-  if (GetArena() == nullptr && hash_ != nullptr) {
-    delete hash_;
+inline void SetManyRequest::set_allocated_batch_uuid(std::string* batch_uuid) {
+  if (batch_uuid != nullptr) {
+    
+  } else {
+    
   }
-  hash_ = nullptr;
-}
-inline const ::hashdb::v1::Fea& HashValueGL::_internal_hash() const {
-  const ::hashdb::v1::Fea* p = hash_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
-      &::hashdb::v1::_Fea_default_instance_);
+  batch_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), batch_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetManyRequest.batch_uuid)
 }
-inline const ::hashdb::v1::Fea& HashValueGL::hash() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.HashValueGL.hash)
-  return _internal_hash();
+inline std::string* SetManyRequest::unsafe_arena_release_batch_uuid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.SetManyRequest.batch_uuid)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return batch_uuid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
 }
-inline void HashValueGL::unsafe_arena_set_allocated_hash(
-    ::hashdb::v1::Fea* hash) {
-  if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(hash_);
-  }
-  hash_ = hash;
-  if (hash) {
+inline void SetManyRequest::unsafe_arena_set_allocated_batch_uuid(
+    std::string* batch_uuid) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (batch_uuid != nullptr) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.HashValueGL.hash)
+  batch_uuid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      batch_uuid, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetManyRequest.batch_uuid)
 }
-inline ::hashdb::v1::Fea* HashValueGL::release_hash() {
-  auto temp = unsafe_arena_release_hash();
-  if (GetArena() != nullptr) {
-    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
-  }
-  return temp;
+
+// uint64 tx_index = 7;
+inline void SetManyRequest::clear_tx_index() {
+  tx_index_ = PROTOBUF_ULONGLONG(0);
 }
-inline ::hashdb::v1::Fea* HashValueGL::unsafe_arena_release_hash() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.HashValueGL.hash)
-  
-  ::hashdb::v1::Fea* temp = hash_;
-  hash_ = nullptr;
-  return temp;
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SetManyRequest::_internal_tx_index() const {
+  return tx_index_;
 }
-inline ::hashdb::v1::Fea* HashValueGL::_internal_mutable_hash() {
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SetManyRequest::tx_index() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.tx_index)
+  return _internal_tx_index();
+}
+inline void SetManyRequest::_internal_set_tx_index(::PROTOBUF_NAMESPACE_ID::uint64 value) {
   
-  if (hash_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
-    hash_ = p;
-  }
-  return hash_;
+  tx_index_ = value;
 }
-inline ::hashdb::v1::Fea* HashValueGL::mutable_hash() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.HashValueGL.hash)
-  return _internal_mutable_hash();
+inline void SetManyRequest::set_tx_index(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_tx_index(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetManyRequest.tx_index)
 }
-inline void HashValueGL::set_allocated_hash(::hashdb::v1::Fea* hash) {
-  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
-  if (message_arena == nullptr) {
-    delete hash_;
-  }
-  if (hash) {
-    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(hash);
-    if (message_arena != submessage_arena) {
-      hash = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, hash, submessage_arena);
-    }
-    
-  } else {
-    
-  }
-  hash_ = hash;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.HashValueGL.hash)
+
+// uint64 block_index = 8;
+inline void SetManyRequest::clear_block_index() {
+  block_index_ = PROTOBUF_ULONGLONG(0);
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SetManyRequest::_internal_block_index() const {
+  return block_index_;
+}
+inline ::PROTOBUF_NAMESPACE_ID::uint64 SetManyRequest::block_index() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyRequest.block_index)
+  return _internal_block_index();
+}
+inline void SetManyRequest::_internal_set_block_index(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  
+  block_index_ = value;
+}
+inline void SetManyRequest::set_block_index(::PROTOBUF_NAMESPACE_ID::uint64 value) {
+  _internal_set_block_index(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.SetManyRequest.block_index)
 }
 
-// .hashdb.v1.Fea12 value = 2;
-inline bool HashValueGL::_internal_has_value() const {
-  return this != internal_default_instance() && value_ != nullptr;
+// -------------------------------------------------------------------
+
+// GetManyRequest
+
+// .hashdb.v1.Fea root = 1;
+inline bool GetManyRequest::_internal_has_root() const {
+  return this != internal_default_instance() && root_ != nullptr;
 }
-inline bool HashValueGL::has_value() const {
-  return _internal_has_value();
+inline bool GetManyRequest::has_root() const {
+  return _internal_has_root();
 }
-inline void HashValueGL::clear_value() {
-  if (GetArena() == nullptr && value_ != nullptr) {
-    delete value_;
+inline void GetManyRequest::clear_root() {
+  if (GetArena() == nullptr && root_ != nullptr) {
+    delete root_;
   }
-  value_ = nullptr;
+  root_ = nullptr;
 }
-inline const ::hashdb::v1::Fea12& HashValueGL::_internal_value() const {
-  const ::hashdb::v1::Fea12* p = value_;
-  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea12*>(
-      &::hashdb::v1::_Fea12_default_instance_);
+inline const ::hashdb::v1::Fea& GetManyRequest::_internal_root() const {
+  const ::hashdb::v1::Fea* p = root_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
+      &::hashdb::v1::_Fea_default_instance_);
 }
-inline const ::hashdb::v1::Fea12& HashValueGL::value() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.HashValueGL.value)
-  return _internal_value();
+inline const ::hashdb::v1::Fea& GetManyRequest::root() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyRequest.root)
+  return _internal_root();
 }
-inline void HashValueGL::unsafe_arena_set_allocated_value(
-    ::hashdb::v1::Fea12* value) {
+inline void GetManyRequest::unsafe_arena_set_allocated_root(
+    ::hashdb::v1::Fea* root) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(value_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(root_);
   }
-  value_ = value;
-  if (value) {
+  root_ = root;
+  if (root) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.HashValueGL.value)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetManyRequest.root)
 }
-inline ::hashdb::v1::Fea12* HashValueGL::release_value() {
-  auto temp = unsafe_arena_release_value();
+inline ::hashdb::v1::Fea* GetManyRequest::release_root() {
+  auto temp = unsafe_arena_release_root();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::Fea12* HashValueGL::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.HashValueGL.value)
+inline ::hashdb::v1::Fea* GetManyRequest::unsafe_arena_release_root() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetManyRequest.root)
   
-  ::hashdb::v1::Fea12* temp = value_;
-  value_ = nullptr;
+  ::hashdb::v1::Fea* temp = root_;
+  root_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::Fea12* HashValueGL::_internal_mutable_value() {
+inline ::hashdb::v1::Fea* GetManyRequest::_internal_mutable_root() {
   
-  if (value_ == nullptr) {
-    auto* p = CreateMaybeMessage<::hashdb::v1::Fea12>(GetArena());
-    value_ = p;
+  if (root_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
+    root_ = p;
   }
-  return value_;
+  return root_;
 }
-inline ::hashdb::v1::Fea12* HashValueGL::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.HashValueGL.value)
-  return _internal_mutable_value();
+inline ::hashdb::v1::Fea* GetManyRequest::mutable_root() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetManyRequest.root)
+  return _internal_mutable_root();
 }
-inline void HashValueGL::set_allocated_value(::hashdb::v1::Fea12* value) {
+inline void GetManyRequest::set_allocated_root(::hashdb::v1::Fea* root) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete value_;
+    delete root_;
   }
-  if (value) {
+  if (root) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(value);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(root);
     if (message_arena != submessage_arena) {
-      value = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, value, submessage_arena);
+      root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, root, submessage_arena);
     }
     
   } else {
     
   }
-  value_ = value;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.HashValueGL.value)
+  root_ = root;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetManyRequest.root)
+}
+
+// repeated .hashdb.v1.Fea key = 2;
+inline int GetManyRequest::_internal_key_size() const {
+  return key_.size();
+}
+inline int GetManyRequest::key_size() const {
+  return _internal_key_size();
+}
+inline void GetManyRequest::clear_key() {
+  key_.Clear();
+}
+inline ::hashdb::v1::Fea* GetManyRequest::mutable_key(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetManyRequest.key)
+  return key_.Mutable(index);
+}
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::Fea >*
+GetManyRequest::mutable_key() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.GetManyRequest.key)
+  return &key_;
+}
+inline const ::hashdb::v1::Fea& GetManyRequest::_internal_key(int index) const {
+  return key_.Get(index);
+}
+inline const ::hashdb::v1::Fea& GetManyRequest::key(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyRequest.key)
+  return _internal_key(index);
+}
+inline ::hashdb::v1::Fea* GetManyRequest::_internal_add_key() {
+  return key_.Add();
+}
+inline ::hashdb::v1::Fea* GetManyRequest::add_key() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.GetManyRequest.key)
+  return _internal_add_key();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::Fea >&
+GetManyRequest::key() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.GetManyRequest.key)
+  return key_;
+}
+
+// bool details = 3;
+inline void GetManyRequest::clear_details() {
+  details_ = false;
+}
+inline bool GetManyRequest::_internal_details() const {
+  return details_;
+}
+inline bool GetManyRequest::details() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyRequest.details)
+  return _internal_details();
+}
+inline void GetManyRequest::_internal_set_details(bool value) {
+  
+  details_ = value;
+}
+inline void GetManyRequest::set_details(bool value) {
+  _internal_set_details(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetManyRequest.details)
+}
+
+// bool get_db_read_log = 4;
+inline void GetManyRequest::clear_get_db_read_log() {
+  get_db_read_log_ = false;
+}
+inline bool GetManyRequest::_internal_get_db_read_log() const {
+  return get_db_read_log_;
+}
+inline bool GetManyRequest::get_db_read_log() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyRequest.get_db_read_log)
+  return _internal_get_db_read_log();
+}
+inline void GetManyRequest::_internal_set_get_db_read_log(bool value) {
+  
+  get_db_read_log_ = value;
+}
+inline void GetManyRequest::set_get_db_read_log(bool value) {
+  _internal_set_get_db_read_log(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetManyRequest.get_db_read_log)
+}
+
+// string batch_uuid = 5;
+inline void GetManyRequest::clear_batch_uuid() {
+  batch_uuid_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline const std::string& GetManyRequest::batch_uuid() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyRequest.batch_uuid)
+  return _internal_batch_uuid();
+}
+inline void GetManyRequest::set_batch_uuid(const std::string& value) {
+  _internal_set_batch_uuid(value);
+  // @@protoc_insertion_point(field_set:hashdb.v1.GetManyRequest.batch_uuid)
+}
+inline std::string* GetManyRequest::mutable_batch_uuid() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetManyRequest.batch_uuid)
+  return _internal_mutable_batch_uuid();
+}
+inline const std::string& GetManyRequest::_internal_batch_uuid() const {
+  return batch_uuid_.Get();
+}
+inline void GetManyRequest::_internal_set_batch_uuid(const std::string& value) {
+  
+  batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+}
+inline void GetManyRequest::set_batch_uuid(std::string&& value) {
+  
+  batch_uuid_.Set(
+    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
+  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.GetManyRequest.batch_uuid)
+}
+inline void GetManyRequest::set_batch_uuid(const char* value) {
+  GOOGLE_DCHECK(value != nullptr);
+  
+  batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
+              GetArena());
+  // @@protoc_insertion_point(field_set_char:hashdb.v1.GetManyRequest.batch_uuid)
+}
+inline void GetManyRequest::set_batch_uuid(const char* value,
+    size_t size) {
+  
+  batch_uuid_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
+      reinterpret_cast<const char*>(value), size), GetArena());
+  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.GetManyRequest.batch_uuid)
+}
+inline std::string* GetManyRequest::_internal_mutable_batch_uuid() {
+  
+  return batch_uuid_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline std::string* GetManyRequest::release_batch_uuid() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetManyRequest.batch_uuid)
+  return batch_uuid_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+}
+inline void GetManyRequest::set_allocated_batch_uuid(std::string* batch_uuid) {
+  if (batch_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  batch_uuid_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), batch_uuid,
+      GetArena());
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetManyRequest.batch_uuid)
+}
+inline std::string* GetManyRequest::unsafe_arena_release_batch_uuid() {
+  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.GetManyRequest.batch_uuid)
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  
+  return batch_uuid_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      GetArena());
+}
+inline void GetManyRequest::unsafe_arena_set_allocated_batch_uuid(
+    std::string* batch_uuid) {
+  GOOGLE_DCHECK(GetArena() != nullptr);
+  if (batch_uuid != nullptr) {
+    
+  } else {
+    
+  }
+  batch_uuid_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
+      batch_uuid, GetArena());
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetManyRequest.batch_uuid)
 }
 
 // -------------------------------------------------------------------
 
-// KeyValue
+// -------------------------------------------------------------------
 
-// .hashdb.v1.Fea key = 1;
-inline bool KeyValue::_internal_has_key() const {
-  return this != internal_default_instance() && key_ != nullptr;
+// SetManyResponse
+
+// .hashdb.v1.Fea new_root = 1;
+inline bool SetManyResponse::_internal_has_new_root() const {
+  return this != internal_default_instance() && new_root_ != nullptr;
 }
-inline bool KeyValue::has_key() const {
-  return _internal_has_key();
+inline bool SetManyResponse::has_new_root() const {
+  return _internal_has_new_root();
 }
-inline void KeyValue::clear_key() {
-  if (GetArena() == nullptr && key_ != nullptr) {
-    delete key_;
+inline void SetManyResponse::clear_new_root() {
+  if (GetArena() == nullptr && new_root_ != nullptr) {
+    delete new_root_;
   }
-  key_ = nullptr;
+  new_root_ = nullptr;
 }
-inline const ::hashdb::v1::Fea& KeyValue::_internal_key() const {
-  const ::hashdb::v1::Fea* p = key_;
+inline const ::hashdb::v1::Fea& SetManyResponse::_internal_new_root() const {
+  const ::hashdb::v1::Fea* p = new_root_;
   return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::Fea*>(
       &::hashdb::v1::_Fea_default_instance_);
 }
-inline const ::hashdb::v1::Fea& KeyValue::key() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.KeyValue.key)
-  return _internal_key();
+inline const ::hashdb::v1::Fea& SetManyResponse::new_root() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyResponse.new_root)
+  return _internal_new_root();
 }
-inline void KeyValue::unsafe_arena_set_allocated_key(
-    ::hashdb::v1::Fea* key) {
+inline void SetManyResponse::unsafe_arena_set_allocated_new_root(
+    ::hashdb::v1::Fea* new_root) {
   if (GetArena() == nullptr) {
-    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(key_);
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(new_root_);
   }
-  key_ = key;
-  if (key) {
+  new_root_ = new_root;
+  if (new_root) {
     
   } else {
     
   }
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.KeyValue.key)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetManyResponse.new_root)
 }
-inline ::hashdb::v1::Fea* KeyValue::release_key() {
-  auto temp = unsafe_arena_release_key();
+inline ::hashdb::v1::Fea* SetManyResponse::release_new_root() {
+  auto temp = unsafe_arena_release_new_root();
   if (GetArena() != nullptr) {
     temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
   }
   return temp;
 }
-inline ::hashdb::v1::Fea* KeyValue::unsafe_arena_release_key() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.KeyValue.key)
+inline ::hashdb::v1::Fea* SetManyResponse::unsafe_arena_release_new_root() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.SetManyResponse.new_root)
   
-  ::hashdb::v1::Fea* temp = key_;
-  key_ = nullptr;
+  ::hashdb::v1::Fea* temp = new_root_;
+  new_root_ = nullptr;
   return temp;
 }
-inline ::hashdb::v1::Fea* KeyValue::_internal_mutable_key() {
+inline ::hashdb::v1::Fea* SetManyResponse::_internal_mutable_new_root() {
   
-  if (key_ == nullptr) {
+  if (new_root_ == nullptr) {
     auto* p = CreateMaybeMessage<::hashdb::v1::Fea>(GetArena());
-    key_ = p;
+    new_root_ = p;
   }
-  return key_;
+  return new_root_;
 }
-inline ::hashdb::v1::Fea* KeyValue::mutable_key() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.KeyValue.key)
-  return _internal_mutable_key();
+inline ::hashdb::v1::Fea* SetManyResponse::mutable_new_root() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetManyResponse.new_root)
+  return _internal_mutable_new_root();
 }
-inline void KeyValue::set_allocated_key(::hashdb::v1::Fea* key) {
+inline void SetManyResponse::set_allocated_new_root(::hashdb::v1::Fea* new_root) {
   ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
   if (message_arena == nullptr) {
-    delete key_;
+    delete new_root_;
   }
-  if (key) {
+  if (new_root) {
     ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
-      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(key);
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(new_root);
     if (message_arena != submessage_arena) {
-      key = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
-          message_arena, key, submessage_arena);
+      new_root = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, new_root, submessage_arena);
     }
     
   } else {
     
   }
-  key_ = key;
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.KeyValue.key)
+  new_root_ = new_root;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetManyResponse.new_root)
 }
 
-// string value = 2;
-inline void KeyValue::clear_value() {
-  value_.ClearToEmpty(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+// repeated .hashdb.v1.SetResponse set_response = 2;
+inline int SetManyResponse::_internal_set_response_size() const {
+  return set_response_.size();
 }
-inline const std::string& KeyValue::value() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.KeyValue.value)
-  return _internal_value();
+inline int SetManyResponse::set_response_size() const {
+  return _internal_set_response_size();
 }
-inline void KeyValue::set_value(const std::string& value) {
-  _internal_set_value(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.KeyValue.value)
+inline void SetManyResponse::clear_set_response() {
+  set_response_.Clear();
 }
-inline std::string* KeyValue::mutable_value() {
-  // @@protoc_insertion_point(field_mutable:hashdb.v1.KeyValue.value)
-  return _internal_mutable_value();
+inline ::hashdb::v1::SetResponse* SetManyResponse::mutable_set_response(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetManyResponse.set_response)
+  return set_response_.Mutable(index);
 }
-inline const std::string& KeyValue::_internal_value() const {
-  return value_.Get();
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >*
+SetManyResponse::mutable_set_response() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.SetManyResponse.set_response)
+  return &set_response_;
 }
-inline void KeyValue::_internal_set_value(const std::string& value) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value, GetArena());
+inline const ::hashdb::v1::SetResponse& SetManyResponse::_internal_set_response(int index) const {
+  return set_response_.Get(index);
 }
-inline void KeyValue::set_value(std::string&& value) {
-  
-  value_.Set(
-    &::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::move(value), GetArena());
-  // @@protoc_insertion_point(field_set_rvalue:hashdb.v1.KeyValue.value)
+inline const ::hashdb::v1::SetResponse& SetManyResponse::set_response(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyResponse.set_response)
+  return _internal_set_response(index);
+}
+inline ::hashdb::v1::SetResponse* SetManyResponse::_internal_add_set_response() {
+  return set_response_.Add();
+}
+inline ::hashdb::v1::SetResponse* SetManyResponse::add_set_response() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.SetManyResponse.set_response)
+  return _internal_add_set_response();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::SetResponse >&
+SetManyResponse::set_response() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.SetManyResponse.set_response)
+  return set_response_;
+}
+
+// map<string, .hashdb.v1.FeList> db_read_log = 3;
+inline int SetManyResponse::_internal_db_read_log_size() const {
+  return db_read_log_.size();
+}
+inline int SetManyResponse::db_read_log_size() const {
+  return _internal_db_read_log_size();
+}
+inline void SetManyResponse::clear_db_read_log() {
+  db_read_log_.Clear();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+SetManyResponse::_internal_db_read_log() const {
+  return db_read_log_.GetMap();
+}
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+SetManyResponse::db_read_log() const {
+  // @@protoc_insertion_point(field_map:hashdb.v1.SetManyResponse.db_read_log)
+  return _internal_db_read_log();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+SetManyResponse::_internal_mutable_db_read_log() {
+  return db_read_log_.MutableMap();
+}
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+SetManyResponse::mutable_db_read_log() {
+  // @@protoc_insertion_point(field_mutable_map:hashdb.v1.SetManyResponse.db_read_log)
+  return _internal_mutable_db_read_log();
 }
-inline void KeyValue::set_value(const char* value) {
-  GOOGLE_DCHECK(value != nullptr);
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(value),
-              GetArena());
-  // @@protoc_insertion_point(field_set_char:hashdb.v1.KeyValue.value)
+
+// .hashdb.v1.ResultCode result = 4;
+inline bool SetManyResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
 }
-inline void KeyValue::set_value(const char* value,
-    size_t size) {
-  
-  value_.Set(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), ::std::string(
-      reinterpret_cast<const char*>(value), size), GetArena());
-  // @@protoc_insertion_point(field_set_pointer:hashdb.v1.KeyValue.value)
+inline bool SetManyResponse::has_result() const {
+  return _internal_has_result();
 }
-inline std::string* KeyValue::_internal_mutable_value() {
-  
-  return value_.Mutable(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline void SetManyResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
 }
-inline std::string* KeyValue::release_value() {
-  // @@protoc_insertion_point(field_release:hashdb.v1.KeyValue.value)
-  return value_.Release(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), GetArena());
+inline const ::hashdb::v1::ResultCode& SetManyResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline void KeyValue::set_allocated_value(std::string* value) {
-  if (value != nullptr) {
+inline const ::hashdb::v1::ResultCode& SetManyResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.SetManyResponse.result)
+  return _internal_result();
+}
+inline void SetManyResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
     
   } else {
     
   }
-  value_.SetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(), value,
-      GetArena());
-  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.KeyValue.value)
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.SetManyResponse.result)
 }
-inline std::string* KeyValue::unsafe_arena_release_value() {
-  // @@protoc_insertion_point(field_unsafe_arena_release:hashdb.v1.KeyValue.value)
-  GOOGLE_DCHECK(GetArena() != nullptr);
+inline ::hashdb::v1::ResultCode* SetManyResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
+}
+inline ::hashdb::v1::ResultCode* SetManyResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.SetManyResponse.result)
   
-  return value_.UnsafeArenaRelease(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      GetArena());
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
 }
-inline void KeyValue::unsafe_arena_set_allocated_value(
-    std::string* value) {
-  GOOGLE_DCHECK(GetArena() != nullptr);
-  if (value != nullptr) {
+inline ::hashdb::v1::ResultCode* SetManyResponse::_internal_mutable_result() {
+  
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
+}
+inline ::hashdb::v1::ResultCode* SetManyResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.SetManyResponse.result)
+  return _internal_mutable_result();
+}
+inline void SetManyResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
     
   } else {
     
   }
-  value_.UnsafeArenaSetAllocated(&::PROTOBUF_NAMESPACE_ID::internal::GetEmptyStringAlreadyInited(),
-      value, GetArena());
-  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.KeyValue.value)
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.SetManyResponse.result)
 }
 
 // -------------------------------------------------------------------
 
-// FeList
+// -------------------------------------------------------------------
 
-// repeated uint64 fe = 1;
-inline int FeList::_internal_fe_size() const {
-  return fe_.size();
-}
-inline int FeList::fe_size() const {
-  return _internal_fe_size();
-}
-inline void FeList::clear_fe() {
-  fe_.Clear();
+// GetManyResponse
+
+// repeated .hashdb.v1.GetResponse get_response = 1;
+inline int GetManyResponse::_internal_get_response_size() const {
+  return get_response_.size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 FeList::_internal_fe(int index) const {
-  return fe_.Get(index);
+inline int GetManyResponse::get_response_size() const {
+  return _internal_get_response_size();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 FeList::fe(int index) const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.FeList.fe)
-  return _internal_fe(index);
+inline void GetManyResponse::clear_get_response() {
+  get_response_.Clear();
 }
-inline void FeList::set_fe(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  fe_.Set(index, value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.FeList.fe)
+inline ::hashdb::v1::GetResponse* GetManyResponse::mutable_get_response(int index) {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetManyResponse.get_response)
+  return get_response_.Mutable(index);
 }
-inline void FeList::_internal_add_fe(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  fe_.Add(value);
+inline ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >*
+GetManyResponse::mutable_get_response() {
+  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.GetManyResponse.get_response)
+  return &get_response_;
 }
-inline void FeList::add_fe(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_add_fe(value);
-  // @@protoc_insertion_point(field_add:hashdb.v1.FeList.fe)
+inline const ::hashdb::v1::GetResponse& GetManyResponse::_internal_get_response(int index) const {
+  return get_response_.Get(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
-FeList::_internal_fe() const {
-  return fe_;
+inline const ::hashdb::v1::GetResponse& GetManyResponse::get_response(int index) const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyResponse.get_response)
+  return _internal_get_response(index);
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
-FeList::fe() const {
-  // @@protoc_insertion_point(field_list:hashdb.v1.FeList.fe)
-  return _internal_fe();
+inline ::hashdb::v1::GetResponse* GetManyResponse::_internal_add_get_response() {
+  return get_response_.Add();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
-FeList::_internal_mutable_fe() {
-  return &fe_;
+inline ::hashdb::v1::GetResponse* GetManyResponse::add_get_response() {
+  // @@protoc_insertion_point(field_add:hashdb.v1.GetManyResponse.get_response)
+  return _internal_add_get_response();
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
-FeList::mutable_fe() {
-  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.FeList.fe)
-  return _internal_mutable_fe();
+inline const ::PROTOBUF_NAMESPACE_ID::RepeatedPtrField< ::hashdb::v1::GetResponse >&
+GetManyResponse::get_response() const {
+  // @@protoc_insertion_point(field_list:hashdb.v1.GetManyResponse.get_response)
+  return get_response_;
 }
 
-// -------------------------------------------------------------------
-
-// SiblingList
-
-// repeated uint64 sibling = 1;
-inline int SiblingList::_internal_sibling_size() const {
-  return sibling_.size();
+// map<string, .hashdb.v1.FeList> db_read_log = 2;
+inline int GetManyResponse::_internal_db_read_log_size() const {
+  return db_read_log_.size();
 }
-inline int SiblingList::sibling_size() const {
-  return _internal_sibling_size();
+inline int GetManyResponse::db_read_log_size() const {
+  return _internal_db_read_log_size();
 }
-inline void SiblingList::clear_sibling() {
-  sibling_.Clear();
+inline void GetManyResponse::clear_db_read_log() {
+  db_read_log_.Clear();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::_internal_sibling(int index) const {
-  return sibling_.Get(index);
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+GetManyResponse::_internal_db_read_log() const {
+  return db_read_log_.GetMap();
 }
-inline ::PROTOBUF_NAMESPACE_ID::uint64 SiblingList::sibling(int index) const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.SiblingList.sibling)
-  return _internal_sibling(index);
+inline const ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >&
+GetManyResponse::db_read_log() const {
+  // @@protoc_insertion_point(field_map:hashdb.v1.GetManyResponse.db_read_log)
+  return _internal_db_read_log();
 }
-inline void SiblingList::set_sibling(int index, ::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  sibling_.Set(index, value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.SiblingList.sibling)
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+GetManyResponse::_internal_mutable_db_read_log() {
+  return db_read_log_.MutableMap();
 }
-inline void SiblingList::_internal_add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  sibling_.Add(value);
+inline ::PROTOBUF_NAMESPACE_ID::Map< std::string, ::hashdb::v1::FeList >*
+GetManyResponse::mutable_db_read_log() {
+  // @@protoc_insertion_point(field_mutable_map:hashdb.v1.GetManyResponse.db_read_log)
+  return _internal_mutable_db_read_log();
 }
-inline void SiblingList::add_sibling(::PROTOBUF_NAMESPACE_ID::uint64 value) {
-  _internal_add_sibling(value);
-  // @@protoc_insertion_point(field_add:hashdb.v1.SiblingList.sibling)
+
+// .hashdb.v1.ResultCode result = 3;
+inline bool GetManyResponse::_internal_has_result() const {
+  return this != internal_default_instance() && result_ != nullptr;
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
-SiblingList::_internal_sibling() const {
-  return sibling_;
+inline bool GetManyResponse::has_result() const {
+  return _internal_has_result();
 }
-inline const ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >&
-SiblingList::sibling() const {
-  // @@protoc_insertion_point(field_list:hashdb.v1.SiblingList.sibling)
-  return _internal_sibling();
+inline void GetManyResponse::clear_result() {
+  if (GetArena() == nullptr && result_ != nullptr) {
+    delete result_;
+  }
+  result_ = nullptr;
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
-SiblingList::_internal_mutable_sibling() {
-  return &sibling_;
+inline const ::hashdb::v1::ResultCode& GetManyResponse::_internal_result() const {
+  const ::hashdb::v1::ResultCode* p = result_;
+  return p != nullptr ? *p : *reinterpret_cast<const ::hashdb::v1::ResultCode*>(
+      &::hashdb::v1::_ResultCode_default_instance_);
 }
-inline ::PROTOBUF_NAMESPACE_ID::RepeatedField< ::PROTOBUF_NAMESPACE_ID::uint64 >*
-SiblingList::mutable_sibling() {
-  // @@protoc_insertion_point(field_mutable_list:hashdb.v1.SiblingList.sibling)
-  return _internal_mutable_sibling();
+inline const ::hashdb::v1::ResultCode& GetManyResponse::result() const {
+  // @@protoc_insertion_point(field_get:hashdb.v1.GetManyResponse.result)
+  return _internal_result();
 }
-
-// -------------------------------------------------------------------
-
-// ResultCode
-
-// .hashdb.v1.ResultCode.Code code = 1;
-inline void ResultCode::clear_code() {
-  code_ = 0;
+inline void GetManyResponse::unsafe_arena_set_allocated_result(
+    ::hashdb::v1::ResultCode* result) {
+  if (GetArena() == nullptr) {
+    delete reinterpret_cast<::PROTOBUF_NAMESPACE_ID::MessageLite*>(result_);
+  }
+  result_ = result;
+  if (result) {
+    
+  } else {
+    
+  }
+  // @@protoc_insertion_point(field_unsafe_arena_set_allocated:hashdb.v1.GetManyResponse.result)
 }
-inline ::hashdb::v1::ResultCode_Code ResultCode::_internal_code() const {
-  return static_cast< ::hashdb::v1::ResultCode_Code >(code_);
+inline ::hashdb::v1::ResultCode* GetManyResponse::release_result() {
+  auto temp = unsafe_arena_release_result();
+  if (GetArena() != nullptr) {
+    temp = ::PROTOBUF_NAMESPACE_ID::internal::DuplicateIfNonNull(temp);
+  }
+  return temp;
 }
-inline ::hashdb::v1::ResultCode_Code ResultCode::code() const {
-  // @@protoc_insertion_point(field_get:hashdb.v1.ResultCode.code)
-  return _internal_code();
+inline ::hashdb::v1::ResultCode* GetManyResponse::unsafe_arena_release_result() {
+  // @@protoc_insertion_point(field_release:hashdb.v1.GetManyResponse.result)
+  
+  ::hashdb::v1::ResultCode* temp = result_;
+  result_ = nullptr;
+  return temp;
 }
-inline void ResultCode::_internal_set_code(::hashdb::v1::ResultCode_Code value) {
+inline ::hashdb::v1::ResultCode* GetManyResponse::_internal_mutable_result() {
   
-  code_ = value;
+  if (result_ == nullptr) {
+    auto* p = CreateMaybeMessage<::hashdb::v1::ResultCode>(GetArena());
+    result_ = p;
+  }
+  return result_;
 }
-inline void ResultCode::set_code(::hashdb::v1::ResultCode_Code value) {
-  _internal_set_code(value);
-  // @@protoc_insertion_point(field_set:hashdb.v1.ResultCode.code)
+inline ::hashdb::v1::ResultCode* GetManyResponse::mutable_result() {
+  // @@protoc_insertion_point(field_mutable:hashdb.v1.GetManyResponse.result)
+  return _internal_mutable_result();
+}
+inline void GetManyResponse::set_allocated_result(::hashdb::v1::ResultCode* result) {
+  ::PROTOBUF_NAMESPACE_ID::Arena* message_arena = GetArena();
+  if (message_arena == nullptr) {
+    delete result_;
+  }
+  if (result) {
+    ::PROTOBUF_NAMESPACE_ID::Arena* submessage_arena =
+      ::PROTOBUF_NAMESPACE_ID::Arena::GetArena(result);
+    if (message_arena != submessage_arena) {
+      result = ::PROTOBUF_NAMESPACE_ID::internal::GetOwnedMessage(
+          message_arena, result, submessage_arena);
+    }
+    
+  } else {
+    
+  }
+  result_ = result;
+  // @@protoc_insertion_point(field_set_allocated:hashdb.v1.GetManyResponse.result)
 }
 
 #ifdef __GNUC__
@@ -14299,6 +16193,18 @@ inline void ResultCode::set_code(::hashdb::v1::ResultCode_Code value) {
 
 // -------------------------------------------------------------------
 
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
+// -------------------------------------------------------------------
+
 
 // @@protoc_insertion_point(namespace_scope)
 
@@ -38,7 +38,11 @@ Database::Database (Goldilocks &fr, const Config &config) :
         fr(fr),
         config(config),
         connectionsPool(NULL),
-        multiWrite(fr)
+        multiWrite(fr),
+        readQueries(0),
+        readKeys(0),
+        readTime(0),
+        readMetricsStart(0)
 {
     // Init mutex
     pthread_mutex_init(&connMutex, NULL);
@@ -123,26 +127,28 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
 
     zkresult r = ZKR_UNSPECIFIED;
 
-    // Normalize key format
-    string key = NormalizeToNFormat(_key, 64);
-    key = stringToLower(key);
+    // The cache is keyed by the binary key, so the key string is normalized only if needed
+    string key;
 
 #ifdef DATABASE_USE_CACHE
     // If the key is found in local database (cached) simply return it
-    if(usingAssociativeCache() && dbMTACache.findKey(vkey,value)){
-
-        if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
-        r = ZKR_SUCCESS;
-
-    } else if( dbMTCache.enabled() && dbMTCache.find(key, value)){
-        
-        if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
+    if ( (usingAssociativeCache() && dbMTACache.findKey(vkey,value)) ||
+         (dbMTCache.enabled() && dbMTCache.find(vkey, value)) )
+    {
+        if (dbReadLog != NULL) dbReadLog->add(stringToLower(NormalizeToNFormat(_key, 64)), value, true, TimeDiff(t));
         r = ZKR_SUCCESS;
     }
-    else
 #endif
+
+    // Normalize key format
+    if (r == ZKR_UNSPECIFIED)
+    {
+        key = NormalizeToNFormat(_key, 64);
+        key = stringToLower(key);
+    }
+
     // If the key is pending to be stored in database, but already deleted from cache
-    if (config.dbMultiWrite && multiWrite.findNode(key, value))
+    if ((r == ZKR_UNSPECIFIED) && config.dbMultiWrite && multiWrite.findNode(key, value))
     {
         // Add to the read log
         if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
@@ -152,14 +158,14 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
         if(usingAssociativeCache()){
             dbMTACache.addKeyValue(vkey, value, false);
         }
-        else if(dbMTCache.enabled()){                
-            dbMTCache.add(key, value, false);
+        else if(dbMTCache.enabled()){
+            dbMTCache.add(vkey, value, false);
         }
 #endif
         r = ZKR_SUCCESS;
     }
     // If get tree is configured, read the tree from the branch (key hash) to the leaf (keys since level)
-    else if (useRemoteDB && config.dbGetTree && (keys != NULL))
+    else if ((r == ZKR_UNSPECIFIED) && useRemoteDB && config.dbGetTree && (keys != NULL))
     {
         // Get the tree
         uint64_t numberOfFields;
@@ -204,7 +210,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
             if (usingAssociativeCache() && dbMTACache.findKey(vkey,value)){
                 if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
                 r = ZKR_SUCCESS;
-            }else if(dbMTCache.enabled() && dbMTCache.find(key, value)){
+            }else if(dbMTCache.enabled() && dbMTCache.find(vkey, value)){
                 if (dbReadLog != NULL) dbReadLog->add(key, value, true, TimeDiff(t));
                 r = ZKR_SUCCESS;                
             }
@@ -253,12 +259,19 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
             if(usingAssociativeCache()){
                 dbMTACache.addKeyValue(vkey, value, update);
             }else if (dbMTCache.enabled()){
-                dbMTCache.add(key, value, update);
+                dbMTCache.add(vkey, value, update);
             }
 #endif
 
             // Add to the read log
             if (dbReadLog != NULL) dbReadLog->add(key, value, false, TimeDiff(t));
+
+            // A tree node read from the remote database means a cold cache, so the next levels
+            // below it are read in batches before the caller descends through them one by one
+            if ((keys != NULL) && (config.dbReadPrefetchLevels > 0))
+            {
+                prefetchLevels(value, config.dbReadPrefetchLevels);
+            }
         }
     }
 
@@ -274,7 +287,7 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
         string s = "Database::read()";
         if (r != ZKR_SUCCESS)
             s += " ERROR=" + zkresult2string(r);
-        s += " key=" + key;
+        s += " key=" + _key;
         s += " value=";
         for (uint64_t i = 0; i < value.size(); i++)
             s += fr.toString(value[i], 16) + ":";
@@ -285,6 +298,139 @@ zkresult Database::read(const string &_key, Goldilocks::Element (&vkey)[4], vect
     return r;
 }
 
+zkresult Database::readMany(vector<HashValueGL> &hashValues, DatabaseMap *dbReadLog)
+{
+    // Check that it has been initialized before
+    if (!bInitialized)
+    {
+        zklog.error("Database::readMany() called uninitialized");
+        exitProcess();
+    }
+
+    struct timeval t;
+    if (dbReadLog != NULL) gettimeofday(&t, NULL);
+
+    zkresult zkr;
+    vector<Goldilocks::Element> value;
+    vector<string> remoteKeys;
+    vector<uint64_t> remoteIndexes;
+
+    for (uint64_t i=0; i<hashValues.size(); i++)
+    {
+#ifdef DATABASE_USE_CACHE
+        // If the key is found in local database (cached) simply return it
+        if ( (usingAssociativeCache() && dbMTACache.findKey(hashValues[i].hash, value)) ||
+             (dbMTCache.enabled() && dbMTCache.find(hashValues[i].hash, value)) )
+        {
+            for (uint64_t j=0; j<12; j++)
+            {
+                hashValues[i].value[j] = (j < value.size()) ? value[j] : fr.zero();
+            }
+            if (dbReadLog != NULL) dbReadLog->add(fea2string(fr, hashValues[i].hash), value, true, TimeDiff(t));
+            continue;
+        }
+#endif
+        remoteKeys.push_back(fea2string(fr, hashValues[i].hash));
+        remoteIndexes.push_back(i);
+    }
+
+    // Read the missing keys remotely, in as few queries as possible
+    unordered_map<string, string> remoteValues;
+    if (useRemoteDB && (remoteKeys.size() > 0))
+    {
+        zkr = readManyRemote(false, remoteKeys, remoteValues);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.warning("Database::readMany() failed calling readManyRemote() result=" + zkresult2string(zkr) + " keys=" + to_string(remoteKeys.size()) + "; will read them one by one");
+            remoteValues.clear();
+        }
+    }
+
+    for (uint64_t i=0; i<remoteKeys.size(); i++)
+    {
+        HashValueGL &hashValue = hashValues[remoteIndexes[i]];
+        unordered_map<string, string>::const_iterator it = remoteValues.find(remoteKeys[i]);
+        if (it != remoteValues.end())
+        {
+            string2fea(fr, it->second, value);
+
+#ifdef DATABASE_USE_CACHE
+            // Store it locally to avoid any future remote access for this key
+            if(usingAssociativeCache()){
+                dbMTACache.addKeyValue(hashValue.hash, value, false);
+            }else if (dbMTCache.enabled()){
+                dbMTCache.add(hashValue.hash, value, false);
+            }
+#endif
+
+            // Add to the read log
+            if (dbReadLog != NULL) dbReadLog->add(remoteKeys[i], value, false, TimeDiff(t));
+        }
+        else
+        {
+            // Keys pending to be written, not yet stored or not found are read one by one, with retries
+            zkr = read(remoteKeys[i], hashValue.hash, value, dbReadLog);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("Database::readMany() failed calling read() result=" + zkresult2string(zkr) + " key=" + remoteKeys[i]);
+                return zkr;
+            }
+        }
+        for (uint64_t j=0; j<12; j++)
+        {
+            hashValue.value[j] = (j < value.size()) ? value[j] : fr.zero();
+        }
+    }
+
+    return ZKR_SUCCESS;
+}
+
+void Database::prefetchLevels(const vector<Goldilocks::Element> &value, uint64_t levels)
+{
+#ifdef DATABASE_USE_CACHE
+    if (!usingAssociativeCache() && !dbMTCache.enabled())
+    {
+        return;
+    }
+
+    // Only intermediate nodes have children
+    vector<HashValueGL> nodes(1);
+    if ((value.size() < 12) || !fr.isZero(value[8]))
+    {
+        return;
+    }
+    for (uint64_t i=0; i<12; i++) nodes[0].value[i] = value[i];
+
+    // Read the children of every intermediate node of the current level, one level per batch
+    for (uint64_t level=0; level<levels; level++)
+    {
+        vector<HashValueGL> children;
+        for (uint64_t n=0; n<nodes.size(); n++)
+        {
+            if (!fr.isZero(nodes[n].value[8])) continue;
+            for (uint64_t child=0; child<2; child++)
+            {
+                HashValueGL childNode;
+                for (uint64_t i=0; i<4; i++) childNode.hash[i] = nodes[n].value[child*4 + i];
+                if (fr.isZero(childNode.hash[0]) && fr.isZero(childNode.hash[1]) && fr.isZero(childNode.hash[2]) && fr.isZero(childNode.hash[3])) continue;
+                children.push_back(childNode);
+            }
+        }
+        if (children.size() == 0)
+        {
+            break;
+        }
+        zkresult zkr = readMany(children, NULL);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.warning("Database::prefetchLevels() failed calling readMany() result=" + zkresult2string(zkr) + " level=" + to_string(level));
+            break;
+        }
+        nodes.swap(children);
+    }
+#endif
+}
+
 zkresult Database::write(const string &_key, const Goldilocks::Element* vkey, const vector<Goldilocks::Element> &value, const bool persistent)
 {
     // Check that it has  been initialized before
@@ -330,19 +476,19 @@ zkresult Database::write(const string &_key, const Goldilocks::Element* vkey, co
 #ifdef DATABASE_USE_CACHE
     if ((r == ZKR_SUCCESS) && (dbMTCache.enabled() || dbMTACache.enabled()))
     {
+        Goldilocks::Element vkeyf[4];
+        if(vkey == NULL){
+            string2fea(fr, key, vkeyf);
+        }else{
+            vkeyf[0] = vkey[0];
+            vkeyf[1] = vkey[1];
+            vkeyf[2] = vkey[2];
+            vkeyf[3] = vkey[3];
+        }
         if(usingAssociativeCache()){
-            Goldilocks::Element vkeyf[4];
-            if(vkey == NULL){
-                string2fea(fr, key, vkeyf);
-            }else{
-                vkeyf[0] = vkey[0];
-                vkeyf[1] = vkey[1];
-                vkeyf[2] = vkey[2];
-                vkeyf[3] = vkey[3];
-            }
             dbMTACache.addKeyValue(vkeyf, value, false);
         }else{
-            dbMTCache.add(key, value, false);
+            dbMTCache.add(vkeyf, value, false);
         }
     }
 #endif
@@ -419,6 +565,7 @@ void Database::initRemote(void)
                     exitProcess();
                 }
                 connectionsPool[i].bInUse = false;
+                prepareStatements(connectionsPool[i]);
                 //zklog.info("Database::initRemote() created write connection i=" + to_string(i) + " connectionsPool[i]=" + to_string((uint64_t)connectionsPool[i].pConnection));
             }
 
@@ -435,6 +582,7 @@ void Database::initRemote(void)
                 exitProcess();
             }
             connection.bInUse = false;
+            prepareStatements(connection);
         }
         
         connUnlock();
@@ -546,6 +694,54 @@ void Database::queryFailed (void)
     connUnlock();
 }
 
+void Database::prepareStatements(DatabaseConnection &connection)
+{
+    // Statements are prepared once per connection, and re-prepared by pqxx if the connection is reactivated
+    connection.pConnection->prepare("read_nodes", "SELECT hash, data FROM " + config.dbNodesTableName + " WHERE hash = $1;");
+    connection.pConnection->prepare("read_program", "SELECT hash, data FROM " + config.dbProgramTableName + " WHERE hash = $1;");
+    connection.pConnection->prepare("read_many_nodes", "SELECT hash, data FROM " + config.dbNodesTableName + " WHERE hash = ANY($1::bytea[]);");
+    connection.pConnection->prepare("read_many_program", "SELECT hash, data FROM " + config.dbProgramTableName + " WHERE hash = ANY($1::bytea[]);");
+}
+
+void Database::addReadMetrics(uint64_t keys, const struct timeval &t)
+{
+    if (!config.dbMetrics)
+    {
+        return;
+    }
+
+    uint64_t queries = ++readQueries;
+    uint64_t totalKeys = (readKeys += keys);
+    uint64_t time = (readTime += TimeDiff(t));
+
+    // Log and reset the metrics once per period; only the thread that resets the start time logs them
+    struct timeval now;
+    gettimeofday(&now, NULL);
+    uint64_t nowUs = uint64_t(now.tv_sec)*1000000 + now.tv_usec;
+    uint64_t start = readMetricsStart;
+    if (start == 0)
+    {
+        readMetricsStart.compare_exchange_strong(start, nowUs);
+        return;
+    }
+    uint64_t period = nowUs - start;
+    if ((period < DATABASE_READ_METRICS_PERIOD) || !readMetricsStart.compare_exchange_strong(start, nowUs))
+    {
+        return;
+    }
+    readQueries -= queries;
+    readKeys -= totalKeys;
+    readTime -= time;
+
+    zklog.info("Database::addReadMetrics() dbMetrics remote reads queries=" + to_string(queries) +
+        " keys=" + to_string(totalKeys) +
+        " time=" + to_string(time) + "us" +
+        " period=" + to_string(period) + "us" +
+        " QPS=" + to_string(double(queries)*1000000/zkmax(period,1)) +
+        " averageBatchSize=" + to_string(double(totalKeys)/zkmax(queries,1)) + "keys/query" +
+        " averageQueryTime=" + to_string(time/zkmax(queries,1)) + "us/query");
+}
+
 zkresult Database::readRemote(bool bProgram, const string &key, string &value)
 {
     const string &tableName = (bProgram ? config.dbProgramTableName : config.dbNodesTableName);
@@ -555,21 +751,21 @@ zkresult Database::readRemote(bool bProgram, const string &key, string &value)
         zklog.info("Database::readRemote() table=" + tableName + " key=" + key);
     }
 
+    struct timeval t;
+    gettimeofday(&t, NULL);
+
     // Get a free read db connection
     DatabaseConnection * pDatabaseConnection = getConnection();
 
     try
     {
-        // Prepare the query
-        string query = "SELECT * FROM " + tableName + " WHERE hash = E\'\\\\x" + key + "\';";
-
         pqxx::result rows;
 
         // Start a transaction.
         pqxx::nontransaction n(*(pDatabaseConnection->pConnection));
 
-        // Execute the query
-        rows = n.exec(query);
+        // Execute the prepared query
+        rows = n.exec_prepared(bProgram ? "read_program" : "read_nodes", "\\x" + key);
 
         // Commit your transaction
         n.commit();
@@ -578,6 +774,7 @@ zkresult Database::readRemote(bool bProgram, const string &key, string &value)
         if (rows.size() == 0)
         {
             disposeConnection(pDatabaseConnection);
+            addReadMetrics(1, t);
             return ZKR_DB_KEY_NOT_FOUND;
         }
         else if (rows.size() > 1)
@@ -606,6 +803,77 @@ zkresult Database::readRemote(bool bProgram, const string &key, string &value)
     // Dispose the read db conneciton
     disposeConnection(pDatabaseConnection);
 
+    addReadMetrics(1, t);
+
+    return ZKR_SUCCESS;
+}
+
+zkresult Database::readManyRemote(bool bProgram, const vector<string> &keys, unordered_map<string, string> &values)
+{
+    const string &tableName = (bProgram ? config.dbProgramTableName : config.dbNodesTableName);
+
+    if (config.logRemoteDbReads)
+    {
+        zklog.info("Database::readManyRemote() table=" + tableName + " keys=" + to_string(keys.size()));
+    }
+
+    // Get a free read db connection
+    DatabaseConnection * pDatabaseConnection = getConnection();
+
+    try
+    {
+        // Start a transaction.
+        pqxx::nontransaction n(*(pDatabaseConnection->pConnection));
+
+        for (uint64_t first=0; first<keys.size(); first+=DATABASE_READ_MANY_MAX_KEYS)
+        {
+            struct timeval t;
+            gettimeofday(&t, NULL);
+
+            // Build the bytea array parameter, e.g. {"\\x01ab","\\x02cd"}
+            uint64_t last = zkmin(first + DATABASE_READ_MANY_MAX_KEYS, keys.size());
+            string keysArray;
+            keysArray.reserve((last - first)*(64 + 6) + 2);
+            keysArray += "{";
+            for (uint64_t i=first; i<last; i++)
+            {
+                if (i != first) keysArray += ",";
+                keysArray += "\"\\\\x" + keys[i] + "\"";
+            }
+            keysArray += "}";
+
+            // Execute the prepared query
+            pqxx::result rows = n.exec_prepared(bProgram ? "read_many_program" : "read_many_nodes", keysArray);
+
+            // Process the result; keys that are not found are simply not returned
+            for (uint64_t i=0; i<rows.size(); i++)
+            {
+                const pqxx::row& row = rows[i];
+                if (row.size() != 2)
+                {
+                    zklog.error("Database::readManyRemote() table=" + tableName + " got an invalid number of colums for the row: " + to_string(row.size()));
+                    exitProcess();
+                }
+                values[removeBSXIfExists(row[0].c_str())] = removeBSXIfExists(row[1].c_str());
+            }
+
+            addReadMetrics(last - first, t);
+        }
+
+        // Commit your transaction
+        n.commit();
+    }
+    catch (const std::exception &e)
+    {
+        zklog.error("Database::readManyRemote() table=" + tableName + " exception: " + string(e.what()) + " connection=" + to_string((uint64_t)pDatabaseConnection));
+        queryFailed();
+        disposeConnection(pDatabaseConnection);
+        return ZKR_DB_ERROR;
+    }
+    
+    // Dispose the read db conneciton
+    disposeConnection(pDatabaseConnection);
+
     return ZKR_SUCCESS;
 }
 
@@ -630,6 +898,9 @@ zkresult Database::readTreeRemote(const string &key, bool *keys, uint64_t level,
         rkey.append(1, byte2char(auxByte & 0x0F));
     }
 
+    struct timeval t;
+    gettimeofday(&t, NULL);
+
     // Get a free read db connection
     DatabaseConnection * pDatabaseConnection = getConnection();
 
@@ -697,13 +968,13 @@ zkresult Database::readTreeRemote(const string &key, bool *keys, uint64_t level,
             if (dbMTCache.enabled() || dbMTACache.enabled())
             {
                 //zklog.info("Database::readTreeRemote() adding hash=" + hash + " to dbMTCache");
+                Goldilocks::Element vhash[4];
+                string2fea(fr, hash, vhash);
                 if(usingAssociativeCache()){
-                    Goldilocks::Element vhash[4];
-                    string2fea(fr, hash, vhash);   
                     dbMTACache.addKeyValue(vhash, value, false);
                 }else{
-                    dbMTCache.add(hash, value, false);
-              }
+                    dbMTCache.add(vhash, value, false);
+                }
             }
 #endif
         }
@@ -719,6 +990,8 @@ zkresult Database::readTreeRemote(const string &key, bool *keys, uint64_t level,
     // Dispose the read db conneciton
     disposeConnection(pDatabaseConnection);
 
+    addReadMetrics(numberOfFields, t);
+
     if (config.logRemoteDbReads)
     {
         zklog.info("Database::readTreeRemote() key=" + key + " read " + to_string(numberOfFields));
@@ -938,7 +1211,7 @@ zkresult Database::updateStateRoot(const Goldilocks::Element (&stateRoot)[4])
         if(usingAssociativeCache()){
                 dbMTACache.addKeyValue(dbStateRootvKey, value, true);
         }else{
-                dbMTCache.add(dbStateRootKey, value, true);
+                dbMTCache.add(dbStateRootvKey, value, true);
         }
     }
 #endif
@@ -1660,7 +1933,7 @@ void Database::printTree(const string &root, string prefix)
     string key = root;
     vector<Goldilocks::Element> value;
     Goldilocks::Element vKey[4];
-    if(Database::useAssociativeCache) string2fea(fr, key, vKey);  
+    string2fea(fr, key, vKey);
     read(key,vKey,value, NULL);
 
     if (value.size() != 12)
@@ -2052,7 +2325,7 @@ void loadDb2MemCache(const Config &config)
             dbValue.clear();
             Goldilocks::Element vhash[4];
             string hashNorm = NormalizeToNFormat(hash, 64);
-            if(pHashDB->db.usingAssociativeCache()) string2fea(fr, hashNorm, vhash);
+            string2fea(fr, hashNorm, vhash);
             zkresult zkr = pHashDB->db.read(hash, vhash, dbValue, NULL, true);
 
             if (zkr != ZKR_SUCCESS)
@@ -2103,7 +2376,8 @@ void loadDb2MemCache(const Config &config)
                     {
                         //zklog.info("loadDb2MemCache() level=" + to_string(level) + " found value rightHash=" + rightHash);
                         dbValue.clear();
-                        Goldilocks::Element vRightHash[4]={dbValue[4], dbValue[5], dbValue[6], dbValue[7]};
+                        Goldilocks::Element vRightHash[4];
+                        string2fea(fr, rightHash, vRightHash);
                         zkresult zkr = pHashDB->db.read(rightHash, vRightHash, dbValue, NULL, true);
                         if (zkr != ZKR_SUCCESS)
                         {
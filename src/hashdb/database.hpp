@@ -15,9 +15,18 @@
 #include "zkassert.hpp"
 #include "multi_write.hpp"
 #include "database_associative_cache.hpp"
+#include "hash_value_gl.hpp"
+#include <atomic>
+#include <unordered_map>
 
 using namespace std;
 
+// Maximum number of keys of a single multi-key remote read query; larger requests are split in chunks
+#define DATABASE_READ_MANY_MAX_KEYS 1024
+
+// Period of the remote read metrics log, in microseconds
+#define DATABASE_READ_METRICS_PERIOD (10*1000*1000)
+
 class Database
 {
 public:
@@ -60,11 +69,23 @@ private:
 private:
     // Remote database based on Postgres (PostgreSQL)
     void initRemote(void);
+    void prepareStatements(DatabaseConnection &connection);
     zkresult readRemote(bool bProgram, const string &key, string &value);
+    zkresult readManyRemote(bool bProgram, const vector<string> &keys, unordered_map<string, string> &values);
     zkresult readTreeRemote(const string &key, bool *keys, uint64_t level, uint64_t &numberOfFields);
     zkresult writeRemote(bool bProgram, const string &key, const string &value);
     zkresult writeGetTreeFunction(void);
 
+    // Speculatively reads into the cache the next levels of the subtree of an intermediate node
+    void prefetchLevels(const vector<Goldilocks::Element> &value, uint64_t levels);
+
+    // Remote read metrics
+    atomic<uint64_t> readQueries;
+    atomic<uint64_t> readKeys;
+    atomic<uint64_t> readTime;
+    atomic<uint64_t> readMetricsStart;
+    void addReadMetrics(uint64_t keys, const struct timeval &t);
+
 public:
 #ifdef DATABASE_USE_CACHE
     // Cache static instances
@@ -89,6 +110,7 @@ public:
     void init(void);
     zkresult read(const string &_key, Goldilocks::Element (&vkey)[4], vector<Goldilocks::Element> &value, DatabaseMap *dbReadLog, const bool update = false, bool *keys = NULL , uint64_t level=0);
     zkresult write(const string &_key, const Goldilocks::Element* vkey, const vector<Goldilocks::Element> &value, const bool persistent);
+    zkresult readMany(vector<HashValueGL> &hashValues, DatabaseMap *dbReadLog); // Reads a batch of MT nodes, e.g. the nodes of an SMT level
     zkresult getProgram(const string &_key, vector<uint8_t> &value, DatabaseMap *dbReadLog);
     zkresult setProgram(const string &_key, const vector<uint8_t> &value, const bool persistent);
     inline bool usingAssociativeCache(void){ return useAssociativeCache; };
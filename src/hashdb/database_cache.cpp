@@ -166,8 +166,97 @@ DatabaseCache::~DatabaseCache()
     TimerStopAndLog(DATABASE_CACHE_DESTRUCTOR);
 }
 
-// DatabaseMTCache class implementation
+// DatabaseMTCacheShard class implementation
+
+#define DATABASE_MT_CACHE_NULL UINT32_MAX
+
+DatabaseMTCacheShard::DatabaseMTCacheShard() :
+    head(DATABASE_MT_CACHE_NULL),
+    last(DATABASE_MT_CACHE_NULL),
+    freeList(DATABASE_MT_CACHE_NULL),
+    allocated(0),
+    maxSize(0),
+    currentSize(0),
+    hits(0),
+    misses(0),
+    evictions(0)
+{
+}
+
+DatabaseMTCacheShard::~DatabaseMTCacheShard()
+{
+    for (uint64_t i=0; i<slabs.size(); i++)
+    {
+        delete[] slabs[i];
+    }
+}
+
+// Returns the index of an unused record, taking it from the free list or from the slabs
+uint32_t DatabaseMTCacheShard::allocRecord(void)
+{
+    if (freeList != DATABASE_MT_CACHE_NULL)
+    {
+        uint32_t index = freeList;
+        freeList = record(index).next;
+        return index;
+    }
+    if (allocated == slabs.size()*DATABASE_MT_CACHE_SLAB_SIZE)
+    {
+        DatabaseMTCacheRecord * pSlab = new(nothrow) DatabaseMTCacheRecord[DATABASE_MT_CACHE_SLAB_SIZE];
+        if (pSlab == NULL)
+        {
+            zklog.error("DatabaseMTCacheShard::allocRecord() failed calling new(DatabaseMTCacheRecord[" + to_string(DATABASE_MT_CACHE_SLAB_SIZE) + "])");
+            exitProcess();
+        }
+        slabs.push_back(pSlab);
+    }
+    return allocated++;
+}
+
+// Moves a record to the head of the LRU list; the record can be already linked or not
+void DatabaseMTCacheShard::moveToHead(uint32_t index)
+{
+    DatabaseMTCacheRecord &r = record(index);
+    if (head == index)
+    {
+        return;
+    }
+
+    // Unlink it, if it was linked
+    if (r.prev != DATABASE_MT_CACHE_NULL)
+    {
+        record(r.prev).next = r.next;
+        if (last == index) last = r.prev;
+        else record(r.next).prev = r.prev;
+    }
+
+    // Link it as the new head
+    r.prev = DATABASE_MT_CACHE_NULL;
+    r.next = head;
+    if (head != DATABASE_MT_CACHE_NULL) record(head).prev = index;
+    else last = index;
+    head = index;
+}
 
+void DatabaseMTCacheShard::clear(void)
+{
+    // Return all the linked records to the free list, keeping the slabs
+    while (head != DATABASE_MT_CACHE_NULL)
+    {
+        uint32_t next = record(head).next;
+        record(head).next = freeList;
+        freeList = head;
+        head = next;
+    }
+    last = DATABASE_MT_CACHE_NULL;
+    cacheMap.clear();
+    currentSize = 0;
+    hits = 0;
+    misses = 0;
+    evictions = 0;
+}
+
+// DatabaseMTCache class implementation
 
 DatabaseMTCache::~DatabaseMTCache()
 {
@@ -176,72 +265,166 @@ DatabaseMTCache::~DatabaseMTCache()
     TimerStopAndLog(DATABASE_MT_CACHE_DESTRUCTOR);
 }
 
-// Add a record in the head of the MT cache. Returns true if the cache is full (or no cache), false otherwise
-bool DatabaseMTCache::add(const string &key, const vector<Goldilocks::Element> &value, const bool update)
+void DatabaseMTCache::setMaxSize(int64_t size)
 {
-    lock_guard<recursive_mutex> guard(mlock);
-
-    if (maxSize == 0) return true;
+    maxSize = size;
+    for (uint64_t i=0; i<DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        lock_guard<mutex> guard(shards[i].mlock);
+        shards[i].maxSize = maxSize / DATABASE_MT_CACHE_SHARDS;
+    }
+}
 
-    return addKeyValue(key, (const void *)&value, update);
+uint64_t DatabaseMTCache::getCurrentSize(void)
+{
+    uint64_t currentSize = 0;
+    for (uint64_t i=0; i<DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        lock_guard<mutex> guard(shards[i].mlock);
+        currentSize += shards[i].currentSize;
+    }
+    return currentSize;
 }
 
-bool DatabaseMTCache::find(const string &key, vector<Goldilocks::Element> &value)
+// Add a record in the head of the MT cache. Returns true if the cache is full (or no cache), false otherwise
+bool DatabaseMTCache::add(const Goldilocks::Element (&vkey)[4], const vector<Goldilocks::Element> &value, const bool update)
 {
-    lock_guard<recursive_mutex> guard(mlock);
+    if (maxSize == 0) return true;
 
-    if (maxSize == 0) return false;
+    if (value.size() > DATABASE_MT_CACHE_VALUE_SIZE)
+    {
+        zklog.error("DatabaseMTCache::add() got a value with size=" + to_string(value.size()) + " > DATABASE_MT_CACHE_VALUE_SIZE=" + to_string(DATABASE_MT_CACHE_VALUE_SIZE));
+        exitProcess();
+    }
 
-    DatabaseCacheRecord* record;
-    bool found = findKey(key, record);
-    if (found) 
+    DatabaseMTCacheKey key;
+    getKey(vkey, key);
+    DatabaseMTCacheShard &shard = getShard(key);
+
+    lock_guard<mutex> guard(shard.mlock);
+
+    // If key already exists in the cache, move it to the head and update it if requested
+    unordered_map<DatabaseMTCacheKey, uint32_t, DatabaseMTCacheKeyHash>::iterator it = shard.cacheMap.find(key);
+    if (it != shard.cacheMap.end())
     {
-        value = *((vector<Goldilocks::Element>*) record->value);
+        shard.moveToHead(it->second);
+        if (update)
+        {
+            DatabaseMTCacheRecord &record = shard.record(it->second);
+            record.size = value.size();
+            for (uint64_t i=0; i<value.size(); i++) record.value[i] = value[i];
+            return true;
+        }
+        return false;
     }
 
-    return found;
+    // Create a new record and set it in the head of the cache
+    uint32_t index = shard.allocRecord();
+    DatabaseMTCacheRecord &record = shard.record(index);
+    record.key = key;
+    record.size = value.size();
+    for (uint64_t i=0; i<value.size(); i++) record.value[i] = value[i];
+    record.prev = DATABASE_MT_CACHE_NULL;
+    record.next = DATABASE_MT_CACHE_NULL;
+    shard.moveToHead(index);
+    shard.cacheMap[key] = index;
+    shard.currentSize += recordSize;
+
+    bool full = (shard.currentSize > shard.maxSize);
+
+    // Evict the least recently used records to be under maxSize
+    while ((shard.currentSize > shard.maxSize) && (shard.last != shard.head))
+    {
+        uint32_t evicted = shard.last;
+        DatabaseMTCacheRecord &evictedRecord = shard.record(evicted);
+        shard.last = evictedRecord.prev;
+        shard.record(shard.last).next = DATABASE_MT_CACHE_NULL;
+        shard.cacheMap.erase(evictedRecord.key);
+        evictedRecord.next = shard.freeList;
+        shard.freeList = evicted;
+        zkassert(shard.currentSize >= recordSize);
+        shard.currentSize -= recordSize;
+        shard.evictions++;
+    }
+
+    return full;
 }
 
-DatabaseCacheRecord * DatabaseMTCache::allocRecord(const string key, const void * value)
+bool DatabaseMTCache::find(const Goldilocks::Element (&vkey)[4], vector<Goldilocks::Element> &value)
 {
-    // Allocate memory
-    DatabaseCacheRecord * pRecord = new(DatabaseCacheRecord);
-    if (pRecord == NULL)
+    if (maxSize == 0) return false;
+
+    DatabaseMTCacheKey key;
+    getKey(vkey, key);
+    DatabaseMTCacheShard &shard = getShard(key);
+
+    lock_guard<mutex> guard(shard.mlock);
+
+    if ((shard.hits + shard.misses + 1)%1000000 == 0)
     {
-        zklog.error("DatabaseMTCache::allocRecord() failed calling new(DatabaseCacheRecord)");
-        exitProcess();
+        zklog.info("DatabaseMTCache::find() name=" + name + " shard=" + to_string(&shard - shards) + " count=" + to_string(shard.cacheMap.size()) + " maxSize=" + to_string(shard.maxSize) + " currentSize=" + to_string(shard.currentSize) + " hits=" + to_string(shard.hits) + " misses=" + to_string(shard.misses) + " evictions=" + to_string(shard.evictions) + " hit ratio=" + to_string(double(shard.hits)*100.0/double(zkmax(shard.hits + shard.misses,1))) + "%");
     }
-    vector<Goldilocks::Element>* pValue = new(vector<Goldilocks::Element>);
-    if (pValue == NULL)
+
+    unordered_map<DatabaseMTCacheKey, uint32_t, DatabaseMTCacheKeyHash>::iterator it = shard.cacheMap.find(key);
+    if (it == shard.cacheMap.end())
     {
-        zklog.error("DatabaseMTCache::allocRecord() failed calling new(vector<Goldilocks::Element>)");
-        exitProcess();
+        shard.misses++;
+        return false;
     }
+    shard.hits++;
 
-    // Copy vector
-    *pValue = *(const vector<Goldilocks::Element> *)value;
+    // Move cache record to the top/head
+    shard.moveToHead(it->second);
 
-    // Assign values to record
-    pRecord->value = pValue;
-    pRecord->key = key;
-    pRecord->size = 2*(
-        sizeof(DatabaseCacheRecord)+
-        (pRecord->key.capacity()+1)+
-        sizeof(vector<Goldilocks::Element>)+
-        sizeof(Goldilocks::Element)*pValue->capacity() );
-        
-    return pRecord;
+    DatabaseMTCacheRecord &record = shard.record(it->second);
+    value.assign(record.value, record.value + record.size);
+
+    return true;
 }
 
-void DatabaseMTCache::freeRecord(DatabaseCacheRecord* record)
+void DatabaseMTCache::getCounters(uint64_t shard, uint64_t &hits, uint64_t &misses, uint64_t &evictions)
 {
-    delete (vector<Goldilocks::Element>*)(record->value);
-    delete record;
+    zkassert(shard < DATABASE_MT_CACHE_SHARDS);
+    lock_guard<mutex> guard(shards[shard].mlock);
+    hits = shards[shard].hits;
+    misses = shards[shard].misses;
+    evictions = shards[shard].evictions;
 }
 
-void DatabaseMTCache::updateRecord(DatabaseCacheRecord* record, const void * value)
+void DatabaseMTCache::print(bool printContent)
 {
-    *(vector<Goldilocks::Element>*)(record->value) = *(vector<Goldilocks::Element>*)(value);
+    zklog.info("DatabaseMTCache::print() printContent=" + to_string(printContent) + " name=" + name);
+    zklog.info("Cache current size: " + to_string(getCurrentSize()));
+    zklog.info("Cache max size: " + to_string(maxSize));
+
+    uint64_t count = 0;
+    for (uint64_t i=0; i<DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        DatabaseMTCacheShard &shard = shards[i];
+        lock_guard<mutex> guard(shard.mlock);
+        zklog.info("Shard " + to_string(i) + ": count=" + to_string(shard.cacheMap.size()) + " currentSize=" + to_string(shard.currentSize) + " hits=" + to_string(shard.hits) + " misses=" + to_string(shard.misses) + " evictions=" + to_string(shard.evictions));
+        count += shard.cacheMap.size();
+        if (printContent)
+        {
+            for (uint32_t index = shard.head; index != DATABASE_MT_CACHE_NULL; index = shard.record(index).next)
+            {
+                DatabaseMTCacheRecord &record = shard.record(index);
+                string key;
+                for (uint64_t j=0; j<4; j++) key += PrependZeros(Goldilocks::toString(Goldilocks::fromU64(record.key.fe[3-j]), 16), 16);
+                zklog.info("key:" + key + " size=" + to_string(record.size) + " prev=" + to_string(record.prev) + " next=" + to_string(record.next));
+            }
+        }
+    }
+    zklog.info("Cache count: " + to_string(count));
+}
+
+void DatabaseMTCache::clear(void)
+{
+    for (uint64_t i=0; i<DATABASE_MT_CACHE_SHARDS; i++)
+    {
+        lock_guard<mutex> guard(shards[i].mlock);
+        shards[i].clear();
+    }
 }
 
 // DatabaseProgramCache class implementation
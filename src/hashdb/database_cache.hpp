@@ -58,15 +58,96 @@ public:
     void clear(void);
 };
 
-class DatabaseMTCache : public DatabaseCache
+#define DATABASE_MT_CACHE_SHARDS 64 // Number of independent shards, each of them with its own lock and LRU list
+#define DATABASE_MT_CACHE_VALUE_SIZE 12 // Maximum number of field elements of an MT value, i.e. a node or a leaf
+#define DATABASE_MT_CACHE_SLAB_SIZE 4096 // Number of records allocated at once
+
+// MT cache key, i.e. the raw hash of the node
+struct DatabaseMTCacheKey
+{
+    uint64_t fe[4];
+    bool operator==(const DatabaseMTCacheKey &other) const
+    {
+        return (fe[0] == other.fe[0]) && (fe[1] == other.fe[1]) && (fe[2] == other.fe[2]) && (fe[3] == other.fe[3]);
+    }
+};
+
+// The key is a hash, so its first element is already uniformly distributed
+struct DatabaseMTCacheKeyHash
+{
+    size_t operator()(const DatabaseMTCacheKey &key) const { return key.fe[0]; };
+};
+
+// Fixed size MT cache record; records are linked in the LRU list by their index in the shard slabs
+struct DatabaseMTCacheRecord
+{
+    Goldilocks::Element value[DATABASE_MT_CACHE_VALUE_SIZE];
+    DatabaseMTCacheKey key;
+    uint32_t size; // Number of field elements of the value
+    uint32_t prev;
+    uint32_t next;
+};
+
+class DatabaseMTCacheShard
+{
+public:
+    mutex mlock;
+    unordered_map<DatabaseMTCacheKey, uint32_t, DatabaseMTCacheKeyHash> cacheMap; // Key -> record index
+    vector<DatabaseMTCacheRecord *> slabs;
+    uint32_t head; // Most recently used record
+    uint32_t last; // Least recently used record
+    uint32_t freeList; // Records released by clear(), linked by next
+    uint32_t allocated; // Number of records ever allocated from the slabs
+    uint64_t maxSize;
+    uint64_t currentSize;
+    uint64_t hits;
+    uint64_t misses;
+    uint64_t evictions;
+
+    DatabaseMTCacheShard();
+    ~DatabaseMTCacheShard();
+    inline DatabaseMTCacheRecord &record(uint32_t index) { return slabs[index / DATABASE_MT_CACHE_SLAB_SIZE][index % DATABASE_MT_CACHE_SLAB_SIZE]; };
+    uint32_t allocRecord(void);
+    void moveToHead(uint32_t index);
+    void clear(void);
+};
+
+// MT cache, keyed by the binary node hash and split in shards, so that concurrent executors accessing
+// different nodes do not contend for the same lock
+class DatabaseMTCache
 {
+private:
+    DatabaseMTCacheShard shards[DATABASE_MT_CACHE_SHARDS];
+    uint64_t maxSize;
+    string name;
+
+    // The map hash uses the first key element, so the shard is selected with the second one
+    inline DatabaseMTCacheShard &getShard(const DatabaseMTCacheKey &key) { return shards[key.fe[1] % DATABASE_MT_CACHE_SHARDS]; };
+    static inline void getKey(const Goldilocks::Element (&vkey)[4], DatabaseMTCacheKey &key)
+    {
+        key.fe[0] = Goldilocks::toU64(vkey[0]);
+        key.fe[1] = Goldilocks::toU64(vkey[1]);
+        key.fe[2] = Goldilocks::toU64(vkey[2]);
+        key.fe[3] = Goldilocks::toU64(vkey[3]);
+    }
+
 public:
+    DatabaseMTCache() : maxSize(0) {};
     ~DatabaseMTCache();
-    bool add(const string &key, const vector<Goldilocks::Element> &value, const bool update); // returns true if cache is full
-    bool find(const string &key, vector<Goldilocks::Element> &value);
-    DatabaseCacheRecord* allocRecord(const string key, const void * value) override;
-    void freeRecord(DatabaseCacheRecord* record) override;
-    void updateRecord(DatabaseCacheRecord* record, const void * value) override;
+    bool add(const Goldilocks::Element (&key)[4], const vector<Goldilocks::Element> &value, const bool update); // returns true if cache is full
+    bool find(const Goldilocks::Element (&key)[4], vector<Goldilocks::Element> &value);
+
+    uint64_t getMaxSize(void) { return maxSize; };
+    uint64_t getCurrentSize(void);
+    bool enabled() { return (maxSize > 0); };
+    void setMaxSize(int64_t size); // size is in bytes, 0 = no cache
+    void setName(const char * pChar) { name = pChar; };
+    void getCounters(uint64_t shard, uint64_t &hits, uint64_t &misses, uint64_t &evictions);
+    void print(bool printContent);
+    void clear(void);
+
+    // Memory used by a record, including its cache map entry
+    static const uint64_t recordSize = sizeof(DatabaseMTCacheRecord) + sizeof(DatabaseMTCacheKey) + sizeof(uint32_t) + 2*sizeof(void *);
 };
 
 class DatabaseProgramCache : public DatabaseCache
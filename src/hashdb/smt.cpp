@@ -7,6 +7,7 @@
 #include <bitset>
 #include "state_manager.hpp"
 #include "key_utils.hpp"
+#include <algorithm>
 
 zkresult Smt::set (const string &batchUUID, uint64_t block, uint64_t tx, Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, SmtSetResult &result, DatabaseMap *dbReadLog)
 {
@@ -1067,6 +1068,213 @@ zkresult Smt::get (const string &batchUUID, Database &db, const Goldilocks::Elem
     return ZKR_SUCCESS;
 }
 
+zkresult Smt::setMany (const string &batchUUID, uint64_t block, uint64_t tx, Database &db, const Goldilocks::Element (&oldRoot)[4], const vector<KeyValue> &keyValues, const Persistence persistence, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> &results, DatabaseMap *dbReadLog)
+{
+    zkresult zkr;
+
+    // Sort the keys in tree order, so that consecutive keys share the longest possible descent
+    vector<SmtKeyPath> paths;
+    vector<uint64_t> order;
+    sortKeys(fr, keyValues, paths, order);
+
+    // Read the nodes of the common descent, level by level
+    zkr = prefetch(batchUUID, db, oldRoot, paths, order);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("Smt::setMany() failed calling prefetch() result=" + zkresult2string(zkr) + " oldRoot=" + fea2string(fr, oldRoot));
+        return zkr;
+    }
+
+    // Set the keys in tree order, chaining the roots
+    results.resize(keyValues.size());
+    Goldilocks::Element root[4];
+    for (uint64_t i=0; i<4; i++) root[i] = oldRoot[i];
+    for (uint64_t i=0; i<order.size(); i++)
+    {
+        const KeyValue &keyValue = keyValues[order[i]];
+        SmtSetResult &result = results[order[i]];
+        zkr = set(batchUUID, block, tx, db, root, keyValue.key, keyValue.value, persistence, result, dbReadLog);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt::setMany() failed calling set() result=" + zkresult2string(zkr) + " key=" + fea2string(fr, keyValue.key));
+            return zkr;
+        }
+        for (uint64_t j=0; j<4; j++) root[j] = result.newRoot[j];
+    }
+    for (uint64_t i=0; i<4; i++) newRoot[i] = root[i];
+
+    return ZKR_SUCCESS;
+}
+
+zkresult Smt::getMany (const string &batchUUID, Database &db, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, vector<SmtGetResult> &results, DatabaseMap *dbReadLog)
+{
+    zkresult zkr;
+
+    // Sort the keys in tree order, so that consecutive keys share the longest possible descent
+    vector<SmtKeyPath> paths;
+    vector<uint64_t> order;
+    sortKeys(fr, keyValues, paths, order);
+
+    // Read the nodes of the common descent, level by level
+    zkr = prefetch(batchUUID, db, root, paths, order);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("Smt::getMany() failed calling prefetch() result=" + zkresult2string(zkr) + " root=" + fea2string(fr, root));
+        return zkr;
+    }
+
+    // Get the keys in tree order
+    results.resize(keyValues.size());
+    for (uint64_t i=0; i<order.size(); i++)
+    {
+        KeyValue &keyValue = keyValues[order[i]];
+        SmtGetResult &result = results[order[i]];
+        zkr = get(batchUUID, db, root, keyValue.key, result, dbReadLog);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt::getMany() failed calling get() result=" + zkresult2string(zkr) + " key=" + fea2string(fr, keyValue.key));
+            return zkr;
+        }
+        keyValue.value = result.value;
+    }
+
+    return ZKR_SUCCESS;
+}
+
+void Smt::sortKeys (Goldilocks &fr, const vector<KeyValue> &keyValues, vector<SmtKeyPath> &paths, vector<uint64_t> &order)
+{
+    paths.resize(keyValues.size());
+    order.resize(keyValues.size());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        splitKey(fr, keyValues[i].key, paths[i].bits);
+        order[i] = i;
+    }
+    stable_sort(order.begin(), order.end(), [&paths](uint64_t a, uint64_t b)
+    {
+        return lexicographical_compare(paths[a].bits, paths[a].bits + 256, paths[b].bits, paths[b].bits + 256);
+    });
+}
+
+// Reads a list of nodes, first from the state manager, if used, and then from the database in one batch
+zkresult Smt::readNodes (const string &batchUUID, Database &db, vector<HashValueGL> &hashValues)
+{
+    bool bUseStateManager = db.config.stateManager && (batchUUID.size() > 0);
+    vector<Goldilocks::Element> dbValue;
+    vector<HashValueGL> dbHashValues;
+    vector<uint64_t> dbIndexes;
+
+    for (uint64_t i=0; i<hashValues.size(); i++)
+    {
+        if (bUseStateManager && (stateManager.readNode(batchUUID, fea2string(fr, hashValues[i].hash), dbValue, NULL) == ZKR_SUCCESS))
+        {
+            for (uint64_t j=0; j<12; j++) hashValues[i].value[j] = (j < dbValue.size()) ? dbValue[j] : fr.zero();
+        }
+        else
+        {
+            dbHashValues.push_back(hashValues[i]);
+            dbIndexes.push_back(i);
+        }
+    }
+
+    if (dbHashValues.size() > 0)
+    {
+        zkresult zkr = db.readMany(dbHashValues, NULL);
+        if (zkr != ZKR_SUCCESS)
+        {
+            return zkr;
+        }
+        for (uint64_t i=0; i<dbHashValues.size(); i++)
+        {
+            hashValues[dbIndexes[i]] = dbHashValues[i];
+        }
+    }
+
+    return ZKR_SUCCESS;
+}
+
+// Reads, level by level, the nodes that set() or get() will read for the sorted keys, so that every level
+// costs one database batch and every node shared by several keys is read only once; it relies on the
+// database cache to keep them, so it does nothing if the cache is disabled
+zkresult Smt::prefetch (const string &batchUUID, Database &db, const Goldilocks::Element (&root)[4], const vector<SmtKeyPath> &paths, const vector<uint64_t> &order)
+{
+#ifdef DATABASE_USE_CACHE
+    if (!db.usingAssociativeCache() && !Database::dbMTCache.enabled())
+    {
+        return ZKR_SUCCESS;
+    }
+
+    // Nodes of the current level, and the range [first, last) of sorted keys that go through each of them
+    vector<HashValueGL> nodes;
+    vector<pair<uint64_t, uint64_t>> ranges;
+    if (!fr.isZero(root[0]) || !fr.isZero(root[1]) || !fr.isZero(root[2]) || !fr.isZero(root[3]))
+    {
+        HashValueGL node;
+        for (uint64_t i=0; i<4; i++) node.hash[i] = root[i];
+        nodes.push_back(node);
+        ranges.push_back(pair<uint64_t, uint64_t>(0, order.size()));
+    }
+
+    for (uint64_t level=0; (level<256) && (nodes.size()>0); level++)
+    {
+        zkresult zkr = readNodes(batchUUID, db, nodes);
+        if (zkr != ZKR_SUCCESS)
+        {
+            zklog.error("Smt::prefetch() failed calling readNodes() result=" + zkresult2string(zkr) + " level=" + to_string(level));
+            return zkr;
+        }
+
+        vector<HashValueGL> nextNodes;
+        vector<pair<uint64_t, uint64_t>> nextRanges;
+        vector<HashValueGL> leafValues;
+        for (uint64_t n=0; n<nodes.size(); n++)
+        {
+            HashValueGL &node = nodes[n];
+
+            // If this is a leaf node, its value hash is read as well
+            if (fr.equal(node.value[8], fr.one()))
+            {
+                HashValueGL leafValue;
+                for (uint64_t i=0; i<4; i++) leafValue.hash[i] = node.value[4+i];
+                leafValues.push_back(leafValue);
+                continue;
+            }
+
+            // Keys are sorted, so the ones that go through the left child come first
+            uint64_t first = ranges[n].first;
+            uint64_t last = ranges[n].second;
+            uint64_t middle = first;
+            while ((middle < last) && !paths[order[middle]].bits[level]) middle++;
+
+            for (uint64_t child=0; child<2; child++)
+            {
+                if ( (child == 0) ? (middle == first) : (middle == last) ) continue;
+                HashValueGL childNode;
+                for (uint64_t i=0; i<4; i++) childNode.hash[i] = node.value[child*4 + i];
+                if (fr.isZero(childNode.hash[0]) && fr.isZero(childNode.hash[1]) && fr.isZero(childNode.hash[2]) && fr.isZero(childNode.hash[3])) continue;
+                nextNodes.push_back(childNode);
+                nextRanges.push_back((child == 0) ? pair<uint64_t, uint64_t>(first, middle) : pair<uint64_t, uint64_t>(middle, last));
+            }
+        }
+
+        if (leafValues.size() > 0)
+        {
+            zkr = readNodes(batchUUID, db, leafValues);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("Smt::prefetch() failed calling readNodes() for leaf values result=" + zkresult2string(zkr) + " level=" + to_string(level));
+                return zkr;
+            }
+        }
+
+        nodes.swap(nextNodes);
+        ranges.swap(nextRanges);
+    }
+#endif
+
+    return ZKR_SUCCESS;
+}
+
 zkresult Smt::hashSave ( const SmtContext &ctx, const Goldilocks::Element (&v)[12], Goldilocks::Element (&hash)[4])
 {
     // Calculate the poseidon hash of the vector of field elements: v = a | c
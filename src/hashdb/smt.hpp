@@ -14,6 +14,8 @@
 #include "persistence.hpp"
 #include "smt_set_result.hpp"
 #include "smt_get_result.hpp"
+#include "key_value.hpp"
+#include "hash_value_gl.hpp"
 
 class SmtContext
 {
@@ -33,6 +35,13 @@ public:
         persistence(persistence) {};
 };
 
+// Path of a key in the tree, i.e. the key bits in the order used to navigate top-down
+class SmtKeyPath
+{
+public:
+    bool bits[256];
+};
+
 // SMT class
 class Smt
 {
@@ -41,6 +50,10 @@ private:
     PoseidonGoldilocks poseidon;
     Goldilocks::Element capacityZero[4];
     Goldilocks::Element capacityOne[4];
+
+    // Batch helpers: read the nodes of the common descent of the sorted keys level by level
+    zkresult readNodes(const string &batchUUID, Database &db, vector<HashValueGL> &hashValues);
+    zkresult prefetch(const string &batchUUID, Database &db, const Goldilocks::Element (&root)[4], const vector<SmtKeyPath> &paths, const vector<uint64_t> &order);
 public:
     Smt(Goldilocks &fr) : fr(fr)
     {
@@ -55,6 +68,17 @@ public:
     }
     zkresult set(const string &batchUUID, uint64_t block, uint64_t tx, Database &db, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, SmtSetResult &result, DatabaseMap *dbReadLog = NULL);
     zkresult get(const string &batchUUID, Database &db, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], SmtGetResult &result, DatabaseMap *dbReadLog = NULL);
+
+    // Batch versions of set() and get(); keys are processed in tree order, sharing the prefetch of their common
+    // upper nodes, and results[i] corresponds to keyValues[i]; in setMany() the oldRoot of every result is the
+    // newRoot of the previous key in tree order, and the newRoot is the same as setting the keys one by one
+    zkresult setMany(const string &batchUUID, uint64_t block, uint64_t tx, Database &db, const Goldilocks::Element (&oldRoot)[4], const vector<KeyValue> &keyValues, const Persistence persistence, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> &results, DatabaseMap *dbReadLog = NULL);
+    zkresult getMany(const string &batchUUID, Database &db, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, vector<SmtGetResult> &results, DatabaseMap *dbReadLog = NULL);
+
+    // Returns in order the indexes of keyValues sorted in tree order; repeated keys keep their request order, so the
+    // last value of a key is the one that remains set, as if the keys were set one by one in request order
+    static void sortKeys(Goldilocks &fr, const vector<KeyValue> &keyValues, vector<SmtKeyPath> &paths, vector<uint64_t> &order);
+
     zkresult hashSave(const SmtContext &ctx, const Goldilocks::Element (&v)[12], Goldilocks::Element (&hash)[4]);
 
     // Consolidate value and capacity
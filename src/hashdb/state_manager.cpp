@@ -1,3 +1,4 @@
+#include <algorithm>
 #include "state_manager.hpp"
 #include "zkassert.hpp"
 #include "zklog.hpp"
@@ -15,6 +16,89 @@ StateManager stateManager;
 //#define LOG_STATE_MANAGER_DELETE_NODE
 //#define LOG_STATE_MANAGER_WRITE_PROGRAM
 
+shared_ptr<BatchState> StateManager::lockBatchState (const string &batchUUID, bool bCreate)
+{
+    while (true)
+    {
+        // Find the batch state, or create it, holding the state map lock only for the lookup
+        Lock();
+        unordered_map<string, shared_ptr<BatchState>>::iterator it = state.find(batchUUID);
+        if (it == state.end())
+        {
+            if (!bCreate)
+            {
+                Unlock();
+                return nullptr;
+            }
+            it = state.emplace(batchUUID, make_shared<BatchState>()).first;
+        }
+        shared_ptr<BatchState> pBatchState = it->second;
+        Unlock();
+
+        // Lock the batch state; if it was erased while waiting for it, e.g. by a flush, look it up again
+        pthread_mutex_lock(&pBatchState->mutex);
+        if (!pBatchState->bErased)
+        {
+            return pBatchState;
+        }
+        pthread_mutex_unlock(&pBatchState->mutex);
+    }
+}
+
+void StateManager::eraseBatchState (const string &batchUUID, BatchState &batchState)
+{
+    Lock();
+    unordered_map<string, shared_ptr<BatchState>>::iterator it = state.find(batchUUID);
+    if ((it != state.end()) && (it->second.get() == &batchState))
+    {
+        state.erase(it);
+    }
+    batchState.bErased = true;
+    Unlock();
+}
+
+StateVersion & StateManager::newVersion (BatchState &batchState, uint64_t block, uint64_t tx, const string &oldStateRoot, const Persistence persistence)
+{
+    shared_ptr<StateVersion> pVersion = make_shared<StateVersion>();
+    pVersion->version = batchState.versions.size();
+    pVersion->block = block;
+    pVersion->tx = tx;
+    pVersion->persistence = persistence;
+    pVersion->oldStateRoot = oldStateRoot;
+
+    // Derive it from the first version that produced its old state root, so that any detour that came back to this
+    // state root is left out; if no version produced it, e.g. at the beginning of a tx, continue from the head
+    unordered_map<string, shared_ptr<StateVersion>>::const_iterator it = batchState.rootVersion[persistence].find(oldStateRoot);
+    if (it != batchState.rootVersion[persistence].end())
+    {
+        pVersion->pParent = it->second;
+    }
+    else
+    {
+        pVersion->pParent = batchState.head[persistence];
+        if (batchState.head[persistence] == nullptr)
+        {
+            batchState.rootVersion[persistence][oldStateRoot] = nullptr;
+        }
+    }
+
+    batchState.versions.emplace_back(pVersion);
+    batchState.head[persistence] = pVersion;
+
+    return *pVersion;
+}
+
+void StateManager::rollback (BatchState &batchState, const string &stateRoot, const Persistence persistence)
+{
+    // The later versions are not deleted, since they are released together with the batch state, but they are no
+    // longer reachable from the head, so they will not be written to database
+    unordered_map<string, shared_ptr<StateVersion>>::const_iterator it = batchState.rootVersion[persistence].find(stateRoot);
+    if (it != batchState.rootVersion[persistence].end())
+    {
+        batchState.head[persistence] = it->second;
+    }
+}
+
 zkresult StateManager::setStateRoot (const string &batchUUID, uint64_t block, uint64_t tx, const string &_stateRoot, bool bIsOldStateRoot, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
@@ -37,26 +121,14 @@ zkresult StateManager::setStateRoot (const string &batchUUID, uint64_t block, ui
     zklog.info("StateManager::setStateRoot() batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " stateRoot=" + stateRoot + " bIsOldStateRoot=" + to_string(bIsOldStateRoot) + " persistence=" + persistence2string(persistence));
 #endif
 
-    Lock();
-
-    unordered_map<string, BatchState>::iterator it;
-
     // Find batch state for this uuid, or create it if it does not exist
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, bIsOldStateRoot);
+    if (pBatchState == nullptr)
     {
-        if (!bIsOldStateRoot)
-        {
-            zklog.error("StateManager::setStateRoot() called with bIsOldStateRoot=false, but batchUUID=" + batchUUID + " does not previously exist");
-            Unlock();
-            return ZKR_STATE_MANAGER;
-        }
-        BatchState batchState;
-        state[batchUUID] = batchState;
-        it = state.find(batchUUID);
-        zkassert(it != state.end());
+        zklog.error("StateManager::setStateRoot() called with bIsOldStateRoot=false, but batchUUID=" + batchUUID + " does not previously exist");
+        return ZKR_STATE_MANAGER;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // The first time we set a non-temporary old state root, assign it to the batch old state root
     if ( batchState.oldStateRoot.empty() &&
@@ -69,149 +141,60 @@ zkresult StateManager::setStateRoot (const string &batchUUID, uint64_t block, ui
     // Set the current state root
     batchState.currentStateRoot = stateRoot;
 
-    // Check block range, and create any previous block state if missing
+    // Check block range, and count any previous block as started if missing
     // This is required for forks < 7 where block start/finish events are not generated by the ROM,
     // and onFinishTx() is not generated for tx=0 because it is a virtual TX to contain SMT activity previous to the first real TX
-    if (block >= batchState.blockState.size())
-    {
-        BlockState emptyBlockState;
-        while (block >= batchState.blockState.size())
-        {
-            batchState.blockState.emplace_back(emptyBlockState);
-        }
-        batchState.currentBlock = batchState.blockState.size() - 1;
-    }
-
-    // Get a reference to the block state
-    BlockState &blockState = batchState.blockState[block];
-
-    // The first time we set a non-temporary old state root, assign it to the block old state root
-    if ( blockState.oldStateRoot.empty() &&
-         ((persistence == PERSISTENCE_DATABASE) || (persistence == PERSISTENCE_CACHE)) &&
-         bIsOldStateRoot )
-    {
-        blockState.oldStateRoot = stateRoot;
-    }
-
-    // If this is a new state root, update the current state root of the block
-    if ( ((persistence == PERSISTENCE_DATABASE) || (persistence == PERSISTENCE_CACHE)) &&
-         !bIsOldStateRoot )
+    if (block >= batchState.blocks)
     {
-        blockState.currentStateRoot = stateRoot;
+        batchState.blocks = block + 1;
+        batchState.currentBlock = block;
     }
 
+    shared_ptr<StateVersion> &head = batchState.head[persistence];
 
-    // Create tx states, if needed
-    if (tx >= blockState.txState.size())
-    {
-        // If this is the first state of a new tx, check that it is the old state root
-        if (!bIsOldStateRoot)
-        {
-            zklog.error("StateManager::setStateRoot() called with bIsOldStateRoot=false, but tx=" + to_string(tx) + " does not previously exist");
-            Unlock();
-            return ZKR_STATE_MANAGER;
-        }
-
-        // Calculate the number of tx slots to create
-        uint64_t txsToCreate = tx - blockState.txState.size() + 1;
-
-        // Create TX state to insert
-        TxState txState;
-        
-        // Insert TX state
-        for (uint64_t i=0; i<txsToCreate; i++)
-        {
-            blockState.txState.emplace_back(txState);
-        }
-
-        // Set current TX
-        blockState.currentTx = tx;
-    }
-
-    // Get a reference to the tx state
-    TxState &txState = blockState.txState[tx];
-
-    // Get the current sub-state list size
-    uint64_t currentSubStateSize = txState.persistence[persistence].subState.size();
-    
-    // In case it is an old state root, we need to create a new sub-state, and check that everything makes sense
+    // In case it is an old state root, we need to create a new version, and check that everything makes sense
     if (bIsOldStateRoot)
     {
-        // If this is the first sub-state of the tx state, record the tx old state root
-        if ( currentSubStateSize == 0)
-        {
-            // Check current sub-state
-            if (txState.persistence[persistence].currentSubState != 0)
-            {
-                zklog.error("StateManager::setStateRoot() currentSubState=" + to_string(txState.persistence[persistence].currentSubState) + "!=0 batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " stateRoot=" + stateRoot + " bIsOldStateRoot=" + to_string(bIsOldStateRoot) + " persistence=" + persistence2string(persistence));
-                Unlock();
-                return ZKR_STATE_MANAGER;
-            }
-
-            // Record the old state root
-            txState.persistence[persistence].oldStateRoot = stateRoot;
-        }
-
-        // If it is not the first sub-state, it must have been called with the previous new state root
-        else
+        // The previous version of the same tx must have been completed with its new state root
+        if ((head != nullptr) && head->newStateRoot.empty() && (head->block == block) && (head->tx == tx))
         {
-            // Check current sub-state
-            if (txState.persistence[persistence].currentSubState >= currentSubStateSize)
-            {
-                zklog.error("StateManager::setStateRoot() currentSubState=" + to_string(txState.persistence[persistence].currentSubState) + " > currentSubStateSize=" + to_string(currentSubStateSize) + " batchUUID=" + batchUUID + " block=" + to_string(block) +  " tx=" + to_string(tx) + " stateRoot=" + stateRoot + " bIsOldStateRoot=" + to_string(bIsOldStateRoot) + " persistence=" + persistence2string(persistence));
-                Unlock();
-                return ZKR_STATE_MANAGER;
-            }
-
-            // Check that new state root is empty
-            if (txState.persistence[persistence].subState[currentSubStateSize-1].newStateRoot.empty())
-            {
-                zklog.error("StateManager::setStateRoot() oldStateRoot found previous newStateRoot empty");
-                Unlock();
-                return ZKR_STATE_MANAGER;
-            }
+            zklog.error("StateManager::setStateRoot() oldStateRoot found previous newStateRoot empty batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
+            unlockBatchState(batchState);
+            return ZKR_STATE_MANAGER;
         }
 
-        // Create TX sub-state
-        TxSubState txSubState;
-        txSubState.oldStateRoot = stateRoot;
-        txSubState.previousSubState = txState.persistence[persistence].currentSubState;
-
-        // Insert it
-        txState.persistence[persistence].subState.emplace_back(txSubState);
-
-        // Record the current state
-        txState.persistence[persistence].currentSubState = txState.persistence[persistence].subState.size() - 1;
+        newVersion(batchState, block, tx, stateRoot, persistence);
     }
 
-    // If it is a new state root, we need to complete the current sub-state
+    // If it is a new state root, we need to complete the current version
     else
     {
-        if (txState.persistence[persistence].currentSubState >= currentSubStateSize)
+        if (head == nullptr)
         {
-            zklog.error("StateManager::setStateRoot() currentSubState=" + to_string(txState.persistence[persistence].currentSubState) + " > currentSubStateSize=" + to_string(currentSubStateSize) + " batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " stateRoot=" + stateRoot + " bIsOldStateRoot=" + to_string(bIsOldStateRoot) + " persistence=" + persistence2string(persistence));
-            Unlock();
+            zklog.error("StateManager::setStateRoot() called with bIsOldStateRoot=false, but tx=" + to_string(tx) + " does not previously exist batchUUID=" + batchUUID + " block=" + to_string(block) + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
+            unlockBatchState(batchState);
             return ZKR_STATE_MANAGER;
         }
 
         // Check that the new state root is empty
-        if (txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState].newStateRoot.size() != 0)
+        if (!head->newStateRoot.empty())
         {
-            zklog.error("StateManager::setStateRoot() found nesStateRoot busy");
-            Unlock();
+            zklog.error("StateManager::setStateRoot() found newStateRoot busy batchUUID=" + batchUUID + " block=" + to_string(block) + " tx=" + to_string(tx) + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
+            unlockBatchState(batchState);
             return ZKR_STATE_MANAGER;
         }
 
-        // Record the new state root in the tx sub-state, and in the tx state
-        txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState].newStateRoot = stateRoot;
-        txState.persistence[persistence].newStateRoot = stateRoot;
+        // Record the new state root; only the first version that produced it is recorded, so that rolling back to
+        // it drops every later detour
+        head->newStateRoot = stateRoot;
+        batchState.rootVersion[persistence].emplace(stateRoot, head);
     }
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     batchState.timeMetricStorage.add("setStateRoot", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 
@@ -239,58 +222,33 @@ zkresult StateManager::writeNode (const string &batchUUID, uint64_t block, uint6
         return ZKR_STATE_MANAGER;
     }
 
-    Lock();
-
     // Find batch state for this uuid
-    unordered_map<string, BatchState>::iterator it;
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         zklog.error("StateManager::writeNode() found no batch state for batch UUID=" + batchUUID);
-        Unlock();
         return ZKR_STATE_MANAGER;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // Check block range
-    if (block >= batchState.blockState.size())
+    if (block >= batchState.blocks)
     {
-        zklog.error("StateManager::writeNode() got block=" + to_string(block) + " bigger than blockState size=" + to_string(it->second.blockState.size()));
-        Unlock();
+        zklog.error("StateManager::writeNode() got block=" + to_string(block) + " bigger than blocks=" + to_string(batchState.blocks));
+        unlockBatchState(batchState);
         return ZKR_STATE_MANAGER;
     }
-    BlockState &blockState = batchState.blockState[block];
 
-    // Check tx range
-    if (tx > blockState.txState.size())
+    // Create a version, if there is none open; completed versions are never modified, since others can derive from them
+    shared_ptr<StateVersion> &head = batchState.head[persistence];
+    if ((head == nullptr) || !head->newStateRoot.empty())
     {
-        zklog.error("StateManager::writeNode() got tx=" + to_string(tx) + " bigger than txState size=" + to_string(blockState.txState.size()));
-        Unlock();
-        return ZKR_STATE_MANAGER;
+        newVersion(batchState, block, tx, (head == nullptr) ? batchState.currentStateRoot : head->newStateRoot, persistence);
     }
 
-    // Create TxState, if not existing
-    if (tx == blockState.txState.size())
-    {
-        TxState aux;
-        aux.persistence[persistence].oldStateRoot = it->second.currentStateRoot;
-        blockState.txState.emplace_back(aux);
-    }
-    TxState &txState = blockState.txState[tx];
-
-    // Create TxSubState, if not existing
-    if (txState.persistence[persistence].subState.size() == 0)
-    {
-        TxSubState subState;
-        subState.previousSubState = 0;
-        subState.oldStateRoot = batchState.currentStateRoot;
-        txState.persistence[persistence].subState.emplace_back(subState);
-        txState.persistence[persistence].currentSubState = 0;
-    }
+    // Add to the current version
+    head->dbWriteNodes[key] = value;
 
-    // Add to sub-state
-    txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState].dbWriteNodes[key] = value;
-    
     // Add to common write pool to speed up read
     batchState.dbWriteNodes[key] = value;
 
@@ -298,7 +256,7 @@ zkresult StateManager::writeNode (const string &batchUUID, uint64_t block, uint6
     batchState.timeMetricStorage.add("writeNode", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 }
@@ -325,73 +283,44 @@ zkresult StateManager::deleteNode (const string &batchUUID, uint64_t block, uint
         return ZKR_STATE_MANAGER;
     }
 
-    Lock();
-
-    unordered_map<string, BatchState>::iterator it;
-
     // Find batch state for this batch uuid
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         zklog.error("StateManager::deleteNode() found no batch state for batch UUID=" + batchUUID);
-        Unlock();
         return ZKR_STATE_MANAGER;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // Check block range
-    if (block >= batchState.blockState.size())
-    {
-        zklog.error("StateManager::deleteNode() got block=" + to_string(block) + " bigger than blockState size=" + to_string(batchState.blockState.size()));
-        Unlock();
-        return ZKR_STATE_MANAGER;
-    }
-
-    // Find block state for this block
-    BlockState &blockState = batchState.blockState[block];
-
-    // Check tx range
-    if (tx >= blockState.txState.size())
+    if (block >= batchState.blocks)
     {
-        zklog.error("StateManager::deleteNode() got tx=" + to_string(tx) + " bigger than txState size=" + to_string(blockState.txState.size()));
-        Unlock();
+        zklog.error("StateManager::deleteNode() got block=" + to_string(block) + " bigger than blocks=" + to_string(batchState.blocks));
+        unlockBatchState(batchState);
         return ZKR_STATE_MANAGER;
     }
 
-    // Find TX state for this tx
-    TxState &txState = blockState.txState[tx];
-    
-    // Find TX current sub-state
-    if (txState.persistence[persistence].subState.size() == 0)
+    // Find the current version
+    shared_ptr<StateVersion> &head = batchState.head[persistence];
+    if (head == nullptr)
     {
-        zklog.error("StateManager::deleteNode() found subState.size=0 tx=" + to_string(tx) + " batchUUIDe=" + batchUUID);
-        Unlock();
+        zklog.error("StateManager::deleteNode() found no version tx=" + to_string(tx) + " batchUUID=" + batchUUID);
+        unlockBatchState(batchState);
         return ZKR_STATE_MANAGER;
     }
-    if (txState.persistence[persistence].currentSubState >= txState.persistence[persistence].subState.size())
+    if (!head->newStateRoot.empty())
     {
-        zklog.error("StateManager::deleteNode() found currentSubState=" + to_string(txState.persistence[persistence].currentSubState) + " >= subState.size=" + to_string(txState.persistence[persistence].subState.size()) + " tx=" + to_string(tx) + " batchUUIDe=" + batchUUID);
-        Unlock();
-        return ZKR_STATE_MANAGER;
+        newVersion(batchState, block, tx, head->newStateRoot, persistence);
     }
-    TxSubState &txSubState = txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState];
-
-    // Delete this key in the surrent TX sub-state
-    /*unordered_map<string, vector<Goldilocks::Element>>::iterator dbIt;
-    dbIt = txSubState.dbWrite.find(key);
-    if (dbIt != txSubState.dbWrite.end())
-    {
-        txSubState.dbWrite.erase(dbIt);
-        zklog.info("StateManager::deleteNode() batchUUID=" + batchUUID + " tx=" + to_string(tx) + " key=" + key);
-    }*/
 
-    txSubState.dbDeleteNodes.emplace_back(key);
+    // Record the deletion of this key in the current version
+    head->dbDeleteNodes.emplace_back(key);
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     batchState.timeMetricStorage.add("deleteNode", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 }
@@ -405,18 +334,14 @@ zkresult StateManager::readNode (const string &batchUUID, const string &_key, ve
     string key = NormalizeToNFormat(_key, 64);
     key = stringToLower(key);
 
-    Lock();
-
     // Find batch state for this uuid
-    unordered_map<string, BatchState>::iterator it;
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         //zklog.error("StateManager::read() found no batch state for batch UUID=" + batchUUID);
-        Unlock();
         return ZKR_DB_KEY_NOT_FOUND;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // Search in the common write list
     unordered_map<string, vector<Goldilocks::Element>>::iterator dbIt;
@@ -435,7 +360,7 @@ zkresult StateManager::readNode (const string &batchUUID, const string &_key, ve
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
         batchState.timeMetricStorage.add("readNode success", TimeDiff(t));
 #endif
-        Unlock();
+        unlockBatchState(batchState);
 
         return ZKR_SUCCESS;
     }
@@ -444,7 +369,7 @@ zkresult StateManager::readNode (const string &batchUUID, const string &_key, ve
     batchState.timeMetricStorage.add("readNode not found", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_DB_KEY_NOT_FOUND;
 }
@@ -471,56 +396,29 @@ zkresult StateManager::writeProgram (const string &batchUUID, uint64_t block, ui
         return ZKR_STATE_MANAGER;
     }
 
-    Lock();
-
     // Find batch state for this uuid, or create it if it does not exist
-    unordered_map<string, BatchState>::iterator it;
-    it = state.find(batchUUID);
-    if (it == state.end())
-    {
-        BatchState batchState;
-        state[batchUUID] = batchState;
-        it = state.find(batchUUID);
-        zkassert(it != state.end());
-    }
-    BatchState &batchState = it->second;
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, true);
+    BatchState &batchState = *pBatchState;
 
     // Detect first set programs before first block, one per TX, and ignore them
-    if ((block == 0) && batchState.blockState.empty())
+    if ((block == 0) && (batchState.blocks == 0))
     {
         //zklog.warning("StateManager::writeProgram() ignoring program set before first block key=" + key);
-        Unlock();
+        unlockBatchState(batchState);
         return ZKR_SUCCESS;
     }
 
     // Check block range
-    if (block >= batchState.blockState.size())
+    if (block >= batchState.blocks)
     {
-        zklog.error("StateManager::writeProgram() got block=" + to_string(block) + " bigger than blockState size=" + to_string(it->second.blockState.size()));
-        Unlock();
+        zklog.error("StateManager::writeProgram() got block=" + to_string(block) + " bigger than blocks=" + to_string(batchState.blocks));
+        unlockBatchState(batchState);
         return ZKR_STATE_MANAGER;
     }
-    BlockState &blockState = batchState.blockState[block];
 
-    // Check tx range
-    if (tx > blockState.txState.size())
-    {
-        zklog.error("StateManager::writeProgram() got tx=" + to_string(tx) + " bigger than txState size=" + to_string(blockState.txState.size()));
-        Unlock();
-        return ZKR_STATE_MANAGER;
-    }
-
-    // Create TxState, if not existing
-    if (tx == blockState.txState.size())
-    {
-        TxState aux;
-        aux.persistence[persistence].oldStateRoot = it->second.currentStateRoot;
-        blockState.txState.emplace_back(aux);
-    }
-    TxState &txState = blockState.txState[tx];
-
-    // Add to sub-state
-    txState.persistence[persistence].dbWritePrograms[key] = value;
+    // Add to the programs to write of this persistence; programs are not versioned, since their key is the hash of
+    // their content, so writing the ones of a rolled back tx is harmless
+    batchState.persistenceWritePrograms[persistence][key] = value;
     
     // Add to common write pool to speed up read
     batchState.dbWritePrograms[key] = value;
@@ -529,7 +427,7 @@ zkresult StateManager::writeProgram (const string &batchUUID, uint64_t block, ui
     batchState.timeMetricStorage.add("writePrograms", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 }
@@ -543,18 +441,14 @@ zkresult StateManager::readProgram (const string &batchUUID, const string &_key,
     string key = NormalizeToNFormat(_key, 64);
     key = stringToLower(key);
 
-    Lock();
-
     // Find batch state for this uuid
-    unordered_map<string, BatchState>::iterator it;
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         //zklog.error("StateManager::readProgram() found no batch state for batch UUID=" + batchUUID);
-        Unlock();
         return ZKR_DB_KEY_NOT_FOUND;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // Search in the common write list
     unordered_map<string, vector<uint8_t>>::iterator dbIt;
@@ -573,7 +467,7 @@ zkresult StateManager::readProgram (const string &batchUUID, const string &_key,
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
         batchState.timeMetricStorage.add("readProgram success", TimeDiff(t));
 #endif
-        Unlock();
+        unlockBatchState(batchState);
 
         return ZKR_SUCCESS;
     }
@@ -582,16 +476,11 @@ zkresult StateManager::readProgram (const string &batchUUID, const string &_key,
     batchState.timeMetricStorage.add("readProgram not found", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_DB_KEY_NOT_FOUND;
 }
 
-bool IsInvalid(TxSubState &txSubState)
-{
-    return !txSubState.bValid;
-}
-
 zkresult StateManager::finishTx (const string &batchUUID, const string &_stateRoot, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
@@ -614,13 +503,9 @@ zkresult StateManager::finishTx (const string &batchUUID, const string &_stateRo
     zklog.info("StateManager::finishTx() batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
 #endif
 
-    Lock();
-
-    unordered_map<string, BatchState>::iterator it;
-
     // Find batch state for this uuid
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         zklog.warning("StateManager::finishTx() found no batch state for batch UUID=" + batchUUID + "; normal if no SMT activity happened");
  
@@ -628,79 +513,31 @@ zkresult StateManager::finishTx (const string &batchUUID, const string &_stateRo
         //batchState.timeMetricStorage.add("finishTx UUID not found", TimeDiff(t));
         //batchState.timeMetricStorage.print("State Manager calls");
 #endif
-        Unlock();
         return ZKR_SUCCESS;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // Check currentBlock range
-    if (batchState.currentBlock >= batchState.blockState.size())
+    if (batchState.currentBlock >= batchState.blocks)
     {
-        zklog.error("StateManager::finishTx() found batchState.currentBlock=" + to_string(batchState.currentBlock) + " >= batchState.blockState.size=" + to_string(batchState.blockState.size()) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
-        Unlock();
+        zklog.error("StateManager::finishTx() found batchState.currentBlock=" + to_string(batchState.currentBlock) + " >= batchState.blocks=" + to_string(batchState.blocks) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
+        unlockBatchState(batchState);
         return ZKR_STATE_MANAGER;
     }
-    BlockState &blockState = batchState.blockState[batchState.currentBlock];
 
-    // Check currentTx range
-    if (blockState.currentTx >= blockState.txState.size())
+    // In the expected case, the tx ended at the state root of the current version; otherwise, e.g. if the tx was
+    // reverted, roll back to the version that produced this state root, dropping the rest
+    const shared_ptr<StateVersion> &head = batchState.head[persistence];
+    if (config.stateManagerPurge && ((head == nullptr) || (head->newStateRoot != stateRoot)))
     {
-        zklog.error("StateManager::finishTx() found blockState.currentTx=" + to_string(blockState.currentTx) + " >= blockState.txState.size=" + to_string(blockState.txState.size()) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
-        Unlock();
-        return ZKR_STATE_MANAGER;
-    }
-
-    // Get a reference to the tx state
-    TxState &txState = blockState.txState[blockState.currentTx];
-    TxPersistenceState &txPersistenceState = txState.persistence[persistence];
-
-    if (txPersistenceState.newStateRoot == stateRoot)
-    {
-        // This is the expected case
-    }
-    else if (txPersistenceState.oldStateRoot == stateRoot)
-    {
-        if (config.stateManagerPurge)
-        {
-            // The TX ended up with the same state root as the beginning, so we can delete all data
-            txPersistenceState.subState.clear();
-            txPersistenceState.newStateRoot = stateRoot;
-            txPersistenceState.currentSubState = 0;
-        }
-    }
-    else
-    {
-        if (config.stateManagerPurge)
-        {
-            // Search for the point at which we reach this state, and delete the rest
-            bool bFound = false;
-            uint64_t i=0;
-            uint64_t subStateSize = txPersistenceState.subState.size();
-            for (i=0; i<subStateSize; i++)
-            {
-                if (!bFound && txPersistenceState.subState[i].oldStateRoot == stateRoot)
-                {
-                    bFound = true;
-                    break;
-                }
-            }
-            if (bFound)
-            {
-                txPersistenceState.newStateRoot = stateRoot;
-                txPersistenceState.currentSubState = (i == 0) ? 0 : i-1;
-                for (; i<subStateSize; i++)
-                {
-                    txPersistenceState.subState.pop_back();
-                }
-            }
-        }
+        rollback(batchState, stateRoot, persistence);
     }
     
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     batchState.timeMetricStorage.add("finishTx", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 }
@@ -727,42 +564,19 @@ zkresult StateManager::startBlock (const string &batchUUID, const string &_state
     zklog.info("StateManager::startBlock() batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
 #endif
 
-    Lock();
-
-    unordered_map<string, BatchState>::iterator it;
-
     // Find batch state for this uuid
-    it = state.find(batchUUID);
-    if (it == state.end())
-    {
-        BatchState batchState;
-        state[batchUUID] = batchState;
-        it = state.find(batchUUID);
-        zkassert(it != state.end());
-    }
-    BatchState &batchState = it->second;
-
-    // Check currentBlock range
-    if (!batchState.blockState.empty() && (batchState.currentBlock >= batchState.blockState.size()))
-    {
-        zklog.error("StateManager::startBlock() found batchState.currentBlock=" + to_string(batchState.currentBlock) + " >= batchState.blockState.size=" + to_string(batchState.blockState.size()) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
-        Unlock();
-        return ZKR_STATE_MANAGER;
-    }
-
-    // Create an empty block state to insert
-    BlockState blockState;
-    blockState.oldStateRoot = stateRoot;
-    batchState.blockState.emplace_back(blockState);
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, true);
+    BatchState &batchState = *pBatchState;
 
-    // Set current block
-    batchState.currentBlock = batchState.blockState.size() - 1;
+    // Start a new block
+    batchState.blocks++;
+    batchState.currentBlock = batchState.blocks - 1;
     
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     batchState.timeMetricStorage.add("startBlock", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 }
@@ -789,13 +603,9 @@ zkresult StateManager::finishBlock (const string &batchUUID, const string &_stat
     zklog.info("StateManager::finishBlock() batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
 #endif
 
-    Lock();
-
-    unordered_map<string, BatchState>::iterator it;
-
     // Find batch state for this uuid
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         zklog.warning("StateManager::finishBlock() found no batch state for batch UUID=" + batchUUID + "; normal if no SMT activity happened");
  
@@ -803,83 +613,31 @@ zkresult StateManager::finishBlock (const string &batchUUID, const string &_stat
         //batchState.timeMetricStorage.add("finishBlock UUID not found", TimeDiff(t));
         //batchState.timeMetricStorage.print("State Manager calls");
 #endif
-        Unlock();
         return ZKR_SUCCESS;
     }
-    BatchState &batchState = it->second;
+    BatchState &batchState = *pBatchState;
 
     // Check currentBlock range
-    if (batchState.currentBlock >= batchState.blockState.size())
-    {
-        zklog.error("StateManager::finishBlock() found batchState.currentBlock=" + to_string(batchState.currentBlock) + " >= batchState.blockState.size=" + to_string(batchState.blockState.size()) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
-        Unlock();
-        return ZKR_STATE_MANAGER;
-    }
-    BlockState &blockState = batchState.blockState[batchState.currentBlock];
-
-    // Check currentTx range
-    if (blockState.currentTx >= blockState.txState.size())
+    if (batchState.currentBlock >= batchState.blocks)
     {
-        zklog.error("StateManager::finishBlock() found blockState.currentTx=" + to_string(blockState.currentTx) + " >= blockState.txState.size=" + to_string(blockState.txState.size()) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
-        Unlock();
+        zklog.error("StateManager::finishBlock() found batchState.currentBlock=" + to_string(batchState.currentBlock) + " >= batchState.blocks=" + to_string(batchState.blocks) + " batchUUID=" + batchUUID + " stateRoot=" + stateRoot + " persistence=" + persistence2string(persistence));
+        unlockBatchState(batchState);
         return ZKR_STATE_MANAGER;
     }
 
-    // Get a reference to the tx state
-    TxState &txState = blockState.txState[blockState.currentTx];
-    TxPersistenceState &txPersistenceState = txState.persistence[persistence];
-
-
-    // This is the happy path case: the last tx
-    if (txPersistenceState.newStateRoot == stateRoot)
+    // In the happy path, the last tx ended at the state root of the current version; otherwise, roll back to the
+    // version that produced this state root, which drops the whole block if it ended with its initial state root
+    const shared_ptr<StateVersion> &head = batchState.head[persistence];
+    if (config.stateManagerPurge && ((head == nullptr) || (head->newStateRoot != stateRoot)))
     {
-        blockState.currentStateRoot = stateRoot;
-    }
-
-    // If it ended with the same state, activity can be discarded
-    else if (txPersistenceState.oldStateRoot == stateRoot)
-    {
-        if (config.stateManagerPurge)
-        {
-            // The block ended up with the same state root as the beginning, so we can delete all data
-            blockState.txState.clear();
-            blockState.currentStateRoot = stateRoot;
-            blockState.currentTx = 0;
-        }
-    }
-    else
-    {
-        if (config.stateManagerPurge)
-        {
-            // Search for the point at which we reach this state, and delete the rest
-            bool bFound = false;
-            uint64_t i=0;
-            uint64_t txStateSize = blockState.txState.size();
-            for (i=0; i<txStateSize; i++)
-            {
-                if (!bFound && blockState.txState[i].persistence[persistence].oldStateRoot == stateRoot)
-                {
-                    bFound = true;
-                    break;
-                }
-            }
-            if (bFound)
-            {
-                blockState.currentStateRoot = stateRoot;
-                blockState.currentTx = (i == 0) ? 0 : i-1;
-                for (; i<txStateSize; i++)
-                {
-                    blockState.txState.pop_back();
-                }
-            }
-        }
+        rollback(batchState, stateRoot, persistence);
     }
     
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     batchState.timeMetricStorage.add("finishBlock", TimeDiff(t));
 #endif
 
-    Unlock();
+    unlockBatchState(batchState);
 
     return ZKR_SUCCESS;
 }
@@ -892,6 +650,7 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
 #endif
 
     string newStateRoot = NormalizeToNFormat(_newStateRoot, 64);
+    newStateRoot = stringToLower(newStateRoot);
 
     //TimerStart(STATE_MANAGER_FLUSH);
 
@@ -899,18 +658,13 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
     zklog.info("StateManager::flush() batchUUID=" + batchUUID + " newStateRoot=" + newStateRoot + " persistence=" + persistence2string(_persistence));
 #endif
 
-    // For every TX, track backwards from newStateRoot to oldStateRoot, marking sub-states as valid
-
-    Lock();
-
     zkresult zkr;
 
     //print(false);
 
     // Find batch state for this uuid
-    unordered_map<string, BatchState>::iterator it;
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         //zklog.warning("StateManager::flush() found no batch state for batch UUID=" + batchUUID + "; normal if no SMT activity happened");
  
@@ -926,251 +680,150 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
         //timeMetricStorage.add("flush UUID not found", TimeDiff(t));
         //timeMetricStorage.print("State Manager calls");
 #endif
-        Unlock();
         return zkr;
     }
-    BatchState &batchState = it->second;
-
-    /////////////////////////////////////////////////
-    // Purge batch, i.e. delete unnecessary blocks //
-    /////////////////////////////////////////////////
-
-    // Simple case: TX was cancelled (e.g. OOC) and state root does not change, so clear blocks
-    if (config.stateManagerPurge && (newStateRoot == batchState.oldStateRoot))
-    {
-        //zklog.info("StateManager::flush() deleting whole batch");
-        batchState.blockState.clear();
-        batchState.currentBlock = 0;
-        batchState.currentStateRoot = batchState.oldStateRoot;
-    }
-
-    // Apply the same logic for all blocks: if block does not change the state, delete it
-    if (config.stateManagerPurge && !_newStateRoot.empty() && !batchState.blockState.empty() && !batchState.oldStateRoot.empty())
-    {
+    BatchState &batchState = *pBatchState;
 
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-        gettimeofday(&t2, NULL);
-#endif
-        for (int64_t block = batchState.blockState.size() - 1; block >= 0; block--)
-        {
-            if (batchState.blockState[block].currentStateRoot == batchState.blockState[block].oldStateRoot)
-            {
-                //zklog.info("StateManager::flush() deleting block that does not change the state=" + batchState.blockState[block].currentStateRoot + " at position=" + to_string(block));
-                batchState.blockState.erase(batchState.blockState.begin() + block);
-            }
-        }
+    //////////////////////////////////////////////
+    // Select the versions to write to database //
+    //////////////////////////////////////////////
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-        batchState.timeMetricStorage.add("purge blocks", TimeDiff(t2));
+    gettimeofday(&t2, NULL);
 #endif
-    }
 
-    string lastNewStateRoot;
-
-    // For all blocks
-    for (uint64_t block=0; block<batchState.blockState.size(); block++)
+    // If purge is active, only the versions from the first state root of the batch to the new state root are written,
+    // i.e. the chain of parents of the version that produced it; this chain does not include the rolled back versions,
+    // nor the ones that came back to a previous state root, e.g. a block that did not change the state, so there is
+    // nothing to purge; if the batch did not change the state, e.g. it was cancelled (OOC), nothing is written
+    // Temporary data is never written to database
+    bool bCancelled = config.stateManagerPurge && (newStateRoot == batchState.oldStateRoot);
+    vector<StateVersion *> versions;
+    if (config.stateManagerPurge)
     {
-        // Get a reference to the block state
-        BlockState &blockState = batchState.blockState[block];
-
-        // Data to write to database
-        unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
-
-        // For all tx sub-states, purge the data to write
-        for (uint64_t tx=0; tx<blockState.txState.size(); tx++)
+        if (!bCancelled)
         {
             for (uint64_t persistence = 0; persistence < PERSISTENCE_SIZE; persistence++)
             {
-                TxState &txState = blockState.txState[tx];
-
-                // Temporary data can be deleted at the end of a batch
                 if ((persistence == PERSISTENCE_TEMPORARY) || (persistence == PERSISTENCE_TEMPORARY_HASH))
                 {
-                    txState.persistence[persistence].subState.clear();
-                    txState.persistence[persistence].currentSubState = 0;
                     continue;
                 }
-
-                // If there's no data, there's nothing to do
-                if (txState.persistence[persistence].subState.size() == 0)
+                StateVersion *pVersion = batchState.head[persistence].get();
+                if (!_newStateRoot.empty())
                 {
-                    continue;
+                    unordered_map<string, shared_ptr<StateVersion>>::const_iterator it = batchState.rootVersion[persistence].find(newStateRoot);
+                    if (it != batchState.rootVersion[persistence].end())
+                    {
+                        pVersion = it->second.get();
+                    }
                 }
-
-                // Check that current sub-state newStateRoot matches the TX one
-                if (txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState].newStateRoot != txState.persistence[persistence].newStateRoot)
+                for (; pVersion != NULL; pVersion = pVersion->pParent.get())
                 {
-                    zklog.error("StateManager::flush() found inconsistent new state roots: batchUUID=" + batchUUID +
-                        " newStateRoot=" + _newStateRoot +
-                        " block=" + to_string(block) +
-                        " tx=" + to_string(tx) + " txState.newStateRoot=" + txState.persistence[persistence].newStateRoot +
-                        " currentSubState=" + to_string(txState.persistence[persistence].currentSubState) +
-                        " substate.newStateRoot=" + txState.persistence[persistence].subState[txState.persistence[persistence].currentSubState].newStateRoot);
-                        
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                    batchState.timeMetricStorage.add("flush UUID inconsistent new state roots", TimeDiff(t));
-                    batchState.timeMetricStorage.print("State Manager calls");
-#endif
-                    Unlock();
-                    return ZKR_STATE_MANAGER;
+                    versions.emplace_back(pVersion);
                 }
-
-                //////////////////////////
-                // Find valid substates //
-                //////////////////////////
+            }
+            sort(versions.begin(), versions.end(), [](const StateVersion *a, const StateVersion *b) { return a->version < b->version; });
+        }
+    }
+    else
+    {
+        for (uint64_t i = 0; i < batchState.versions.size(); i++)
+        {
+            if ((batchState.versions[i]->persistence != PERSISTENCE_TEMPORARY) && (batchState.versions[i]->persistence != PERSISTENCE_TEMPORARY_HASH))
+            {
+                versions.emplace_back(batchState.versions[i].get());
+            }
+        }
+    }
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                gettimeofday(&t2, NULL);
+    batchState.timeMetricStorage.add("select versions", TimeDiff(t2));
 #endif
-                uint64_t currentSubState = txState.persistence[persistence].currentSubState;
-                while (true)
-                {
-                    txState.persistence[persistence].subState[currentSubState].bValid = true;
-                    if (currentSubState == 0)
-                    {
-                        if (txState.persistence[persistence].subState[currentSubState].oldStateRoot != txState.persistence[persistence].oldStateRoot)
-                        {
-                            zklog.error("StateManager::flush() found inconsistent old state roots: batchUUID=" + batchUUID +
-                                " newStateRoot=" + _newStateRoot +
-                                " block=" + to_string(block) +
-                                " tx=" + to_string(tx) + " txState.oldStateRoot=" + txState.persistence[persistence].oldStateRoot +
-                                " currentSubState=" + to_string(txState.persistence[persistence].currentSubState) +
-                                " substate.oldStateRoot=" + txState.persistence[persistence].subState[currentSubState].oldStateRoot);
 
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                            batchState.timeMetricStorage.add("flush UUID inconsistent old state roots", TimeDiff(t));
-                            batchState.timeMetricStorage.print("State Manager calls");
-#endif
-                            Unlock();
-                            return ZKR_STATE_MANAGER;
-                        }
-                        break;
-                    }
-                    uint64_t previousSubState = txState.persistence[persistence].subState[currentSubState].previousSubState;
-                    if (txState.persistence[persistence].subState[previousSubState].newStateRoot == txState.persistence[persistence].subState[currentSubState].oldStateRoot)
-                    {
-                        currentSubState = previousSubState;
-                        continue;
-                    }
+    ////////////////////////////////
+    // Write programs to database //
+    ////////////////////////////////
 
-                    // Search for the previous state
-                    uint64_t i=0;
-                    for (; i<currentSubState; i++)
-                    {
-                        if (txState.persistence[persistence].subState[i].newStateRoot == txState.persistence[persistence].subState[currentSubState].oldStateRoot)
-                        {
-                            previousSubState = i;
-                            break;
-                        }
-                    }
-                    if (i == currentSubState)
-                    {
-                        // If the origin of this sub-state is the tx old state root, then we are done
-                        if (txState.persistence[persistence].subState[currentSubState].oldStateRoot == txState.persistence[persistence].oldStateRoot)
-                        {
-                            break;
-                        }
-
-                        // Otherwise, we could not find a sub-state that connects to this one
-                        zklog.error("StateManager::flush() could not find previous tx sub-state: batchUUID=" + batchUUID +
-                            " newStateRoot=" + _newStateRoot +
-                            " block=" + to_string(block) +
-                            " tx=" + to_string(tx) +
-                            " txState.oldStateRoot=" + txState.persistence[persistence].oldStateRoot +
-                            " currentSubState=" + to_string(txState.persistence[persistence].currentSubState) +
-                            " substate.oldStateRoot=" + txState.persistence[persistence].subState[currentSubState].oldStateRoot);
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                        batchState.timeMetricStorage.add("flush UUID cannot find previous tx sub-state", TimeDiff(t));
-                        batchState.timeMetricStorage.print("State Manager calls");
-#endif
-                        Unlock();
-                        return ZKR_STATE_MANAGER;
-                    }
-                    currentSubState = previousSubState;
-                }
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                batchState.timeMetricStorage.add("find valid substates", TimeDiff(t2));
+    gettimeofday(&t2, NULL);
 #endif
+    for (uint64_t persistence = 0; persistence < PERSISTENCE_SIZE; persistence++)
+    {
+        if (bCancelled || (persistence == PERSISTENCE_TEMPORARY) || (persistence == PERSISTENCE_TEMPORARY_HASH))
+        {
+            continue;
+        }
+
+        // For all programs in persistenceWritePrograms
+        unordered_map<string, vector<uint8_t>>::const_iterator writeIt;
+        for ( writeIt = batchState.persistenceWritePrograms[persistence].begin();
+              writeIt != batchState.persistenceWritePrograms[persistence].end();
+              writeIt++ )
+        {
+            // Call db.setProgram
+            zkr = db.setProgram(writeIt->first, writeIt->second, persistence == PERSISTENCE_DATABASE ? 1 : 0);
+            if (zkr != ZKR_SUCCESS)
+            {
+                zklog.error("StateManager::flush() failed calling db.writeProgram() result=" + zkresult2string(zkr));
+                eraseBatchState(batchUUID, batchState);
 
-                /////////////////////////////////
-                // Load data to write database //
-                /////////////////////////////////
+                //TimerStopAndLog(STATE_MANAGER_FLUSH);
 
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                gettimeofday(&t2, NULL);
+                batchState.timeMetricStorage.add("flush error db.writeProgram", TimeDiff(t));
+                batchState.timeMetricStorage.print("State Manager calls");
+#endif
+                unlockBatchState(batchState);
+                return zkr;
+            }
+        }
+    }
+#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
+    batchState.timeMetricStorage.add("db.setProgram", TimeDiff(t2));
 #endif
 
-                // For all sub-states
-                for (uint64_t ss = 0; ss < txState.persistence[persistence].subState.size(); ss++)
-                {
-                    // Skip invalid sub-states (if purge is active)
-                    if (db.config.stateManagerPurge &&
-                        ( !txState.persistence[persistence].subState[ss].bValid ||
-                          (txState.persistence[persistence].subState[ss].oldStateRoot == txState.persistence[persistence].subState[ss].newStateRoot) ) )
-                    {
-                        //zklog.info("StateManager::flush() skipping subState block=" + to_string(block) + " tx=" + to_string(tx) + " persistence=" + persistence2string((Persistence)persistence) + " ss=" + to_string(ss));
-                        continue;
-                    }
-
-                    // Add node keys to dbWriteNodes
-                    dbWriteNodes.insert( txState.persistence[persistence].subState[ss].dbWriteNodes.begin(),
-                                         txState.persistence[persistence].subState[ss].dbWriteNodes.end());
+    /////////////////////////////
+    // Write nodes to database //
+    /////////////////////////////
 
-                    // Delete node keys (if purge is active)
-                    if (db.config.stateManagerPurge)
-                    {
-                        for (uint64_t k = 0; k < txState.persistence[persistence].subState[ss].dbDeleteNodes.size(); k++)
-                        {
-                            //zklog.info("StateManager::flush() deleting key=" + txState.persistence[persistence].subState[ss].dbDeleteNodes[k] + " at block=" + to_string(block) + " with stateRoot=" + batchState.blockState[block].currentStateRoot);
-                            dbWriteNodes.erase(txState.persistence[persistence].subState[ss].dbDeleteNodes[k]);
-                        }
-                    }
+    string lastNewStateRoot;
 
-                    // Copy new state root
-                    lastNewStateRoot = txState.persistence[persistence].newStateRoot;
-                }
+    // Data to write to database, per block
+    unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
 
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                batchState.timeMetricStorage.add("load data to write to DB", TimeDiff(t2));
-#endif
+    for (uint64_t v = 0; v < versions.size(); v++)
+    {
+        StateVersion &version = *versions[v];
 
-                ///////////////////////////////////////////
-                // Write programs of this TX to database //
-                ///////////////////////////////////////////
+        // Skip versions that do not change the state (if purge is active)
+        if (!config.stateManagerPurge || (version.oldStateRoot != version.newStateRoot))
+        {
+            // Add node keys to dbWriteNodes
+            dbWriteNodes.insert(version.dbWriteNodes.begin(), version.dbWriteNodes.end());
 
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                gettimeofday(&t2, NULL);
-#endif
-                // For all programs in dbWritePrograms
-                unordered_map<string, vector<uint8_t>>::const_iterator writeIt;
-                for ( writeIt = txState.persistence[persistence].dbWritePrograms.begin();
-                      writeIt != txState.persistence[persistence].dbWritePrograms.end();
-                      writeIt++ )
+            // Delete node keys (if purge is active)
+            if (config.stateManagerPurge)
+            {
+                for (uint64_t k = 0; k < version.dbDeleteNodes.size(); k++)
                 {
-                    // Call db.setProgram
-                    zkr = db.setProgram(writeIt->first, writeIt->second, persistence == PERSISTENCE_DATABASE ? 1 : 0);
-                    if (zkr != ZKR_SUCCESS)
-                    {
-                        zklog.error("StateManager::flush() failed calling db.writeProgram() result=" + zkresult2string(zkr));
-                        state.erase(it);
-
-                        //TimerStopAndLog(STATE_MANAGER_FLUSH);
-
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                        batchState.timeMetricStorage.add("flush error db.writeProgram", TimeDiff(t));
-                        batchState.timeMetricStorage.print("State Manager calls");
-#endif
-                        Unlock();
-                        return zkr;
-                    }
+                    dbWriteNodes.erase(version.dbDeleteNodes[k]);
                 }
-#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
-                batchState.timeMetricStorage.add("db.setProgram", TimeDiff(t2));
-#endif
+            }
+
+            // Copy new state root
+            if (!version.newStateRoot.empty())
+            {
+                lastNewStateRoot = version.newStateRoot;
             }
         }
 
-        // Write remaining nodes of this block to database
+        // Write the nodes of a block to database after its last version, so that the deleted nodes only cancel the
+        // ones written in the same block
+        if ((v + 1 < versions.size()) && (versions[v + 1]->block == version.block))
+        {
+            continue;
+        }
         unordered_map<string, vector<Goldilocks::Element>>::const_iterator writeIt;
         for (writeIt = dbWriteNodes.begin(); writeIt != dbWriteNodes.end(); writeIt++)
         {
@@ -1178,18 +831,19 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
             if (zkr != ZKR_SUCCESS)
             {
                 zklog.error("StateManager::flush() failed calling db.write() result=" + zkresult2string(zkr));
-                state.erase(it);
+                eraseBatchState(batchUUID, batchState);
 
                 //TimerStopAndLog(STATE_MANAGER_FLUSH);
 
-    #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
+#ifdef LOG_TIME_STATISTICS_STATE_MANAGER
                 batchState.timeMetricStorage.add("flush error db.write", TimeDiff(t));
                 batchState.timeMetricStorage.print("State Manager calls");
-    #endif
-                Unlock();
+#endif
+                unlockBatchState(batchState);
                 return zkr;
             }
         }
+        dbWriteNodes.clear();
     }
 
     // Write last new state root to database
@@ -1207,7 +861,7 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
         if (zkr != ZKR_SUCCESS)
         {
             zklog.error("StateManager::flush() failed calling db.updateStateRoot() result=" + zkresult2string(zkr));
-            state.erase(it);
+            eraseBatchState(batchUUID, batchState);
 
             //TimerStopAndLog(STATE_MANAGER_FLUSH);
 
@@ -1215,7 +869,7 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
             batchState.timeMetricStorage.add("flush error db.updateStateRoot", TimeDiff(t));
             batchState.timeMetricStorage.print("State Manager calls");
 #endif
-            Unlock();
+            unlockBatchState(batchState);
             return zkr;
         }
 
@@ -1242,9 +896,9 @@ zkresult StateManager::flush (const string &batchUUID, const string &_newStateRo
 #endif
     
     // Delete this batch UUID state
-    state.erase(it);
+    eraseBatchState(batchUUID, batchState);
 
-    Unlock();
+    unlockBatchState(batchState);
 
     //TimerStopAndLog(STATE_MANAGER_FLUSH);
 
@@ -1264,21 +918,16 @@ zkresult StateManager::cancelBatch (const string &batchUUID)
     zklog.info("StateManager::cancelBatch() batchUUID=" + batchUUID);
 #endif
 
-    Lock();
-
     // Find batch state for this uuid
-    unordered_map<string, BatchState>::iterator it;
-    it = state.find(batchUUID);
-    if (it == state.end())
+    shared_ptr<BatchState> pBatchState = lockBatchState(batchUUID, false);
+    if (pBatchState == nullptr)
     {
         zklog.warning("StateManager::cancelBatch() found no batch state for batch UUID=" + batchUUID + "; normal if no SMT activity happened");
         TimerStopAndLog(STATE_MANAGER_CANCEL_BATCH);
-        Unlock();
         return ZKR_STATE_MANAGER;
     }
-    state.erase(it);
-
-    Unlock();
+    eraseBatchState(batchUUID, *pBatchState);
+    unlockBatchState(*pBatchState);
 
     TimerStopAndLog(STATE_MANAGER_CANCEL_BATCH);
 
@@ -1287,82 +936,68 @@ zkresult StateManager::cancelBatch (const string &batchUUID)
 
 void StateManager::print (bool bDbContent)
 {
-    uint64_t totalDbWrites[PERSISTENCE_SIZE] = {0, 0, 0};
-    uint64_t totalDbDeletes[PERSISTENCE_SIZE] = {0, 0, 0};
+    uint64_t totalDbWrites[PERSISTENCE_SIZE] = {0, 0, 0, 0};
+    uint64_t totalDbDeletes[PERSISTENCE_SIZE] = {0, 0, 0, 0};
     zklog.info("StateManager::print():");
     zklog.info("state.size=" + to_string(state.size()));
-    unordered_map<string, BatchState>::const_iterator stateIt;
+    unordered_map<string, shared_ptr<BatchState>>::const_iterator stateIt;
     uint64_t batchStateCounter = 0;
     for (stateIt = state.begin(); stateIt != state.end(); stateIt++)
     {
-        const BatchState &batchState = stateIt->second;
+        const BatchState &batchState = *stateIt->second;
         zklog.info("  batchState=" + to_string(batchStateCounter));
         batchStateCounter++;
         zklog.info("  BatchUUID=" + stateIt->first);
         zklog.info("  oldStateRoot=" + batchState.oldStateRoot);
         zklog.info("  currentStateRoot=" + batchState.currentStateRoot);
         zklog.info("  currentBlock=" + to_string(batchState.currentBlock));
+        zklog.info("  blocks=" + to_string(batchState.blocks));
 
-        for (uint64_t block=0; block<batchState.blockState.size(); block++)
+        for (uint64_t persistence = 0; persistence < PERSISTENCE_SIZE; persistence++)
         {
-            zklog.info("    BLOCK=" + to_string(block) + "/" + to_string(batchState.blockState.size()));
-            const BlockState &blockState = batchState.blockState[block];
-
-            zklog.info("    oldStateRoot=" + blockState.oldStateRoot);
-            zklog.info("    currentStateRoot=" + blockState.currentStateRoot);
-            zklog.info("    currentTx=" + to_string(blockState.currentTx));       
+            const shared_ptr<StateVersion> &head = batchState.head[persistence];
+            zklog.info("  head[" + persistence2string((Persistence)persistence) + "]=" + ((head == nullptr) ? string("none") : to_string(head->version)));
+        }
 
-            for (uint64_t tx=0; tx<blockState.txState.size(); tx++)
+        for (uint64_t i=0; i<batchState.versions.size(); i++)
+        {
+            const StateVersion &version = *batchState.versions[i];
+            zklog.info("    version=" + to_string(version.version) + "/" + to_string(batchState.versions.size()));
+            zklog.info("      block=" + to_string(version.block) + " tx=" + to_string(version.tx) + " persistence=" + persistence2string(version.persistence));
+            zklog.info("      parent=" + ((version.pParent == nullptr) ? string("none") : to_string(version.pParent->version)));
+            zklog.info("      oldStateRoot=" + version.oldStateRoot);
+            zklog.info("      newStateRoot=" + version.newStateRoot);
+            zklog.info("      dbWriteNodes.size=" + to_string(version.dbWriteNodes.size()));
+
+            totalDbWrites[version.persistence] += version.dbWriteNodes.size();
+            if (bDbContent)
             {
-                zklog.info("      TX=" + to_string(tx) + "/" + to_string(blockState.txState.size()));
-                const TxState &txState = blockState.txState[tx];
+                unordered_map<string, vector<Goldilocks::Element>>::const_iterator dbIt;
+                for (dbIt = version.dbWriteNodes.begin(); dbIt != version.dbWriteNodes.end(); dbIt++)
+                {
+                    zklog.info("        " + dbIt->first);
+                }
+            }
+            zklog.info("      dbDeleteNodes.size=" + to_string(version.dbDeleteNodes.size()));
+            totalDbDeletes[version.persistence] += version.dbDeleteNodes.size();
+            if (bDbContent)
+            {
+                for (uint64_t j=0; j<version.dbDeleteNodes.size(); j++)
+                {
+                    zklog.info("        " + version.dbDeleteNodes[j]);
+                }
+            }
+        }
 
-                for (uint64_t persistence = 0; persistence < PERSISTENCE_SIZE; persistence++)
+        for (uint64_t persistence = 0; persistence < PERSISTENCE_SIZE; persistence++)
+        {
+            zklog.info("  dbWritePrograms[" + persistence2string((Persistence)persistence) + "].size=" + to_string(batchState.persistenceWritePrograms[persistence].size()));
+            if (bDbContent)
+            {
+                unordered_map<string, vector<uint8_t>>::const_iterator dbIt;
+                for (dbIt = batchState.persistenceWritePrograms[persistence].begin(); dbIt != batchState.persistenceWritePrograms[persistence].end(); dbIt++)
                 {
-                    //if (persistence != PERSISTENCE_DATABASE) continue;
-                    zklog.info("        persistence=" + to_string(persistence) + "=" + persistence2string((Persistence)persistence));
-                    zklog.info("          oldStateRoot=" + txState.persistence[persistence].oldStateRoot);
-                    zklog.info("          newStateRoot=" + txState.persistence[persistence].newStateRoot);
-                    zklog.info("          currentSubState=" + to_string(txState.persistence[persistence].currentSubState));
-                    zklog.info("          txSubState.size=" + to_string(txState.persistence[persistence].subState.size()));
-                    for (uint64_t i=0; i<txState.persistence[persistence].subState.size(); i++)
-                    {
-                        const TxSubState &txSubState = txState.persistence[persistence].subState[i];
-                        zklog.info("            txSubState=" + to_string(i));
-                        zklog.info("              oldStateRoot=" + txSubState.oldStateRoot);
-                        zklog.info("              newStateRoot=" + txSubState.newStateRoot);
-                        zklog.info("              valid=" + to_string(txSubState.bValid));
-                        zklog.info("              previousSubState=" + to_string(txSubState.previousSubState));
-                        zklog.info("              dbWriteNodes.size=" + to_string(txSubState.dbWriteNodes.size()));
-
-                        totalDbWrites[persistence] += txSubState.dbWriteNodes.size();
-                        if (bDbContent)
-                        {
-                            unordered_map<string, vector<Goldilocks::Element>>::const_iterator dbIt;
-                            for (dbIt = txSubState.dbWriteNodes.begin(); dbIt != txSubState.dbWriteNodes.end(); dbIt++)
-                            {
-                                zklog.info("                " + dbIt->first);
-                            }
-                        }
-                        zklog.info("              dbDeleteNodes.size=" + to_string(txSubState.dbDeleteNodes.size()));
-                        totalDbDeletes[persistence] += txSubState.dbDeleteNodes.size();
-                        if (bDbContent)
-                        {
-                            for (uint64_t j=0; j<txSubState.dbDeleteNodes.size(); j++)
-                            {
-                                zklog.info("                " + txSubState.dbDeleteNodes[j]);
-                            }
-                        }
-                    }
-                    zklog.info("          dbWritePrograms.size=" + to_string(txState.persistence[persistence].dbWritePrograms.size()));
-                    if (bDbContent)
-                    {
-                        unordered_map<string, vector<uint8_t>>::const_iterator dbIt;
-                        for (dbIt = txState.persistence[persistence].dbWritePrograms.begin(); dbIt != txState.persistence[persistence].dbWritePrograms.end(); dbIt++)
-                        {
-                            zklog.info("                " + dbIt->first);
-                        }
-                    }
+                    zklog.info("        " + dbIt->first);
                 }
             }
         }
@@ -1379,4 +1014,4 @@ void StateManager::print (bool bDbContent)
     }
     zklog.info("total writes=" + to_string(totalWrites));
     zklog.info("total deletes=" + to_string(totalDeletes));
-}
\ No newline at end of file
+}
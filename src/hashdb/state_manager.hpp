@@ -4,6 +4,8 @@
 #include <unordered_map>
 #include <vector>
 #include <string>
+#include <memory>
+#include <pthread.h>
 #include "goldilocks_base_field.hpp"
 #include "zkresult.hpp"
 #include "database_map.hpp"
@@ -13,82 +15,70 @@
 
 using namespace std;
 
-class TxSubState
+// Version of the state of a batch, for one persistence: the nodes written, and the nodes deleted, while moving from
+// oldStateRoot to newStateRoot; a version only stores this delta, and shares the rest of the state with its parent,
+// i.e. the version that produced its oldStateRoot, or nullptr if oldStateRoot is the first one of the batch
+class StateVersion
 {
 public:
+    uint64_t version; // Creation order of this version in its batch
+    uint64_t block;
+    uint64_t tx;
+    Persistence persistence;
+    shared_ptr<StateVersion> pParent;
     string oldStateRoot;
     string newStateRoot;
-    uint64_t previousSubState;
-    bool bValid;
     unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
     vector<string> dbDeleteNodes;
-    TxSubState() : previousSubState(0), bValid(false)
+    StateVersion() : version(0), block(0), tx(0), persistence(PERSISTENCE_CACHE)
     {
         dbWriteNodes.reserve(128);
         dbDeleteNodes.reserve(128);
     };
 };
 
-class TxPersistenceState
-{
-public:
-    string oldStateRoot;
-    string newStateRoot;
-    uint64_t currentSubState;
-    vector<TxSubState> subState;
-    unordered_map<string, vector<uint8_t>> dbWritePrograms;
-    TxPersistenceState() : currentSubState(0)
-    {
-        subState.reserve(128);
-        dbWritePrograms.reserve(8);
-    };
-};
-
-class TxState
-{
-public:
-    TxPersistenceState persistence[PERSISTENCE_SIZE];
-};
-
-class BlockState
-{
-public:
-    string oldStateRoot;
-    string currentStateRoot;
-    uint64_t currentTx;
-    vector<TxState> txState;
-    BlockState() : currentTx(0)
-    {
-        txState.reserve(32);
-    };
-};
-
 class BatchState
 {
 public:
     string oldStateRoot;
     string currentStateRoot;
     uint64_t currentBlock;
-    vector<BlockState> blockState;
-    unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes;
-    unordered_map<string, vector<uint8_t>> dbWritePrograms;
+    uint64_t blocks; // Number of blocks started in this batch
+    vector<shared_ptr<StateVersion>> versions; // All versions of this batch, in creation order, released together with it
+    shared_ptr<StateVersion> head[PERSISTENCE_SIZE]; // Current version of every persistence, or nullptr if none
+    unordered_map<string, shared_ptr<StateVersion>> rootVersion[PERSISTENCE_SIZE]; // First version that produced every state root, or nullptr for the first state root of the batch
+    unordered_map<string, vector<Goldilocks::Element>> dbWriteNodes; // All the nodes written in this batch, to speed up reads
+    unordered_map<string, vector<uint8_t>> dbWritePrograms; // All the programs written in this batch, to speed up reads
+    unordered_map<string, vector<uint8_t>> persistenceWritePrograms[PERSISTENCE_SIZE]; // Programs to write to database, per persistence
 #ifdef LOG_TIME_STATISTICS_STATE_MANAGER
     TimeMetricStorage timeMetricStorage;
 #endif
-    BatchState() : currentBlock(0)
+    pthread_mutex_t mutex; // Mutex to protect this batch state, so that different batches do not serialize
+    bool bErased; // True if the batch state has been removed from the state map, e.g. after a flush
+    BatchState() : currentBlock(0), blocks(0), bErased(false)
     {
-        blockState.reserve(32);
+        versions.reserve(1024);
         dbWriteNodes.reserve(1024);
         dbWritePrograms.reserve(8);
+        pthread_mutex_init(&mutex, NULL);
+    };
+    ~BatchState()
+    {
+        // Unlink the versions first, so that releasing a long chain of versions does not recurse through all of them
+        for (uint64_t i=0; i<versions.size(); i++)
+        {
+            versions[i]->pParent.reset();
+        }
+        pthread_mutex_destroy(&mutex);
     };
 };
 
 class StateManager
 {
 private:
-    unordered_map<string, BatchState> state;
+    unordered_map<string, shared_ptr<BatchState>> state;
     Config config;
-    pthread_mutex_t mutex; // Mutex to protect the multi write queues
+    pthread_mutex_t mutex; // Mutex to protect the state map; every batch state is protected by its own mutex
 
 public:
     StateManager ()
@@ -123,9 +113,22 @@ public:
     zkresult cancelBatch (const string &batchUUID);
     void print (bool bDbContent = false);
 private:
-    // Lock/Unlock
+    // Lock/Unlock the state map
     void Lock(void) { pthread_mutex_lock(&mutex); };
     void Unlock(void) { pthread_mutex_unlock(&mutex); };
+
+    // Returns the state of a batch with its mutex locked, creating it if bCreate is true, or nullptr if it does not exist
+    shared_ptr<BatchState> lockBatchState (const string &batchUUID, bool bCreate);
+    void unlockBatchState (BatchState &batchState) { pthread_mutex_unlock(&batchState.mutex); };
+
+    // Removes a locked batch state from the state map; the caller still has to unlock it
+    void eraseBatchState (const string &batchUUID, BatchState &batchState);
+
+    // Creates a new head version of a persistence, starting at oldStateRoot
+    StateVersion & newVersion (BatchState &batchState, uint64_t block, uint64_t tx, const string &oldStateRoot, const Persistence persistence);
+
+    // Moves the head version of a persistence back to the first version that produced a state root, if any
+    void rollback (BatchState &batchState, const string &stateRoot, const Persistence persistence);
 };
 
 extern StateManager stateManager;
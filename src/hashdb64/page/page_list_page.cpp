@@ -18,8 +18,9 @@ zkresult PageListPage::InitEmptyPage (PageContext &ctx, const uint64_t pageNumbe
 
 zkresult PageListPage::InsertPage (PageContext &ctx, uint64_t &pageNumber, const uint64_t pageNumberToInsert)
 {
-    // Get page
+    // Get page, which is written in place
     PageListStruct * page = (PageListStruct *)ctx.pageManager.getPageAddress(pageNumber);
+    ctx.pageManager.setDirtyPage(pageNumber);
 
     // Check page attributes
     uint64_t offset = page->nextPageNumberAndOffset >> 48;
@@ -93,6 +94,7 @@ zkresult PageListPage::ExtractPage (PageContext &ctx, uint64_t &pageNumber, uint
     offset -= 8;
     extractedPageNumber = *(uint64_t *)((uint8_t *)page + offset);
     page->nextPageNumberAndOffset = offset << 48;
+    ctx.pageManager.setDirtyPage(pageNumber);
 
     // Release any empty page
     while (offset == minOffset)
@@ -15,6 +15,8 @@
 #include "page_list_page.hpp"
 #include <dirent.h>
 #include <regex>
+#include <algorithm>
+#include "timer.hpp"
 
 PageManager::PageManager() 
 {
@@ -24,6 +26,9 @@ PageManager::PageManager()
     nFiles=0;
     nPages=0;
     numFreePages=0;
+    flushCount=0;
+    flushBytesSynced=0;
+    flushTimeUs=0;
 }
 
 PageManager::~PageManager(void)
@@ -308,12 +313,24 @@ uint64_t PageManager::editPage(const uint64_t pageNumber)
     return pageNumber_;
 }
 
+// Pages obtained with getFreePage() or editPage() are synced by the next flush; any other page written in place,
+// e.g. the last raw data page, which is appended to beyond the offset committed by the header, must be set dirty
+void PageManager::setDirtyPage(const uint64_t pageNumber)
+{
+#if MULTIPLE_WRITES
+    lock_guard<recursive_mutex> lock(writePagesLock);
+#endif
+    dirtyPages.insert(pageNumber);
+}
+
 void PageManager::flushPages(PageContext &ctx){
 
 #if MULTIPLE_WRITES
         lock_guard<recursive_mutex> guard_freePages(writePagesLock);
 #endif
     zkassertpermanent(&ctx.pageManager == this); 
+    struct timeval t;
+    gettimeofday(&t, NULL);
 
     //1// get list of previous freePages containers
     uint64_t headerPageNum = 0;
@@ -355,16 +372,10 @@ void PageManager::flushPages(PageContext &ctx){
 
     HeaderPage::SetFirstUnusedPage(ctx, headerPageNum, firstUnusedPage);
 
-    //4// sync all pages
+    //4// sync the pages written since the last flush
+    uint64_t bytesSynced = 0;
     if(mappedFile){
-        #pragma omp parallel for schedule(static,1) num_threads(omp_get_num_threads()/2)
-        for(uint64_t k=0; k< pages.size(); ++k){
-            if(k==0){
-                msync(getPageAddress(1), fileSize-4096, MS_SYNC);
-            }else{
-                msync(pages[k], fileSize, MS_SYNC);
-            }
-        }
+        bytesSynced = syncDirtyPages();
     }
 
     //5// write header
@@ -373,6 +384,7 @@ void PageManager::flushPages(PageContext &ctx){
         memcpy(getPageAddress(0), getPageAddress(1), 4096);
         if(mappedFile){
             msync(getPageAddress(0), 4096, MS_SYNC);
+            bytesSynced += 4096;
         }
     }
 
@@ -386,5 +398,52 @@ void PageManager::flushPages(PageContext &ctx){
         releasePage(*it);
     }     
     editedPages.clear();
+    dirtyPages.clear();
+
+    uint64_t flushTime = TimeDiff(t);
+    flushCount++;
+    flushBytesSynced += bytesSynced;
+    flushTimeUs += flushTime;
+    if(ctx.config.dbMetrics){
+        zklog.info("PageManager::flushPages() flush=" + to_string(flushCount) + " copiedPages=" + to_string(nEditedPages) + " bytesSynced=" + to_string(bytesSynced) + " time=" + to_string(flushTime) + "us totalBytesSynced=" + to_string(flushBytesSynced) + " totalTime=" + to_string(flushTimeUs) + "us");
+    }
+}
 
+uint64_t PageManager::syncDirtyPages(){
+
+    // The pages written since the last flush are the targets of editedPages, i.e. the copies of the edited pages,
+    // the pages obtained with getFreePage() and the header copy (page 1), plus the pages written in place; all of
+    // them are synced before page 0
+    vector<uint64_t> syncPages;
+    syncPages.reserve(editedPages.size() + dirtyPages.size());
+    for(unordered_map<uint64_t, uint64_t>::const_iterator it = editedPages.begin(); it != editedPages.end(); it++){
+        syncPages.emplace_back(it->second);
+    }
+    syncPages.insert(syncPages.end(), dirtyPages.begin(), dirtyPages.end());
+    std::sort(syncPages.begin(), syncPages.end());
+    syncPages.erase(std::unique(syncPages.begin(), syncPages.end()), syncPages.end());
+
+    // Coalesce them into ranges of pages of the same file, tolerating small gaps of clean pages, which msync() skips
+    vector<uint64_t> rangeFirst;
+    vector<uint64_t> rangeLast;
+    for(uint64_t i=0; i<syncPages.size(); ++i){
+        uint64_t page = syncPages[i];
+        if(rangeLast.size() > 0 && page - rangeLast.back() <= FLUSH_COALESCE_GAP + 1 && page / pagesPerFile == rangeLast.back() / pagesPerFile){
+            rangeLast.back() = page;
+        }else{
+            rangeFirst.emplace_back(page);
+            rangeLast.emplace_back(page);
+        }
+    }
+
+    //Sync the ranges in parallel
+    uint64_t nRanges = rangeFirst.size();
+    #pragma omp parallel for schedule(dynamic)
+    for(uint64_t r=0; r<nRanges; ++r){
+        if(msync(getPageAddress(rangeFirst[r]), (rangeLast[r] - rangeFirst[r] + 1) * 4096, MS_SYNC) != 0){
+            zklog.error("PageManager::syncDirtyPages() failed calling msync() of page=" + to_string(rangeFirst[r]) + " error=" + strerror(errno));
+            exitProcess();
+        }
+    }
+    return syncPages.size() * 4096;
 }
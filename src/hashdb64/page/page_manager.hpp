@@ -7,6 +7,7 @@
 #include "zkresult.hpp"
 #include <vector>
 #include <unordered_map>
+#include <unordered_set>
 #include <mutex>
 #include <shared_mutex>
 #include <vector>
@@ -15,6 +16,7 @@
 #include <unistd.h>
 
 #define MULTIPLE_WRITES 0
+#define FLUSH_COALESCE_GAP 16 // Max number of clean pages between two dirty pages synced by the same msync() call
 
 class PageContext;
 class PageManager
@@ -30,6 +32,7 @@ public:
     uint64_t getFreePage();
     void releasePage(const uint64_t pageNumber);
     uint64_t editPage(const uint64_t pageNumber);
+    void setDirtyPage(const uint64_t pageNumber);
     void flushPages(PageContext &ctx);
     inline char *getPageAddress(const uint64_t pageNumber);
     inline uint64_t getNumFreePages();
@@ -59,9 +62,17 @@ private:
     uint64_t numFreePages;
     vector<uint64_t> freePages;
     unordered_map<uint64_t, uint64_t> editedPages;
+    unordered_set<uint64_t> dirtyPages; // Pages written in place since the last flush, e.g. appended raw data
 
     shared_mutex headerLock;
 
+    // Accumulated flush statistics, logged by flushPages() if dbMetrics is set
+    uint64_t flushCount;
+    uint64_t flushBytesSynced;
+    uint64_t flushTimeUs;
+
+    uint64_t syncDirtyPages();
+
 };
 
 char* PageManager::getPageAddress(const uint64_t pageNumber)
@@ -84,8 +84,9 @@ zkresult RawDataPage::Read (PageContext &ctx, const uint64_t _pageNumber, const
 
 zkresult RawDataPage::Write (PageContext &ctx, uint64_t &pageNumber, const string &data)
 {
-    // Get the pointer corresponding to the current page number
+    // Get the pointer corresponding to the current page number; it is appended to in place, so it must be synced
     RawDataStruct *page = (RawDataStruct *)ctx.pageManager.getPageAddress(pageNumber);
+    ctx.pageManager.setDirtyPage(pageNumber);
 
     // Get page attributes
     uint64_t offset = page->nextPageNumberAndOffset >> 48;
@@ -23,6 +23,7 @@
 #include "sm/keccak_f/keccak_executor_test.hpp"
 #include "sm/storage/storage_executor.hpp"
 #include "sm/storage/storage_test.hpp"
+#include "main_sm/main_sm_checkpoint_test.hpp"
 #include "sm/climb_key/climb_key_executor.hpp"
 #include "sm/climb_key/climb_key_test.hpp"
 #include "sm/binary/binary_test.hpp"
@@ -49,6 +50,9 @@
 #include "page_manager_test.hpp"
 #include "zkglobals.hpp"
 #include "key_value_tree_test.hpp"
+#include "zkevmSteps.hpp"
+#include "chelpers_program.hpp"
+#include "chelpers_test.hpp"
 
 using namespace std;
 using json = nlohmann::json;
@@ -401,6 +405,25 @@ int main(int argc, char **argv)
         SHA256GenerateScript(config);
     }
 
+    // Optimize the zkEVM step42ns chelpers parser program
+    if (config.runChelpersOptimizer)
+    {
+        ZkevmSteps::optimizeStep42nsProgram(config.zkevmStep42nsProgram);
+    }
+
+    // Compile the circuit-agnostic chelpers programs
+    if (config.runChelpersCompiler)
+    {
+        if (!ChelpersProgram::compileFile(config, config.zkevmStarkInfo) ||
+            !ChelpersProgram::compileFile(config, config.c12aStarkInfo) ||
+            !ChelpersProgram::compileFile(config, config.recursive1StarkInfo) ||
+            !ChelpersProgram::compileFile(config, config.recursive2StarkInfo))
+        {
+            zklog.error("main() failed compiling the chelpers programs");
+            exitProcess();
+        }
+    }
+
 #ifdef DATABASE_USE_CACHE
 
     /* INIT DB CACHE */
@@ -455,6 +478,12 @@ int main(int argc, char **argv)
         StorageSMTest(fr, poseidon, config);
     }
 
+    // Test the main SM checkpoints
+    if (config.runMainSMCheckpointTest)
+    {
+        MainSMCheckpointTest(fr, poseidon, config);
+    }
+
     // Test Storage SM
     if (config.runClimbKeySMTest)
     {
@@ -525,6 +554,12 @@ int main(int argc, char **argv)
         Smt64Test(config);
     }
 
+    // Test circuit-agnostic chelpers
+    if (config.runChelpersTest)
+    {
+        ChelpersTest(config);
+    }
+
     // Unit test
     if (config.runUnitTest)
     {
@@ -411,7 +411,7 @@ string generate(const json &rom, uint64_t forkID, string forkNamespace, const st
     code += "    uint64_t lm;\n";
     code += "    uint64_t lh;\n";
     code += "    mpz_class paddingA;\n";
-    code += "    unordered_map< uint64_t, HashValue >::iterator hashIterator;\n";
+    code += "    decltype(ctx.hashK)::iterator hashIterator;\n";
     code += "    unordered_map<uint64_t, uint64_t>::iterator readsIterator;\n";
     code += "    HashValue emptyHashValue;\n";
 
@@ -468,7 +468,7 @@ string generate(const json &rom, uint64_t forkID, string forkNamespace, const st
         code += "    MemoryAccess memoryAccess;\n";
 
     code += "    std::ofstream outfile;\n";
-    code += "    std::unordered_map<uint64_t, Fea>::iterator memIterator;\n";
+    code += "    decltype(ctx.mem)::iterator memIterator;\n";
     code += "\n";
 
     code += "    uint64_t zkPC = 0; // Zero-knowledge program counter\n";
@@ -583,6 +583,19 @@ string generate(const json &rom, uint64_t forkID, string forkNamespace, const st
         //    code += "// ";
         code += functionName + "_rom_line_" + to_string(zkPC) + ": //" + string(rom["program"][zkPC]["fileName"]) + ":" + to_string(rom["program"][zkPC]["line"]) + "=[" + removeDuplicateSpaces(string(rom["program"][zkPC]["lineStr"])) + "]\n\n";
 
+        // If the 2 previous evaluations already executed finalWait, all the evaluations until N-3 will be equal to the
+        // previous one; fill them in parallel and execute the last ones, which write the registers of N-2
+        if (!bFastMode && (forkID >= 9) && (zkPC == rom["labels"]["finalWait"]))
+        {
+            code += "    if (mainExecutor.config.executorParallelFinalWait && (ctx.lastStep != 0) && (i >= 2) && (i + 4 < N_Max) &&\n";
+            code += "        (fr.toU64(pols.zkPC[i - 1]) == " + to_string(zkPC) + ") && (fr.toU64(pols.zkPC[i - 2]) == " + to_string(zkPC) + "))\n";
+            code += "    {\n";
+            code += "        mainExecutor.fillFinalWait(pols, i - 1, i, N_Max - 3);\n";
+            code += "        i = N_Max - 3;\n";
+            code += "        nexti = i + 1;\n";
+            code += "    }\n\n";
+        }
+
         // START LOGS
         code += "#ifdef LOG_COMPLETED_STEPS_TO_FILE\n";
         code += "    fi0=fi1=fi2=fi3=fi4=fi5=fi6=fi7=fr.zero();\n";
@@ -792,6 +792,12 @@ zkresult FullTracer::onFinishBlock (Context &ctx)
     finalTrace.block_responses.emplace_back(currentBlock);
     currentBlock.initialized = false;
 
+    // Stream the block, if requested
+    if (ctx.proverRequest.onFinishBlockCallback != NULL)
+    {
+        ctx.proverRequest.onFinishBlockCallback(ctx.proverRequest.onFinishBlockCallbackParam, finalTrace.block_responses.back());
+    }
+
     // Reset logs
     logs.clear();
     
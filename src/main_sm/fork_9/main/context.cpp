@@ -89,12 +89,12 @@ void Context::printMem()
 {
     zklog.info("Memory:");
     uint64_t i = 0;
-    for (unordered_map<uint64_t, Fea>::iterator it = mem.begin(); it != mem.end(); it++)
+    mem.forEach([&](uint64_t address, Fea &fea)
     {
-        mpz_class addr(it->first);
-        zklog.info("i: " + to_string(i) + " address:" + addr.get_str(16) + " " + printFea(it->second));
+        mpz_class addr(address);
+        zklog.info("i: " + to_string(i) + " address:" + addr.get_str(16) + " " + printFea(fea));
         i++;
-    }
+    });
 }
 
 void Context::printReg(string name, Goldilocks::Element &fe)
@@ -10,6 +10,8 @@
 #include "main_sm/fork_9/main/rom_command.hpp"
 #include "main_sm/fork_9/pols_generated/commit_pols.hpp"
 #include "main_sm/fork_9/main/full_tracer.hpp"
+#include "main_sm/fork_9/main/paged_map.hpp"
+#include "main_sm/fork_9/main/main_exec_checkpoint.hpp"
 #include "config.hpp"
 #include "goldilocks_base_field.hpp"
 #include "smt.hpp"
@@ -91,6 +93,14 @@ public:
     Goldilocks::Element fe7;
 };
 
+// Hash slots map, indexed by hash address; addresses are assigned incrementally by the ROM, so slots are
+// allocated in slabs of 64 hash values
+typedef PagedMap<HashValue, 6, 10> HashMap;
+
+// Memory map, indexed by absolute address, i.e. CTX*0x40000 + offset; every context owns one table of
+// 0x40000 addresses, split in lazily allocated pages of 256 field element arrays
+typedef PagedMap<Fea, 8, 10> MemMap;
+
 class OutLog
 {
 public:
@@ -162,6 +172,11 @@ public:
     uint64_t * pStep; // Polynomial evaluation counter (it is 0 in single-evaluation batch process)
     uint64_t * pEvaluation; // Evaluation counter
     uint64_t N; // Polynomials degree
+
+    // Checkpoint and replay data
+    MainExecutionMode mode; // Direct, checkpoint or replay execution mode
+    vector<MainExecHashDBResult> * pHashDBResults; // HashDB results, recorded in checkpoint mode and returned in replay mode
+    uint64_t hashDBResult; // Index of the next HashDB result to return in replay mode
 #ifdef LOG_FILENAME
     string   fileName; // From ROM JSON file instruction
     uint64_t line; // From ROM JSON file instruction
@@ -190,22 +205,25 @@ public:
         pZKPC(NULL),
         pStep(NULL),
         pEvaluation(NULL),
-        N(0){}; // Constructor, setting references
+        N(0),
+        mode(mainDirect),
+        pHashDBResults(NULL),
+        hashDBResult(0){}; // Constructor, setting references
 
     // HashK database, used in Keccak-f hash instructions hashK, hashK1, hashKLen and hashKDigest
-    unordered_map< uint64_t, HashValue > hashK;
+    HashMap hashK;
 
     // HashP database, used in Poseidon linear hash instructions hashP, hashP1, hashPLen and hashPDigest
-    unordered_map< uint64_t, HashValue > hashP;
+    HashMap hashP;
 
     // HashS database, used in SHA-256 hash instructions hashS, hashS1, hashSLen and hashSDigest
-    unordered_map< uint64_t, HashValue > hashS;
+    HashMap hashS;
 
     // Variables database, used in evalCommand() declareVar/setVar/getVar
     unordered_map< string, mpz_class > vars;
 
     // Memory map, using absolute address as key, and field element array as value
-    unordered_map< uint64_t, Fea > mem; // TODO: Use array<Goldilocks::Element,8> instead of Fea, or declare Fea8, Fea4 at a higher level
+    MemMap mem; // TODO: Use array<Goldilocks::Element,8> instead of Fea, or declare Fea8, Fea4 at a higher level
 
     // A vector of maps of accessed Ethereum address to sets of keys
     // Every position of the vector represents a context
@@ -3,6 +3,7 @@
 #include "config.hpp"
 #include "main_sm/fork_9/main/eval_command.hpp"
 #include "scalar.hpp"
+#include "u256.hpp"
 #include "utils.hpp"
 #include "zkassert.hpp"
 #include "zklog.hpp"
@@ -377,7 +378,8 @@ void eval_getReg (Context &ctx, const RomCommand &cmd, CommandResult &cr)
             break;
         case reg_STEP:
             cr.type = crt_u64;
-            cr.u64 = *ctx.pStep;
+            // In checkpoint mode, *ctx.pStep is the scratch evaluation, not the step
+            cr.u64 = (ctx.mode == mainCheckpoint) ? *ctx.pEvaluation : *ctx.pStep;
             break;
         case reg_HASHPOS:
             cr.type = crt_u64;
@@ -1264,7 +1266,9 @@ void eval_eventLog(Context &ctx, const RomCommand &cmd, CommandResult &cr)
 #endif
 
     zkassert(ctx.proverRequest.input.publicInputsExtended.publicInputs.forkID == 9); // fork_9
-    cr.zkResult = ((fork_9::FullTracer *)ctx.proverRequest.pFullTracer)->handleEvent(ctx, cmd);
+
+    // In replay mode, the full tracer already got this event when the checkpoints were taken
+    cr.zkResult = (ctx.mode == mainReplay) ? ZKR_SUCCESS : ((fork_9::FullTracer *)ctx.proverRequest.pFullTracer)->handleEvent(ctx, cmd);
 
     // Return an empty array of field elements
     cr.type = crt_fea;
@@ -1769,7 +1773,9 @@ void eval_loadScalar (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 void eval_storeLog (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 {
     zkassert(ctx.proverRequest.input.publicInputsExtended.publicInputs.forkID == 9); // fork_9
-    cr.zkResult = ((fork_9::FullTracer *)ctx.proverRequest.pFullTracer)->handleEvent(ctx, cmd);
+
+    // In replay mode, the full tracer already got this event when the checkpoints were taken
+    cr.zkResult = (ctx.mode == mainReplay) ? ZKR_SUCCESS : ((fork_9::FullTracer *)ctx.proverRequest.pFullTracer)->handleEvent(ctx, cmd);
 
     // Return an empty array of field elements
     cr.type = crt_fea;
@@ -2063,19 +2069,22 @@ void eval_inverseFpEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         exitProcess();
     }
 #endif
-    RawFec::Element a;
-    ctx.fec.fromString(a, cr.scalar.get_str(16), 16);
-    if (ctx.fec.isZero(a))
+    const MontgomeryField &Fp = Secp256k1Fp();
+    U256 a;
+    a.fromScalar(cr.scalar);
+    Fp.toMontgomery(a, a);
+    if (a.isZero())
     {
         zklog.error("eval_inverseFpEc() Division by zero step=" + to_string(*ctx.pStep) + " zkPC=" + to_string(*ctx.pZKPC) + " line=" + ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) + " uuid=" + ctx.proverRequest.uuid);
         exitProcess();
     }
 
-    RawFec::Element r;
-    ctx.fec.inv(r, a);
+    U256 r;
+    Fp.inv(r, a);
+    Fp.fromMontgomery(r, r);
 
     cr.type = crt_scalar;
-    ctx.fec.toMpz(cr.scalar.get_mpz_t(), r);
+    r.toScalar(cr.scalar);
 }
 
 void eval_inverseFnEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
@@ -2102,19 +2111,22 @@ void eval_inverseFnEc (Context &ctx, const RomCommand &cmd, CommandResult &cr)
         exitProcess();
     }
 #endif
-    RawFnec::Element a;
-    ctx.fnec.fromMpz(a, cr.scalar.get_mpz_t());
-    if (ctx.fnec.isZero(a))
+    const MontgomeryField &Fn = Secp256k1Fn();
+    U256 a;
+    a.fromScalar(cr.scalar);
+    Fn.toMontgomery(a, a);
+    if (a.isZero())
     {
         zklog.error("eval_inverseFnEc() Division by zero step=" + to_string(*ctx.pStep) + " zkPC=" + to_string(*ctx.pZKPC) + " line=" + ctx.rom.line[*ctx.pZKPC].toString(ctx.fr) + " uuid=" + ctx.proverRequest.uuid);
         exitProcess();
     }
 
-    RawFnec::Element r;
-    ctx.fnec.inv(r, a);
+    U256 r;
+    Fn.inv(r, a);
+    Fn.fromMontgomery(r, r);
 
     cr.type = crt_scalar;
-    ctx.fnec.toMpz(cr.scalar.get_mpz_t(), r);
+    r.toScalar(cr.scalar);
 }
 
 /*****************************/
@@ -2281,10 +2293,10 @@ void eval_sqrtFpEcParity (Context &ctx, const RomCommand &cmd, CommandResult &cr
     else
     {
         // Negate the result
-        RawFec::Element fe;
-        fec.fromMpz(fe, cr.scalar.get_mpz_t());
-        fe = fec.neg(fe);
-        fec.toMpz(cr.scalar.get_mpz_t(), fe);
+        U256 root;
+        root.fromScalar(cr.scalar);
+        Secp256k1Fp().neg(root, root);
+        root.toScalar(cr.scalar);
     }
 }
 
@@ -3120,7 +3132,7 @@ void eval_MPdiv (Context &ctx, const RomCommand &cmd, CommandResult &cr)
 
     vector<mpz_class> input1;
     vector<mpz_class> input2;
-    unordered_map<uint64_t, fork_9::Fea>::const_iterator it;
+    fork_9::MemMap::iterator it;
     mpz_class auxScalar;
     for (uint64_t i = 0; i < len1; i++)
     {
@@ -3213,7 +3225,7 @@ void eval_MPdiv_short (Context &ctx, const RomCommand &cmd, CommandResult &cr)
     mpz_class &input2 = cr.scalar;
 
     vector<mpz_class> input1;
-    unordered_map<uint64_t, fork_9::Fea>::const_iterator it;
+    fork_9::MemMap::iterator it;
     mpz_class auxScalar;
     for (uint64_t i = 0; i < len1; i++)
     {
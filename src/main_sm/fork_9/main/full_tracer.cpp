@@ -117,7 +117,7 @@ inline zkresult getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length
     if (init != double(initCeil))
     {
         mpz_class memScalarStart = 0;
-        std::unordered_map<uint64_t, Fea>::iterator it = ctx.mem.find(initFloor);
+        MemMap::iterator it = ctx.mem.find(initFloor);
         if (it != ctx.mem.end())
         {
             if (!fea2scalar(ctx.fr, memScalarStart, it->second.fe0, it->second.fe1, it->second.fe2, it->second.fe3, it->second.fe4, it->second.fe5, it->second.fe6, it->second.fe7))
@@ -149,7 +149,7 @@ inline zkresult getFromMemory(Context &ctx, mpz_class &offset, mpz_class &length
     if (end != double(endFloor))
     {
         mpz_class memScalarEnd = 0;
-        std::unordered_map<uint64_t, Fea>::iterator it = ctx.mem.find(endFloor);
+        MemMap::iterator it = ctx.mem.find(endFloor);
         if (it != ctx.mem.end())
         {
             if (!fea2scalar(ctx.fr, memScalarEnd, it->second.fe0, it->second.fe1, it->second.fe2, it->second.fe3, it->second.fe4, it->second.fe5, it->second.fe6, it->second.fe7))
@@ -177,7 +177,7 @@ inline zkresult getVarFromCtx(Context &ctx, bool global, uint64_t varOffset, mpz
 
     uint64_t offsetCtx = global ? 0 : (pContext != NULL) ? *pContext*0x40000 : ctx.fr.toU64(ctx.pols.CTX[*ctx.pStep])*0x40000;
     uint64_t addressMem = offsetCtx + varOffset;
-    unordered_map<uint64_t, Fea>::iterator memIterator;
+    MemMap::iterator memIterator;
     memIterator = ctx.mem.find(addressMem);
     if (memIterator == ctx.mem.end())
     {
@@ -206,7 +206,7 @@ inline zkresult getCalldataFromStack(Context &ctx, uint64_t offset, uint64_t len
     mpz_class auxScalar;
     result = "0x";
     
-    unordered_map<uint64_t, Fea>::iterator memIterator;
+    MemMap::iterator memIterator;
     uint64_t consumedLength = 0;
     for (uint64_t i = firstAddr; i < lastAddr; i++)
     {
@@ -262,6 +262,23 @@ inline uint64_t getCurrentTime (void)
     return tv.tv_sec * 1000000 + tv.tv_usec;
 }
 
+// Converts a memory value into a trace word, without the cost of an mpz_class; every element must fit in 32 bits
+inline bool fea2word (Goldilocks &fr, const Fea &fea, TraceWord &word)
+{
+    const Goldilocks::Element * fe[8] = { &fea.fe7, &fea.fe6, &fea.fe5, &fea.fe4, &fea.fe3, &fea.fe2, &fea.fe1, &fea.fe0 };
+    for (uint64_t i = 0; i < 8; i++)
+    {
+        uint64_t aux = fr.toU64(*fe[i]);
+        if (aux >= 0x100000000)
+        {
+            zklog.error("fea2word() found element " + to_string(7 - i) + " has a too high value=" + fr.toString(*fe[i], 16));
+            return false;
+        }
+        word.chunk[i] = aux;
+    }
+    return true;
+}
+
 using namespace rlp;
 
 // Returns a transaction hash from transaction params
@@ -808,6 +825,12 @@ zkresult FullTracer::onFinishBlock (Context &ctx)
     finalTrace.block_responses.emplace_back(currentBlock);
     currentBlock.initialized = false;
 
+    // Stream the block, if requested
+    if (ctx.proverRequest.onFinishBlockCallback != NULL)
+    {
+        ctx.proverRequest.onFinishBlockCallback(ctx.proverRequest.onFinishBlockCallbackParam, finalTrace.block_responses.back());
+    }
+
     // Reset logs
     logs.clear();
     
@@ -1071,6 +1094,8 @@ zkresult FullTracer::onProcessTx (Context &ctx, const RomCommand &cmd)
     // Clear temporary tx traces
     full_trace.clear();
     full_trace.reserve(ctx.config.fullTracerTraceReserveSize);
+    stackArena.clear();
+    previousStack.clear();
 
     // Reset previous memory
     previousMemory = "";
@@ -1293,6 +1318,7 @@ zkresult FullTracer::onFinishTx(Context &ctx, const RomCommand &cmd)
         }
 
         response.full_trace.steps.swap(full_trace);
+        response.full_trace.stackArena.swap(stackArena);
 
         if (response.error.size() == 0)
         {
@@ -1633,8 +1659,6 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
 
     if (ctx.proverRequest.input.traceConfig.bGenerateMemory)
     {
-        string finalMemory;
-        
         // Get context offset
         uint64_t offsetCtx = fr.toU64(ctx.pols.CTX[*ctx.pStep]) * 0x40000;
 
@@ -1643,7 +1667,7 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
 
         uint64_t lengthMemOffset = ctx.rom.memLengthOffset;
         uint64_t lenMemValueFinal = 0;
-        unordered_map< uint64_t, Fea >::iterator it;
+        MemMap::iterator it;
         it = ctx.mem.find(offsetCtx + lengthMemOffset);
         if (it != ctx.mem.end())
         {
@@ -1656,43 +1680,42 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
             lenMemValueFinal = ceil(double(auxScalar.get_ui()) / 32);
         }
 
+        // Build the memory bytes directly from the memory words, leaving the missing words as zeros
+        currentMemory.assign(lenMemValueFinal * 32, 0);
+        TraceWord memWord;
         for (uint64_t i = 0; i < lenMemValueFinal; i++)
         {
             it = ctx.mem.find(addrMem + i);
             if (it == ctx.mem.end())
             {
-                finalMemory += "0000000000000000000000000000000000000000000000000000000000000000";
                 continue;
             }
-            Fea memValue = it->second;
-            if (!fea2scalar(ctx.fr, auxScalar, memValue.fe0, memValue.fe1, memValue.fe2, memValue.fe3, memValue.fe4, memValue.fe5, memValue.fe6, memValue.fe7))
+            if (!fea2word(fr, it->second, memWord))
             {
-                zklog.error("FullTracer::onOpcode() failed calling fea2scalar(memValue)");
+                zklog.error("FullTracer::onOpcode() failed calling fea2word(memValue)");
                 return ZKR_SM_MAIN_FEA2SCALAR;
             }
-            finalMemory += PrependZeros(auxScalar.get_str(16), 64);
+            memWord.toBytes(&currentMemory[i * 32]);
         }
-        
-        string baMemory = string2ba(finalMemory);
 
         if (numOpcodes == 0)
         {
             singleInfo.memory_offset = 0;
-            singleInfo.memory = baMemory;
+            singleInfo.memory = currentMemory;
         }
-        else if (baMemory != previousMemory)
+        else if (currentMemory != previousMemory)
         {
             uint64_t offset;
             uint64_t length;
-            getStringIncrement(previousMemory, baMemory, offset, length);
+            getStringIncrement(previousMemory, currentMemory, offset, length);
             if (length > 0)
             {
                 singleInfo.memory_offset = offset;
-                singleInfo.memory = baMemory.substr(offset, length); // Content of memory, incremental
+                singleInfo.memory = currentMemory.substr(offset, length); // Content of memory, incremental
             }
-            previousMemory = baMemory;
+            previousMemory.swap(currentMemory);
         }
-        singleInfo.memory_size = baMemory.size();
+        singleInfo.memory_size = lenMemValueFinal * 32;
     }
 
 #ifdef LOG_TIME_STATISTICS
@@ -1705,7 +1728,7 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
     
     if (ctx.proverRequest.input.traceConfig.bGenerateStack)
     {
-        vector<mpz_class> finalStack;
+        currentStack.clear();
 
         // Get context offset
         uint64_t offsetCtx = fr.toU64(ctx.pols.CTX[*ctx.pStep]) * 0x40000;
@@ -1714,24 +1737,22 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
         uint64_t addr = offsetCtx + 0x10000;
 
         uint16_t sp = fr.toU64(ctx.pols.SP[*ctx.pStep]);
-        unordered_map<uint64_t, Fea>::iterator it;
+        MemMap::iterator it;
+        TraceWord stackWord;
         for (uint16_t i = 0; i < sp; i++)
         {
             it = ctx.mem.find(addr + i);
             if (it == ctx.mem.end())
                 continue;
-            Fea stack = it->second;
-            mpz_class stackScalar;
-            if (!fea2scalar(ctx.fr, stackScalar, stack.fe0, stack.fe1, stack.fe2, stack.fe3, stack.fe4, stack.fe5, stack.fe6, stack.fe7))
+            if (!fea2word(fr, it->second, stackWord))
             {
-                zklog.error("FullTracer::onOpcode() failed calling fea2scalar(stackScalar)");
+                zklog.error("FullTracer::onOpcode() failed calling fea2word(stack)");
                 return ZKR_SM_MAIN_FEA2SCALAR;
             }
-            finalStack.push_back(stackScalar);
+            currentStack.push_back(stackWord);
         }
 
-        // save stack to opcode trace
-        singleInfo.stack = finalStack;
+        // The stack is saved to the opcode trace as a delta, when the opcode is added to full_trace
     }
 
 #ifdef LOG_TIME_STATISTICS
@@ -2141,8 +2162,23 @@ zkresult FullTracer::onOpcode(Context &ctx, const RomCommand &cmd)
     {
         if (ctx.proverRequest.input.traceConfig.bGenerateFullTrace)
         {
+            // Save the stack as a delta of the stack of the previous step
+            if (ctx.proverRequest.input.traceConfig.bGenerateStack)
+            {
+                uint64_t common = 0;
+                while ((common < currentStack.size()) && (common < previousStack.size()) && (currentStack[common] == previousStack[common]))
+                {
+                    common++;
+                }
+                singleInfo.stack_common = common;
+                singleInfo.stack_new = currentStack.size() - common;
+                singleInfo.stack_offset = stackArena.size();
+                stackArena.insert(stackArena.end(), currentStack.begin() + common, currentStack.end());
+                previousStack.swap(currentStack);
+            }
+
             // Save output traces
-            full_trace.emplace_back(singleInfo);
+            full_trace.emplace_back(move(singleInfo));
         }
     }
 
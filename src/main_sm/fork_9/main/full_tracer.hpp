@@ -38,6 +38,9 @@ public:
     uint64_t accBatchGas;
     map<uint64_t,map<uint64_t,LogV2>> logs;
     vector<Opcode> full_trace;
+    vector<TraceWord> stackArena; // Stack words pushed by the steps of full_trace
+    vector<TraceWord> currentStack; // Stack of the current opcode
+    vector<TraceWord> previousStack; // Stack of the last step added to full_trace
     string lastError;
     uint64_t numberOfOpcodesInThisTx;
     uint64_t lastErrorOpcode;
@@ -45,6 +48,7 @@ public:
     ReturnFromCreate returnFromCreate;
     unordered_map<uint64_t, ContextData> callData;
     string previousMemory;
+    string currentMemory; // Memory of the current opcode, reused to avoid reallocating it
     bool hasGaspriceOpcode;
     bool hasBalanceOpcode;
     uint64_t txIndex; // Transaction index in the current block
@@ -100,6 +104,7 @@ public:
         accBatchGas     = other.accBatchGas;
         logs            = other.logs;
         full_trace      = other.full_trace;
+        stackArena      = other.stackArena;
         lastError       = other.lastError;
         callData        = other.callData;
         currentBlock    = other.currentBlock;
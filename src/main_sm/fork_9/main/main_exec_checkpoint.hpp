@@ -0,0 +1,63 @@
+#ifndef MAIN_EXEC_CHECKPOINT_HPP_fork_9
+#define MAIN_EXEC_CHECKPOINT_HPP_fork_9
+
+#include <vector>
+#include <gmpxx.h>
+#include "goldilocks_base_field.hpp"
+#include "smt_get_result.hpp"
+#include "smt_set_result.hpp"
+#include "zkresult.hpp"
+
+using namespace std;
+
+namespace fork_9
+{
+
+// Execution modes of the main executor, in prove mode
+enum MainExecutionMode
+{
+    mainDirect = 0,     // Fills the polynomials, calling HashDB and storing the required data, in a single pass
+    mainCheckpoint = 1, // Runs over a 2 evaluations scratch, calling HashDB and storing the required data, and takes a checkpoint every executorCheckpointSteps steps
+    mainReplay = 2      // Fills the polynomials of the steps following a checkpoint, replaying the HashDB results recorded in checkpoint mode
+};
+
+// Result of a HashDB call of the main executor loop, recorded in checkpoint mode and returned in replay mode
+class MainExecHashDBResult
+{
+public:
+    zkresult zkResult;
+    mpz_class value; // get()
+    SmtGetResult getResult; // get()
+    Goldilocks::Element newRoot[4]; // set()
+    SmtSetResult setResult; // set()
+    vector<uint8_t> data; // getProgram()
+
+    MainExecHashDBResult () : zkResult(ZKR_SUCCESS) {};
+};
+
+class Context;
+
+// State of the main executor before a step, taken in checkpoint mode; the steps from this one until the step of the
+// next checkpoint, or until the last step, are a segment that can be replayed independently of the other ones
+class MainExecCheckpoint
+{
+public:
+    uint64_t step; // Next step to execute
+    vector<Goldilocks::Element> row; // Main columns of the evaluation of this step, i.e. the registers
+    Goldilocks::Element currentRCX; // RCX of the last repeat instruction
+    Context *pContext; // Copy of the context, including the index of its first HashDB result
+
+    MainExecCheckpoint () : step(0), pContext(NULL) {};
+};
+
+// Checkpoints taken in checkpoint mode, in steps order, and the HashDB results of all the steps
+class MainExecCheckpoints
+{
+public:
+    vector<MainExecCheckpoint> checkpoints;
+    vector<MainExecHashDBResult> hashDBResults;
+};
+
+} // namespace
+
+#endif
@@ -98,6 +98,7 @@ MainExecutor::MainExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const
 
     // Get labels
     finalizeExecutionLabel     = rom.getLabel(string("finalizeExecution"));
+    finalWaitLabel             = rom.getLabel(string("finalWait"));
     checkAndSaveFromLabel      = rom.getLabel(string("checkAndSaveFrom"));
     ecrecoverStoreArgsLabel    = rom.getLabel(string("ecrecover_store_args"));
     ecrecoverEndLabel          = rom.getLabel(string("ecrecover_end"));
@@ -136,7 +137,194 @@ MainExecutor::~MainExecutor ()
     TimerStopAndLog(MAIN_EXECUTOR_DESTRUCTOR_fork_9);
 }
 
+void MainExecutor::fillFinalWait (MainCommitPols &pols, uint64_t sourceRow, uint64_t firstRow, uint64_t lastRow)
+{
+    TimerStart(MAIN_EXECUTOR_FILL_FINAL_WAIT);
+
+    // The main columns are contiguous in every evaluation, starting at A7
+    Goldilocks::Element *pSource = &pols.A7[sourceRow];
+    uint64_t rowSize = &pols.A7[1] - &pols.A7[0];
+    uint64_t mainSize = MainCommitPols::numPols() * sizeof(Goldilocks::Element);
+
+#pragma omp parallel for
+    for (uint64_t row = firstRow; row <= lastRow; row++)
+    {
+        memcpy(pSource + (row - sourceRow) * rowSize, pSource, mainSize);
+    }
+
+    zklog.info("MainExecutor::fillFinalWait() copied evaluation " + to_string(sourceRow) + " into evaluations [" + to_string(firstRow) + ", " + to_string(lastRow) + "]");
+
+    TimerStopAndLog(MAIN_EXECUTOR_FILL_FINAL_WAIT);
+}
+
+void MainExecutor::executeCheckpoints (ProverRequest &proverRequest, MainCommitPols &pols, MainExecRequired &required)
+{
+    TimerStart(MAIN_EXECUTOR_EXECUTE_CHECKPOINTS);
+
+    // Execute all the steps over the evaluations 0 and 1, calling HashDB and the full tracer, storing the required
+    // data and taking the checkpoints
+    MainExecCheckpoints checkpoints;
+    execute(proverRequest, pols, required, &checkpoints, NULL, 0);
+
+    if (proverRequest.result == ZKR_SUCCESS)
+    {
+        TimerStart(MAIN_EXECUTOR_REPLAY_SEGMENTS);
+
+        // Restore the registers of the first evaluation of every segment, and replay it from its checkpoint context
+        uint64_t nSegments = checkpoints.checkpoints.size();
+        vector<uint64_t> segmentEnd(nSegments);
+        for (uint64_t s=0; s<nSegments; s++)
+        {
+            MainExecCheckpoint &checkpoint = checkpoints.checkpoints[s];
+            segmentEnd[s] = (s + 1 < nSegments) ? checkpoints.checkpoints[s + 1].step : N;
+            memcpy(&pols.A7[checkpoint.step], checkpoint.row.data(), checkpoint.row.size()*sizeof(Goldilocks::Element));
+            checkpoint.pContext->mode = mainReplay;
+        }
+
+        // Replay the segments in parallel, but their last steps, which write the registers of the first evaluation of
+        // the next segment, or of the evaluation 0, while the next segment could be reading them; the required data
+        // was stored in checkpoint mode, so the one stored when replaying is discarded
+#pragma omp parallel for schedule(dynamic, 1)
+        for (uint64_t s=0; s<nSegments; s++)
+        {
+            MainExecRequired segmentRequired;
+            execute(proverRequest, pols, segmentRequired, &checkpoints, &checkpoints.checkpoints[s], segmentEnd[s] - 1);
+        }
+
+        // Replay the last step of every segment
+        MainExecRequired segmentRequired;
+        for (uint64_t s=0; s<nSegments; s++)
+        {
+            execute(proverRequest, pols, segmentRequired, &checkpoints, &checkpoints.checkpoints[s], segmentEnd[s]);
+        }
+
+        // The replayed steps already succeeded in checkpoint mode, with the same state
+        if (proverRequest.result != ZKR_SUCCESS)
+        {
+            zklog.error("MainExecutor::executeCheckpoints() failed replaying the segments result=" + zkresult2string(proverRequest.result));
+            exitProcess();
+        }
+
+        zklog.info("MainExecutor::executeCheckpoints() replayed " + to_string(nSegments) + " segments with " + to_string(checkpoints.hashDBResults.size()) + " HashDB results");
+
+        TimerStopAndLog(MAIN_EXECUTOR_REPLAY_SEGMENTS);
+    }
+
+    for (uint64_t s=0; s<checkpoints.checkpoints.size(); s++)
+    {
+        delete checkpoints.checkpoints[s].pContext;
+    }
+
+    TimerStopAndLog(MAIN_EXECUTOR_EXECUTE_CHECKPOINTS);
+}
+
+zkresult MainExecutor::hashDBGet (Context &ctx, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result)
+{
+    if (ctx.mode == mainReplay)
+    {
+        zkassert(ctx.hashDBResult < ctx.pHashDBResults->size());
+        MainExecHashDBResult &hashDBResult = (*ctx.pHashDBResults)[ctx.hashDBResult++];
+        value = hashDBResult.value;
+        if (result != NULL) *result = hashDBResult.getResult;
+        return hashDBResult.zkResult;
+    }
+
+    zkresult zkr = pHashDB->get(ctx.proverRequest.uuid, root, key, value, result, ctx.proverRequest.dbReadLog);
+
+    if (ctx.mode == mainCheckpoint)
+    {
+        ctx.pHashDBResults->emplace_back();
+        MainExecHashDBResult &hashDBResult = ctx.pHashDBResults->back();
+        hashDBResult.zkResult = zkr;
+        hashDBResult.value = value;
+        if (result != NULL) hashDBResult.getResult = *result;
+        ctx.hashDBResult++;
+    }
+
+    return zkr;
+}
+
+zkresult MainExecutor::hashDBSet (Context &ctx, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, Goldilocks::Element (&newRoot)[4], SmtSetResult *result)
+{
+    if (ctx.mode == mainReplay)
+    {
+        zkassert(ctx.hashDBResult < ctx.pHashDBResults->size());
+        MainExecHashDBResult &hashDBResult = (*ctx.pHashDBResults)[ctx.hashDBResult++];
+        for (uint64_t i=0; i<4; i++) newRoot[i] = hashDBResult.newRoot[i];
+        if (result != NULL) *result = hashDBResult.setResult;
+        return hashDBResult.zkResult;
+    }
+
+    zkresult zkr = pHashDB->set(ctx.proverRequest.uuid, ctx.proverRequest.pFullTracer->get_block_number(), ctx.proverRequest.pFullTracer->get_tx_number(), oldRoot, key, value, persistence, newRoot, result, ctx.proverRequest.dbReadLog);
+
+    if (ctx.mode == mainCheckpoint)
+    {
+        ctx.pHashDBResults->emplace_back();
+        MainExecHashDBResult &hashDBResult = ctx.pHashDBResults->back();
+        hashDBResult.zkResult = zkr;
+        for (uint64_t i=0; i<4; i++) hashDBResult.newRoot[i] = newRoot[i];
+        if (result != NULL) hashDBResult.setResult = *result;
+        ctx.hashDBResult++;
+    }
+
+    return zkr;
+}
+
+zkresult MainExecutor::hashDBSetProgram (Context &ctx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence)
+{
+    if (ctx.mode == mainReplay)
+    {
+        zkassert(ctx.hashDBResult < ctx.pHashDBResults->size());
+        return (*ctx.pHashDBResults)[ctx.hashDBResult++].zkResult;
+    }
+
+    zkresult zkr = pHashDB->setProgram(ctx.proverRequest.uuid, ctx.proverRequest.pFullTracer->get_block_number(), ctx.proverRequest.pFullTracer->get_tx_number(), key, data, persistence);
+
+    if (ctx.mode == mainCheckpoint)
+    {
+        ctx.pHashDBResults->emplace_back();
+        ctx.pHashDBResults->back().zkResult = zkr;
+        ctx.hashDBResult++;
+    }
+
+    return zkr;
+}
+
+zkresult MainExecutor::hashDBGetProgram (Context &ctx, const Goldilocks::Element (&key)[4], vector<uint8_t> &data)
+{
+    if (ctx.mode == mainReplay)
+    {
+        zkassert(ctx.hashDBResult < ctx.pHashDBResults->size());
+        MainExecHashDBResult &hashDBResult = (*ctx.pHashDBResults)[ctx.hashDBResult++];
+        data = hashDBResult.data;
+        return hashDBResult.zkResult;
+    }
+
+    zkresult zkr = pHashDB->getProgram(ctx.proverRequest.uuid, key, data, ctx.proverRequest.dbReadLog);
+
+    if (ctx.mode == mainCheckpoint)
+    {
+        ctx.pHashDBResults->emplace_back();
+        MainExecHashDBResult &hashDBResult = ctx.pHashDBResults->back();
+        hashDBResult.zkResult = zkr;
+        hashDBResult.data = data;
+        ctx.hashDBResult++;
+    }
+
+    return zkr;
+}
+
 void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols, MainExecRequired &required)
+{
+    if ((proverRequest.type != prt_processBatch) && (config.executorCheckpointSteps > 0) && !config.executorROMLineTraces)
+    {
+        executeCheckpoints(proverRequest, pols, required);
+        return;
+    }
+    execute(proverRequest, pols, required, NULL, NULL, 0);
+}
+
+void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols, MainExecRequired &required, MainExecCheckpoints *pCheckpoints, MainExecCheckpoint *pSegment, uint64_t lastStep)
 {
     TimerStart(MAIN_EXECUTOR_EXECUTE);
 
@@ -166,6 +354,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 
     // Get labels
     finalizeExecutionLabel    = rom.getLabel(string("finalizeExecution"));
+    finalWaitLabel            = rom.getLabel(string("finalWait"));
     checkAndSaveFromLabel     = rom.getLabel(string("checkAndSaveFrom"));
     ecrecoverStoreArgsLabel   = rom.getLabel(string("ecrecover_store_args"));
     ecrecoverEndLabel         = rom.getLabel(string("ecrecover_end"));
@@ -188,18 +377,27 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         return;
     }
 
-    // Create context and store a finite field reference in it
-    Context ctx(fr, config, fec, fnec, pols, rom, proverRequest, pHashDB);
+    // Create context and store a finite field reference in it; a replayed segment continues the context of its checkpoint
+    Context directCtx(fr, config, fec, fnec, pols, rom, proverRequest, pHashDB);
+    Context &ctx = (pSegment != NULL) ? *pSegment->pContext : directCtx;
+    if ((pCheckpoints != NULL) && (pSegment == NULL))
+    {
+        ctx.mode = mainCheckpoint;
+        ctx.pHashDBResults = &pCheckpoints->hashDBResults;
+    }
 
     // Init the state of the polynomials first evaluation
-    initState(ctx);
+    if (pSegment == NULL)
+    {
+        initState(ctx);
+    }
 
 #ifdef LOG_COMPLETED_STEPS_TO_FILE
     remove("c.txt");
 #endif
 
     // Copy input database content into context database
-    if (proverRequest.input.db.size() > 0)
+    if ((pSegment == NULL) && (proverRequest.input.db.size() > 0))
     {
         Goldilocks::Element stateRoot[4];
         scalar2fea(fr, proverRequest.input.publicInputsExtended.publicInputs.oldStateRoot, stateRoot);
@@ -213,7 +411,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
     }
 
     // Copy input contracts database content into context database (dbProgram)
-    if (proverRequest.input.contractsBytecode.size() > 0)
+    if ((pSegment == NULL) && (proverRequest.input.contractsBytecode.size() > 0))
     {
         pHashDB->loadProgramDB(proverRequest.input.contractsBytecode, true);
         uint64_t flushId, lastSentFlushId;
@@ -235,7 +433,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
     ctx.pStep = &i; // ctx.pStep is used inside evaluateCommand() to find the current value of the registers, e.g. pols(A0)[ctx.step]
     ctx.pEvaluation = &step;
     ctx.pZKPC = &zkPC; // Pointer to the zkPC
-    Goldilocks::Element currentRCX = fr.zero();
+    Goldilocks::Element currentRCX = (pSegment != NULL) ? pSegment->currentRCX : fr.zero();
 
     uint64_t N_Max;
     if (proverRequest.input.bNoCounters)
@@ -294,7 +492,16 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         ctx.mem[rom.timestampOffset] = fea;
     }
 
-    for (step=0; step<N_Max; step++)
+    // A replayed segment executes the steps [pSegment->step, lastStep)
+    uint64_t firstStep = 0;
+    uint64_t endStep = N_Max;
+    if (pSegment != NULL)
+    {
+        firstStep = pSegment->step;
+        endStep = lastStep;
+    }
+
+    for (step=firstStep; step<endStep; step++)
     {
         if (bProcessBatch)
         {
@@ -311,10 +518,37 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         }
         else
         {
+            // If the 2 previous evaluations already executed finalWait, all the evaluations until N-3 will be equal to
+            // the previous one; fill them in parallel and execute the last ones, which write the registers of N-2
+            if (config.executorParallelFinalWait && !config.executorROMLineTraces && (ctx.mode == mainDirect) && (ctx.lastStep != 0) && (step >= 2) && (step + 4 < N) &&
+                (fr.toU64(pols.zkPC[step]) == finalWaitLabel) && (fr.toU64(pols.zkPC[step - 1]) == finalWaitLabel) && (fr.toU64(pols.zkPC[step - 2]) == finalWaitLabel))
+            {
+                fillFinalWait(pols, step - 1, step, N - 3);
+                step = N - 3;
+            }
+
             i = step;
             // Calculate nexti to write the next evaluation register values according to setX
             // The registers of the evaluation 0 will be overwritten with the values from the last evaluation, closing the evaluation circle
             nexti = (i+1)%N;
+
+            // In checkpoint mode, the even steps use the evaluation 0 and the odd ones the evaluation 1; the next
+            // evaluation is cleared, as if it was never written, so that the checkpoints contain only the registers
+            if (ctx.mode == mainCheckpoint)
+            {
+                i = step%2;
+                nexti = (step+1)%2;
+                memset(&pols.A7[nexti], 0, MainCommitPols::numPols()*sizeof(Goldilocks::Element));
+                if ((step%config.executorCheckpointSteps) == 0)
+                {
+                    MainExecCheckpoint checkpoint;
+                    checkpoint.step = step;
+                    checkpoint.row.assign(&pols.A7[i], &pols.A7[i] + MainCommitPols::numPols());
+                    checkpoint.currentRCX = currentRCX;
+                    checkpoint.pContext = new Context(ctx);
+                    pCheckpoints->checkpoints.emplace_back(checkpoint);
+                }
+            }
         }
 
         zkPC = fr.toU64(pols.zkPC[i]); // This is the read line of ZK code
@@ -912,7 +1146,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // Memory read free in: get fi=mem[addr], if it exists
                 if ( (rom.line[zkPC].mOp==1) && (rom.line[zkPC].mWR==0) )
                 {
-                    std::unordered_map<uint64_t, Fea>::iterator memIterator;
+                    MemMap::iterator memIterator;
                     memIterator = ctx.mem.find(addr);
                     if (memIterator != ctx.mem.end()) {
 #ifdef LOG_MEMORY
@@ -1138,12 +1372,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                         gettimeofday(&t, NULL);
 #endif
                         // Collect the keys used to read or write store data
-                        if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree)
+                        if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree && (ctx.mode != mainReplay))
                         {
                             proverRequest.nodesKeys.insert(fea2string(fr, key));
                         }
 
-                        zkResult = pHashDB->get(proverRequest.uuid, oldRoot, key, value, &smtGetResult, proverRequest.dbReadLog);
+                        zkResult = hashDBGet(ctx, oldRoot, key, value, &smtGetResult);
                         if (zkResult != ZKR_SUCCESS)
                         {
                             proverRequest.result = zkResult;
@@ -1377,12 +1611,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                         gettimeofday(&t, NULL);
 #endif
                         // Collect the keys used to read or write store data
-                        if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree)
+                        if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree && (ctx.mode != mainReplay))
                         {
                             proverRequest.nodesKeys.insert(fea2string(fr, ctx.lastSWrite.key));
                         }
 
-                        zkResult = pHashDB->set(proverRequest.uuid, proverRequest.pFullTracer->get_block_number(), proverRequest.pFullTracer->get_tx_number(), oldRoot, ctx.lastSWrite.key, value, bIsTouchedAddressTree ? PERSISTENCE_TEMPORARY : bIsBlockL2Hash ? PERSISTENCE_TEMPORARY_HASH : proverRequest.input.bUpdateMerkleTree ? PERSISTENCE_DATABASE : PERSISTENCE_CACHE, ctx.lastSWrite.newRoot, &ctx.lastSWrite.res, proverRequest.dbReadLog);
+                        zkResult = hashDBSet(ctx, oldRoot, ctx.lastSWrite.key, value, bIsTouchedAddressTree ? PERSISTENCE_TEMPORARY : bIsBlockL2Hash ? PERSISTENCE_TEMPORARY_HASH : proverRequest.input.bUpdateMerkleTree ? PERSISTENCE_DATABASE : PERSISTENCE_CACHE, ctx.lastSWrite.newRoot, &ctx.lastSWrite.res);
                         if (zkResult != ZKR_SUCCESS)
                         {
                             proverRequest.result = zkResult;
@@ -1431,7 +1665,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 #ifdef LOG_TIME_STATISTICS_MAIN_EXECUTOR
                     mainMetrics.add("SMT Set", TimeDiff(t));
 #endif
-                    ctx.lastSWrite.step = i;
+                    ctx.lastSWrite.step = step;
 
                     sr4to8(fr, ctx.lastSWrite.newRoot[0], ctx.lastSWrite.newRoot[1], ctx.lastSWrite.newRoot[2], ctx.lastSWrite.newRoot[3], fi0, fi1, fi2, fi3, fi4, fi5, fi6, fi7);
                     nHits++;
@@ -1443,7 +1677,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashK free in
                 if ( (rom.line[zkPC].hashK == 1) || (rom.line[zkPC].hashK1 == 1) )
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+                    HashMap::iterator hashKIterator;
 
                     // If there is no entry in the hash database for this address, then create a new one
                     hashKIterator = ctx.hashK.find(addr);
@@ -1509,7 +1743,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashKDigest free in
                 if (rom.line[zkPC].hashKDigest == 1)
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+                    HashMap::iterator hashKIterator;
 
                     // If there is no entry in the hash database for this address, this is an error
                     hashKIterator = ctx.hashK.find(addr);
@@ -1543,7 +1777,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashP free in
                 if ( (rom.line[zkPC].hashP == 1) || (rom.line[zkPC].hashP1 == 1) )
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+                    HashMap::iterator hashPIterator;
 
                     // If there is no entry in the hash database for this address, then create a new one
                     hashPIterator = ctx.hashP.find(addr);
@@ -1605,7 +1839,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashPDigest free in
                 if (rom.line[zkPC].hashPDigest == 1)
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+                    HashMap::iterator hashPIterator;
 
                     // If there is no entry in the hash database for this address, this is an error
                     hashPIterator = ctx.hashP.find(addr);
@@ -1635,7 +1869,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashS free in
                 if ( (rom.line[zkPC].hashS == 1) || (rom.line[zkPC].hashS1 == 1) )
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+                    HashMap::iterator hashSIterator;
 
                     // If there is no entry in the hash database for this address, then create a new one
                     hashSIterator = ctx.hashS.find(addr);
@@ -1701,7 +1935,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 // HashSDigest free in
                 if (rom.line[zkPC].hashSDigest == 1)
                 {
-                    unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+                    HashMap::iterator hashSIterator;
 
                     // If there is no entry in the hash database for this address, this is an error
                     hashSIterator = ctx.hashS.find(addr);
@@ -2159,7 +2393,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     MemoryAccess memoryAccess;
                     memoryAccess.bIsWrite = true;
                     memoryAccess.address = addr;
-                    memoryAccess.pc = i;
+                    memoryAccess.pc = step;
                     memoryAccess.fe0 = op0;
                     memoryAccess.fe1 = op1;
                     memoryAccess.fe2 = op2;
@@ -2182,7 +2416,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     MemoryAccess memoryAccess;
                     memoryAccess.bIsWrite = false;
                     memoryAccess.address = addr;
-                    memoryAccess.pc = i;
+                    memoryAccess.pc = step;
                     memoryAccess.fe0 = op0;
                     memoryAccess.fe1 = op1;
                     memoryAccess.fe2 = op2;
@@ -2371,14 +2605,14 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 #endif
 
             // Collect the keys used to read or write store data
-            if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree)
+            if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree && (ctx.mode != mainReplay))
             {
                 proverRequest.nodesKeys.insert(fea2string(fr, key));
             }
 
             SmtGetResult smtGetResult;
             mpz_class value;
-            zkresult zkResult = pHashDB->get(proverRequest.uuid, oldRoot, key, value, &smtGetResult, proverRequest.dbReadLog);
+            zkresult zkResult = hashDBGet(ctx, oldRoot, key, value, &smtGetResult);
             if (zkResult != ZKR_SUCCESS)
             {
                 proverRequest.result = zkResult;
@@ -2444,7 +2678,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
             // Copy ROM flags into the polynomials
             if (!bProcessBatch) pols.sWR[i] = fr.one();
 
-            if ( (!bProcessBatch && (ctx.lastSWrite.step == 0)) || (ctx.lastSWrite.step != i) )
+            if ( (!bProcessBatch && (ctx.lastSWrite.step == 0)) || (ctx.lastSWrite.step != step) )
             {
                 // Reset lastSWrite
                 ctx.lastSWrite.reset();
@@ -2540,12 +2774,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 sr8to4(fr, pols.SR0[i], pols.SR1[i], pols.SR2[i], pols.SR3[i], pols.SR4[i], pols.SR5[i], pols.SR6[i], pols.SR7[i], oldRoot[0], oldRoot[1], oldRoot[2], oldRoot[3]);
 
                 // Collect the keys used to read or write store data
-                if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree)
+                if (proverRequest.input.bGetKeys && !bIsTouchedAddressTree && (ctx.mode != mainReplay))
                 {
                     proverRequest.nodesKeys.insert(fea2string(fr, ctx.lastSWrite.key));
                 }
 
-                zkresult zkResult = pHashDB->set(proverRequest.uuid, proverRequest.pFullTracer->get_block_number(), proverRequest.pFullTracer->get_tx_number(), oldRoot, ctx.lastSWrite.key, scalarD, bIsTouchedAddressTree ? PERSISTENCE_TEMPORARY : bIsBlockL2Hash ? PERSISTENCE_TEMPORARY_HASH : proverRequest.input.bUpdateMerkleTree ? PERSISTENCE_DATABASE : PERSISTENCE_CACHE, ctx.lastSWrite.newRoot, &ctx.lastSWrite.res, proverRequest.dbReadLog);
+                zkresult zkResult = hashDBSet(ctx, oldRoot, ctx.lastSWrite.key, scalarD, bIsTouchedAddressTree ? PERSISTENCE_TEMPORARY : bIsBlockL2Hash ? PERSISTENCE_TEMPORARY_HASH : proverRequest.input.bUpdateMerkleTree ? PERSISTENCE_DATABASE : PERSISTENCE_CACHE, ctx.lastSWrite.newRoot, &ctx.lastSWrite.res);
                 if (zkResult != ZKR_SUCCESS)
                 {
                     proverRequest.result = zkResult;
@@ -2578,7 +2812,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 #ifdef LOG_TIME_STATISTICS_MAIN_EXECUTOR
                 mainMetrics.add("SMT Set", TimeDiff(t));
 #endif
-                ctx.lastSWrite.step = i;
+                ctx.lastSWrite.step = step;
             }
 
             // Store PoseidonG required data
@@ -2671,7 +2905,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 }
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+            HashMap::iterator hashKIterator;
 
             // If there is no entry in the hash database for this address, then create a new one
             hashKIterator = ctx.hashK.find(addr);
@@ -2791,7 +3025,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashKLen[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+            HashMap::iterator hashKIterator;
 
             // Get the length
             uint64_t lm = fr.toU64(op0);
@@ -2864,7 +3098,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashKDigest[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashKIterator;
+            HashMap::iterator hashKIterator;
 
             // Find the entry in the hash database for this address
             hashKIterator = ctx.hashK.find(addr);
@@ -2925,7 +3159,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 }
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+            HashMap::iterator hashPIterator;
 
             // If there is no entry in the hash database for this address, then create a new one
             hashPIterator = ctx.hashP.find(addr);
@@ -3069,7 +3303,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashPLen[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+            HashMap::iterator hashPIterator;
 
             // Get the length
             uint64_t lm = fr.toU64(op0);
@@ -3130,12 +3364,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 gettimeofday(&t, NULL);
 #endif
                 // Collect the keys used to read or write program data
-                if (proverRequest.input.bGetKeys)
+                if (proverRequest.input.bGetKeys && (ctx.mode != mainReplay))
                 {
                     proverRequest.programKeys.insert(fea2string(fr, result));
                 }
 
-                zkresult zkResult = pHashDB->setProgram(proverRequest.uuid, proverRequest.pFullTracer->get_block_number(), proverRequest.pFullTracer->get_tx_number(), result, hashPIterator->second.data, proverRequest.input.bUpdateMerkleTree ? PERSISTENCE_DATABASE : PERSISTENCE_CACHE);
+                zkresult zkResult = hashDBSetProgram(ctx, result, hashPIterator->second.data, proverRequest.input.bUpdateMerkleTree ? PERSISTENCE_DATABASE : PERSISTENCE_CACHE);
                 if (zkResult != ZKR_SUCCESS)
                 {
                     proverRequest.result = zkResult;
@@ -3173,7 +3407,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 return;
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashPIterator;
+            HashMap::iterator hashPIterator;
             hashPIterator = ctx.hashP.find(addr);
             if (hashPIterator == ctx.hashP.end())
             {
@@ -3185,12 +3419,12 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 gettimeofday(&t, NULL);
 #endif
                 // Collect the keys used to read or write store data
-                if (proverRequest.input.bGetKeys)
+                if (proverRequest.input.bGetKeys && (ctx.mode != mainReplay))
                 {
                     proverRequest.programKeys.insert(fea2string(fr, aux));
                 }
 
-                zkresult zkResult = pHashDB->getProgram(proverRequest.uuid, aux, hashValue.data, proverRequest.dbReadLog);
+                zkresult zkResult = hashDBGetProgram(ctx, aux, hashValue.data);
                 if (zkResult != ZKR_SUCCESS)
                 {
                     proverRequest.result = zkResult;
@@ -3243,7 +3477,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                 }
             }
 
-            unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+            HashMap::iterator hashSIterator;
 
             // If there is no entry in the hash database for this address, then create a new one
             hashSIterator = ctx.hashS.find(addr);
@@ -3363,7 +3597,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashSLen[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+            HashMap::iterator hashSIterator;
 
             // Get the length
             uint64_t lm = fr.toU64(op0);
@@ -3436,7 +3670,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         {
             if (!bProcessBatch) pols.hashSDigest[i] = fr.one();
 
-            unordered_map< uint64_t, HashValue >::iterator hashSIterator;
+            HashMap::iterator hashSIterator;
 
             // Find the entry in the hash database for this address
             hashSIterator = ctx.hashS.find(addr);
@@ -4996,77 +5230,82 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 #ifdef LOG_JMP
             zklog.info("JMPN: op0=" + fr.toString(op0));
 #endif
-            if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersStepLabel))
+            // The counters reserve was already updated when the checkpoints were taken, and the replayed segments
+            // run in parallel
+            if (ctx.mode != mainReplay)
             {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_STEPS) - fr.toS64(op0);
-                if (reserve < 0)
+                if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersStepLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_STEPS) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.steps = zkmax(proverRequest.counters_reserve.steps, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.steps = zkmax(proverRequest.counters_reserve.steps, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersArithLabel))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_ARITH) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersArithLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_ARITH) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.arith = zkmax(proverRequest.counters_reserve.arith, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.arith = zkmax(proverRequest.counters_reserve.arith, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersBinaryLabel))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_BINARY) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersBinaryLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_BINARY) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.binary = zkmax(proverRequest.counters_reserve.binary, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.binary = zkmax(proverRequest.counters_reserve.binary, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersKeccakLabel))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_KECCAK_F) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersKeccakLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_KECCAK_F) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.keccakF = zkmax(proverRequest.counters_reserve.keccakF, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.keccakF = zkmax(proverRequest.counters_reserve.keccakF, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersSha256Label))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_SHA256_F) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersSha256Label))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_SHA256_F) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.sha256F = zkmax(proverRequest.counters_reserve.sha256F, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.sha256F = zkmax(proverRequest.counters_reserve.sha256F, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersMemalignLabel))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_MEM_ALIGN) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersMemalignLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_MEM_ALIGN) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.memAlign = zkmax(proverRequest.counters_reserve.memAlign, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.memAlign = zkmax(proverRequest.counters_reserve.memAlign, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersPoseidonLabel))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_POSEIDON_G) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersPoseidonLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_POSEIDON_G) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.poseidonG = zkmax(proverRequest.counters_reserve.poseidonG, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.poseidonG = zkmax(proverRequest.counters_reserve.poseidonG, uint64_t(reserve));
-            }
-            else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersPaddingLabel))
-            {
-                int64_t reserve = int64_t(rom.constants.MAX_CNT_PADDING_PG) - fr.toS64(op0);
-                if (reserve < 0)
+                else if (rom.line[zkPC].jmpAddr == fr.fromU64(outOfCountersPaddingLabel))
                 {
-                    reserve = 0;
+                    int64_t reserve = int64_t(rom.constants.MAX_CNT_PADDING_PG) - fr.toS64(op0);
+                    if (reserve < 0)
+                    {
+                        reserve = 0;
+                    }
+                    proverRequest.counters_reserve.paddingPG = zkmax(proverRequest.counters_reserve.paddingPG, uint64_t(reserve));
                 }
-                proverRequest.counters_reserve.paddingPG = zkmax(proverRequest.counters_reserve.paddingPG, uint64_t(reserve));
             }
 
             uint64_t jmpnCondValue = fr.toU64(op0);
@@ -5344,7 +5583,8 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
         // and any children command, recursively
         if ( (rom.line[zkPC].cmdAfter.size() > 0) && (step < (N_Max - 1)) )
         {
-            if (!bProcessBatch) i++;
+            uint64_t currenti = i;
+            if (!bProcessBatch) i = nexti;
             for (uint64_t j=0; j<rom.line[zkPC].cmdAfter.size(); j++)
             {
 #ifdef LOG_TIME_STATISTICS_MAIN_EXECUTOR
@@ -5366,7 +5606,7 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
                     return;
                 }
             }
-            if (!bProcessBatch) i--;
+            i = currenti;
         }
 
 #ifdef LOG_COMPLETED_STEPS
@@ -5411,6 +5651,14 @@ void MainExecutor::execute (ProverRequest &proverRequest, MainCommitPols &pols,
 
     } // End of main executor loop, for all evaluations
 
+    // A replayed segment stops here, keeping its state to continue the replay later
+    if (pSegment != NULL)
+    {
+        pSegment->step = step;
+        pSegment->currentRCX = currentRCX;
+        return;
+    }
+
     // Copy the counters
     proverRequest.counters.arith = fr.toU64(pols.cntArith[0]);
     proverRequest.counters.binary = fr.toU64(pols.cntBinary[0]);
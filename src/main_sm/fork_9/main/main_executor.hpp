@@ -10,6 +10,7 @@
 #include "main_sm/fork_9/main/context.hpp"
 #include "main_sm/fork_9/pols_generated/commit_pols.hpp"
 #include "main_sm/fork_9/main/main_exec_required.hpp"
+#include "main_sm/fork_9/main/main_exec_checkpoint.hpp"
 #include "scalar.hpp"
 #include "hashdb_factory.hpp"
 #include "poseidon_goldilocks.hpp"
@@ -57,6 +58,7 @@ public:
 
     // ROM labels
     uint64_t finalizeExecutionLabel;
+    uint64_t finalWaitLabel;
     uint64_t checkAndSaveFromLabel;
     uint64_t ecrecoverStoreArgsLabel;
     uint64_t ecrecoverEndLabel;
@@ -89,6 +91,22 @@ public:
 
     void execute (ProverRequest &proverRequest, MainCommitPols &cmPols, MainExecRequired &required);
 
+    // Executes all the steps in direct mode if pCheckpoints is NULL; otherwise, if pSegment is NULL, executes all the
+    // steps in checkpoint mode, storing the checkpoints in pCheckpoints, or else replays the steps from pSegment->step
+    // until lastStep, starting at the checkpoint pSegment, which is updated to continue the replay later
+    void execute (ProverRequest &proverRequest, MainCommitPols &cmPols, MainExecRequired &required, MainExecCheckpoints *pCheckpoints, MainExecCheckpoint *pSegment, uint64_t lastStep);
+
+    // In prove mode, executes all the steps in checkpoint mode, and then replays the segments between checkpoints in
+    // parallel to fill the polynomials
+    void executeCheckpoints (ProverRequest &proverRequest, MainCommitPols &cmPols, MainExecRequired &required);
+
+    // HashDB calls of the execution loop; their results are recorded in checkpoint mode, and returned instead of
+    // calling HashDB in replay mode
+    zkresult hashDBGet (Context &ctx, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result);
+    zkresult hashDBSet (Context &ctx, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, Goldilocks::Element (&newRoot)[4], SmtSetResult *result);
+    zkresult hashDBSetProgram (Context &ctx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence);
+    zkresult hashDBGetProgram (Context &ctx, const Goldilocks::Element (&key)[4], vector<uint8_t> &data);
+
     // Initial and final evaluations/state management
     void initState(Context &ctx);
     void checkFinalState(Context &ctx);
@@ -96,6 +114,11 @@ public:
     void logError(Context &ctx, const string &message = "");
     void linearPoseidon(Context &ctx, const vector<uint8_t> &data, Goldilocks::Element (&result)[4]);
 
+    // In prove mode, once the batch is finalized, the ROM loops at finalWait until the evaluation N-2 without changing
+    // its state, so all these evaluations are identical; copies the main columns of the evaluation sourceRow into the
+    // evaluations [firstRow, lastRow] in parallel, so that the executor can resume at lastRow
+    void fillFinalWait(MainCommitPols &pols, uint64_t sourceRow, uint64_t firstRow, uint64_t lastRow);
+
     // Labels lock / unlock
     void labelsLock(void) { pthread_mutex_lock(&labelsMutex); };
     void labelsUnlock(void) { pthread_mutex_unlock(&labelsMutex); };
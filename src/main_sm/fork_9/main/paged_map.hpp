@@ -0,0 +1,175 @@
+#ifndef PAGED_MAP_HPP_fork_9
+#define PAGED_MAP_HPP_fork_9
+
+#include <cstdint>
+#include <cstring>
+#include <vector>
+#include <unordered_map>
+#include <utility>
+
+using namespace std;
+
+namespace fork_9
+{
+
+/*
+    Dense, address-indexed map used by the main executor context to store the ROM memory and the hash slots.
+
+    An address is split into 3 fields: directory index | table index | page index.
+    The directory is a vector of tables, a table is an array of pages, and a page is a slab of entries, all of
+    them allocated lazily the first time an address of their range is accessed, so a lookup costs 2 indirections
+    instead of a hash calculation plus a bucket scan.  Every page keeps a bitmap of the entries that have been
+    accessed through operator[], so that find() behaves as in unordered_map.
+    Addresses beyond the directory limit, which are not expected, are stored in an overflow unordered_map.
+
+    Entries are never erased nor moved, so iterators (i.e. entry pointers) are valid for the whole map life; a copy
+    allocates its own pages, so its iterators are not valid in the original map, and vice versa.
+*/
+
+template <typename T, uint64_t PAGE_BITS, uint64_t TABLE_BITS, uint64_t DIRECTORY_BITS = 24>
+class PagedMap
+{
+public:
+    typedef pair<uint64_t, T> value_type;
+    typedef value_type * iterator;
+
+private:
+    static const uint64_t PAGE_SIZE = 1ULL << PAGE_BITS;
+    static const uint64_t TABLE_SIZE = 1ULL << TABLE_BITS;
+    static const uint64_t DIRECTORY_SIZE = 1ULL << DIRECTORY_BITS;
+
+    class Page
+    {
+    public:
+        uint64_t used[(PAGE_SIZE + 63) / 64];
+        value_type entries[PAGE_SIZE];
+        Page() : used(), entries() {};
+    };
+
+    class Table
+    {
+    public:
+        Page * pages[TABLE_SIZE];
+        Table() : pages() {};
+        ~Table() { for (uint64_t i=0; i<TABLE_SIZE; i++) delete pages[i]; };
+    };
+
+    vector<Table *> directory;
+    unordered_map<uint64_t, value_type> overflow;
+    uint64_t counter;
+
+public:
+    PagedMap() : counter(0) {};
+    ~PagedMap() { for (uint64_t i=0; i<directory.size(); i++) delete directory[i]; };
+
+    // Deep copy, used by the main executor to take checkpoints of its context
+    PagedMap(const PagedMap &other) : directory(other.directory.size(), NULL), overflow(other.overflow), counter(other.counter)
+    {
+        for (uint64_t d=0; d<other.directory.size(); d++)
+        {
+            if (other.directory[d] == NULL) continue;
+            directory[d] = new Table();
+            for (uint64_t t=0; t<TABLE_SIZE; t++)
+            {
+                if (other.directory[d]->pages[t] != NULL)
+                {
+                    directory[d]->pages[t] = new Page(*other.directory[d]->pages[t]);
+                }
+            }
+        }
+    }
+    PagedMap & operator=(const PagedMap &) = delete;
+
+    iterator end (void) const { return NULL; };
+
+    // Returns the number of accessed addresses
+    uint64_t size (void) const { return counter; };
+
+    // Returns the entry of an address, or end() if it was never accessed
+    iterator find (uint64_t addr)
+    {
+        uint64_t dirIndex = addr >> (PAGE_BITS + TABLE_BITS);
+        if (dirIndex >= DIRECTORY_SIZE)
+        {
+            typename unordered_map<uint64_t, value_type>::iterator it = overflow.find(addr);
+            return (it == overflow.end()) ? end() : &it->second;
+        }
+        if (dirIndex >= directory.size() || directory[dirIndex] == NULL) return end();
+        Page *pPage = directory[dirIndex]->pages[(addr >> PAGE_BITS) & (TABLE_SIZE - 1)];
+        if (pPage == NULL) return end();
+        uint64_t pageIndex = addr & (PAGE_SIZE - 1);
+        if ((pPage->used[pageIndex >> 6] & (1ULL << (pageIndex & 63))) == 0) return end();
+        return &pPage->entries[pageIndex];
+    }
+
+    // Returns the value of an address, creating a value-initialized one if it was never accessed
+    T & operator[] (uint64_t addr)
+    {
+        uint64_t dirIndex = addr >> (PAGE_BITS + TABLE_BITS);
+        if (dirIndex >= DIRECTORY_SIZE)
+        {
+            typename unordered_map<uint64_t, value_type>::iterator it = overflow.find(addr);
+            if (it == overflow.end())
+            {
+                it = overflow.emplace(addr, value_type(addr, T())).first;
+                counter++;
+            }
+            return it->second.second;
+        }
+        if (dirIndex >= directory.size())
+        {
+            directory.resize(dirIndex + 1, NULL);
+        }
+        Table *pTable = directory[dirIndex];
+        if (pTable == NULL)
+        {
+            pTable = new Table();
+            directory[dirIndex] = pTable;
+        }
+        Page *&pPage = pTable->pages[(addr >> PAGE_BITS) & (TABLE_SIZE - 1)];
+        if (pPage == NULL)
+        {
+            pPage = new Page();
+        }
+        uint64_t pageIndex = addr & (PAGE_SIZE - 1);
+        uint64_t &used = pPage->used[pageIndex >> 6];
+        uint64_t mask = 1ULL << (pageIndex & 63);
+        if ((used & mask) == 0)
+        {
+            used |= mask;
+            pPage->entries[pageIndex].first = addr;
+            counter++;
+        }
+        return pPage->entries[pageIndex].second;
+    }
+
+    // Calls f(addr, value) for every accessed address, in ascending address order except for the overflow ones
+    template <typename F>
+    void forEach (F f)
+    {
+        for (uint64_t d=0; d<directory.size(); d++)
+        {
+            if (directory[d] == NULL) continue;
+            for (uint64_t t=0; t<TABLE_SIZE; t++)
+            {
+                Page *pPage = directory[d]->pages[t];
+                if (pPage == NULL) continue;
+                for (uint64_t p=0; p<PAGE_SIZE; p++)
+                {
+                    if (pPage->used[p >> 6] & (1ULL << (p & 63)))
+                    {
+                        f(pPage->entries[p].first, pPage->entries[p].second);
+                    }
+                }
+            }
+        }
+        for (typename unordered_map<uint64_t, value_type>::iterator it = overflow.begin(); it != overflow.end(); it++)
+        {
+            f(it->second.first, it->second.second);
+        }
+    }
+};
+
+} // namespace
+
+#endif
@@ -2,6 +2,8 @@
 #define FULL_TRACER_INTERFACE_HPP
 
 #include <string>
+#include <cstring>
+#include <cstdio>
 #include <unordered_map>
 #include "zkglobals.hpp"
 
@@ -23,6 +25,42 @@ public:
     OpcodeContract() : value(0), gas(0) {};
 };
 
+// 256-bit EVM word of a trace, stored as 8 chunks of 32 bits, from the most to the least significant one
+class TraceWord
+{
+public:
+    uint32_t chunk[8];
+
+    bool operator== (const TraceWord &other) const { return memcmp(chunk, other.chunk, sizeof(chunk)) == 0; };
+    bool operator!= (const TraceWord &other) const { return !(*this == other); };
+
+    // Writes the 32 bytes of the word in big-endian order, as in the EVM memory
+    void toBytes (char * pBytes) const
+    {
+        for (uint64_t i = 0; i < 8; i++)
+        {
+            pBytes[4*i]     = char(chunk[i] >> 24);
+            pBytes[4*i + 1] = char(chunk[i] >> 16);
+            pBytes[4*i + 2] = char(chunk[i] >> 8);
+            pBytes[4*i + 3] = char(chunk[i]);
+        }
+    }
+
+    // Returns the word in hexa, without leading zeros, as mpz_class::get_str(16) does
+    string toString (void) const
+    {
+        char buffer[65];
+        uint64_t i = 0;
+        while ((i < 7) && (chunk[i] == 0)) i++;
+        int n = snprintf(buffer, sizeof(buffer), "%x", chunk[i]);
+        for (i++; i < 8; i++)
+        {
+            n += snprintf(buffer + n, sizeof(buffer) - n, "%08x", chunk[i]);
+        }
+        return string(buffer, n);
+    }
+};
+
 class Opcode
 {
 public:
@@ -37,6 +75,12 @@ public:
     string error;
     OpcodeContract contract;
     vector<mpz_class> stack;
+    // Stack delta, used by the tracers that store the stack words in FullTraceV2::stackArena instead of stack:
+    // the stack of this step keeps the first stack_common words of the stack of the previous step, and pushes
+    // stack_new words on top of them, stored in FullTraceV2::stackArena starting at stack_offset
+    uint32_t stack_common;
+    uint32_t stack_new;
+    uint64_t stack_offset;
     string memory;
     uint64_t memory_size;
     uint64_t memory_offset;
@@ -44,7 +88,7 @@ public:
     vector<string> return_data;
     struct timeval startTime;
     uint64_t duration;
-    Opcode() : gas(0), gas_cost(0), depth(0), pc(0), op(0), opcode(NULL), gas_refund(0), memory_size(0), memory_offset(0), startTime({0,0}), duration(0) {};
+    Opcode() : gas(0), gas_cost(0), depth(0), pc(0), op(0), opcode(NULL), gas_refund(0), stack_common(0), stack_new(0), stack_offset(0), memory_size(0), memory_offset(0), startTime({0,0}), duration(0) {};
 };
 
 class Log
@@ -132,6 +176,7 @@ class FullTraceV2
 public:
     TxTraceContextV2 context;
     vector<Opcode> steps;
+    vector<TraceWord> stackArena; // Stack words pushed by the steps, referenced by their stack deltas
 };
 
 class Response
@@ -31,8 +31,19 @@
 #include "recursive2Steps.hpp"
 #include "zklog.hpp"
 #include "exit_process.hpp"
+#include "zkmax.hpp"
 
 
+void loadVerkey(const string &fileName, Goldilocks::Element (&verkey)[4])
+{
+    json verkeyJson;
+    file2json(fileName, verkeyJson);
+    for (uint64_t i = 0; i < 4; i++)
+    {
+        verkey[i] = Goldilocks::fromU64(verkeyJson["constRoot"][i]);
+    }
+}
+
 Prover::Prover(Goldilocks &fr,
                PoseidonGoldilocks &poseidon,
                const Config &config) : fr(fr),
@@ -98,11 +109,20 @@ Prover::Prover(Goldilocks &fr,
             zkassert(PROVER_FORK_NAMESPACE::CommitPols::pilSize() <= polsSize);
             zkassert(PROVER_FORK_NAMESPACE::CommitPols::pilSize() == _starkInfo.mapOffsets.section[cm2_n] * sizeof(Goldilocks::Element));
 
+            pAddressSize = polsSize;
             if (config.zkevmCmPols.size() > 0)
             {
                 pAddress = mapFile(config.zkevmCmPols, polsSize, true);
+                bPAddressMapped = true;
                 zklog.info("Prover::genBatchProof() successfully mapped " + to_string(polsSize) + " bytes to file " + config.zkevmCmPols);
             }
+            else if (config.starkOutOfCore && (config.starkOutOfCoreDirectory.size() > 0))
+            {
+                // Out-of-core mode: the pages spilled by the stark prover are written back to this file instead of swap
+                pAddress = mapSpillFile(config.starkOutOfCoreDirectory, polsSize);
+                bPAddressMapped = true;
+                zklog.info("Prover::genBatchProof() successfully mapped " + to_string(polsSize) + " bytes to a spill file in directory " + config.starkOutOfCoreDirectory);
+            }
             else
             {
                 pAddress = calloc(polsSize, 1);
@@ -126,6 +146,60 @@ Prover::Prover(Goldilocks &fr,
             starksRecursive1 = new Starks(config, {config.recursive1ConstPols, config.mapConstPolsFile, config.recursive1ConstantsTree, config.recursive1StarkInfo}, pAddress);
             starksRecursive2 = new Starks(config, {config.recursive2ConstPols, config.mapConstPolsFile, config.recursive2ConstantsTree, config.recursive2StarkInfo}, pAddress);
             starksRecursiveF = new StarkRecursiveF(config, pAddressStarksRecursiveF);
+
+            // Load the verification keys once, instead of reading them for every proof
+            TimerStart(PROVER_LOAD_VERKEYS);
+            loadVerkey(config.zkevmVerkey, zkevmVerkey);
+            loadVerkey(config.c12aVerkey, c12aVerkey);
+            loadVerkey(config.recursive1Verkey, recursive1Verkey);
+            file2json(config.recursive2Verkey, recursive2VerkeyJson);
+            for (uint64_t i = 0; i < 4; i++)
+            {
+                recursive2Verkey[i] = Goldilocks::fromU64(recursive2VerkeyJson["constRoot"][i]);
+            }
+            TimerStopAndLog(PROVER_LOAD_VERKEYS);
+
+            // Load the optimized step42ns parser program, if configured
+            if (!config.zkevmStep42nsProgram.empty())
+            {
+                if (!ZkevmSteps::loadStep42nsProgram(config.zkevmStep42nsProgram, zkevmStep42nsProgram))
+                {
+                    zklog.error("Prover::Prover() failed loading config.zkevmStep42nsProgram=" + config.zkevmStep42nsProgram);
+                    exitProcess();
+                }
+                zklog.info("Prover::Prover() loaded step42ns parser program with " + to_string(zkevmStep42nsProgram.ops.size()) + " ops");
+            }
+
+            // Load the circuit-agnostic chelpers programs, if configured
+            if (config.useGenericChelpers)
+            {
+                TimerStart(PROVER_LOAD_CHELPERS_PROGRAMS);
+                if (!zkevmChelpersSteps.load(ChelpersProgram::getFileName(config.zkevmStarkInfo), starkZkevm->starkInfo) ||
+                    !c12aChelpersSteps.load(ChelpersProgram::getFileName(config.c12aStarkInfo), starksC12a->starkInfo) ||
+                    !recursive1ChelpersSteps.load(ChelpersProgram::getFileName(config.recursive1StarkInfo), starksRecursive1->starkInfo) ||
+                    !recursive2ChelpersSteps.load(ChelpersProgram::getFileName(config.recursive2StarkInfo), starksRecursive2->starkInfo))
+                {
+                    zklog.error("Prover::Prover() failed loading the chelpers programs; generate them with runChelpersCompiler");
+                    exitProcess();
+                }
+                starkZkevm->nrowsStepBatch = CHELPERS_NROWS_BATCH;
+                starksC12a->nrowsStepBatch = CHELPERS_NROWS_BATCH;
+                starksRecursive1->nrowsStepBatch = CHELPERS_NROWS_BATCH;
+                starksRecursive2->nrowsStepBatch = CHELPERS_NROWS_BATCH;
+                TimerStopAndLog(PROVER_LOAD_CHELPERS_PROGRAMS);
+            }
+
+            // Allocate the second commit pols buffer, used to execute the next batch while proving the current one
+            if (config.proverExecutorPrefetch)
+            {
+                pAddressPrefetch = calloc(PROVER_FORK_NAMESPACE::CommitPols::pilSize(), 1);
+                if (pAddressPrefetch == NULL)
+                {
+                    zklog.error("Prover::Prover() failed calling calloc() of size " + to_string(PROVER_FORK_NAMESPACE::CommitPols::pilSize()));
+                    exitProcess();
+                }
+                zklog.info("Prover::Prover() successfully allocated " + to_string(PROVER_FORK_NAMESPACE::CommitPols::pilSize()) + " bytes for the executor prefetch");
+            }
         }
     }
     catch (std::exception &e)
@@ -156,12 +230,10 @@ Prover::~Prover()
         delete pZkey;
         delete pZkeyHeader;
 
-        uint64_t polsSize = starkZkevm->starkInfo.mapTotalN * sizeof(Goldilocks::Element) + starkZkevm->starkInfo.mapSectionsN.section[eSection::cm1_n] * (1 << starkZkevm->starkInfo.starkStruct.nBits) * FIELD_EXTENSION * sizeof(Goldilocks::Element);
-
         // Unmap committed polynomials address
-        if (config.zkevmCmPols.size() > 0)
+        if (bPAddressMapped)
         {
-            unmapFile(pAddress, polsSize);
+            unmapFile(pAddress, pAddressSize);
         }
         else
         {
@@ -169,6 +241,12 @@ Prover::~Prover()
         }
         free(pAddressStarksRecursiveF);
 
+        waitForExecutorPrefetch();
+        if (pAddressPrefetch != NULL)
+        {
+            free(pAddressPrefetch);
+        }
+
         delete prover;
 
         delete starkZkevm;
@@ -389,6 +467,71 @@ void Prover::processBatch(ProverRequest *pProverRequest)
     //TimerStopAndLog(PROVER_PROCESS_BATCH);
 }
 
+void Prover::executeBatch(ProverRequest *pProverRequest, void *pCmPolsAddress)
+{
+    zkassert(pProverRequest != NULL);
+    zkassert(pCmPolsAddress != NULL);
+
+    TimerStart(EXECUTOR_EXECUTE_INITIALIZATION);
+
+    PROVER_FORK_NAMESPACE::CommitPols cmPols(pCmPolsAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
+    uint64_t num_threads = omp_get_max_threads();
+    uint64_t bytes_per_thread = (cmPols.size() + num_threads - 1) / num_threads;
+#pragma omp parallel for num_threads(num_threads)
+    for (uint64_t i = 0; i < cmPols.size(); i += bytes_per_thread) // The last chunk is clamped to the end of the buffer
+    {
+        memset((uint8_t *)pCmPolsAddress + i, 0, zkmin(bytes_per_thread, cmPols.size() - i));
+    }
+
+    TimerStopAndLog(EXECUTOR_EXECUTE_INITIALIZATION);
+    // Execute all the State Machines
+    TimerStart(EXECUTOR_EXECUTE_BATCH_PROOF);
+    executor.execute(*pProverRequest, cmPols);
+    TimerStopAndLog(EXECUTOR_EXECUTE_BATCH_PROOF);
+}
+
+void *executorPrefetchThread(void *arg)
+{
+    Prover *pProver = (Prover *)arg;
+    ProverRequest *pProverRequest = pProver->pPrefetchRequest;
+    zklog.info("executorPrefetchThread() starting to execute request with UUID: " + pProverRequest->uuid);
+    pProver->executeBatch(pProverRequest, pProver->pAddressPrefetch);
+    zklog.info("executorPrefetchThread() done executing request with UUID: " + pProverRequest->uuid);
+    return NULL;
+}
+
+void Prover::startExecutorPrefetch(void)
+{
+    // Only one request can be prefetched at a time, since there is only one prefetch buffer
+    if ((pAddressPrefetch == NULL) || (pPrefetchRequest != NULL))
+    {
+        return;
+    }
+
+    // Only the first pending request can be prefetched, since requests are processed in order
+    lock();
+    if ((pendingRequests.size() > 0) && (pendingRequests[0]->type == prt_genBatchProof))
+    {
+        pPrefetchRequest = pendingRequests[0];
+    }
+    unlock();
+
+    if (pPrefetchRequest != NULL)
+    {
+        zklog.info("Prover::startExecutorPrefetch() prefetching request with UUID: " + pPrefetchRequest->uuid);
+        pthread_create(&prefetchPthread, NULL, executorPrefetchThread, this);
+    }
+}
+
+void Prover::waitForExecutorPrefetch(void)
+{
+    if (pPrefetchRequest != NULL)
+    {
+        pthread_join(prefetchPthread, NULL);
+        pPrefetchRequest = NULL;
+    }
+}
+
 void Prover::genBatchProof(ProverRequest *pProverRequest)
 {
     zkassert(config.generateProof());
@@ -418,22 +561,37 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
     /************/
     /* Executor */
     /************/
-    TimerStart(EXECUTOR_EXECUTE_INITIALIZATION);
 
     PROVER_FORK_NAMESPACE::CommitPols cmPols(pAddress, PROVER_FORK_NAMESPACE::CommitPols::pilDegree());
-    uint64_t num_threads = omp_get_max_threads();
-    uint64_t bytes_per_thread = cmPols.size() / num_threads;
+
+    if ((pPrefetchRequest != NULL) && (pPrefetchRequest == pProverRequest))
+    {
+        // This request was already executed into the prefetch buffer while the previous one was being proved
+        TimerStart(EXECUTOR_EXECUTE_WAIT_FOR_PREFETCH);
+        waitForExecutorPrefetch();
+        TimerStopAndLog(EXECUTOR_EXECUTE_WAIT_FOR_PREFETCH);
+
+        TimerStart(EXECUTOR_EXECUTE_COPY_PREFETCH);
+        uint64_t num_threads = omp_get_max_threads();
+        uint64_t bytes_per_thread = (cmPols.size() + num_threads - 1) / num_threads;
 #pragma omp parallel for num_threads(num_threads)
-    for (uint64_t i = 0; i < cmPols.size(); i += bytes_per_thread) // Each iteration processes 64 bytes at a time
+        for (uint64_t i = 0; i < num_threads; i++)
+        {
+            uint64_t offset = i * bytes_per_thread;
+            if (offset < cmPols.size())
+            {
+                memcpy((uint8_t *)pAddress + offset, (uint8_t *)pAddressPrefetch + offset, zkmin(bytes_per_thread, cmPols.size() - offset));
+            }
+        }
+        TimerStopAndLog(EXECUTOR_EXECUTE_COPY_PREFETCH);
+    }
+    else
     {
-        memset((uint8_t *)pAddress + i, 0, bytes_per_thread);
+        executeBatch(pProverRequest, pAddress);
     }
 
-    TimerStopAndLog(EXECUTOR_EXECUTE_INITIALIZATION);
-    // Execute all the State Machines
-    TimerStart(EXECUTOR_EXECUTE_BATCH_PROOF);
-    executor.execute(*pProverRequest, cmPols);
-    TimerStopAndLog(EXECUTOR_EXECUTE_BATCH_PROOF);
+    // The prefetch buffer is free again, so start executing the next pending batch, if any
+    startExecutorPrefetch();
 
     uint64_t lastN = cmPols.pilDegree() - 1;
 
@@ -464,32 +622,6 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         TimerStart(SAVE_PUBLICS_JSON_BATCH_PROOF);
         json publicStarkJson;
 
-        json zkevmVerkeyJson;
-        file2json(config.zkevmVerkey, zkevmVerkeyJson);
-        Goldilocks::Element zkevmVerkey[4];
-        zkevmVerkey[0] = Goldilocks::fromU64(zkevmVerkeyJson["constRoot"][0]);
-        zkevmVerkey[1] = Goldilocks::fromU64(zkevmVerkeyJson["constRoot"][1]);
-        zkevmVerkey[2] = Goldilocks::fromU64(zkevmVerkeyJson["constRoot"][2]);
-        zkevmVerkey[3] = Goldilocks::fromU64(zkevmVerkeyJson["constRoot"][3]);
-
-        json c12aVerkeyJson;
-        file2json(config.c12aVerkey, c12aVerkeyJson);
-        Goldilocks::Element c12aVerkey[4];
-        c12aVerkey[0] = Goldilocks::fromU64(c12aVerkeyJson["constRoot"][0]);
-        c12aVerkey[1] = Goldilocks::fromU64(c12aVerkeyJson["constRoot"][1]);
-        c12aVerkey[2] = Goldilocks::fromU64(c12aVerkeyJson["constRoot"][2]);
-        c12aVerkey[3] = Goldilocks::fromU64(c12aVerkeyJson["constRoot"][3]);
-
-        json recursive1VerkeyJson;
-        file2json(config.recursive1Verkey, recursive1VerkeyJson);
-        Goldilocks::Element recursive1Verkey[4];
-        recursive1Verkey[0] = Goldilocks::fromU64(recursive1VerkeyJson["constRoot"][0]);
-        recursive1Verkey[1] = Goldilocks::fromU64(recursive1VerkeyJson["constRoot"][1]);
-        recursive1Verkey[2] = Goldilocks::fromU64(recursive1VerkeyJson["constRoot"][2]);
-        recursive1Verkey[3] = Goldilocks::fromU64(recursive1VerkeyJson["constRoot"][3]);
-
-        json recursive2Verkey;
-        file2json(config.recursive2Verkey, recursive2Verkey);
 
         Goldilocks::Element publics[starksRecursive1->starkInfo.nPublics];
 
@@ -553,10 +685,10 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         // newBatchNum
         publics[43] = cmPols.Main.PC[lastN];
 
-        publics[44] = Goldilocks::fromU64(recursive2Verkey["constRoot"][0]);
-        publics[45] = Goldilocks::fromU64(recursive2Verkey["constRoot"][1]);
-        publics[46] = Goldilocks::fromU64(recursive2Verkey["constRoot"][2]);
-        publics[47] = Goldilocks::fromU64(recursive2Verkey["constRoot"][3]);
+        publics[44] = recursive2Verkey[0];
+        publics[45] = recursive2Verkey[1];
+        publics[46] = recursive2Verkey[2];
+        publics[47] = recursive2Verkey[3];
 
         for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
         {
@@ -572,21 +704,28 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         TimerStart(STARK_PROOF_BATCH_PROOF);
 
         ZkevmSteps zkevmSteps;
+        zkevmSteps.pStep42nsProgram = zkevmStep42nsProgram.empty() ? NULL : &zkevmStep42nsProgram;
         uint64_t polBits = starkZkevm->starkInfo.starkStruct.steps[starkZkevm->starkInfo.starkStruct.steps.size() - 1].nBits;
         FRIProof fproof((1 << polBits), FIELD_EXTENSION, starkZkevm->starkInfo.starkStruct.steps.size(), starkZkevm->starkInfo.evMap.size(), starkZkevm->starkInfo.nPublics);
-        starkZkevm->genProof(fproof, &publics[0], zkevmVerkey, &zkevmSteps);
+        starkZkevm->genProof(fproof, &publics[0], zkevmVerkey, config.useGenericChelpers ? (Steps *)&zkevmChelpersSteps : (Steps *)&zkevmSteps);
 
         TimerStopAndLog(STARK_PROOF_BATCH_PROOF);
         TimerStart(STARK_GEN_AND_CALC_WITNESS_C12A);
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF);
+        TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF);
 
-        nlohmann::ordered_json jProof = fproof.proofs.proof2json();
-        nlohmann::json zkin = proof2zkinStark(jProof);
-        // Generate publics
-        jProof["publics"] = publicStarkJson;
-        zkin["publics"] = publicStarkJson;
+        // The zkin is handed to the C12a witness generator in binary form; json is only generated to be saved
+        ZkinStark zkin;
+        proof2zkinStark(fproof, zkin);
+        zkin.addSignal("publics", std::vector<Goldilocks::Element>(publics, publics + starkZkevm->starkInfo.nPublics));
 
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF);
+        TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF);
+
+        if (config.saveProofToFile)
+        {
+            nlohmann::ordered_json jProof = fproof.proofs.proof2json();
+            jProof["publics"] = publicStarkJson;
+            json2file(jProof, pProverRequest->filePrefix + "batch_proof.zkevm.proof.json");
+        }
 
         CommitPolsStarks cmPols12a(pAddress, (1 << starksC12a->starkInfo.starkStruct.nBits), starksC12a->starkInfo.nCm1);
 
@@ -607,24 +746,26 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         // Generate the proof
         C12aSteps c12aSteps;
 
-        starksC12a->genProof(fproofC12a, publics, c12aVerkey, &c12aSteps);
+        starksC12a->genProof(fproofC12a, publics, c12aVerkey, config.useGenericChelpers ? (Steps *)&c12aChelpersSteps : (Steps *)&c12aSteps);
 
         TimerStopAndLog(STARK_C12_A_PROOF_BATCH_PROOF);
-        TimerStart(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+        TimerStart(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
 
-        // Save the proof & zkinproof
-        nlohmann::ordered_json jProofc12a = fproofC12a.proofs.proof2json();
-        nlohmann::json zkinC12a = proof2zkinStark(jProofc12a);
+        ZkinStark zkinC12a;
+        proof2zkinStark(fproofC12a, zkinC12a);
+        zkinC12a.addSignal("publics", std::vector<Goldilocks::Element>(publics, publics + starkZkevm->starkInfo.nPublics));
 
         // Add the recursive2 verification key
-        json rootC;
-        rootC[0] = to_string(recursive2Verkey["constRoot"][0]);
-        rootC[1] = to_string(recursive2Verkey["constRoot"][1]);
-        rootC[2] = to_string(recursive2Verkey["constRoot"][2]);
-        rootC[3] = to_string(recursive2Verkey["constRoot"][3]);
-        zkinC12a["publics"] = publicStarkJson;
-        zkinC12a["rootC"] = rootC;
-        TimerStopAndLog(STARK_JSON_GENERATION_BATCH_PROOF_C12A);
+        zkinC12a.addSignal("rootC", std::vector<Goldilocks::Element>(recursive2Verkey, recursive2Verkey + 4));
+
+        TimerStopAndLog(STARK_ZKIN_GENERATION_BATCH_PROOF_C12A);
+
+        if (config.saveProofToFile)
+        {
+            nlohmann::ordered_json jProofc12a = fproofC12a.proofs.proof2json();
+            jProofc12a["publics"] = publicStarkJson;
+            json2file(jProofc12a, pProverRequest->filePrefix + "batch_proof.c12a.proof.json");
+        }
 
         CommitPolsStarks cmPolsRecursive1(pAddress, (1 << starksRecursive1->starkInfo.starkStruct.nBits), starksRecursive1->starkInfo.nCm1);
         CircomRecursive1::getCommitedPols(&cmPolsRecursive1, config.recursive1Verifier, config.recursive1Exec, zkinC12a, (1 << starksRecursive1->starkInfo.starkStruct.nBits), starksRecursive1->starkInfo.nCm1);
@@ -641,7 +782,7 @@ void Prover::genBatchProof(ProverRequest *pProverRequest)
         uint64_t polBitsRecursive1 = starksRecursive1->starkInfo.starkStruct.steps[starksRecursive1->starkInfo.starkStruct.steps.size() - 1].nBits;
         FRIProof fproofRecursive1((1 << polBitsRecursive1), FIELD_EXTENSION, starksRecursive1->starkInfo.starkStruct.steps.size(), starksRecursive1->starkInfo.evMap.size(), starksRecursive1->starkInfo.nPublics);
         Recursive1Steps recursive1Steps;
-        starksRecursive1->genProof(fproofRecursive1, publics, recursive1Verkey, &recursive1Steps);
+        starksRecursive1->genProof(fproofRecursive1, publics, recursive1Verkey, config.useGenericChelpers ? (Steps *)&recursive1ChelpersSteps : (Steps *)&recursive1Steps);
         TimerStopAndLog(STARK_RECURSIVE_1_PROOF_BATCH_PROOF);
 
         // Save the proof & zkinproof
@@ -685,6 +826,9 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     printMemoryInfo(true);
     printProcessInfo(true);
 
+    // This proof does not use the executor, so let it run the next pending batch, if any
+    startExecutorPrefetch();
+
     // Save input to file
     if (config.saveInputToFile)
     {
@@ -694,8 +838,7 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
 
     // Input is pProverRequest->aggregatedProofInput1 and pProverRequest->aggregatedProofInput2 (of type json)
 
-    ordered_json verKey;
-    file2json(config.recursive2Verkey, verKey);
+    ordered_json verKey = recursive2VerkeyJson;
 
     // ----------------------------------------------
     // CHECKS
@@ -743,14 +886,6 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     }
 
     json zkinInputRecursive2 = joinzkin(pProverRequest->aggregatedProofInput1, pProverRequest->aggregatedProofInput2, verKey, starksRecursive2->starkInfo.starkStruct.steps.size());
-    json recursive2Verkey;
-    file2json(config.recursive2Verkey, recursive2Verkey);
-
-    Goldilocks::Element recursive2VerkeyValues[4];
-    recursive2VerkeyValues[0] = Goldilocks::fromU64(recursive2Verkey["constRoot"][0]);
-    recursive2VerkeyValues[1] = Goldilocks::fromU64(recursive2Verkey["constRoot"][1]);
-    recursive2VerkeyValues[2] = Goldilocks::fromU64(recursive2Verkey["constRoot"][2]);
-    recursive2VerkeyValues[3] = Goldilocks::fromU64(recursive2Verkey["constRoot"][3]);
 
     Goldilocks::Element publics[starksRecursive2->starkInfo.nPublics];
 
@@ -759,9 +894,9 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
         publics[i] = Goldilocks::fromString(zkinInputRecursive2["publics"][i]);
     }
 
-    for (uint64_t i = 0; i < recursive2Verkey["constRoot"].size(); i++)
+    for (uint64_t i = 0; i < 4; i++)
     {
-        publics[starkZkevm->starkInfo.nPublics + i] = Goldilocks::fromU64(recursive2Verkey["constRoot"][i]);
+        publics[starkZkevm->starkInfo.nPublics + i] = recursive2Verkey[i];
     }
 
     CommitPolsStarks cmPolsRecursive2(pAddress, (1 << starksRecursive2->starkInfo.starkStruct.nBits), starksRecursive2->starkInfo.nCm1);
@@ -779,7 +914,7 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     uint64_t polBitsRecursive2 = starksRecursive2->starkInfo.starkStruct.steps[starksRecursive2->starkInfo.starkStruct.steps.size() - 1].nBits;
     FRIProof fproofRecursive2((1 << polBitsRecursive2), FIELD_EXTENSION, starksRecursive2->starkInfo.starkStruct.steps.size(), starksRecursive2->starkInfo.evMap.size(), starksRecursive2->starkInfo.nPublics);
     Recursive2Steps recursive2Steps;
-    starksRecursive2->genProof(fproofRecursive2, publics, recursive2VerkeyValues, &recursive2Steps);
+    starksRecursive2->genProof(fproofRecursive2, publics, recursive2Verkey, config.useGenericChelpers ? (Steps *)&recursive2ChelpersSteps : (Steps *)&recursive2Steps);
     TimerStopAndLog(STARK_RECURSIVE_2_PROOF_BATCH_PROOF);
 
     // Save the proof & zkinproof
@@ -805,17 +940,15 @@ void Prover::genAggregatedProof(ProverRequest *pProverRequest)
     // Add the recursive2 verification key
     json publicsJson = json::array();
 
-    file2json(config.recursive2Verkey, recursive2Verkey);
-
     for (uint64_t i = 0; i < starkZkevm->starkInfo.nPublics; i++)
     {
         publicsJson[i] = zkinInputRecursive2["publics"][i];
     }
     // Add the recursive2 verification key
-    publicsJson[44] = to_string(recursive2Verkey["constRoot"][0]);
-    publicsJson[45] = to_string(recursive2Verkey["constRoot"][1]);
-    publicsJson[46] = to_string(recursive2Verkey["constRoot"][2]);
-    publicsJson[47] = to_string(recursive2Verkey["constRoot"][3]);
+    publicsJson[44] = to_string(recursive2VerkeyJson["constRoot"][0]);
+    publicsJson[45] = to_string(recursive2VerkeyJson["constRoot"][1]);
+    publicsJson[46] = to_string(recursive2VerkeyJson["constRoot"][2]);
+    publicsJson[47] = to_string(recursive2VerkeyJson["constRoot"][3]);
 
     json2file(publicsJson, pProverRequest->publicsOutputFile());
 
@@ -835,6 +968,9 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     printMemoryInfo(true);
     printProcessInfo(true);
 
+    // This proof does not use the executor, so let it run the next pending batch, if any
+    startExecutorPrefetch();
+
     // Save input to file
     if (config.saveInputToFile)
     {
@@ -891,11 +1027,11 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     //  ----------------------------------------------
 
     TimerStart(CIRCOM_LOAD_CIRCUIT_FINAL);
-    CircomFinal::Circom_Circuit *circuitFinal = CircomFinal::loadCircuit(config.finalVerifier);
+    CircomFinal::Circom_Circuit *circuitFinal = CircomFinal::getCircuit(config.finalVerifier);
     TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_FINAL);
 
     TimerStart(CIRCOM_FINAL_LOAD_JSON);
-    CircomFinal::Circom_CalcWit *ctxFinal = new CircomFinal::Circom_CalcWit(circuitFinal);
+    CircomFinal::Circom_CalcWit *ctxFinal = CircomFinal::acquireCalcWit(circuitFinal);
 
     CircomFinal::loadJsonImpl(ctxFinal, zkinRecursiveF);
     if (ctxFinal->getRemaingInputsToBeSet() != 0)
@@ -909,8 +1045,7 @@ void Prover::genFinalProof(ProverRequest *pProverRequest)
     AltBn128::FrElement *pWitnessFinal = NULL;
     uint64_t witnessSizeFinal = 0;
     CircomFinal::getBinWitness(ctxFinal, pWitnessFinal, witnessSizeFinal);
-    CircomFinal::freeCircuit(circuitFinal);
-    delete ctxFinal;
+    CircomFinal::releaseCalcWit(ctxFinal);
 
     TimerStopAndLog(CIRCOM_GET_BIN_WITNESS_FINAL);
 
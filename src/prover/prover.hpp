@@ -22,6 +22,8 @@
 #include "starkpil/stark_info.hpp"
 #include "starks.hpp"
 #include "constant_pols_starks.hpp"
+#include "parser_program.hpp"
+#include "chelpers_steps.hpp"
 #include "fflonk_prover.hpp"
 class Prover
 {
@@ -54,9 +56,39 @@ private:
     pthread_t cleanerPthread; // Garbage collector
     pthread_mutex_t mutex;    // Mutex to protect the requests queues
     void *pAddress = NULL;
+    uint64_t pAddressSize = 0; // Size of pAddress in bytes
+    bool bPAddressMapped = false; // pAddress is mapped to the zkevmCmPols file or to an out-of-core spill file
     void *pAddressStarksRecursiveF = NULL;
     int protocolId;
+
+    // Verification keys, loaded once at startup
+    Goldilocks::Element zkevmVerkey[4];
+    Goldilocks::Element c12aVerkey[4];
+    Goldilocks::Element recursive1Verkey[4];
+    Goldilocks::Element recursive2Verkey[4];
+    ordered_json recursive2VerkeyJson;
+
+    // Optimized step42ns parser program, loaded once at startup if configured
+    ParserProgram zkevmStep42nsProgram;
+
+    // Circuit-agnostic steps, loaded once at startup if configured
+    ChelpersSteps zkevmChelpersSteps;
+    ChelpersSteps c12aChelpersSteps;
+    ChelpersSteps recursive1ChelpersSteps;
+    ChelpersSteps recursive2ChelpersSteps;
+
+    pthread_t prefetchPthread; // Executor prefetch thread
+
 public:
+    // Executor prefetch: the next pending batch proof request is executed into pAddressPrefetch
+    // while the current request is generating its stark proofs
+    void *pAddressPrefetch = NULL;
+    ProverRequest *pPrefetchRequest = NULL;
+    void startExecutorPrefetch(void);
+    void waitForExecutorPrefetch(void);
+    void executeBatch(ProverRequest *pProverRequest, void *pCmPolsAddress);
+
+
     const Config &config;
     sem_t pendingRequestSem; // Semaphore to wakeup prover thread when a new request is available
     string lastComputedRequestId;
@@ -83,5 +115,6 @@ public:
 
 void *proverThread(void *arg);
 void *cleanerThread(void *arg);
+void *executorPrefetchThread(void *arg);
 
 #endif
\ No newline at end of file
@@ -25,7 +25,9 @@ ProverRequest::ProverRequest (Goldilocks &fr, const Config &config, tProverReque
     pFullTracer(NULL),
     bCompleted(false),
     bCancelling(false),
-    result(ZKR_UNSPECIFIED)
+    result(ZKR_UNSPECIFIED),
+    onFinishBlockCallback(NULL),
+    onFinishBlockCallbackParam(NULL)
 {
     sem_init(&completedSem, 0, 0);
     
@@ -81,6 +81,11 @@ public:
     /* Debug info */
     string errorLog;
 
+    /* Block streaming: if set, the full tracer calls it every time it finishes a block */
+    typedef void(*onFinishBlockCallbackFunctionPtr)(void*, Block &block);
+    onFinishBlockCallbackFunctionPtr onFinishBlockCallback;
+    void *onFinishBlockCallbackParam;
+
     /* Constructor */
     ProverRequest (Goldilocks &fr, const Config &config, tProverRequestType type);
     ~ProverRequest();
@@ -760,6 +760,37 @@ using grpc::Status;
 
 
 ::grpc::Status ExecutorServiceImpl::ProcessBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response)
+{
+    return processBatchV2(context, request, response, NULL);
+}
+
+::grpc::Status ExecutorServiceImpl::ProcessBatchV2Stream (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* writer)
+{
+    // Process the batch as ProcessBatchV2() does, but write every block response to the stream as soon as the full
+    // tracer finishes it, instead of accumulating all of them in one response message
+    ExecutorBlockStream blockStream(this, writer);
+    executor::v1::ProcessBatchResponseV2 response;
+    Status status = processBatchV2(context, request, &response, &blockStream);
+    if (!status.ok())
+    {
+        return status;
+    }
+    if (blockStream.bFailed)
+    {
+        return Status::CANCELLED;
+    }
+
+    // The last message contains the batch fields, and no block responses
+    if (!writer->Write(response))
+    {
+        zklog.error("ExecutorServiceImpl::ProcessBatchV2Stream() failed calling writer->Write() for the last message");
+        return Status::CANCELLED;
+    }
+
+    return Status::OK;
+}
+
+::grpc::Status ExecutorServiceImpl::processBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response, ExecutorBlockStream * pBlockStream)
 {
     // If the process is exiting, do not start new activities
     if (bExitingProcess)
@@ -1317,6 +1348,14 @@ using grpc::Status;
         zklog.info("ExecutorServiceImpl::ProcessBatchV2() Input=" + inputJsonString, &proverRequest.tags);
     }
 
+    // Stream every block as soon as the full tracer finishes it, if requested
+    if (pBlockStream != NULL)
+    {
+        pBlockStream->pProverRequest = &proverRequest;
+        proverRequest.onFinishBlockCallback = onFinishBlockCallback;
+        proverRequest.onFinishBlockCallbackParam = pBlockStream;
+    }
+
     prover.processBatch(&proverRequest);
 
     //TimerStart(EXECUTOR_PROCESS_BATCH_BUILD_RESPONSE);
@@ -1384,148 +1423,21 @@ using grpc::Status;
     vector<Block> &block_responses = proverRequest.pFullTracer->get_block_responses();
     uint64_t nTxs = 0;
 
-    for (uint64_t block=0; block<block_responses.size(); block++)
+    if (pBlockStream != NULL)
     {
-        executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse = response->add_block_responses();
-
-        pProcessBlockResponse->set_block_hash(string2ba(block_responses[block].block_hash));
-        pProcessBlockResponse->set_block_hash_l1(string2ba(block_responses[block].block_hash_l1));
-        pProcessBlockResponse->set_block_info_root(string2ba(block_responses[block].block_info_root));
-        pProcessBlockResponse->set_block_number(block_responses[block].block_number);
-        pProcessBlockResponse->set_coinbase(block_responses[block].coinbase);
-        pProcessBlockResponse->set_gas_limit(block_responses[block].gas_limit);
-        pProcessBlockResponse->set_gas_used(block_responses[block].gas_used);
-        pProcessBlockResponse->set_ger(string2ba(block_responses[block].ger));
-        pProcessBlockResponse->set_parent_hash(string2ba(block_responses[block].parent_hash));
-        pProcessBlockResponse->set_timestamp(block_responses[block].timestamp);
-        pProcessBlockResponse->set_error(string2error(block_responses[block].error));
-
-        for (uint64_t log=0; log<block_responses[block].logs.size(); log++)
+        // Stream the blocks that were not streamed when finished, if any, so that the last message has no blocks
+        for (uint64_t block=pBlockStream->nBlocks; block<block_responses.size(); block++)
         {
-            executor::v1::LogV2 * pLog = pProcessBlockResponse->add_logs();
-            pLog->set_address(block_responses[block].logs[log].address); // Address of the contract that generated the event
-            for (uint64_t topic=0; topic<block_responses[block].logs[log].topics.size(); topic++)
-            {
-                std::string * pTopic = pLog->add_topics();
-                *pTopic = string2ba(block_responses[block].logs[log].topics[topic]); // List of topics provided by the contract
-            }
-            string dataConcatenated;
-            for (uint64_t data=0; data<block_responses[block].logs[log].data.size(); data++)
-                dataConcatenated += block_responses[block].logs[log].data[data];
-            pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
-            //pLog->set_batch_number(block_responses[tblockx].logs[log].batch_number); // Batch in which the transaction was included
-            pLog->set_tx_hash(string2ba(block_responses[block].logs[log].tx_hash)); // Hash of the transaction
-            pLog->set_tx_hash_l2(string2ba(block_responses[block].logs[log].tx_hash_l2)); // Hash of the transaction in layer 2
-            pLog->set_tx_index(block_responses[block].logs[log].tx_index); // Index of the transaction in the block
-            //pLog->set_batch_hash(string2ba(block_responses[block].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-            pLog->set_index(block_responses[block].logs[log].index); // Index of the log in the block
-            pLog->set_block_hash(string2ba(block_responses[block].logs[log].block_hash));
-            pLog->set_block_number(block_responses[block].logs[log].block_number);
+            streamBlock(*pBlockStream, block_responses[block]);
         }
-
-        vector<ResponseV2> &responses = block_responses[block].responses;
-        nTxs += responses.size();
-
-        for (uint64_t tx=0; tx<block_responses[block].responses.size(); tx++)
+        nTxs = pBlockStream->nTxs;
+    }
+    else
+    {
+        for (uint64_t block=0; block<block_responses.size(); block++)
         {
-            // Remember the previous memory sent for each TX, and send only increments
-            string previousMemory;
-
-            executor::v1::ProcessTransactionResponseV2 * pProcessTransactionResponse = pProcessBlockResponse->add_responses();
-
-            //executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
-            pProcessTransactionResponse->set_tx_hash(string2ba(responses[tx].tx_hash));
-            pProcessTransactionResponse->set_tx_hash_l2(string2ba(responses[tx].tx_hash_l2));
-            pProcessTransactionResponse->set_rlp_tx(responses[tx].rlp_tx);
-            pProcessTransactionResponse->set_type(responses[tx].type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
-            pProcessTransactionResponse->set_return_value(string2ba(responses[tx].return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
-            pProcessTransactionResponse->set_gas_left(responses[tx].gas_left); // Total gas left as result of execution
-            pProcessTransactionResponse->set_gas_used(responses[tx].gas_used); // Total gas used as result of execution or gas estimation
-            pProcessTransactionResponse->set_gas_refunded(responses[tx].gas_refunded); // Total gas refunded as result of execution
-            pProcessTransactionResponse->set_error(string2error(responses[tx].error)); // Any error encountered during the execution
-            pProcessTransactionResponse->set_create_address(responses[tx].create_address); // New SC Address in case of SC creation
-            pProcessTransactionResponse->set_state_root(string2ba(responses[tx].state_root));
-            pProcessTransactionResponse->set_status(responses[tx].status);
-            pProcessTransactionResponse->set_effective_percentage(responses[tx].effective_percentage);
-            pProcessTransactionResponse->set_effective_gas_price(responses[tx].effective_gas_price);
-            pProcessTransactionResponse->set_has_balance_opcode(responses[tx].has_balance_opcode);
-            pProcessTransactionResponse->set_has_gasprice_opcode(responses[tx].has_gasprice_opcode);
-            pProcessTransactionResponse->set_cumulative_gas_used(responses[tx].cumulative_gas_used);
-            
-            for (uint64_t log=0; log<responses[tx].logs.size(); log++)
-            {
-                executor::v1::LogV2 * pLog = pProcessTransactionResponse->add_logs();
-                pLog->set_address(responses[tx].logs[log].address); // Address of the contract that generated the event
-                for (uint64_t topic=0; topic<responses[tx].logs[log].topics.size(); topic++)
-                {
-                    std::string * pTopic = pLog->add_topics();
-                    *pTopic = string2ba(responses[tx].logs[log].topics[topic]); // List of topics provided by the contract
-                }
-                string dataConcatenated;
-                for (uint64_t data=0; data<responses[tx].logs[log].data.size(); data++)
-                    dataConcatenated += responses[tx].logs[log].data[data];
-                pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
-                //pLog->set_batch_number(responses[tx].logs[log].batch_number); // Batch in which the transaction was included
-                pLog->set_tx_hash(string2ba(responses[tx].logs[log].tx_hash)); // Hash of the transaction
-                pLog->set_tx_index(responses[tx].logs[log].tx_index); // Index of the transaction in the block
-                //pLog->set_batch_hash(string2ba(responses[tx].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-                pLog->set_index(responses[tx].logs[log].index); // Index of the log in the block
-                pLog->set_block_hash(string2ba(responses[tx].logs[log].block_hash));
-                pLog->set_block_number(responses[tx].logs[log].block_number);
-            }
-            if (proverRequest.input.traceConfig.bEnabled && (proverRequest.input.traceConfig.txHashToGenerateFullTrace == responses[tx].tx_hash))
-            {
-                executor::v1::FullTraceV2 * pFullTrace = new executor::v1::FullTraceV2();
-                executor::v1::TransactionContextV2 * pTransactionContext = pFullTrace->mutable_context();
-                pTransactionContext->set_type(responses[tx].full_trace.context.type); // "CALL" or "CREATE"
-                pTransactionContext->set_from(responses[tx].full_trace.context.from); // Sender of the transaction
-                pTransactionContext->set_to(responses[tx].full_trace.context.to); // Target of the transaction
-                pTransactionContext->set_data(string2ba(responses[tx].full_trace.context.data)); // Input data of the transaction
-                pTransactionContext->set_gas(responses[tx].full_trace.context.gas);
-                pTransactionContext->set_gas_price(Add0xIfMissing(responses[tx].full_trace.context.gas_price.get_str(16)));
-                pTransactionContext->set_value(Add0xIfMissing(responses[tx].full_trace.context.value.get_str(16)));
-                //pTransactionContext->set_batch(string2ba(responses[tx].full_trace.context.batch)); // Hash of the batch in which the transaction was included
-                pTransactionContext->set_output(string2ba(responses[tx].full_trace.context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
-                pTransactionContext->set_gas_used(responses[tx].full_trace.context.gas_used); // Total gas used as result of execution
-                pTransactionContext->set_execution_time(responses[tx].full_trace.context.execution_time);
-                pTransactionContext->set_old_state_root(string2ba(responses[tx].full_trace.context.old_state_root)); // Starting state root
-                pTransactionContext->set_chain_id(responses[tx].full_trace.context.chainId);
-                pTransactionContext->set_tx_index(responses[tx].full_trace.context.txIndex);
-                for (uint64_t step=0; step<responses[tx].full_trace.steps.size(); step++)
-                {
-                    executor::v1::TransactionStepV2 * pTransactionStep = pFullTrace->add_steps();
-                    pTransactionStep->set_state_root(string2ba(responses[tx].full_trace.steps[step].state_root));
-                    pTransactionStep->set_depth(responses[tx].full_trace.steps[step].depth); // Call depth
-                    pTransactionStep->set_pc(responses[tx].full_trace.steps[step].pc); // Program counter
-                    pTransactionStep->set_gas(responses[tx].full_trace.steps[step].gas); // Remaining gas
-                    pTransactionStep->set_gas_cost(responses[tx].full_trace.steps[step].gas_cost); // Gas cost of the operation
-                    pTransactionStep->set_gas_refund(responses[tx].full_trace.steps[step].gas_refund); // Gas refunded during the operation
-                    pTransactionStep->set_op(responses[tx].full_trace.steps[step].op); // Opcode
-                    for (uint64_t stack=0; stack<responses[tx].full_trace.steps[step].stack.size() ; stack++)
-                        pTransactionStep->add_stack(responses[tx].full_trace.steps[step].stack[stack].get_str(16)); // Content of the stack
-                    pTransactionStep->set_memory_size(responses[tx].full_trace.steps[step].memory_size);
-                    pTransactionStep->set_memory_offset(responses[tx].full_trace.steps[step].memory_offset);
-                    pTransactionStep->set_memory(responses[tx].full_trace.steps[step].memory);
-                    string dataConcatenated;
-                    for (uint64_t data=0; data<responses[tx].full_trace.steps[step].return_data.size(); data++)
-                        dataConcatenated += responses[tx].full_trace.steps[step].return_data[data];
-                    pTransactionStep->set_return_data(string2ba(dataConcatenated));
-                    executor::v1::ContractV2 * pContract = pTransactionStep->mutable_contract(); // Contract information
-                    pContract->set_address(responses[tx].full_trace.steps[step].contract.address);
-                    pContract->set_caller(responses[tx].full_trace.steps[step].contract.caller);
-                    pContract->set_value(Add0xIfMissing(responses[tx].full_trace.steps[step].contract.value.get_str(16)));
-                    pContract->set_data(string2ba(responses[tx].full_trace.steps[step].contract.data));
-                    pContract->set_gas(responses[tx].full_trace.steps[step].contract.gas);
-                    pContract->set_type(responses[tx].full_trace.steps[step].contract.type);
-                    pTransactionStep->set_error(string2error(responses[tx].full_trace.steps[step].error));
-
-                    google::protobuf::Map<std::string, std::string> * pStorage = pTransactionStep->mutable_storage();
-                    unordered_map<string,string>::iterator it;
-                    for (it=responses[tx].full_trace.steps[step].storage.begin(); it!=responses[tx].full_trace.steps[step].storage.end(); it++)
-                        (*pStorage)[it->first] = it->second; // Content of the storage
-                }
-                pProcessTransactionResponse->set_allocated_full_trace(pFullTrace);
-            }
+            nTxs += block_responses[block].responses.size();
+            block2proto(proverRequest, block_responses[block], response->add_block_responses());
         }
     }
 
@@ -2079,147 +1991,8 @@ using grpc::Status;
 
     for (uint64_t block=0; block<block_responses.size(); block++)
     {
-        executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse = response->add_block_responses();
-
-        pProcessBlockResponse->set_block_hash(string2ba(block_responses[block].block_hash));
-        pProcessBlockResponse->set_block_hash_l1(string2ba(block_responses[block].block_hash_l1));
-        pProcessBlockResponse->set_block_info_root(string2ba(block_responses[block].block_info_root));
-        pProcessBlockResponse->set_block_number(block_responses[block].block_number);
-        pProcessBlockResponse->set_coinbase(block_responses[block].coinbase);
-        pProcessBlockResponse->set_gas_limit(block_responses[block].gas_limit);
-        pProcessBlockResponse->set_gas_used(block_responses[block].gas_used);
-        pProcessBlockResponse->set_ger(string2ba(block_responses[block].ger));
-        pProcessBlockResponse->set_parent_hash(string2ba(block_responses[block].parent_hash));
-        pProcessBlockResponse->set_timestamp(block_responses[block].timestamp);
-        pProcessBlockResponse->set_error(string2error(block_responses[block].error));
-
-        for (uint64_t log=0; log<block_responses[block].logs.size(); log++)
-        {
-            executor::v1::LogV2 * pLog = pProcessBlockResponse->add_logs();
-            pLog->set_address(block_responses[block].logs[log].address); // Address of the contract that generated the event
-            for (uint64_t topic=0; topic<block_responses[block].logs[log].topics.size(); topic++)
-            {
-                std::string * pTopic = pLog->add_topics();
-                *pTopic = string2ba(block_responses[block].logs[log].topics[topic]); // List of topics provided by the contract
-            }
-            string dataConcatenated;
-            for (uint64_t data=0; data<block_responses[block].logs[log].data.size(); data++)
-                dataConcatenated += block_responses[block].logs[log].data[data];
-            pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
-            //pLog->set_batch_number(block_responses[tblockx].logs[log].batch_number); // Batch in which the transaction was included
-            pLog->set_tx_hash(string2ba(block_responses[block].logs[log].tx_hash)); // Hash of the transaction
-            pLog->set_tx_hash_l2(string2ba(block_responses[block].logs[log].tx_hash_l2)); // Hash of the transaction in layer 2
-            pLog->set_tx_index(block_responses[block].logs[log].tx_index); // Index of the transaction in the block
-            //pLog->set_batch_hash(string2ba(block_responses[block].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-            pLog->set_index(block_responses[block].logs[log].index); // Index of the log in the block
-            pLog->set_block_hash(string2ba(block_responses[block].logs[log].block_hash));
-            pLog->set_block_number(block_responses[block].logs[log].block_number);
-        }
-
-        vector<ResponseV2> &responses = block_responses[block].responses;
-        nTxs += responses.size();
-
-        for (uint64_t tx=0; tx<block_responses[block].responses.size(); tx++)
-        {
-            // Remember the previous memory sent for each TX, and send only increments
-            string previousMemory;
-
-            executor::v1::ProcessTransactionResponseV2 * pProcessTransactionResponse = pProcessBlockResponse->add_responses();
-
-            //executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
-            pProcessTransactionResponse->set_tx_hash(string2ba(responses[tx].tx_hash));
-            pProcessTransactionResponse->set_tx_hash_l2(string2ba(responses[tx].tx_hash_l2));
-            pProcessTransactionResponse->set_rlp_tx(responses[tx].rlp_tx);
-            pProcessTransactionResponse->set_type(responses[tx].type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
-            pProcessTransactionResponse->set_return_value(string2ba(responses[tx].return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
-            pProcessTransactionResponse->set_gas_left(responses[tx].gas_left); // Total gas left as result of execution
-            pProcessTransactionResponse->set_gas_used(responses[tx].gas_used); // Total gas used as result of execution or gas estimation
-            pProcessTransactionResponse->set_gas_refunded(responses[tx].gas_refunded); // Total gas refunded as result of execution
-            pProcessTransactionResponse->set_error(string2error(responses[tx].error)); // Any error encountered during the execution
-            pProcessTransactionResponse->set_create_address(responses[tx].create_address); // New SC Address in case of SC creation
-            pProcessTransactionResponse->set_state_root(string2ba(responses[tx].state_root));
-            pProcessTransactionResponse->set_status(responses[tx].status);
-            pProcessTransactionResponse->set_effective_percentage(responses[tx].effective_percentage);
-            pProcessTransactionResponse->set_effective_gas_price(responses[tx].effective_gas_price);
-            pProcessTransactionResponse->set_has_balance_opcode(responses[tx].has_balance_opcode);
-            pProcessTransactionResponse->set_has_gasprice_opcode(responses[tx].has_gasprice_opcode);
-            pProcessTransactionResponse->set_cumulative_gas_used(responses[tx].cumulative_gas_used);
-            
-            for (uint64_t log=0; log<responses[tx].logs.size(); log++)
-            {
-                executor::v1::LogV2 * pLog = pProcessTransactionResponse->add_logs();
-                pLog->set_address(responses[tx].logs[log].address); // Address of the contract that generated the event
-                for (uint64_t topic=0; topic<responses[tx].logs[log].topics.size(); topic++)
-                {
-                    std::string * pTopic = pLog->add_topics();
-                    *pTopic = string2ba(responses[tx].logs[log].topics[topic]); // List of topics provided by the contract
-                }
-                string dataConcatenated;
-                for (uint64_t data=0; data<responses[tx].logs[log].data.size(); data++)
-                    dataConcatenated += responses[tx].logs[log].data[data];
-                pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
-                //pLog->set_batch_number(responses[tx].logs[log].batch_number); // Batch in which the transaction was included
-                pLog->set_tx_hash(string2ba(responses[tx].logs[log].tx_hash)); // Hash of the transaction
-                pLog->set_tx_index(responses[tx].logs[log].tx_index); // Index of the transaction in the block
-                //pLog->set_batch_hash(string2ba(responses[tx].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
-                pLog->set_index(responses[tx].logs[log].index); // Index of the log in the block
-                pLog->set_block_hash(string2ba(responses[tx].logs[log].block_hash));
-                pLog->set_block_number(responses[tx].logs[log].block_number);
-            }
-            if (proverRequest.input.traceConfig.bEnabled && (proverRequest.input.traceConfig.txHashToGenerateFullTrace == responses[tx].tx_hash))
-            {
-                executor::v1::FullTraceV2 * pFullTrace = new executor::v1::FullTraceV2();
-                executor::v1::TransactionContextV2 * pTransactionContext = pFullTrace->mutable_context();
-                pTransactionContext->set_type(responses[tx].full_trace.context.type); // "CALL" or "CREATE"
-                pTransactionContext->set_from(responses[tx].full_trace.context.from); // Sender of the transaction
-                pTransactionContext->set_to(responses[tx].full_trace.context.to); // Target of the transaction
-                pTransactionContext->set_data(string2ba(responses[tx].full_trace.context.data)); // Input data of the transaction
-                pTransactionContext->set_gas(responses[tx].full_trace.context.gas);
-                pTransactionContext->set_gas_price(Add0xIfMissing(responses[tx].full_trace.context.gas_price.get_str(16)));
-                pTransactionContext->set_value(Add0xIfMissing(responses[tx].full_trace.context.value.get_str(16)));
-                //pTransactionContext->set_batch(string2ba(responses[tx].full_trace.context.batch)); // Hash of the batch in which the transaction was included
-                pTransactionContext->set_output(string2ba(responses[tx].full_trace.context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
-                pTransactionContext->set_gas_used(responses[tx].full_trace.context.gas_used); // Total gas used as result of execution
-                pTransactionContext->set_execution_time(responses[tx].full_trace.context.execution_time);
-                pTransactionContext->set_old_state_root(string2ba(responses[tx].full_trace.context.old_state_root)); // Starting state root
-                pTransactionContext->set_chain_id(responses[tx].full_trace.context.chainId);
-                pTransactionContext->set_tx_index(responses[tx].full_trace.context.txIndex);
-                for (uint64_t step=0; step<responses[tx].full_trace.steps.size(); step++)
-                {
-                    executor::v1::TransactionStepV2 * pTransactionStep = pFullTrace->add_steps();
-                    pTransactionStep->set_state_root(string2ba(responses[tx].full_trace.steps[step].state_root));
-                    pTransactionStep->set_depth(responses[tx].full_trace.steps[step].depth); // Call depth
-                    pTransactionStep->set_pc(responses[tx].full_trace.steps[step].pc); // Program counter
-                    pTransactionStep->set_gas(responses[tx].full_trace.steps[step].gas); // Remaining gas
-                    pTransactionStep->set_gas_cost(responses[tx].full_trace.steps[step].gas_cost); // Gas cost of the operation
-                    pTransactionStep->set_gas_refund(responses[tx].full_trace.steps[step].gas_refund); // Gas refunded during the operation
-                    pTransactionStep->set_op(responses[tx].full_trace.steps[step].op); // Opcode
-                    for (uint64_t stack=0; stack<responses[tx].full_trace.steps[step].stack.size() ; stack++)
-                        pTransactionStep->add_stack(responses[tx].full_trace.steps[step].stack[stack].get_str(16)); // Content of the stack
-                    pTransactionStep->set_memory_size(responses[tx].full_trace.steps[step].memory_size);
-                    pTransactionStep->set_memory_offset(responses[tx].full_trace.steps[step].memory_offset);
-                    pTransactionStep->set_memory(responses[tx].full_trace.steps[step].memory);
-                    string dataConcatenated;
-                    for (uint64_t data=0; data<responses[tx].full_trace.steps[step].return_data.size(); data++)
-                        dataConcatenated += responses[tx].full_trace.steps[step].return_data[data];
-                    pTransactionStep->set_return_data(string2ba(dataConcatenated));
-                    executor::v1::ContractV2 * pContract = pTransactionStep->mutable_contract(); // Contract information
-                    pContract->set_address(responses[tx].full_trace.steps[step].contract.address);
-                    pContract->set_caller(responses[tx].full_trace.steps[step].contract.caller);
-                    pContract->set_value(Add0xIfMissing(responses[tx].full_trace.steps[step].contract.value.get_str(16)));
-                    pContract->set_data(string2ba(responses[tx].full_trace.steps[step].contract.data));
-                    pContract->set_gas(responses[tx].full_trace.steps[step].contract.gas);
-                    pContract->set_type(responses[tx].full_trace.steps[step].contract.type);
-                    pTransactionStep->set_error(string2error(responses[tx].full_trace.steps[step].error));
-
-                    google::protobuf::Map<std::string, std::string> * pStorage = pTransactionStep->mutable_storage();
-                    unordered_map<string,string>::iterator it;
-                    for (it=responses[tx].full_trace.steps[step].storage.begin(); it!=responses[tx].full_trace.steps[step].storage.end(); it++)
-                        (*pStorage)[it->first] = it->second; // Content of the storage
-                }
-                pProcessTransactionResponse->set_allocated_full_trace(pFullTrace);
-            }
-        }
+        nTxs += block_responses[block].responses.size();
+        block2proto(proverRequest, block_responses[block], response->add_block_responses());
     }
 
     // Return accessed keys, if requested
@@ -2497,6 +2270,209 @@ using grpc::Status;
 
 #endif
 
+void ExecutorServiceImpl::block2proto (ProverRequest &proverRequest, Block &block, executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse)
+{
+    pProcessBlockResponse->set_block_hash(string2ba(block.block_hash));
+    pProcessBlockResponse->set_block_hash_l1(string2ba(block.block_hash_l1));
+    pProcessBlockResponse->set_block_info_root(string2ba(block.block_info_root));
+    pProcessBlockResponse->set_block_number(block.block_number);
+    pProcessBlockResponse->set_coinbase(block.coinbase);
+    pProcessBlockResponse->set_gas_limit(block.gas_limit);
+    pProcessBlockResponse->set_gas_used(block.gas_used);
+    pProcessBlockResponse->set_ger(string2ba(block.ger));
+    pProcessBlockResponse->set_parent_hash(string2ba(block.parent_hash));
+    pProcessBlockResponse->set_timestamp(block.timestamp);
+    pProcessBlockResponse->set_error(string2error(block.error));
+
+    for (uint64_t log=0; log<block.logs.size(); log++)
+    {
+        executor::v1::LogV2 * pLog = pProcessBlockResponse->add_logs();
+        pLog->set_address(block.logs[log].address); // Address of the contract that generated the event
+        for (uint64_t topic=0; topic<block.logs[log].topics.size(); topic++)
+        {
+            std::string * pTopic = pLog->add_topics();
+            *pTopic = string2ba(block.logs[log].topics[topic]); // List of topics provided by the contract
+        }
+        string dataConcatenated;
+        for (uint64_t data=0; data<block.logs[log].data.size(); data++)
+            dataConcatenated += block.logs[log].data[data];
+        pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
+        //pLog->set_batch_number(block_responses[tblockx].logs[log].batch_number); // Batch in which the transaction was included
+        pLog->set_tx_hash(string2ba(block.logs[log].tx_hash)); // Hash of the transaction
+        pLog->set_tx_hash_l2(string2ba(block.logs[log].tx_hash_l2)); // Hash of the transaction in layer 2
+        pLog->set_tx_index(block.logs[log].tx_index); // Index of the transaction in the block
+        //pLog->set_batch_hash(string2ba(block.logs[log].batch_hash)); // Hash of the batch in which the transaction was included
+        pLog->set_index(block.logs[log].index); // Index of the log in the block
+        pLog->set_block_hash(string2ba(block.logs[log].block_hash));
+        pLog->set_block_number(block.logs[log].block_number);
+    }
+
+    vector<ResponseV2> &responses = block.responses;
+
+    for (uint64_t tx=0; tx<responses.size(); tx++)
+    {
+        // Remember the previous memory sent for each TX, and send only increments
+        string previousMemory;
+
+        executor::v1::ProcessTransactionResponseV2 * pProcessTransactionResponse = pProcessBlockResponse->add_responses();
+
+        //executor::v1::ProcessTransactionResponse * pProcessTransactionResponse = response->add_responses();
+        pProcessTransactionResponse->set_tx_hash(string2ba(responses[tx].tx_hash));
+        pProcessTransactionResponse->set_tx_hash_l2(string2ba(responses[tx].tx_hash_l2));
+        pProcessTransactionResponse->set_rlp_tx(responses[tx].rlp_tx);
+        pProcessTransactionResponse->set_type(responses[tx].type); // Type indicates legacy transaction; it will be always 0 (legacy) in the executor
+        pProcessTransactionResponse->set_return_value(string2ba(responses[tx].return_value)); // Returned data from the runtime (function result or data supplied with revert opcode)
+        pProcessTransactionResponse->set_gas_left(responses[tx].gas_left); // Total gas left as result of execution
+        pProcessTransactionResponse->set_gas_used(responses[tx].gas_used); // Total gas used as result of execution or gas estimation
+        pProcessTransactionResponse->set_gas_refunded(responses[tx].gas_refunded); // Total gas refunded as result of execution
+        pProcessTransactionResponse->set_error(string2error(responses[tx].error)); // Any error encountered during the execution
+        pProcessTransactionResponse->set_create_address(responses[tx].create_address); // New SC Address in case of SC creation
+        pProcessTransactionResponse->set_state_root(string2ba(responses[tx].state_root));
+        pProcessTransactionResponse->set_status(responses[tx].status);
+        pProcessTransactionResponse->set_effective_percentage(responses[tx].effective_percentage);
+        pProcessTransactionResponse->set_effective_gas_price(responses[tx].effective_gas_price);
+        pProcessTransactionResponse->set_has_balance_opcode(responses[tx].has_balance_opcode);
+        pProcessTransactionResponse->set_has_gasprice_opcode(responses[tx].has_gasprice_opcode);
+        pProcessTransactionResponse->set_cumulative_gas_used(responses[tx].cumulative_gas_used);
+        
+        for (uint64_t log=0; log<responses[tx].logs.size(); log++)
+        {
+            executor::v1::LogV2 * pLog = pProcessTransactionResponse->add_logs();
+            pLog->set_address(responses[tx].logs[log].address); // Address of the contract that generated the event
+            for (uint64_t topic=0; topic<responses[tx].logs[log].topics.size(); topic++)
+            {
+                std::string * pTopic = pLog->add_topics();
+                *pTopic = string2ba(responses[tx].logs[log].topics[topic]); // List of topics provided by the contract
+            }
+            string dataConcatenated;
+            for (uint64_t data=0; data<responses[tx].logs[log].data.size(); data++)
+                dataConcatenated += responses[tx].logs[log].data[data];
+            pLog->set_data(string2ba(dataConcatenated)); // Supplied by the contract, usually ABI-encoded
+            //pLog->set_batch_number(responses[tx].logs[log].batch_number); // Batch in which the transaction was included
+            pLog->set_tx_hash(string2ba(responses[tx].logs[log].tx_hash)); // Hash of the transaction
+            pLog->set_tx_index(responses[tx].logs[log].tx_index); // Index of the transaction in the block
+            //pLog->set_batch_hash(string2ba(responses[tx].logs[log].batch_hash)); // Hash of the batch in which the transaction was included
+            pLog->set_index(responses[tx].logs[log].index); // Index of the log in the block
+            pLog->set_block_hash(string2ba(responses[tx].logs[log].block_hash));
+            pLog->set_block_number(responses[tx].logs[log].block_number);
+        }
+        if (proverRequest.input.traceConfig.bEnabled && (proverRequest.input.traceConfig.txHashToGenerateFullTrace == responses[tx].tx_hash))
+        {
+            fullTrace2proto(responses[tx].full_trace, pProcessTransactionResponse->mutable_full_trace());
+        }
+    }
+}
+
+void ExecutorServiceImpl::onFinishBlockCallback (void *p, Block &block)
+{
+    ExecutorBlockStream * pBlockStream = (ExecutorBlockStream *)p;
+    pBlockStream->pService->streamBlock(*pBlockStream, block);
+}
+
+void ExecutorServiceImpl::streamBlock (ExecutorBlockStream &blockStream, Block &block)
+{
+    blockStream.nBlocks++;
+    blockStream.nTxs += block.responses.size();
+
+    // If a previous write failed, the client is gone
+    if (blockStream.bFailed)
+    {
+        return;
+    }
+
+    // Build the message in the stream arena, which reuses the same memory for every block
+    executor::v1::ProcessBatchResponseV2 * pResponse = google::protobuf::Arena::CreateMessage<executor::v1::ProcessBatchResponseV2>(blockStream.pArena);
+    block2proto(*blockStream.pProverRequest, block, pResponse->add_block_responses());
+    if (!blockStream.pWriter->Write(*pResponse))
+    {
+        zklog.error("ExecutorServiceImpl::streamBlock() failed calling pWriter->Write() block_number=" + to_string(block.block_number), &blockStream.pProverRequest->tags);
+        blockStream.bFailed = true;
+    }
+    blockStream.pArena->Reset();
+
+    // Release the transactions and logs of the block, since they have already been sent
+    vector<ResponseV2>().swap(block.responses);
+    vector<LogV2>().swap(block.logs);
+}
+
+void ExecutorServiceImpl::fullTrace2proto (FullTraceV2 &fullTrace, executor::v1::FullTraceV2 * pFullTrace)
+{
+    // The full trace is moved into the protobuf message step by step, releasing every step as soon as it has been
+    // converted, so that a debug trace is never held twice in memory
+    TxTraceContextV2 &context = fullTrace.context;
+    executor::v1::TransactionContextV2 * pTransactionContext = pFullTrace->mutable_context();
+    pTransactionContext->set_type(move(context.type)); // "CALL" or "CREATE"
+    pTransactionContext->set_from(move(context.from)); // Sender of the transaction
+    pTransactionContext->set_to(move(context.to)); // Target of the transaction
+    pTransactionContext->set_data(string2ba(context.data)); // Input data of the transaction
+    pTransactionContext->set_gas(context.gas);
+    pTransactionContext->set_gas_price(Add0xIfMissing(context.gas_price.get_str(16)));
+    pTransactionContext->set_value(Add0xIfMissing(context.value.get_str(16)));
+    //pTransactionContext->set_batch(string2ba(context.batch)); // Hash of the batch in which the transaction was included
+    pTransactionContext->set_output(string2ba(context.output)); // Returned data from the runtime (function result or data supplied with revert opcode)
+    pTransactionContext->set_gas_used(context.gas_used); // Total gas used as result of execution
+    pTransactionContext->set_execution_time(context.execution_time);
+    pTransactionContext->set_old_state_root(string2ba(context.old_state_root)); // Starting state root
+    pTransactionContext->set_chain_id(context.chainId);
+    pTransactionContext->set_tx_index(context.txIndex);
+
+    vector<Opcode> steps;
+    steps.swap(fullTrace.steps);
+    vector<TraceWord> stackArena;
+    stackArena.swap(fullTrace.stackArena);
+    vector<TraceWord> stack; // Stack of the current step, rebuilt from the stack deltas
+    pFullTrace->mutable_steps()->Reserve(steps.size());
+    for (uint64_t step=0; step<steps.size(); step++)
+    {
+        Opcode &opcode = steps[step];
+        executor::v1::TransactionStepV2 * pTransactionStep = pFullTrace->add_steps();
+        pTransactionStep->set_state_root(string2ba(opcode.state_root));
+        pTransactionStep->set_depth(opcode.depth); // Call depth
+        pTransactionStep->set_pc(opcode.pc); // Program counter
+        pTransactionStep->set_gas(opcode.gas); // Remaining gas
+        pTransactionStep->set_gas_cost(opcode.gas_cost); // Gas cost of the operation
+        pTransactionStep->set_gas_refund(opcode.gas_refund); // Gas refunded during the operation
+        pTransactionStep->set_op(opcode.op); // Opcode
+        if (opcode.stack.empty())
+        {
+            stack.resize(opcode.stack_common);
+            stack.insert(stack.end(), stackArena.begin() + opcode.stack_offset, stackArena.begin() + opcode.stack_offset + opcode.stack_new);
+            pTransactionStep->mutable_stack()->Reserve(stack.size());
+            for (uint64_t i=0; i<stack.size(); i++)
+                pTransactionStep->add_stack(stack[i].toString()); // Content of the stack
+        }
+        else
+        {
+            pTransactionStep->mutable_stack()->Reserve(opcode.stack.size());
+            for (uint64_t stack=0; stack<opcode.stack.size() ; stack++)
+                pTransactionStep->add_stack(opcode.stack[stack].get_str(16)); // Content of the stack
+        }
+        pTransactionStep->set_memory_size(opcode.memory_size);
+        pTransactionStep->set_memory_offset(opcode.memory_offset);
+        pTransactionStep->set_memory(move(opcode.memory));
+        string dataConcatenated;
+        for (uint64_t data=0; data<opcode.return_data.size(); data++)
+            dataConcatenated += opcode.return_data[data];
+        pTransactionStep->set_return_data(string2ba(dataConcatenated));
+        executor::v1::ContractV2 * pContract = pTransactionStep->mutable_contract(); // Contract information
+        pContract->set_address(move(opcode.contract.address));
+        pContract->set_caller(move(opcode.contract.caller));
+        pContract->set_value(Add0xIfMissing(opcode.contract.value.get_str(16)));
+        pContract->set_data(string2ba(opcode.contract.data));
+        pContract->set_gas(opcode.contract.gas);
+        pContract->set_type(move(opcode.contract.type));
+        pTransactionStep->set_error(string2error(opcode.error));
+
+        google::protobuf::Map<std::string, std::string> * pStorage = pTransactionStep->mutable_storage();
+        unordered_map<string,string>::iterator it;
+        for (it=opcode.storage.begin(); it!=opcode.storage.end(); it++)
+            (*pStorage)[it->first] = move(it->second); // Content of the storage
+
+        // Release the step
+        opcode = Opcode();
+    }
+}
+
 ::executor::v1::RomError ExecutorServiceImpl::string2error (string &errorString)
 {
     if (errorString == "OOG"                              ) return ::executor::v1::ROM_ERROR_OUT_OF_GAS;
@@ -10,6 +10,45 @@
 
 //#define PROCESS_BATCH_STREAM
 
+// Size of the initial block of the arena used to build the ProcessBatchV2Stream messages, reused by every message
+#define EXECUTOR_BLOCK_STREAM_ARENA_SIZE (1024*1024)
+
+class ExecutorServiceImpl;
+
+// State of a ProcessBatchV2Stream call, used to stream every block as soon as the full tracer finishes it
+class ExecutorBlockStream
+{
+public:
+    ExecutorServiceImpl * pService;
+    ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2> * pWriter;
+    ProverRequest * pProverRequest;
+    uint64_t nBlocks; // Number of streamed blocks
+    uint64_t nTxs; // Number of transactions of the streamed blocks
+    bool bFailed; // Set when a write fails, i.e. when the client is gone
+    char * pArenaBlock; // Initial block of the arena, kept when the arena is reset after every message
+    google::protobuf::Arena * pArena;
+
+    ExecutorBlockStream (ExecutorServiceImpl * pService, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2> * pWriter) :
+        pService(pService),
+        pWriter(pWriter),
+        pProverRequest(NULL),
+        nBlocks(0),
+        nTxs(0),
+        bFailed(false)
+    {
+        pArenaBlock = new char[EXECUTOR_BLOCK_STREAM_ARENA_SIZE];
+        google::protobuf::ArenaOptions options;
+        options.initial_block = pArenaBlock;
+        options.initial_block_size = EXECUTOR_BLOCK_STREAM_ARENA_SIZE;
+        pArena = new google::protobuf::Arena(options);
+    };
+    ~ExecutorBlockStream ()
+    {
+        delete pArena;
+        delete[] pArenaBlock;
+    };
+};
+
 class ExecutorServiceImpl final : public executor::v1::ExecutorService::Service
 {
     Goldilocks &fr;
@@ -74,11 +113,17 @@ public:
     ::grpc::Status ProcessBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response) override;
     ::grpc::Status ProcessStatelessBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessStatelessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response) override;
     ::grpc::Status GetFlushStatus (::grpc::ServerContext* context, const ::google::protobuf::Empty* request, ::executor::v1::GetFlushStatusResponse* response) override;
+    ::grpc::Status ProcessBatchV2Stream (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::grpc::ServerWriter< ::executor::v1::ProcessBatchResponseV2>* writer) override;
 #ifdef PROCESS_BATCH_STREAM
     ::grpc::Status ProcessBatchStream (::grpc::ServerContext* context, ::grpc::ServerReaderWriter< ::executor::v1::ProcessBatchResponse, ::executor::v1::ProcessBatchRequest>* stream) override;
 #endif    
     ::executor::v1::RomError string2error (string &errorString);
     ::executor::v1::ExecutorError zkresult2error (zkresult &result);
+    void fullTrace2proto (FullTraceV2 &fullTrace, ::executor::v1::FullTraceV2 * pFullTrace);
+    void block2proto (ProverRequest &proverRequest, Block &block, ::executor::v1::ProcessBlockResponseV2 * pProcessBlockResponse);
+    ::grpc::Status processBatchV2 (::grpc::ServerContext* context, const ::executor::v1::ProcessBatchRequestV2* request, ::executor::v1::ProcessBatchResponseV2* response, ExecutorBlockStream * pBlockStream);
+    static void onFinishBlockCallback (void *p, Block &block);
+    void streamBlock (ExecutorBlockStream &blockStream, Block &block);
 };
 
 #endif
\ No newline at end of file
@@ -120,6 +120,86 @@ zkresult HashDB::get (const string &batchUUID, const Goldilocks::Element (&root)
     return zkr;
 }
 
+zkresult HashDB::setMany (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const vector<KeyValue> &keyValues, const Persistence persistence, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_HASHDB
+    gettimeofday(&t, NULL);
+#endif
+
+#ifdef HASHDB_LOCK
+    lock_guard<recursive_mutex> guard(mlock);
+#endif
+
+    vector<SmtSetResult> *r;
+    if (results == NULL) r = new vector<SmtSetResult>;
+    else r = results;
+
+    zkresult zkr = ZKR_SUCCESS;
+
+    if (config.hashDB64)
+    {
+        r->resize(keyValues.size());
+        for (int i = 0; i < 4; i++) newRoot[i] = oldRoot[i];
+        for (uint64_t k = 0; (k < keyValues.size()) && (zkr == ZKR_SUCCESS); k++)
+        {
+            Goldilocks::Element root[4] = { newRoot[0], newRoot[1], newRoot[2], newRoot[3] };
+            zkr = stateManager64.set(batchUUID, block, tx, db64, root, keyValues[k].key, keyValues[k].value, persistence, (*r)[k], dbReadLog);
+            for (int i = 0; i < 4; i++) newRoot[i] = (*r)[k].newRoot[i];
+        }
+    }
+    else
+    {
+        zkr = smt.setMany(batchUUID, block, tx, db, oldRoot, keyValues, persistence, newRoot, *r, dbReadLog);
+    }
+
+    if (results == NULL) delete r;
+
+#ifdef LOG_TIME_STATISTICS_HASHDB
+    tms.add("setMany", TimeDiff(t));
+#endif
+
+    return zkr;
+}
+
+zkresult HashDB::getMany (const string &batchUUID, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, vector<SmtGetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_HASHDB
+    gettimeofday(&t, NULL);
+#endif
+
+#ifdef HASHDB_LOCK
+    lock_guard<recursive_mutex> guard(mlock);
+#endif
+
+    vector<SmtGetResult> *r;
+    if (results == NULL) r = new vector<SmtGetResult>;
+    else r = results;
+
+    zkresult zkr = ZKR_SUCCESS;
+
+    if (config.hashDB64)
+    {
+        r->resize(keyValues.size());
+        for (uint64_t k = 0; (k < keyValues.size()) && (zkr == ZKR_SUCCESS); k++)
+        {
+            zkr = stateManager64.get(batchUUID, db64, root, keyValues[k].key, (*r)[k], dbReadLog);
+            keyValues[k].value = (*r)[k].value;
+        }
+    }
+    else
+    {
+        zkr = smt.getMany(batchUUID, db, root, keyValues, *r, dbReadLog);
+    }
+
+    if (results == NULL) delete r;
+
+#ifdef LOG_TIME_STATISTICS_HASHDB
+    tms.add("getMany", TimeDiff(t));
+#endif
+
+    return zkr;
+}
+
 zkresult HashDB::setProgram (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_HASHDB
@@ -38,6 +38,8 @@ public:
     zkresult getLatestStateRoot (Goldilocks::Element (&stateRoot)[4]);
     zkresult set                (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog);
     zkresult get                (const string &batchUUID, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog);
+    zkresult setMany            (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const vector<KeyValue> &keyValues, const Persistence persistence, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog);
+    zkresult getMany            (const string &batchUUID, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, vector<SmtGetResult> *results, DatabaseMap *dbReadLog);
     zkresult setProgram         (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence);
     zkresult getProgram         (const string &batchUUID, const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog);
     void     loadDB             (const DatabaseMap::MTMap &inputDB, const bool persistent, const Goldilocks::Element (&stateRoot)[4]);
@@ -21,6 +21,8 @@ public:
     virtual zkresult getLatestStateRoot (Goldilocks::Element (&stateRoot)[4]) = 0;
     virtual zkresult set                (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const Goldilocks::Element (&key)[4], const mpz_class &value, const Persistence persistence, Goldilocks::Element (&newRoot)[4], SmtSetResult *result, DatabaseMap *dbReadLog) = 0;
     virtual zkresult get                (const string &batchUUID, const Goldilocks::Element (&root)[4], const Goldilocks::Element (&key)[4], mpz_class &value, SmtGetResult *result, DatabaseMap *dbReadLog) = 0;
+    virtual zkresult setMany            (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const vector<KeyValue> &keyValues, const Persistence persistence, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog) = 0;
+    virtual zkresult getMany            (const string &batchUUID, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, vector<SmtGetResult> *results, DatabaseMap *dbReadLog) = 0;
     virtual zkresult setProgram         (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence) = 0;
     virtual zkresult getProgram         (const string &batchUUID, const Goldilocks::Element (&key)[4], vector<uint8_t> &data, DatabaseMap *dbReadLog) = 0;
     virtual void     loadDB             (const DatabaseMap::MTMap &input, const bool persistentconst, const Goldilocks::Element (&stateRoot)[4]) = 0;
@@ -203,6 +203,129 @@ zkresult HashDBRemote::get (const string &batchUUID, const Goldilocks::Element (
     return static_cast<zkresult>(response.result().code());
 }
 
+zkresult HashDBRemote::setMany (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&oldRoot)[4], const vector<KeyValue> &keyValues, const Persistence persistence, Goldilocks::Element (&newRoot)[4], vector<SmtSetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    gettimeofday(&t, NULL);
+#endif
+
+    ::grpc::ClientContext context;
+    ::hashdb::v1::SetManyRequest request;
+    ::hashdb::v1::SetManyResponse response;
+
+    fea2grpc(fr, oldRoot, request.mutable_old_root());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        ::hashdb::v1::KeyValue *reqKeyValue = request.add_key_value();
+        fea2grpc(fr, keyValues[i].key, reqKeyValue->mutable_key());
+        reqKeyValue->set_value(keyValues[i].value.get_str(16));
+    }
+    request.set_persistence((hashdb::v1::Persistence)persistence);
+    request.set_details(results != NULL);
+    request.set_get_db_read_log((dbReadLog != NULL));
+    request.set_batch_uuid(batchUUID);
+    request.set_tx_index(tx);
+    request.set_block_index(block);
+
+    grpc::Status s = stub->SetMany(&context, request, &response);
+    if (s.error_code() != grpc::StatusCode::OK)
+    {
+        zklog.error("HashDBRemote::setMany() GRPC error(" + to_string(s.error_code()) + "): " + s.error_message());
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+
+    zkresult zkr = static_cast<zkresult>(response.result().code());
+    if ((zkr == ZKR_SUCCESS) && (results != NULL) && ((uint64_t)response.set_response_size() != keyValues.size()))
+    {
+        zklog.error("HashDBRemote::setMany() got " + to_string(response.set_response_size()) + " responses for " + to_string(keyValues.size()) + " keys");
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+
+    grpc2fea(fr, response.new_root(), newRoot);
+
+    if (results != NULL)
+    {
+        results->resize(response.set_response_size());
+        for (int i=0; i<response.set_response_size(); i++)
+        {
+            grpc2smtSetResult(fr, response.set_response(i), (*results)[i]);
+        }
+    }
+
+    if (dbReadLog != NULL)
+    {
+        DatabaseMap::MTMap mtMap;
+        grpc2mtMap(fr, *response.mutable_db_read_log(), mtMap);
+        dbReadLog->add(mtMap);
+    }
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    tms.add("setMany", TimeDiff(t));
+#endif
+
+    return zkr;
+}
+
+zkresult HashDBRemote::getMany (const string &batchUUID, const Goldilocks::Element (&root)[4], vector<KeyValue> &keyValues, vector<SmtGetResult> *results, DatabaseMap *dbReadLog)
+{
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    gettimeofday(&t, NULL);
+#endif
+
+    ::grpc::ClientContext context;
+    ::hashdb::v1::GetManyRequest request;
+    ::hashdb::v1::GetManyResponse response;
+
+    fea2grpc(fr, root, request.mutable_root());
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        fea2grpc(fr, keyValues[i].key, request.add_key());
+    }
+    request.set_details(results != NULL);
+    request.set_get_db_read_log((dbReadLog != NULL));
+    request.set_batch_uuid(batchUUID);
+
+    grpc::Status s = stub->GetMany(&context, request, &response);
+    if (s.error_code() != grpc::StatusCode::OK)
+    {
+        zklog.error("HashDBRemote::getMany() GRPC error(" + to_string(s.error_code()) + "): " + s.error_message());
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+
+    zkresult zkr = static_cast<zkresult>(response.result().code());
+    if ((zkr == ZKR_SUCCESS) && ((uint64_t)response.get_response_size() != keyValues.size()))
+    {
+        zklog.error("HashDBRemote::getMany() got " + to_string(response.get_response_size()) + " responses for " + to_string(keyValues.size()) + " keys");
+        return ZKR_HASHDB_GRPC_ERROR;
+    }
+
+    if (results != NULL)
+    {
+        results->resize(response.get_response_size());
+    }
+    for (int i=0; i<response.get_response_size(); i++)
+    {
+        keyValues[i].value.set_str(response.get_response(i).value(), 16);
+        if (results != NULL)
+        {
+            grpc2smtGetResult(fr, response.get_response(i), (*results)[i]);
+        }
+    }
+
+    if (dbReadLog != NULL)
+    {
+        DatabaseMap::MTMap mtMap;
+        grpc2mtMap(fr, *response.mutable_db_read_log(), mtMap);
+        dbReadLog->add(mtMap);
+    }
+
+#ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
+    tms.add("getMany", TimeDiff(t));
+#endif
+
+    return zkr;
+}
+
 zkresult HashDBRemote::setProgram (const string &batchUUID, uint64_t block, uint64_t tx, const Goldilocks::Element (&key)[4], const vector<uint8_t> &data, const Persistence persistence)
 {
 #ifdef LOG_TIME_STATISTICS_HASHDB_REMOTE
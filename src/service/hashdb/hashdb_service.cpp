@@ -303,6 +303,173 @@ using grpc::Status;
     return Status::OK;
 }
 
+::grpc::Status HashDBServiceImpl::SetMany(::grpc::ServerContext* context, const ::hashdb::v1::SetManyRequest* request, ::hashdb::v1::SetManyResponse* response)
+{
+    // If the process is exiting, do not start new activities
+    if (bExitingProcess)
+    {
+        return Status::CANCELLED;
+    }
+
+    try
+    {
+        // Get old state root
+        Goldilocks::Element oldRoot[4];
+        grpc2fea(fr, request->old_root(), oldRoot);
+
+        // Get keys and values
+        vector<KeyValue> keyValues(request->key_value_size());
+        for (int i=0; i<request->key_value_size(); i++)
+        {
+            const ::hashdb::v1::KeyValue &keyValue = request->key_value(i);
+            grpc2fea(fr, keyValue.key(), keyValues[i].key);
+            if (keyValue.value().size() > 64)
+            {
+                zklog.error("HashDBServiceImpl::SetMany() got a too big value: " + keyValue.value());
+                return Status::CANCELLED;
+            }
+            if (!stringIsHex(keyValue.value()))
+            {
+                zklog.error("HashDBServiceImpl::SetMany() got a non-hex value: " + keyValue.value());
+                return Status::CANCELLED;
+            }
+            keyValues[i].value.set_str(keyValue.value(), 16);
+        }
+
+        // Get persistence flag
+        Persistence persistence = (Persistence)request->persistence();
+
+#ifdef LOG_HASHDB_SERVICE
+        zklog.info("HashDBServiceImpl::SetMany() called. oldRoot=" + fea2string(fr, oldRoot[0], oldRoot[1], oldRoot[2], oldRoot[3]) +
+            " keys=" + to_string(keyValues.size()) +
+            " persistence=" + to_string(persistence));
+#endif
+        // Get database read log flag
+        DatabaseMap *dbReadLog = NULL;
+        if (request->get_db_read_log())
+        {
+            dbReadLog = new DatabaseMap();
+            if (dbReadLog == NULL)
+            {
+                zklog.error("HashDBServiceImpl::SetMany() failed allocating a new DatabaseMap");
+                return Status::CANCELLED;
+            }
+        }
+
+        // Call SMT set many
+        Goldilocks::Element newRoot[4];
+        vector<SmtSetResult> results;
+        zkresult zkr = pHashDB->setMany(request->batch_uuid(), request->block_index(), request->tx_index(), oldRoot, keyValues, persistence, newRoot, &results, dbReadLog);
+
+        // Return database read log
+        if (request->get_db_read_log())
+        {
+            mtMap2grpc(fr, dbReadLog->getMTDB(), response->mutable_db_read_log());
+            delete dbReadLog;
+        }
+
+        // Return new state root
+        fea2grpc(fr, newRoot, response->mutable_new_root());
+
+        // If requested, return details of every key
+        if (request->details() && (zkr == ZKR_SUCCESS))
+        {
+            for (uint64_t i=0; i<results.size(); i++)
+            {
+                smtSetResult2grpc(fr, results[i], response->add_set_response());
+            }
+        }
+
+        // Return result
+        response->mutable_result()->set_code(static_cast<::hashdb::v1::ResultCode_Code>(zkr));
+    }
+    catch (const std::exception &e)
+    {
+        zklog.error("HashDBServiceImpl::SetMany() exception: " + string(e.what()));
+        return Status::CANCELLED;
+    }
+
+    return Status::OK;
+}
+
+::grpc::Status HashDBServiceImpl::GetMany(::grpc::ServerContext* context, const ::hashdb::v1::GetManyRequest* request, ::hashdb::v1::GetManyResponse* response)
+{
+    // If the process is exiting, do not start new activities
+    if (bExitingProcess)
+    {
+        return Status::CANCELLED;
+    }
+
+    try
+    {
+        // Get state root
+        Goldilocks::Element root[4];
+        grpc2fea(fr, request->root(), root);
+
+        // Get keys
+        vector<KeyValue> keyValues(request->key_size());
+        for (int i=0; i<request->key_size(); i++)
+        {
+            grpc2fea(fr, request->key(i), keyValues[i].key);
+        }
+
+#ifdef LOG_HASHDB_SERVICE
+        zklog.info("HashDBServiceImpl::GetMany() called. root=" + fea2string(fr, root[0], root[1], root[2], root[3]) +
+            " keys=" + to_string(keyValues.size()));
+#endif
+
+        // Get database read log flag
+        DatabaseMap *dbReadLog = NULL;
+        if (request->get_db_read_log())
+        {
+            dbReadLog = new DatabaseMap();
+            if (dbReadLog == NULL)
+            {
+                zklog.error("HashDBServiceImpl::GetMany() failed allocating a new DatabaseMap");
+                return Status::CANCELLED;
+            }
+        }
+
+        // Call SMT get many
+        vector<SmtGetResult> results;
+        zkresult zkr = pHashDB->getMany(request->batch_uuid(), root, keyValues, &results, dbReadLog);
+
+        // Return database read log
+        if (request->get_db_read_log())
+        {
+            mtMap2grpc(fr, dbReadLog->getMTDB(), response->mutable_db_read_log());
+            delete dbReadLog;
+        }
+
+        // Return values, and details if requested
+        if (zkr == ZKR_SUCCESS)
+        {
+            for (uint64_t i=0; i<keyValues.size(); i++)
+            {
+                ::hashdb::v1::GetResponse *getResponse = response->add_get_response();
+                if (request->details())
+                {
+                    smtGetResult2grpc(fr, results[i], getResponse);
+                }
+                else
+                {
+                    getResponse->set_value(PrependZeros(keyValues[i].value.get_str(16), 64));
+                }
+            }
+        }
+
+        // Return result
+        response->mutable_result()->set_code(static_cast<::hashdb::v1::ResultCode_Code>(zkr));
+    }
+    catch (const std::exception &e)
+    {
+        zklog.error("HashDBServiceImpl::GetMany() exception: " + string(e.what()));
+        return Status::CANCELLED;
+    }
+
+    return Status::OK;
+}
+
 ::grpc::Status HashDBServiceImpl::SetProgram(::grpc::ServerContext* context, const ::hashdb::v1::SetProgramRequest* request, ::hashdb::v1::SetProgramResponse* response)
 {
     // If the process is exiting, do not start new activities
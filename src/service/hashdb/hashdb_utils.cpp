@@ -119,4 +119,98 @@ bool grpc2programMap (Goldilocks &fr, const ::PROTOBUF_NAMESPACE_ID::Map<string,
     return true;
 }
 
+void smtSetResult2grpc (Goldilocks &fr, const SmtSetResult &result, ::hashdb::v1::SetResponse *response)
+{
+    fea2grpc(fr, result.oldRoot, response->mutable_old_root());
+    fea2grpc(fr, result.newRoot, response->mutable_new_root());
+    fea2grpc(fr, result.key, response->mutable_key());
+    std::map<uint64_t, std::vector<Goldilocks::Element>>::const_iterator it;
+    for (it = result.siblings.begin(); it != result.siblings.end(); it++)
+    {
+        ::hashdb::v1::SiblingList list;
+        for (uint64_t i=0; i<it->second.size(); i++)
+        {
+            list.add_sibling(fr.toU64(it->second[i]));
+        }
+        (*response->mutable_siblings())[it->first] = list;
+    }
+    fea2grpc(fr, result.insKey, response->mutable_ins_key());
+    response->set_ins_value(result.insValue.get_str(16));
+    response->set_is_old0(result.isOld0);
+    response->set_old_value(result.oldValue.get_str(16));
+    response->set_new_value(result.newValue.get_str(16));
+    response->set_mode(result.mode);
+    response->set_proof_hash_counter(result.proofHashCounter);
+    fea2grpc(fr, result.siblingLeftChild, response->mutable_sibling_left_child());
+    fea2grpc(fr, result.siblingRightChild, response->mutable_sibling_right_child());
+}
+
+void grpc2smtSetResult (Goldilocks &fr, const ::hashdb::v1::SetResponse &response, SmtSetResult &result)
+{
+    grpc2fea(fr, response.old_root(), result.oldRoot);
+    grpc2fea(fr, response.new_root(), result.newRoot);
+    grpc2fea(fr, response.key(), result.key);
+    result.siblings.clear();
+    google::protobuf::Map<google::protobuf::uint64, hashdb::v1::SiblingList>::const_iterator it;
+    for (it = response.siblings().begin(); it != response.siblings().end(); it++)
+    {
+        vector<Goldilocks::Element> list;
+        for (int i=0; i<it->second.sibling_size(); i++)
+        {
+            list.push_back(fr.fromU64(it->second.sibling(i)));
+        }
+        result.siblings[it->first] = list;
+    }
+    grpc2fea(fr, response.ins_key(), result.insKey);
+    result.insValue.set_str(response.ins_value(), 16);
+    result.isOld0 = response.is_old0();
+    result.oldValue.set_str(response.old_value(), 16);
+    result.newValue.set_str(response.new_value(), 16);
+    result.mode = response.mode();
+    result.proofHashCounter = response.proof_hash_counter();
+    grpc2fea(fr, response.sibling_left_child(), result.siblingLeftChild);
+    grpc2fea(fr, response.sibling_right_child(), result.siblingRightChild);
+}
 
+void smtGetResult2grpc (Goldilocks &fr, const SmtGetResult &result, ::hashdb::v1::GetResponse *response)
+{
+    fea2grpc(fr, result.root, response->mutable_root());
+    fea2grpc(fr, result.key, response->mutable_key());
+    response->set_value(PrependZeros(result.value.get_str(16), 64));
+    std::map<uint64_t, std::vector<Goldilocks::Element>>::const_iterator it;
+    for (it = result.siblings.begin(); it != result.siblings.end(); it++)
+    {
+        ::hashdb::v1::SiblingList list;
+        for (uint64_t i=0; i<it->second.size(); i++)
+        {
+            list.add_sibling(fr.toU64(it->second[i]));
+        }
+        (*response->mutable_siblings())[it->first] = list;
+    }
+    fea2grpc(fr, result.insKey, response->mutable_ins_key());
+    response->set_ins_value(result.insValue.get_str(16));
+    response->set_is_old0(result.isOld0);
+    response->set_proof_hash_counter(result.proofHashCounter);
+}
+
+void grpc2smtGetResult (Goldilocks &fr, const ::hashdb::v1::GetResponse &response, SmtGetResult &result)
+{
+    grpc2fea(fr, response.root(), result.root);
+    grpc2fea(fr, response.key(), result.key);
+    result.value.set_str(response.value(), 16);
+    result.siblings.clear();
+    google::protobuf::Map<google::protobuf::uint64, hashdb::v1::SiblingList>::const_iterator it;
+    for (it = response.siblings().begin(); it != response.siblings().end(); it++)
+    {
+        vector<Goldilocks::Element> list;
+        for (int i=0; i<it->second.sibling_size(); i++)
+        {
+            list.push_back(fr.fromU64(it->second.sibling(i)));
+        }
+        result.siblings[it->first] = list;
+    }
+    grpc2fea(fr, response.ins_key(), result.insKey);
+    result.insValue.set_str(response.ins_value(), 16);
+    result.isOld0 = response.is_old0();
+    result.proofHashCounter = response.proof_hash_counter();
+}
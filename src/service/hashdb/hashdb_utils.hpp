@@ -5,6 +5,8 @@
 #include "goldilocks_base_field.hpp"
 #include <google/protobuf/port_def.inc>
 #include "database.hpp"
+#include "smt_set_result.hpp"
+#include "smt_get_result.hpp"
 
 using namespace std;
 
@@ -14,5 +16,9 @@ void mtMap2grpc(Goldilocks &fr, const DatabaseMap::MTMap &map, ::PROTOBUF_NAMESP
 void programMap2grpc(Goldilocks &fr, const DatabaseMap::ProgramMap &map, ::PROTOBUF_NAMESPACE_ID::Map<string, string> *grpcMap);
 bool grpc2mtMap(Goldilocks &fr, const ::PROTOBUF_NAMESPACE_ID::Map<string, ::hashdb::v1::FeList> &grpcMap, DatabaseMap::MTMap &map);
 bool grpc2programMap(Goldilocks &fr, const ::PROTOBUF_NAMESPACE_ID::Map<string, string> &grpcMap, DatabaseMap::ProgramMap &map);
+void smtSetResult2grpc(Goldilocks &fr, const SmtSetResult &result, ::hashdb::v1::SetResponse *response);
+void grpc2smtSetResult(Goldilocks &fr, const ::hashdb::v1::SetResponse &response, SmtSetResult &result);
+void smtGetResult2grpc(Goldilocks &fr, const SmtGetResult &result, ::hashdb::v1::GetResponse *response);
+void grpc2smtGetResult(Goldilocks &fr, const ::hashdb::v1::GetResponse &response, SmtGetResult &result);
 
 #endif
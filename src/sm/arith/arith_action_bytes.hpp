@@ -2,17 +2,18 @@
 #define ARITH_ACTION_BYTES_HPP
 
 #include <cstdint>
+#include "u256.hpp"
 
 class ArithActionBytes
 {
 public:
     // Original input data
-    mpz_class x1;
-    mpz_class y1;
-    mpz_class x2;
-    mpz_class y2;
-    mpz_class x3;
-    mpz_class y3;
+    U256 x1;
+    U256 y1;
+    U256 x2;
+    U256 y2;
+    U256 x3;
+    U256 y3;
     uint64_t selEq0;
     uint64_t selEq1;
     uint64_t selEq2;
@@ -4,6 +4,7 @@
 #include "utils.hpp"
 #include "scalar.hpp"
 #include "zklog.hpp"
+#include "trace_chunks.hpp"
 #include "goldilocks_precomputed.hpp"
 #include "zkglobals.hpp"
 
@@ -26,493 +27,583 @@ const uint16_t chunksPrimeSecp256k1[16] = { 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF
 const uint16_t chunksPrimeBN254[16] = { 0x3064, 0x4E72, 0xE131, 0xA029, 0xB850, 0x45B6, 0x8181, 0x585D, 
                                         0x9781, 0x6A91, 0x6871, 0xCA8D, 0x3C20, 0x8C16, 0xD87C, 0xFD47 };
 
-void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
+// Signed integers, in two's complement, wide enough for the worst intermediate values of the quotient
+// calculations, which are around 2^514
+typedef UInt<9> ArithInt;
+
+inline ArithInt arithInt (const U256 &a)
+{
+    return a.resize<9>();
+}
+
+inline ArithInt arithMul (const U256 &a, const U256 &b)
+{
+    return mul(a, b).resize<9>();
+}
+
+inline ArithInt arithPowerOfTwo (unsigned n)
+{
+    ArithInt r;
+    r.setBit(n);
+    return r;
+}
+
+// Calculates q = pq/p, truncated toward zero as the mpz_class division does; returns false if the residual is not zero
+inline bool arithDiv (const ArithInt &pq, const U256 &p, ArithInt &q)
+{
+    ArithInt magnitude = pq;
+    bool bNegative = pq.isNegative();
+    if (bNegative) magnitude.negate();
+    U256 residual;
+    divmod(magnitude, p, q, residual);
+    if (bNegative) q.negate();
+    return residual.isZero();
+}
+
+string arithInt2string (const ArithInt &a)
+{
+    ArithInt magnitude = a;
+    if (a.isNegative()) magnitude.negate();
+    mpz_class auxScalar;
+    magnitude.toScalar(auxScalar);
+    return (a.isNegative() ? "-" : "") + auxScalar.get_str(16);
+}
+
+// Splits a non-negative value into 16 chunks of 16 bits, except the last one, which can be up to 20 bits long, as scalar2ba16() does
+template <unsigned N>
+inline void uint2ba16 (uint64_t *pData, const UInt<N> &a)
+{
+    if (a.bits() > 260)
+    {
+        zklog.error("uint2ba16() run out of buffer of 16 chunks for value=" + arithInt2string(a.template resize<9>()));
+        exitProcess();
+    }
+    for (uint64_t j=0; j<15; j++)
+    {
+        pData[j] = (a.v[j/4] >> (16*(j%4))) & 0xFFFF;
+    }
+    pData[15] = (a.v[3] >> 48) | ((N > 4) ? ((a.v[N > 4 ? 4 : 3] & 0xF) << 16) : 0);
+}
+
+// Conversions between U256 and RawFec elements, which are stored in Montgomery form
+inline void u2562fec (RawFec &fec, RawFec::Element &fe, const U256 &a)
 {
+    for (uint64_t j=0; j<4; j++) fe.v[j] = a.v[j];
+    fec.toMontgomery(fe, fe);
+}
+
+inline void fec2u256 (RawFec &fec, const RawFec::Element &fe, U256 &a)
+{
+    RawFec::Element aux;
+    fec.fromMontgomery(aux, fe);
+    for (uint64_t j=0; j<4; j++) a.v[j] = aux.v[j];
+}
+
+ArithExecutor::ArithExecutor (Goldilocks &fr, const Config &config) :
+    fr(fr),
+    config(config),
+    N(PROVER_FORK_NAMESPACE::ArithCommitPols::pilDegree())
+{
+    // Calculate the prime number
+    mpz_class auxScalar;
+    fec2scalar(fec, fec.negOne(), auxScalar);
+    auxScalar++;
+    pFec.fromScalar(auxScalar);
+
     // Get a scalar with the bn254 prime
-    mpz_class pBN254;
-    pBN254.set_str(fq.toString(fq.negOne(), 16), 16);
-    pBN254++;
+    auxScalar.set_str(fq.toString(fq.negOne(), 16), 16);
+    auxScalar++;
+    pBN254.fromScalar(auxScalar);
+}
 
+TraceChunks ArithExecutor::split (vector<ArithAction> &action, uint64_t nChunks)
+{
     // Check that we have enough room in polynomials  TODO: Do this check in JS
     if (action.size()*32 > N)
     {
-        zklog.error("ArithExecutor::execute() Too many Arith entries=" + to_string(action.size()) + " > N/32=" + to_string(N/32));
+        zklog.error("ArithExecutor::split() Too many Arith entries=" + to_string(action.size()) + " > N/32=" + to_string(N/32));
         exitProcess();
     }
 
-    // Split actions into bytes
-    vector<ArithActionBytes> input;
-    for (uint64_t i=0; i<action.size(); i++)
+    // Split the actions into row ranges; every action fills 32 rows, plus the first row of the next action,
+    // where it only writes the columns that refer to the next row
+    return TraceChunks(action.size(), 32, nChunks);
+}
+
+void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols, const TraceChunks &chunks, uint64_t chunk)
+{
+    for (uint64_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
     {
-        uint64_t dataSize;
-        ArithActionBytes actionBytes;
-
-        actionBytes.x1 = action[i].x1;
-        actionBytes.y1 = action[i].y1;
-        actionBytes.x2 = action[i].x2;
-        actionBytes.y2 = action[i].y2;
-        actionBytes.x3 = action[i].x3;
-        actionBytes.y3 = action[i].y3;
-        actionBytes.selEq0 = action[i].selEq0;
-        actionBytes.selEq1 = action[i].selEq1;
-        actionBytes.selEq2 = action[i].selEq2;
-        actionBytes.selEq3 = action[i].selEq3;
-        actionBytes.selEq4 = action[i].selEq4;
-        actionBytes.selEq5 = action[i].selEq5;
-        actionBytes.selEq6 = action[i].selEq6;
-
-        dataSize = 16;
-        scalar2ba16(actionBytes._x1, dataSize, action[i].x1);
-        dataSize = 16;
-        scalar2ba16(actionBytes._y1, dataSize, action[i].y1);
-        dataSize = 16;
-        scalar2ba16(actionBytes._x2, dataSize, action[i].x2);
-        dataSize = 16;
-        scalar2ba16(actionBytes._y2, dataSize, action[i].y2);
-        dataSize = 16;
-        scalar2ba16(actionBytes._x3, dataSize, action[i].x3);
-        dataSize = 16;
-        scalar2ba16(actionBytes._y3, dataSize, action[i].y3);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq0, dataSize, action[i].selEq0);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq1, dataSize, action[i].selEq1);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq2, dataSize, action[i].selEq2);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq3, dataSize, action[i].selEq3);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq4, dataSize, action[i].selEq4);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq5, dataSize, action[i].selEq5);
-        dataSize = 16;
-        scalar2ba16(actionBytes._selEq6, dataSize, action[i].selEq6);
-
-        memset(actionBytes._s, 0, sizeof(actionBytes._s));
-        memset(actionBytes._q0, 0, sizeof(actionBytes._q0));
-        memset(actionBytes._q1, 0, sizeof(actionBytes._q1));
-        memset(actionBytes._q2, 0, sizeof(actionBytes._q2));
-
-        input.push_back(actionBytes);
+        executeAction(action[i], i, pols);
     }
+}
+
+void ArithExecutor::execute (vector<ArithAction> &action, ArithCommitPols &pols)
+{
+    TraceChunks chunks = split(action, config.executorTraceFillThreads);
 
+    // Process all the inputs, every thread filling the rows of its chunk of actions
+#pragma omp parallel for schedule(static, 1) num_threads(chunks.size())
+    for (uint64_t chunk = 0; chunk < chunks.size(); chunk++)
+    {
+        execute(action, pols, chunks, chunk);
+    }
+
+    zklog.info("ArithExecutor successfully processed " + to_string(action.size()) + " arith actions (" + to_string((double(action.size())*32*100)/N) + "%)");
+}
+
+void ArithExecutor::executeAction (const ArithAction &action, uint64_t i, ArithCommitPols &pols)
+{
+    // Split the action into bytes
+    ArithActionBytes input;
+    uint64_t dataSize;
+    input.x1.fromScalar(action.x1);
+    input.y1.fromScalar(action.y1);
+    input.x2.fromScalar(action.x2);
+    input.y2.fromScalar(action.y2);
+    input.x3.fromScalar(action.x3);
+    input.y3.fromScalar(action.y3);
+    input.selEq0 = action.selEq0;
+    input.selEq1 = action.selEq1;
+    input.selEq2 = action.selEq2;
+    input.selEq3 = action.selEq3;
+    input.selEq4 = action.selEq4;
+    input.selEq5 = action.selEq5;
+    input.selEq6 = action.selEq6;
+
+    uint2ba16(input._x1, input.x1);
+    uint2ba16(input._y1, input.y1);
+    uint2ba16(input._x2, input.x2);
+    uint2ba16(input._y2, input.y2);
+    uint2ba16(input._x3, input.x3);
+    uint2ba16(input._y3, input.y3);
+    dataSize = 16;
+    scalar2ba16(input._selEq0, dataSize, action.selEq0);
+    dataSize = 16;
+    scalar2ba16(input._selEq1, dataSize, action.selEq1);
+    dataSize = 16;
+    scalar2ba16(input._selEq2, dataSize, action.selEq2);
+    dataSize = 16;
+    scalar2ba16(input._selEq3, dataSize, action.selEq3);
+    dataSize = 16;
+    scalar2ba16(input._selEq4, dataSize, action.selEq4);
+    dataSize = 16;
+    scalar2ba16(input._selEq5, dataSize, action.selEq5);
+    dataSize = 16;
+    scalar2ba16(input._selEq6, dataSize, action.selEq6);
+
+    memset(input._s, 0, sizeof(input._s));
+    memset(input._q0, 0, sizeof(input._q0));
+    memset(input._q1, 0, sizeof(input._q1));
+    memset(input._q2, 0, sizeof(input._q2));
+
+    // Calculate s and the quotients
     RawFec::Element s;
     RawFec::Element aux1, aux2;
-    mpz_class q0, q1, q2;
-
-    // Process all the inputs
-//#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
-    for (uint64_t i = 0; i < input.size(); i++)
+    ArithInt q0, q1, q2;
+
+    // TODO: if not have x1, need to componse it
+
+    RawFec::Element x1;
+    RawFec::Element y1;
+    RawFec::Element x2;
+    RawFec::Element y2;
+    RawFec::Element x3;
+    RawFec::Element y3;
+    u2562fec(fec, x1, input.x1);
+    u2562fec(fec, y1, input.y1);
+    u2562fec(fec, x2, input.x2);
+    u2562fec(fec, y2, input.y2);
+    u2562fec(fec, x3, input.x3);
+    u2562fec(fec, y3, input.y3);
+
+    // In the following, recall that we can only work with unsiged integers of 256 bits.
+    // Therefore, as the quotient needs to be represented in our VM, we need to know
+    // the worst negative case and add an offset so that the resulting name is never negative.
+    // Then, this offset is also added in the PIL constraint to ensure the equality.
+    // Note1: Since we can choose whether the quotient is positive or negative, we choose it so
+    //        that the added offset is the lowest.
+    // Note2: x1,x2,y1,y2 can be assumed to be alias free, as this is the pre condition in the Arith SM.
+    //        I.e, x1,x2,y1,y2 ∈ [0, 2^256-1].
+    if (input.selEq1 == 1)
     {
-#ifdef LOG_BINARY_EXECUTOR
-        if (i%10000 == 0)
+        // s=(y2-y1)/(x2-x1)
+        fec.sub(aux1, y2, y1);
+        fec.sub(aux2, x2, x1);
+        if (fec.isZero(aux2))
         {
-            zklog.info("Computing binary pols " + to_string(i) + "/" + to_string(input.size()));
+            zklog.error("ArithExecutor::execute() divide by zero calculating S for input " + to_string(i));
+            exitProcess();
         }
-#endif
-        // TODO: if not have x1, need to componse it
-
-        RawFec::Element x1;
-        RawFec::Element y1;
-        RawFec::Element x2;
-        RawFec::Element y2;
-        RawFec::Element x3;
-        RawFec::Element y3;
-        scalar2fec(fec, x1, input[i].x1);
-        scalar2fec(fec, y1, input[i].y1);
-        scalar2fec(fec, x2, input[i].x2);
-        scalar2fec(fec, y2, input[i].y2);
-        scalar2fec(fec, x3, input[i].x3);
-        scalar2fec(fec, y3, input[i].y3);
-
-        // In the following, recall that we can only work with unsiged integers of 256 bits.
-        // Therefore, as the quotient needs to be represented in our VM, we need to know
-        // the worst negative case and add an offset so that the resulting name is never negative.
-        // Then, this offset is also added in the PIL constraint to ensure the equality.
-        // Note1: Since we can choose whether the quotient is positive or negative, we choose it so
-        //        that the added offset is the lowest.
-        // Note2: x1,x2,y1,y2 can be assumed to be alias free, as this is the pre condition in the Arith SM.
-        //        I.e, x1,x2,y1,y2 ∈ [0, 2^256-1].
-        if (input[i].selEq1 == 1)
-        {
-            // s=(y2-y1)/(x2-x1)
-            fec.sub(aux1, y2, y1);
-            fec.sub(aux2, x2, x1);
-            if (fec.isZero(aux2))
-            {
-                zklog.error("ArithExecutor::execute() divide by zero calculating S for input " + to_string(i));
-                exitProcess();
-            }
-            fec.div(s, aux1, aux2);
+        fec.div(s, aux1, aux2);
 
-            // Get s as a scalar
-            mpz_class sScalar;
-            fec2scalar(fec, s, sScalar);
+        // Get s as a scalar
+        U256 sScalar;
+        fec2u256(fec, s, sScalar);
+
+        // Check
+        ArithInt pq0;
+        pq0 = arithMul(sScalar, input.x2); // Worst values are {-2^256*(2^256-1),2^256*(2^256-1)}
+        pq0.sub(arithMul(sScalar, input.x1));
+        pq0.sub(arithInt(input.y2));
+        pq0.add(arithInt(input.y1));
+        if (!arithDiv(pq0, pFec, q0))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q0 the residual is not zero (diff point)");
+            exitProcess();
+        } 
+        q0.add(arithPowerOfTwo(257));
+        if(q0.isNegative())
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q0 with offset is negative (diff point). Actual value: " + arithInt2string(q0));
+            exitProcess();
+        }
+    }
+    else if (input.selEq2 == 1)
+    {
+        // s = 3*x1*x1/(y1+y1
+        fec.mul(aux1, x1, x1);
+        fec.fromUI(aux2, 3);
+        fec.mul(aux1, aux1, aux2);
+        fec.add(aux2, y1, y1);
+        fec.div(s, aux1, aux2);
 
-            // Check
-            mpz_class pq0;
-            pq0 = sScalar*input[i].x2 - sScalar*input[i].x1 - input[i].y2 + input[i].y1; // Worst values are {-2^256*(2^256-1),2^256*(2^256-1)}
-            q0 = pq0/pFec;
-            if ((pq0 - pFec*q0) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q0 the residual is not zero (diff point)");
-                exitProcess();
-            } 
-            q0 += ScalarTwoTo257;
-            if(q0 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q0 with offset is negative (diff point). Actual value: " + q0.get_str(16));
-                exitProcess();
-            }
+        // Get s as a scalar
+        U256 sScalar;
+        fec2u256(fec, s, sScalar);
+
+        // Check
+        ArithInt pq0, x1x1;
+        pq0 = arithMul(sScalar, input.y1); // Worst values are {-3*(2^256-1)**2,2*(2^256-1)**2}
+        pq0.add(pq0);                         // with |-3*(2^256-1)**2| > 2*(2^256-1)**2
+        x1x1 = arithMul(input.x1, input.x1);
+        pq0.sub(x1x1);
+        pq0.sub(x1x1);
+        pq0.sub(x1x1);
+        if (!arithDiv(pq0, pFec, q0))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q0 the residual is not zero (same point)");
+            exitProcess();
+        } 
+        q0.negate();
+        q0.add(arithPowerOfTwo(258));
+        if(q0.isNegative())
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q0 with offset is negative (same point). Actual value: " + arithInt2string(q0));
+            exitProcess();
         }
-        else if (input[i].selEq2 == 1)
+    }
+    else
+    {
+        fec.fromUI(s, 0);
+        q0 = ArithInt();
+    }
+
+    if (input.selEq3 == 1)
+    {
+        // Get s as a scalar
+        U256 sScalar;
+        fec2u256(fec, s, sScalar);
+
+        // Check q1
+        ArithInt pq1;
+        pq1 = arithMul(sScalar, sScalar); /// Worst values are {-3*(2^256-1),(2^256-1)**2}
+        pq1.sub(arithInt(input.x1));   // with (2^256-1)**2 > |-3*(2^256-1)|
+        pq1.sub(arithInt(input.x2));
+        pq1.sub(arithInt(input.x3));
+        if (!arithDiv(pq1, pFec, q1))
         {
-            // s = 3*x1*x1/(y1+y1
-            fec.mul(aux1, x1, x1);
-            fec.fromUI(aux2, 3);
-            fec.mul(aux1, aux1, aux2);
-            fec.add(aux2, y1, y1);
-            fec.div(s, aux1, aux2);
-
-            // Get s as a scalar
-            mpz_class sScalar;
-            fec2scalar(fec, s, sScalar);
-
-            // Check
-            mpz_class pq0;
-            pq0 = sScalar*2*input[i].y1 - 3*input[i].x1*input[i].x1; // Worst values are {-3*(2^256-1)**2,2*(2^256-1)**2}
-                                                                     // with |-3*(2^256-1)**2| > 2*(2^256-1)**2
-            q0 = -(pq0/pFec);
-            if ((pq0 + pFec*q0) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q0 the residual is not zero (same point)");
-                exitProcess();
-            } 
-            q0 += ScalarTwoTo258;
-            if(q0 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q0 with offset is negative (same point). Actual value: " + q0.get_str(16));
-                exitProcess();
-            }
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+            exitProcess();
         }
-        else
+        // offset 
+        q1.add(ArithInt(4)); //2**2
+        if(q1.isNegative())
         {
-            fec.fromUI(s, 0);
-            q0 = 0;
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (point addition). Actual value: " + arithInt2string(q1));
+            exitProcess();
         }
 
-        if (input[i].selEq3 == 1)
+        // Check q2
+        ArithInt pq2;
+        pq2 = arithMul(sScalar, input.x1); // Worst values are {-(2^256+1)*(2^256-1),(2^256-1)**2}
+        pq2.sub(arithMul(sScalar, input.x3)); // with |-(2^256+1)*(2^256-1)| > (2^256-1)**2
+        pq2.sub(arithInt(input.y1));
+        pq2.sub(arithInt(input.y3));
+        if (!arithDiv(pq2, pFec, q2))
         {
-            // Get s as a scalar
-            mpz_class sScalar;
-            fec2scalar(fec, s, sScalar);
-
-            // Check q1
-            mpz_class pq1;
-            pq1 = sScalar*sScalar - input[i].x1 - input[i].x2 - input[i].x3; /// Worst values are {-3*(2^256-1),(2^256-1)**2}
-                                                                             // with (2^256-1)**2 > |-3*(2^256-1)|
-            q1 = pq1/pFec;
-            if ((pq1 - pFec*q1) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
-                exitProcess();
-            }
-            // offset 
-            q1 += 4; //2**2
-            if(q1 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (point addition). Actual value: " + q1.get_str(16));
-                exitProcess();
-            }
-
-            // Check q2
-            mpz_class pq2;
-            pq2 = sScalar*input[i].x1 - sScalar*input[i].x3 - input[i].y1 - input[i].y3; // Worst values are {-(2^256+1)*(2^256-1),(2^256-1)**2}
-                                                                                         // with |-(2^256+1)*(2^256-1)| > (2^256-1)**2
-            q2 = -(pq2/pFec);
-            if ((pq2 + pFec*q2) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
-                exitProcess();
-            }
-            //offset 
-            q2 += ScalarTwoTo257;
-            if(q2 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (point addition). Actual value: " + q2.get_str(16));
-                exitProcess();
-            }
-
-        }        
-        else if (input[i].selEq4 == 1)
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+            exitProcess();
+        }
+        q2.negate();
+        //offset 
+        q2.add(arithPowerOfTwo(257));
+        if(q2.isNegative())
         {
-            // Check q1
-            mpz_class pq1;
-            pq1 = input[i].x1*input[i].x2 - input[i].y1*input[i].y2 - input[i].x3; /// Worst values are {-2^256*(2^256-1),(2^256-1)**2}
-                                                                                   // with |-2^256*(2^256-1)| > (2^256-1)**2
-            q1 = -(pq1/pBN254);
-            if ((pq1 + pBN254*q1) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
-                exitProcess();
-            }
-            // offset
-            q1 += ScalarTwoTo259;
-            if(q1 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex mul). Actual value: " + q1.get_str(16));
-                exitProcess();
-            }
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (point addition). Actual value: " + arithInt2string(q2));
+            exitProcess();
+        }
 
-            // Check q2
-            mpz_class pq2;
-            pq2 = input[i].y1*input[i].x2 + input[i].x1*input[i].y2 - input[i].y3; // Worst values are {-(2^256-1),2*(2^256-1)}
-                                                                                   // with 2*(2^256-1) > |-(2^256-1)|
-            q2 = pq2/pBN254;
-            if ((pq2 - pBN254*q2) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
-                exitProcess();
-            }
-            // offset
-            q2 += 8; //2**3
-            if(q2 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex mul). Actual value: " + q2.get_str(16));
-                exitProcess();
-            }
+    }        
+    else if (input.selEq4 == 1)
+    {
+        // Check q1
+        ArithInt pq1;
+        pq1 = arithMul(input.x1, input.x2); /// Worst values are {-2^256*(2^256-1),(2^256-1)**2}
+        pq1.sub(arithMul(input.y1, input.y2)); // with |-2^256*(2^256-1)| > (2^256-1)**2
+        pq1.sub(arithInt(input.x3));
+        if (!arithDiv(pq1, pBN254, q1))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+            exitProcess();
         }
-        else if (input[i].selEq5 == 1)
+        q1.negate();
+        // offset
+        q1.add(arithPowerOfTwo(259));
+        if(q1.isNegative())
         {
-            // Check q1
-            mpz_class pq1;
-            pq1 = input[i].x1 + input[i].x2 - input[i].x3; // Worst values are {-(2^256-1),2*(2^256-1)}
-                                                           // with 2*(2^256-1) > |-(2^256-1)|
-            q1 = pq1/pBN254;
-            if ((pq1 - pBN254*q1) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
-                exitProcess();
-            }
-            //offset
-            q1 += 8; //2**3
-            if(q1 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex add). Actual value: " + q1.get_str(16));
-                exitProcess();
-            }
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex mul). Actual value: " + arithInt2string(q1));
+            exitProcess();
+        }
 
-            // Check q2
-            mpz_class pq2;
-            pq2 = input[i].y1 + input[i].y2 - input[i].y3; // Worst values are {-(2^256-1),2*(2^256-1)}
-                                                           // with 2*(2^256-1) > |-(2^256-1)|
-            q2 = pq2/pBN254;
-            if ((pq2 - pBN254*q2) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
-                exitProcess();
-            }
-            //offset
-            q2 += 8; //2**3
-            if(q2 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex add). Actual value: " + q2.get_str(16));
-                exitProcess();
-            }
+        // Check q2
+        ArithInt pq2;
+        pq2 = arithMul(input.y1, input.x2); // Worst values are {-(2^256-1),2*(2^256-1)}
+        pq2.add(arithMul(input.x1, input.y2)); // with 2*(2^256-1) > |-(2^256-1)|
+        pq2.sub(arithInt(input.y3));
+        if (!arithDiv(pq2, pBN254, q2))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+            exitProcess();
         }
-        else if (input[i].selEq6 == 1)
+        // offset
+        q2.add(ArithInt(8)); //2**3
+        if(q2.isNegative())
         {
-            // Check q1
-            mpz_class pq1;
-            pq1 = input[i].x1 - input[i].x2 - input[i].x3; // Worst values are {-2*(2^256-1),(2^256-1)}
-                                                           // with |-2*(2^256-1)| > (2^256-1)
-            q1 = -(pq1/pBN254);
-            if ((pq1 + pBN254*q1) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
-                exitProcess();
-            }
-            //offset
-            q1 += 8; //2**3
-            if(q1 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex sub). Actual value: " + q1.get_str(16));
-                exitProcess();
-            }
-            // Check q2
-            mpz_class pq2;
-            pq2 = input[i].y1 - input[i].y2 - input[i].y3; // Worst values are {-2*(2^256-1),(2^256-1)}
-                                                           // with |-2*(2^256-1)| > (2^256-1)
-                                                           
-            q2 = -(pq2/pBN254);
-            if ((pq2 + pBN254*q2) != 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
-                exitProcess();
-            }
-            //offset
-            q2 += 8; //2**3
-            if(q2 < 0)
-            {
-                zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex sub). Actual value: " + q2.get_str(16));
-                exitProcess();
-            }
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex mul). Actual value: " + arithInt2string(q2));
+            exitProcess();
         }
-        else
+    }
+    else if (input.selEq5 == 1)
+    {
+        // Check q1
+        ArithInt pq1;
+        pq1 = arithInt(input.x1); // Worst values are {-(2^256-1),2*(2^256-1)}
+        pq1.add(arithInt(input.x2)); // with 2*(2^256-1) > |-(2^256-1)|
+        pq1.sub(arithInt(input.x3));
+        if (!arithDiv(pq1, pBN254, q1))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+            exitProcess();
+        }
+        //offset
+        q1.add(ArithInt(8)); //2**3
+        if(q1.isNegative())
         {
-            q1 = 0;
-            q2 = 0;
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex add). Actual value: " + arithInt2string(q1));
+            exitProcess();
         }
 
-        // Get s as a scalar
-        mpz_class sScalar;
-        fec2scalar(fec, s, sScalar);
-
-        uint64_t dataSize;
-        dataSize = 16;
-        scalar2ba16(input[i]._s, dataSize, sScalar);
-        dataSize = 16;
-        scalar2ba16(input[i]._q0, dataSize, q0);
-        dataSize = 16;
-        scalar2ba16(input[i]._q1, dataSize, q1);
-        dataSize = 16;
-        scalar2ba16(input[i]._q2, dataSize, q2);
+        // Check q2
+        ArithInt pq2;
+        pq2 = arithInt(input.y1); // Worst values are {-(2^256-1),2*(2^256-1)}
+        pq2.add(arithInt(input.y2)); // with 2*(2^256-1) > |-(2^256-1)|
+        pq2.sub(arithInt(input.y3));
+        if (!arithDiv(pq2, pBN254, q2))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+            exitProcess();
+        }
+        //offset
+        q2.add(ArithInt(8)); //2**3
+        if(q2.isNegative())
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex add). Actual value: " + arithInt2string(q2));
+            exitProcess();
+        }
     }
-    
-    // Process all the inputs
-//#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
-    for (uint64_t i = 0; i < input.size(); i++)
+    else if (input.selEq6 == 1)
     {
-        uint64_t offset = i*32;
-        bool xAreDifferent = false;
-        bool valueLtPrime = false;
-        for (uint64_t step=0; step<32; step++)
+        // Check q1
+        ArithInt pq1;
+        pq1 = arithInt(input.x1); // Worst values are {-2*(2^256-1),(2^256-1)}
+        pq1.sub(arithInt(input.x2)); // with |-2*(2^256-1)| > (2^256-1)
+        pq1.sub(arithInt(input.x3));
+        if (!arithDiv(pq1, pBN254, q1))
         {
-            uint64_t index = offset + step;
-            uint64_t nextIndex = (index + 1) % N;
-            uint64_t step16 = step % 16;
-            if (step16 == 0)
-            {
-                valueLtPrime = false;
-            }
-            for (uint64_t j=0; j<16; j++)
-            {
-                pols.x1[j][index] = fr.fromU64(input[i]._x1[j]);
-                pols.y1[j][index] = fr.fromU64(input[i]._y1[j]);
-                pols.x2[j][index] = fr.fromU64(input[i]._x2[j]);
-                pols.y2[j][index] = fr.fromU64(input[i]._y2[j]);
-                pols.x3[j][index] = fr.fromU64(input[i]._x3[j]);
-                pols.y3[j][index] = fr.fromU64(input[i]._y3[j]);
-                pols.s[j][index]  = fr.fromU64(input[i]._s[j]);
-                pols.q0[j][index] = fr.fromU64(input[i]._q0[j]);
-                pols.q1[j][index] = fr.fromU64(input[i]._q1[j]);
-                pols.q2[j][index] = fr.fromU64(input[i]._q2[j]);
-            }
-            pols.selEq[0][index] = fr.fromU64(input[i].selEq0);
-            pols.selEq[1][index] = fr.fromU64(input[i].selEq1);
-            pols.selEq[2][index] = fr.fromU64(input[i].selEq2);
-            pols.selEq[3][index] = fr.fromU64(input[i].selEq3);
-            pols.selEq[4][index] = fr.fromU64(input[i].selEq4);
-            pols.selEq[5][index] = fr.fromU64(input[i].selEq5);
-            pols.selEq[6][index] = fr.fromU64(input[i].selEq6);
-
-            // selEq1 (addition different points) is select need to check that points are diferent
-            if (!fr.isZero(pols.selEq[1][index]) && (step < 16))
-            {
-                if (xAreDifferent == false)
-                {
-                    Goldilocks::Element delta = fr.sub(pols.x2[step][index], pols.x1[step][index]);
-                    pols.xDeltaChunkInverse[index] = fr.isZero(delta) ? fr.zero() : glp.inv(delta);
-                    xAreDifferent = fr.isZero(delta) ? false : true;
-                }
-                pols.xAreDifferent[nextIndex] = xAreDifferent ? fr.one() : fr.zero();
-            }
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q1 the residual is not zero");
+            exitProcess();
+        }
+        q1.negate();
+        //offset
+        q1.add(ArithInt(8)); //2**3
+        if(q1.isNegative())
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q1 with offset is negative (complex sub). Actual value: " + arithInt2string(q1));
+            exitProcess();
+        }
+        // Check q2
+        ArithInt pq2;
+        pq2 = arithInt(input.y1); // Worst values are {-2*(2^256-1),(2^256-1)}
+        pq2.sub(arithInt(input.y2)); // with |-2*(2^256-1)| > (2^256-1)
+        pq2.sub(arithInt(input.y3));
+        if (!arithDiv(pq2, pBN254, q2))
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " with the calculated q2 the residual is not zero");
+            exitProcess();
+        }
+        q2.negate();
+        //offset
+        q2.add(ArithInt(8)); //2**3
+        if(q2.isNegative())
+        {
+            zklog.error("ArithExecutor::execute() For input " + to_string(i) + " the q2 with offset is negative (complex sub). Actual value: " + arithInt2string(q2));
+            exitProcess();
+        }
+    }
+    else
+    {
+        q1 = ArithInt();
+        q2 = ArithInt();
+    }
 
-            // If either selEq3,selEq4,selEq5,selEq6 is selected, we need to ensure that x3, y3 is alias free.
-            // Recall that selEq3 work over the Secp256k1 curve, and selEq4,selEq5,selEq6 work over the BN254 curve.
-            if (!fr.isZero(pols.selEq[3][index]) || !fr.isZero(pols.selEq[4][index]) || !fr.isZero(pols.selEq[5][index]) || !fr.isZero(pols.selEq[6][index]))
-            {
-                Goldilocks::Element chunkValue = step < 16 ? pols.x3[15 - step16][offset] : pols.y3[15 - step16][offset];
-                uint64_t chunkPrime = !fr.isZero(pols.selEq[3][index]) ? chunksPrimeSecp256k1[step16] : chunksPrimeBN254[step16];
+    // Get s as a scalar
+    U256 sScalar;
+    fec2u256(fec, s, sScalar);
 
-                bool chunkLtPrime = valueLtPrime ? false : (fr.toU64(chunkValue) < chunkPrime);
-                valueLtPrime = valueLtPrime || chunkLtPrime;
-                pols.chunkLtPrime[index] = chunkLtPrime ? fr.one() : fr.zero();
-                pols.valueLtPrime[nextIndex] = valueLtPrime ? fr.one() : fr.zero();
-            }
+    uint2ba16(input._s, sScalar);
+    uint2ba16(input._q0, q0);
+    uint2ba16(input._q1, q1);
+    uint2ba16(input._q2, q2);
 
-            pols.selEq[0][offset + step] = fr.fromU64(input[i].selEq0);
-            pols.selEq[1][offset + step] = fr.fromU64(input[i].selEq1);
-            pols.selEq[2][offset + step] = fr.fromU64(input[i].selEq2);
-            pols.selEq[3][offset + step] = fr.fromU64(input[i].selEq3);
-            pols.selEq[4][offset + step] = fr.fromU64(input[i].selEq4);
-            pols.selEq[5][offset + step] = fr.fromU64(input[i].selEq5);
-            pols.selEq[6][offset + step] = fr.fromU64(input[i].selEq6);
+    // Fill the 32 rows of the action
+    uint64_t offset = i*32;
+    bool xAreDifferent = false;
+    bool valueLtPrime = false;
+    for (uint64_t step=0; step<32; step++)
+    {
+        uint64_t index = offset + step;
+        uint64_t nextIndex = (index + 1) % N;
+        uint64_t step16 = step % 16;
+        if (step16 == 0)
+        {
+            valueLtPrime = false;
         }
-
-        mpz_class carry[3] = {0, 0, 0};
-        uint64_t eqIndexToCarryIndex[11] = {0, 0, 0, 1, 2, 1, 2, 1, 2, 1, 2};
-        mpz_class eq[11] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
-
-        vector<uint64_t> eqIndexes;
-        if (!fr.isZero(pols.selEq[0][offset])) eqIndexes.push_back(0);
-        if (!fr.isZero(pols.selEq[1][offset])) eqIndexes.push_back(1);
-        if (!fr.isZero(pols.selEq[2][offset])) eqIndexes.push_back(2);
-        if (!fr.isZero(pols.selEq[3][offset])) { eqIndexes.push_back(3); eqIndexes.push_back(4); }
-        if (!fr.isZero(pols.selEq[4][offset])) { eqIndexes.push_back(5); eqIndexes.push_back(6); }
-        if (!fr.isZero(pols.selEq[5][offset])) { eqIndexes.push_back(7); eqIndexes.push_back(8); }
-        if (!fr.isZero(pols.selEq[6][offset])) { eqIndexes.push_back(9); eqIndexes.push_back(10); }
-
-        mpz_class auxScalar;
-        for (uint64_t step=0; step<32; step++)
+        for (uint64_t j=0; j<16; j++)
         {
-            for (uint64_t k=0; k<eqIndexes.size(); k++)
+            pols.x1[j][index] = fr.fromU64(input._x1[j]);
+            pols.y1[j][index] = fr.fromU64(input._y1[j]);
+            pols.x2[j][index] = fr.fromU64(input._x2[j]);
+            pols.y2[j][index] = fr.fromU64(input._y2[j]);
+            pols.x3[j][index] = fr.fromU64(input._x3[j]);
+            pols.y3[j][index] = fr.fromU64(input._y3[j]);
+            pols.s[j][index]  = fr.fromU64(input._s[j]);
+            pols.q0[j][index] = fr.fromU64(input._q0[j]);
+            pols.q1[j][index] = fr.fromU64(input._q1[j]);
+            pols.q2[j][index] = fr.fromU64(input._q2[j]);
+        }
+        pols.selEq[0][index] = fr.fromU64(input.selEq0);
+        pols.selEq[1][index] = fr.fromU64(input.selEq1);
+        pols.selEq[2][index] = fr.fromU64(input.selEq2);
+        pols.selEq[3][index] = fr.fromU64(input.selEq3);
+        pols.selEq[4][index] = fr.fromU64(input.selEq4);
+        pols.selEq[5][index] = fr.fromU64(input.selEq5);
+        pols.selEq[6][index] = fr.fromU64(input.selEq6);
+
+        // selEq1 (addition different points) is select need to check that points are diferent
+        if (!fr.isZero(pols.selEq[1][index]) && (step < 16))
+        {
+            if (xAreDifferent == false)
             {
-                uint64_t eqIndex = eqIndexes[k];
-                uint64_t carryIndex = eqIndexToCarryIndex[eqIndex];
-                switch(eqIndex)
-                {
-                    case 0:  eq[eqIndex] = eq0(fr, pols, step, offset); break;
-                    case 1:  eq[eqIndex] = eq1(fr, pols, step, offset); break;
-                    case 2:  eq[eqIndex] = eq2(fr, pols, step, offset); break;
-                    case 3:  eq[eqIndex] = eq3(fr, pols, step, offset); break;
-                    case 4:  eq[eqIndex] = eq4(fr, pols, step, offset); break;
-                    case 5:  eq[eqIndex] = eq5(fr, pols, step, offset); break;
-                    case 6:  eq[eqIndex] = eq6(fr, pols, step, offset); break;
-                    case 7:  eq[eqIndex] = eq7(fr, pols, step, offset); break;
-                    case 8:  eq[eqIndex] = eq8(fr, pols, step, offset); break;
-                    case 9:  eq[eqIndex] = eq9(fr, pols, step, offset); break;
-                    case 10: eq[eqIndex] = eq10(fr, pols, step, offset); break;
-                    default:
-                        zklog.error("ArithExecutor::execute() invalid eqIndex=" + to_string(eqIndex));
-                        exitProcess();
-                }
-                pols.carry[carryIndex][offset + step] = fr.fromScalar(carry[carryIndex]);
-                if (((eq[eqIndex] + carry[carryIndex]) % ScalarTwoTo16) != 0)
-                {
-                    zklog.error("ArithExecutor::execute() For input " + to_string(i) +
-                        " eq[" + to_string(eqIndex) + "]=" + eq[eqIndex].get_str(16) +
-                        " and carry[" + to_string(carryIndex) + "]=" + carry[carryIndex].get_str(16) +
-                        " do not sum 0 mod 2 to 16");
-                    exitProcess();
-                }
-                carry[carryIndex] = (eq[eqIndex] + carry[carryIndex]) / ScalarTwoTo16;
+                Goldilocks::Element delta = fr.sub(pols.x2[step][index], pols.x1[step][index]);
+                pols.xDeltaChunkInverse[index] = fr.isZero(delta) ? fr.zero() : glp.inv(delta);
+                xAreDifferent = fr.isZero(delta) ? false : true;
             }
+            pols.xAreDifferent[nextIndex] = xAreDifferent ? fr.one() : fr.zero();
         }
 
-        if (!fr.isZero(pols.selEq[0][offset]))
+        // If either selEq3,selEq4,selEq5,selEq6 is selected, we need to ensure that x3, y3 is alias free.
+        // Recall that selEq3 work over the Secp256k1 curve, and selEq4,selEq5,selEq6 work over the BN254 curve.
+        if (!fr.isZero(pols.selEq[3][index]) || !fr.isZero(pols.selEq[4][index]) || !fr.isZero(pols.selEq[5][index]) || !fr.isZero(pols.selEq[6][index]))
         {
-            pols.resultEq0[offset + 31] = fr.one();
-        }
-        if ((!fr.isZero(pols.selEq[1][offset]) && !fr.isZero(pols.selEq[3][offset])) || !fr.isZero(pols.selEq[4][offset]) || !fr.isZero(pols.selEq[5][offset]) || !fr.isZero(pols.selEq[6][offset]))
-        {
-            pols.resultEq1[offset + 31] = fr.one();
+            Goldilocks::Element chunkValue = step < 16 ? pols.x3[15 - step16][offset] : pols.y3[15 - step16][offset];
+            uint64_t chunkPrime = !fr.isZero(pols.selEq[3][index]) ? chunksPrimeSecp256k1[step16] : chunksPrimeBN254[step16];
+
+            bool chunkLtPrime = valueLtPrime ? false : (fr.toU64(chunkValue) < chunkPrime);
+            valueLtPrime = valueLtPrime || chunkLtPrime;
+            pols.chunkLtPrime[index] = chunkLtPrime ? fr.one() : fr.zero();
+            pols.valueLtPrime[nextIndex] = valueLtPrime ? fr.one() : fr.zero();
         }
-        if (!fr.isZero(pols.selEq[2][offset]) && !fr.isZero(pols.selEq[3][offset]))
+
+        pols.selEq[0][offset + step] = fr.fromU64(input.selEq0);
+        pols.selEq[1][offset + step] = fr.fromU64(input.selEq1);
+        pols.selEq[2][offset + step] = fr.fromU64(input.selEq2);
+        pols.selEq[3][offset + step] = fr.fromU64(input.selEq3);
+        pols.selEq[4][offset + step] = fr.fromU64(input.selEq4);
+        pols.selEq[5][offset + step] = fr.fromU64(input.selEq5);
+        pols.selEq[6][offset + step] = fr.fromU64(input.selEq6);
+    }
+
+    mpz_class carry[3] = {0, 0, 0};
+    uint64_t eqIndexToCarryIndex[11] = {0, 0, 0, 1, 2, 1, 2, 1, 2, 1, 2};
+    mpz_class eq[11] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+
+    vector<uint64_t> eqIndexes;
+    if (!fr.isZero(pols.selEq[0][offset])) eqIndexes.push_back(0);
+    if (!fr.isZero(pols.selEq[1][offset])) eqIndexes.push_back(1);
+    if (!fr.isZero(pols.selEq[2][offset])) eqIndexes.push_back(2);
+    if (!fr.isZero(pols.selEq[3][offset])) { eqIndexes.push_back(3); eqIndexes.push_back(4); }
+    if (!fr.isZero(pols.selEq[4][offset])) { eqIndexes.push_back(5); eqIndexes.push_back(6); }
+    if (!fr.isZero(pols.selEq[5][offset])) { eqIndexes.push_back(7); eqIndexes.push_back(8); }
+    if (!fr.isZero(pols.selEq[6][offset])) { eqIndexes.push_back(9); eqIndexes.push_back(10); }
+
+    mpz_class auxScalar;
+    for (uint64_t step=0; step<32; step++)
+    {
+        for (uint64_t k=0; k<eqIndexes.size(); k++)
         {
-            pols.resultEq2[offset + 31] = fr.one();
+            uint64_t eqIndex = eqIndexes[k];
+            uint64_t carryIndex = eqIndexToCarryIndex[eqIndex];
+            switch(eqIndex)
+            {
+                case 0:  eq[eqIndex] = eq0(fr, pols, step, offset); break;
+                case 1:  eq[eqIndex] = eq1(fr, pols, step, offset); break;
+                case 2:  eq[eqIndex] = eq2(fr, pols, step, offset); break;
+                case 3:  eq[eqIndex] = eq3(fr, pols, step, offset); break;
+                case 4:  eq[eqIndex] = eq4(fr, pols, step, offset); break;
+                case 5:  eq[eqIndex] = eq5(fr, pols, step, offset); break;
+                case 6:  eq[eqIndex] = eq6(fr, pols, step, offset); break;
+                case 7:  eq[eqIndex] = eq7(fr, pols, step, offset); break;
+                case 8:  eq[eqIndex] = eq8(fr, pols, step, offset); break;
+                case 9:  eq[eqIndex] = eq9(fr, pols, step, offset); break;
+                case 10: eq[eqIndex] = eq10(fr, pols, step, offset); break;
+                default:
+                    zklog.error("ArithExecutor::execute() invalid eqIndex=" + to_string(eqIndex));
+                    exitProcess();
+            }
+            pols.carry[carryIndex][offset + step] = fr.fromScalar(carry[carryIndex]);
+            if (((eq[eqIndex] + carry[carryIndex]) % ScalarTwoTo16) != 0)
+            {
+                zklog.error("ArithExecutor::execute() For input " + to_string(i) +
+                    " eq[" + to_string(eqIndex) + "]=" + eq[eqIndex].get_str(16) +
+                    " and carry[" + to_string(carryIndex) + "]=" + carry[carryIndex].get_str(16) +
+                    " do not sum 0 mod 2 to 16");
+                exitProcess();
+            }
+            carry[carryIndex] = (eq[eqIndex] + carry[carryIndex]) / ScalarTwoTo16;
         }
     }
-    
-    zklog.info("ArithExecutor successfully processed " + to_string(action.size()) + " arith actions (" + to_string((double(action.size())*32*100)/N) + "%)");
-}
\ No newline at end of file
+
+    if (!fr.isZero(pols.selEq[0][offset]))
+    {
+        pols.resultEq0[offset + 31] = fr.one();
+    }
+    if ((!fr.isZero(pols.selEq[1][offset]) && !fr.isZero(pols.selEq[3][offset])) || !fr.isZero(pols.selEq[4][offset]) || !fr.isZero(pols.selEq[5][offset]) || !fr.isZero(pols.selEq[6][offset]))
+    {
+        pols.resultEq1[offset + 31] = fr.one();
+    }
+    if (!fr.isZero(pols.selEq[2][offset]) && !fr.isZero(pols.selEq[3][offset]))
+    {
+        pols.resultEq2[offset + 31] = fr.one();
+    }
+}
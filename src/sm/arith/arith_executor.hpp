@@ -9,6 +9,8 @@
 #include "ffiasm/fec.hpp"
 #include "scalar.hpp"
 #include "exit_process.hpp"
+#include "u256.hpp"
+#include "trace_chunks.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
 
@@ -19,22 +21,22 @@ private:
     RawFec fec;
     const Config &config;
     const uint64_t N;
-    mpz_class pFec;
+    U256 pFec;
+    U256 pBN254;
 
 public:
-    ArithExecutor (Goldilocks &fr, const Config &config) :
-        fr(fr),
-        config(config),
-        N(PROVER_FORK_NAMESPACE::ArithCommitPols::pilDegree())
-    {
-        // Calculate the prime number
-        fec2scalar(fec, fec.negOne(), pFec);
-        pFec++;
-    }
+    ArithExecutor (Goldilocks &fr, const Config &config);
     ~ArithExecutor ()
     {
     }
     void execute (vector<ArithAction> &action, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
+
+    // Splits the actions into nChunks chunks, that can be filled in any order and in parallel by calling execute() per chunk
+    TraceChunks split (vector<ArithAction> &action, uint64_t nChunks);
+    void execute (vector<ArithAction> &action, PROVER_FORK_NAMESPACE::ArithCommitPols &pols, const TraceChunks &chunks, uint64_t chunk);
+
+private:
+    void executeAction (const ArithAction &action, uint64_t i, PROVER_FORK_NAMESPACE::ArithCommitPols &pols);
 };
 
 #endif
\ No newline at end of file
@@ -6,6 +6,7 @@
 #include "scalar.hpp"
 #include "timer.hpp"
 #include "zklog.hpp"
+#include "trace_chunks.hpp"
 
 using json = nlohmann::json;
 
@@ -79,176 +80,179 @@ void BinaryExecutor::buildReset (void)
     TimerStopAndLog(BINARY_BUILD_RESET);
 }
 
-void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &pols)
+TraceChunks BinaryExecutor::split (vector<BinaryAction> &action, uint64_t nChunks)
 {
     // Check that we have enough room in polynomials  TODO: Do this check in JS
     if (action.size()*LATCH_SIZE > N)
     {
-        zklog.error("BinaryExecutor::execute() Too many Binary entries=" + to_string(action.size()) + " > N/LATCH_SIZE=" + to_string(N/LATCH_SIZE));
+        zklog.error("BinaryExecutor::split() Too many Binary entries=" + to_string(action.size()) + " > N/LATCH_SIZE=" + to_string(N/LATCH_SIZE));
         exitProcess();
     }
 
-    // Split actions into bytes
-    vector<BinaryActionBytes> input;
-    for (uint64_t i=0; i<action.size(); i++)
+    // Split the N/STEPS blocks of STEPS rows into ranges; the first action.size() blocks fill the actions and the rest
+    // are padding, and every block only reads its own rows, since the registers are reset at its first row, while it
+    // writes the first row of the next block, but only the columns that refer to the next row
+    return TraceChunks(N/STEPS, STEPS, nChunks);
+}
+
+void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &pols, const TraceChunks &chunks, uint64_t chunk)
+{
+    for (uint64_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
     {
-        BinaryActionBytes actionBytes;
-        scalar2bytes(action[i].a, actionBytes.a_bytes);
-        scalar2bytes(action[i].b, actionBytes.b_bytes);
-        scalar2bytes(action[i].c, actionBytes.c_bytes);
-        actionBytes.opcode = action[i].opcode;
-        actionBytes.type = action[i].type;
-        input.push_back(actionBytes);
+        if (i < action.size())
+        {
+            executeAction(action[i], i, pols);
+        }
+        else
+        {
+            executePadding(i, pols);
+        }
     }
+}
 
-    // Local array of N uint32 
-    uint32_t * c0Temp = (uint32_t *)calloc(N*sizeof(uint32_t),1);
-    if (c0Temp == NULL)
+void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &pols)
+{
+    TraceChunks chunks = split(action, config.executorTraceFillThreads);
+
+    // Process all the blocks, every thread filling the rows of its chunk
+#pragma omp parallel for schedule(static, 1) num_threads(chunks.size())
+    for (uint64_t chunk = 0; chunk < chunks.size(); chunk++)
     {
-        zklog.error("BinaryExecutor::execute() failed calling malloc() for c0Temp");
-        exitProcess();
+        execute(action, pols, chunks, chunk);
     }
 
-    // Process all the inputs
-//#pragma omp parallel for // TODO: Disabled since OMP decreases performance, probably due to cache invalidations
-    for (uint64_t i = 0; i < input.size(); i++)
-    {
+    zklog.info("BinaryExecutor successfully processed " + to_string(action.size()) + " binary actions (" + to_string((double(action.size())*LATCH_SIZE*100)/N) + "%)");
+}
+
+void BinaryExecutor::executeAction (const BinaryAction &action, uint64_t i, BinaryCommitPols &pols)
+{
 #ifdef LOG_BINARY_EXECUTOR
-        if (i%10000 == 0)
-        {
-            zklog.info("Computing binary pols " + to_string(i) + "/" + to_string(input.size()));
-        }
+    if (i%10000 == 0)
+    {
+        zklog.info("Computing binary pols " + to_string(i));
+    }
 #endif
-        
-        const uint64_t opcode = input[i].opcode;
-        uint64_t reset4 = opcode == 8 ? 1 : 0;
-        Goldilocks::Element previousAreLt4 = fr.zero();
 
-        for (uint64_t j = 0; j < STEPS; j++)
-        {
-            bool last = (j == (STEPS - 1)) ? true : false;
-            uint64_t index = i*STEPS + j;
-            pols.opcode[index] = fr.fromU64(opcode);
+    // Split the action into bytes
+    BinaryActionBytes input;
+    scalar2bytes(action.a, input.a_bytes);
+    scalar2bytes(action.b, input.b_bytes);
+    scalar2bytes(action.c, input.c_bytes);
+    input.opcode = action.opcode;
+    input.type = action.type;
 
-            Goldilocks::Element cIn = fr.zero();
-            Goldilocks::Element cOut = fr.zero();
-            bool reset = (j == 0) ? true : false;
-            bool useCarry = false;
-            uint64_t usePreviousAreLt4 = 0;
+    const uint64_t opcode = input.opcode;
+    uint64_t reset4 = opcode == 8 ? 1 : 0;
+    Goldilocks::Element previousAreLt4 = fr.zero();
 
-            for (uint64_t k = 0; k < 2; k++)
+    for (uint64_t j = 0; j < STEPS; j++)
+    {
+        bool last = (j == (STEPS - 1)) ? true : false;
+        uint64_t index = i*STEPS + j;
+        pols.opcode[index] = fr.fromU64(opcode);
+
+        Goldilocks::Element cIn = fr.zero();
+        Goldilocks::Element cOut = fr.zero();
+        bool reset = (j == 0) ? true : false;
+        bool useCarry = false;
+        uint64_t usePreviousAreLt4 = 0;
+
+        for (uint64_t k = 0; k < 2; k++)
+        {
+            cIn = (k == 0) ? (reset ? fr.zero() : pols.cIn[index]) : cOut; // At reset, cIn is zero, as set by the previous action
+
+            uint64_t byteA = input.a_bytes[j*2 + k];
+            uint64_t byteB = input.b_bytes[j*2 + k];
+            uint64_t byteC = input.c_bytes[j*2 + k];
+            bool resetByte = reset && (k == 0);
+            bool lastByte = last && (k == 1);
+            pols.freeInA[k][index] = fr.fromU64(byteA);
+            pols.freeInB[k][index] = fr.fromU64(byteB);
+            pols.freeInC[k][index] = fr.fromU64(byteC);
+
+            // ONLY forcarry, ge4 management
+            switch (opcode)
             {
-                cIn = (k == 0) ? pols.cIn[index] : cOut;
-
-                uint64_t byteA = input[i].a_bytes[j*2 + k];
-                uint64_t byteB = input[i].b_bytes[j*2 + k];
-                uint64_t byteC = input[i].c_bytes[j*2 + k];
-                bool resetByte = reset && (k == 0);
-                bool lastByte = last && (k == 1);
-                pols.freeInA[k][index] = fr.fromU64(byteA);
-                pols.freeInB[k][index] = fr.fromU64(byteB);
-                pols.freeInC[k][index] = fr.fromU64(byteC);
-
-                // ONLY forcarry, ge4 management
-                switch (opcode)
+                // ADD   (OPCODE = 0)
+                case 0:
+                {
+                    uint64_t sum = byteA + byteB + fr.toU64(cIn);
+                    cOut = fr.fromU64(sum >> 8);
+                    break;
+                }
+                // SUB   (OPCODE = 1)
+                case 1:
                 {
-                    // ADD   (OPCODE = 0)
-                    case 0:
+                    if ((int64_t)byteA - (int64_t)fr.toU64(cIn) >= (int64_t)byteB)
                     {
-                        uint64_t sum = byteA + byteB + fr.toU64(cIn);
-                        cOut = fr.fromU64(sum >> 8);
-                        break;
+                        cOut = fr.zero();
                     }
-                    // SUB   (OPCODE = 1)
-                    case 1:
+                    else
                     {
-                        if ((int64_t)byteA - (int64_t)fr.toU64(cIn) >= (int64_t)byteB)
-                        {
-                            cOut = fr.zero();
-                        }
-                        else
-                        {
-                            cOut = fr.one();
-                        }
-                        break;
+                        cOut = fr.one();
                     }
-                    // LT    (OPCODE = 2)
-                    case 2: 
-                    // LT4   (OPTCODE = 8)
-                    case 8:
+                    break;
+                }
+                // LT    (OPCODE = 2)
+                case 2: 
+                // LT4   (OPTCODE = 8)
+                case 8:
+                {
+                    if (resetByte)
                     {
-                        if (resetByte)
-                        {
-                            pols.freeInC[0][index] = fr.fromU64(input[i].c_bytes[STEPS-1]); // Only change the freeInC when reset or Last
-                        }
-                        
-                        if (byteA < byteB)
-                        {
-                            cOut = fr.one();
-                        }
-                        else if (byteA == byteB)
-                        {
-                            cOut = cIn;
-                        }
-                        else
-                        {
-                            cOut = fr.zero();
-                        }
+                        pols.freeInC[0][index] = fr.fromU64(input.c_bytes[STEPS-1]); // Only change the freeInC when reset or Last
+                    }
+                
+                    if (byteA < byteB)
+                    {
+                        cOut = fr.one();
+                    }
+                    else if (byteA == byteB)
+                    {
+                        cOut = cIn;
+                    }
+                    else
+                    {
+                        cOut = fr.zero();
+                    }
 
-                        if (lastByte)
-                        {
-                            if(opcode == 2 || cOut == fr.zero()){
-                                useCarry = true;
-                                pols.freeInC[1][index] = fr.fromU64(input[i].c_bytes[0]);
-                            } else {
-                                usePreviousAreLt4 = 1;
-                                // SPECIAL CASE: using a runtime value previousAreLt4, but lookup table was static, means in
-                                // this case put expected value, because when rebuild c using correctly previousAreLt4 no freeInC.
-                                pols.freeInC[1][index] = cOut;
-                            }
+                    if (lastByte)
+                    {
+                        if(opcode == 2 || cOut == fr.zero()){
+                            useCarry = true;
+                            pols.freeInC[1][index] = fr.fromU64(input.c_bytes[0]);
+                        } else {
+                            usePreviousAreLt4 = 1;
+                            // SPECIAL CASE: using a runtime value previousAreLt4, but lookup table was static, means in
+                            // this case put expected value, because when rebuild c using correctly previousAreLt4 no freeInC.
+                            pols.freeInC[1][index] = cOut;
                         }
-                        break;
                     }
-                    // SLT    (OPCODE = 3)
-                    case 3:
+                    break;
+                }
+                // SLT    (OPCODE = 3)
+                case 3:
+                {
+                    useCarry = last;
+                    if (resetByte)
                     {
-                        useCarry = last;
-                        if (resetByte)
+                        pols.freeInC[0][index] = fr.fromU64(input.c_bytes[STEPS-1]);  // Only change the freeInC when reset or Last
+                    }
+                    if (lastByte)
+                    {
+                        uint64_t sig_a = byteA >> 7;
+                        uint64_t sig_b = byteB >> 7;
+                        // A Negative ; B Positive
+                        if (sig_a > sig_b)
                         {
-                            pols.freeInC[0][index] = fr.fromU64(input[i].c_bytes[STEPS-1]);  // Only change the freeInC when reset or Last
+                            cOut = fr.one();
                         }
-                        if (lastByte)
+                        // A Positive ; B Negative
+                        else if (sig_a < sig_b)
                         {
-                            uint64_t sig_a = byteA >> 7;
-                            uint64_t sig_b = byteB >> 7;
-                            // A Negative ; B Positive
-                            if (sig_a > sig_b)
-                            {
-                                cOut = fr.one();
-                            }
-                            // A Positive ; B Negative
-                            else if (sig_a < sig_b)
-                            {
-                                cOut = fr.zero();
-                            }
-                            // A and B equals
-                            else
-                            {
-                                if (byteA < byteB)
-                                {
-                                    cOut = fr.one();
-                                }
-                                else if (byteA == byteB)
-                                {
-                                    cOut = cIn;
-                                }
-                                else
-                                {
-                                    cOut = fr.zero();
-                                }
-                            }
-                            pols.freeInC[k][index] = fr.fromU64(input[i].c_bytes[0]); // Only change the freeInC when reset or Last
+                            cOut = fr.zero();
                         }
+                        // A and B equals
                         else
                         {
                             if (byteA < byteB)
@@ -264,147 +268,162 @@ void BinaryExecutor::execute (vector<BinaryAction> &action, BinaryCommitPols &po
                                 cOut = fr.zero();
                             }
                         }
-                        break;
+                        pols.freeInC[k][index] = fr.fromU64(input.c_bytes[0]); // Only change the freeInC when reset or Last
                     }
-                    // EQ    (OPCODE = 4)
-                    case 4:
+                    else
                     {
-                        if (resetByte)
+                        if (byteA < byteB)
                         {
-                            // cIn = 1n
-                            // pols.cIn[index] = 1n;
-                            pols.freeInC[k][index] = fr.fromU64(input[i].c_bytes[STEPS-1]);
+                            cOut = fr.one();
                         }
-
-                        if ( (byteA == byteB) && fr.isZero(cIn) )
+                        else if (byteA == byteB)
                         {
-                            cOut = fr.zero();
+                            cOut = cIn;
                         }
                         else
                         {
-                            cOut = fr.one();
-                        }
-
-                        if (lastByte)
-                        {
-                            useCarry = true;
-                            cOut = fr.isZero(cOut)? fr.one() : fr.zero();
-                            pols.freeInC[k][index] = fr.fromU64(input[i].c_bytes[0]); // Only change the freeInC when reset or Last
+                            cOut = fr.zero();
                         }
-                        
-                        break;
                     }
-                    // AND    (OPCODE = 5)
-                    case 5:
+                    break;
+                }
+                // EQ    (OPCODE = 4)
+                case 4:
+                {
+                    if (resetByte)
                     {
-                        // setting carry if result of AND was non zero
-                        if ( (byteC == 0) && fr.isZero(cIn) )
-                        {
-                            cOut = fr.zero();
-                        }
-                        else
-                        {
-                            cOut = fr.one();
-                        }
-                        break;
+                        // cIn = 1n
+                        // pols.cIn[index] = 1n;
+                        pols.freeInC[k][index] = fr.fromU64(input.c_bytes[STEPS-1]);
                     }
-                    default:
+
+                    if ( (byteA == byteB) && fr.isZero(cIn) )
                     {
-                        cIn = fr.zero();
                         cOut = fr.zero();
-                        break;
                     }
-                }
+                    else
+                    {
+                        cOut = fr.one();
+                    }
 
-                // setting carries
-                if (k == 0)
+                    if (lastByte)
+                    {
+                        useCarry = true;
+                        cOut = fr.isZero(cOut)? fr.one() : fr.zero();
+                        pols.freeInC[k][index] = fr.fromU64(input.c_bytes[0]); // Only change the freeInC when reset or Last
+                    }
+                
+                    break;
+                }
+                // AND    (OPCODE = 5)
+                case 5:
                 {
-                    pols.cMiddle[index] = cOut;
+                    // setting carry if result of AND was non zero
+                    if ( (byteC == 0) && fr.isZero(cIn) )
+                    {
+                        cOut = fr.zero();
+                    }
+                    else
+                    {
+                        cOut = fr.one();
+                    }
+                    break;
                 }
-                else
+                default:
                 {
-                    pols.cOut[index] = cOut;
+                    cIn = fr.zero();
+                    cOut = fr.zero();
+                    break;
                 }
             }
-            if( j % 16 == 3){
-                previousAreLt4 = cOut;
-            } else if ( j % 16 ==7 || j % 16 == 11){
-                previousAreLt4 = previousAreLt4 * cOut;
-            }
-
-            pols.useCarry[index] = useCarry ? fr.one() : fr.zero();
-            pols.usePreviousAreLt4[index] = fr.fromU64(usePreviousAreLt4);
-            pols.reset4[index] = fr.fromU64(reset4);
-
-            uint64_t nextIndex = (index + 1) % N;
-            bool nextReset = (nextIndex % STEPS) == 0 ? true : false;
 
-            pols.previousAreLt4[nextIndex] = previousAreLt4;
-
-            // We can set the cIn and the LCin when RESET =1
-            if (nextReset)
+            // setting carries
+            if (k == 0)
             {
-                pols.cIn[nextIndex] = fr.zero();
+                pols.cMiddle[index] = cOut;
             }
             else
             {
-                pols.cIn[nextIndex] = (reset4 == 1 && (index % 4) == 3) ? fr.zero() : pols.cOut[index];
+                pols.cOut[index] = cOut;
             }
-            pols.lCout[nextIndex] = usePreviousAreLt4 ? previousAreLt4 : pols.cOut[index];
-            pols.lOpcode[nextIndex] = pols.opcode[index];
+        }
+        if( j % 16 == 3){
+            previousAreLt4 = cOut;
+        } else if ( j % 16 ==7 || j % 16 == 11){
+            previousAreLt4 = previousAreLt4 * cOut;
+        }
+
+        pols.useCarry[index] = useCarry ? fr.one() : fr.zero();
+        pols.usePreviousAreLt4[index] = fr.fromU64(usePreviousAreLt4);
+        pols.reset4[index] = fr.fromU64(reset4);
 
-            pols.a[0][nextIndex] = fr.fromU64( fr.toU64(pols.a[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInA[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInA[1][index])*FACTOR[0][index] );
-            pols.b[0][nextIndex] = fr.fromU64( fr.toU64(pols.b[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInB[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInB[1][index])*FACTOR[0][index] );
+        uint64_t nextIndex = (index + 1) % N;
+        bool nextReset = (nextIndex % STEPS) == 0 ? true : false;
 
-            c0Temp[index] = fr.toU64(pols.c[0][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInC[1][index])*FACTOR[0][index];
-            pols.c[0][nextIndex] = (!fr.isZero(pols.useCarry[index])) ? pols.cOut[index] : (pols.usePreviousAreLt4[index] == fr.one() ? pols.previousAreLt4[index] : fr.fromU64(c0Temp[index]));
+        pols.previousAreLt4[nextIndex] = previousAreLt4;
 
-            for (uint64_t k = 1; k < REGISTERS_NUM; k++)
-            {
-                pols.a[k][nextIndex] = fr.fromU64( fr.toU64(pols.a[k][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInA[0][index])*FACTOR[k][index] + 256*fr.toU64(pols.freeInA[1][index])*FACTOR[k][index] );
-                pols.b[k][nextIndex] = fr.fromU64( fr.toU64(pols.b[k][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInB[0][index])*FACTOR[k][index] + 256*fr.toU64(pols.freeInB[1][index])*FACTOR[k][index] );
-                if (last && (useCarry || usePreviousAreLt4))
-                {
-                    pols.c[k][nextIndex] = fr.zero();
-                }
-                else
-                {
-                    pols.c[k][nextIndex] = fr.fromU64( fr.toU64(pols.c[k][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index])*FACTOR[k][index] + 256*fr.toU64(pols.freeInC[1][index])*FACTOR[k][index] );
-                }
-            }
+        // We can set the cIn and the LCin when RESET =1
+        if (nextReset)
+        {
+            pols.cIn[nextIndex] = fr.zero();
         }
-
-        if (input[i].type == 1)
+        else
         {
-            pols.resultBinOp[((i+1) * STEPS)%N] = fr.one();
+            pols.cIn[nextIndex] = (reset4 == 1 && (index % 4) == 3) ? fr.zero() : pols.cOut[index];
         }
-        if (input[i].type == 2)
+        pols.lCout[nextIndex] = usePreviousAreLt4 ? previousAreLt4 : pols.cOut[index];
+        pols.lOpcode[nextIndex] = pols.opcode[index];
+
+        pols.a[0][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.a[0][index])) + fr.toU64(pols.freeInA[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInA[1][index])*FACTOR[0][index] );
+        pols.b[0][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.b[0][index])) + fr.toU64(pols.freeInB[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInB[1][index])*FACTOR[0][index] );
+
+        uint32_t c0Temp = (reset ? 0 : fr.toU64(pols.c[0][index])) + fr.toU64(pols.freeInC[0][index])*FACTOR[0][index] + 256*fr.toU64(pols.freeInC[1][index])*FACTOR[0][index];
+        pols.c[0][nextIndex] = (!fr.isZero(pols.useCarry[index])) ? pols.cOut[index] : (pols.usePreviousAreLt4[index] == fr.one() ? pols.previousAreLt4[index] : fr.fromU64(c0Temp));
+
+        for (uint64_t k = 1; k < REGISTERS_NUM; k++)
         {
-            pols.resultValidRange [((i+1) * STEPS)%N] = fr.one();
+            pols.a[k][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.a[k][index])) + fr.toU64(pols.freeInA[0][index])*FACTOR[k][index] + 256*fr.toU64(pols.freeInA[1][index])*FACTOR[k][index] );
+            pols.b[k][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.b[k][index])) + fr.toU64(pols.freeInB[0][index])*FACTOR[k][index] + 256*fr.toU64(pols.freeInB[1][index])*FACTOR[k][index] );
+            if (last && (useCarry || usePreviousAreLt4))
+            {
+                pols.c[k][nextIndex] = fr.zero();
+            }
+            else
+            {
+                pols.c[k][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.c[k][index])) + fr.toU64(pols.freeInC[0][index])*FACTOR[k][index] + 256*fr.toU64(pols.freeInC[1][index])*FACTOR[k][index] );
+            }
         }
     }
 
-    for (uint64_t index = input.size()*STEPS; index < N; index++)
+    if (input.type == 1)
+    {
+        pols.resultBinOp[((i+1) * STEPS)%N] = fr.one();
+    }
+    if (input.type == 2)
+    {
+        pols.resultValidRange [((i+1) * STEPS)%N] = fr.one();
+    }
+}
+
+void BinaryExecutor::executePadding (uint64_t i, BinaryCommitPols &pols)
+{
+    for (uint64_t index = i*STEPS; index < (i + 1)*STEPS; index++)
     {
         uint64_t nextIndex = (index + 1) % N;
         bool reset = (index % STEPS) == 0 ? true : false;
-        pols.a[0][nextIndex] = fr.fromU64( fr.toU64(pols.a[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInA[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInA[1][index]) * FACTOR[0][index] );
-        pols.b[0][nextIndex] = fr.fromU64( fr.toU64(pols.b[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInB[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInB[1][index]) * FACTOR[0][index] );
+        pols.a[0][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.a[0][index])) + fr.toU64(pols.freeInA[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInA[1][index]) * FACTOR[0][index] );
+        pols.b[0][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.b[0][index])) + fr.toU64(pols.freeInB[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInB[1][index]) * FACTOR[0][index] );
 
-        c0Temp[index] = fr.toU64(pols.c[0][index]) * (reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInC[1][index]) * FACTOR[0][index];
-        pols.c[0][nextIndex] = fr.fromU64( fr.toU64(pols.useCarry[index]) * (fr.toU64(pols.cOut[index]) - c0Temp[index]) + c0Temp[index] );
+        uint32_t c0Temp = (reset ? 0 : fr.toU64(pols.c[0][index])) + fr.toU64(pols.freeInC[0][index]) * FACTOR[0][index] + 256 * fr.toU64(pols.freeInC[1][index]) * FACTOR[0][index];
+        pols.c[0][nextIndex] = fr.fromU64( fr.toU64(pols.useCarry[index]) * (fr.toU64(pols.cOut[index]) - c0Temp) + c0Temp );
 
         for (uint64_t j = 1; j < REGISTERS_NUM; j++)
         {
-            pols.a[j][nextIndex] = fr.fromU64( fr.toU64(pols.a[j][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInA[0][index]) * FACTOR[j][index] + 256 * fr.toU64(pols.freeInA[1][index]) * FACTOR[j][index] );
-            pols.b[j][nextIndex] = fr.fromU64( fr.toU64(pols.b[j][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInB[0][index]) * FACTOR[j][index] + 256 * fr.toU64(pols.freeInB[1][index]) * FACTOR[j][index] );
-            pols.c[j][nextIndex] = fr.fromU64( fr.toU64(pols.c[j][index])*(reset ? 0 : 1) + fr.toU64(pols.freeInC[0][index]) * FACTOR[j][index] + 256 * fr.toU64(pols.freeInC[1][index]) * FACTOR[j][index] );
+            pols.a[j][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.a[j][index])) + fr.toU64(pols.freeInA[0][index]) * FACTOR[j][index] + 256 * fr.toU64(pols.freeInA[1][index]) * FACTOR[j][index] );
+            pols.b[j][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.b[j][index])) + fr.toU64(pols.freeInB[0][index]) * FACTOR[j][index] + 256 * fr.toU64(pols.freeInB[1][index]) * FACTOR[j][index] );
+            pols.c[j][nextIndex] = fr.fromU64( (reset ? 0 : fr.toU64(pols.c[j][index])) + fr.toU64(pols.freeInC[0][index]) * FACTOR[j][index] + 256 * fr.toU64(pols.freeInC[1][index]) * FACTOR[j][index] );
         }
     }
-
-    free(c0Temp);
-
-    zklog.info("BinaryExecutor successfully processed " + to_string(action.size()) + " binary actions (" + to_string((double(action.size())*LATCH_SIZE*100)/N) + "%)");
 }
 
 // To be used only for testing, since it allocates a lot of memory
@@ -6,6 +6,7 @@
 #include "goldilocks_base_field.hpp"
 #include "binary_action.hpp"
 #include "utils.hpp"
+#include "trace_chunks.hpp"
 #include "sm/pols_generated/commit_pols.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
@@ -24,11 +25,17 @@ public:
     
     void execute (vector<BinaryAction> &action, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
 
+    // Splits the rows into nChunks chunks, that can be filled in any order and in parallel by calling execute() per chunk
+    TraceChunks split (vector<BinaryAction> &action, uint64_t nChunks);
+    void execute (vector<BinaryAction> &action, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols, const TraceChunks &chunks, uint64_t chunk);
+
     void execute (vector<BinaryAction> &action); // Only for testing purposes
 
 private:
     void buildFactors (void);
     void buildReset (void);
+    void executeAction (const BinaryAction &action, uint64_t i, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
+    void executePadding (uint64_t i, PROVER_FORK_NAMESPACE::BinaryCommitPols &pols);
 };
 
 #endif
\ No newline at end of file
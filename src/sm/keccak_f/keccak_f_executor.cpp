@@ -124,16 +124,14 @@ void KeccakFExecutor::loadScript(json j)
     bLoaded = true;
 }
 
-/* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
-void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols)
+TraceChunks KeccakFExecutor::split (const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols, uint64_t nChunks)
 {
     zkassertpermanent(bLoaded);
-    const uint64_t keccakMask = 0xFFFFFFFFFFF;
 
     // Check input size
     if (input.size() != numberOfSlots)
     {
-        zklog.error("KeccakFExecutor::execute() got input.size()=" + to_string(input.size()) + " different from numberOfSlots=" + to_string(numberOfSlots));
+        zklog.error("KeccakFExecutor::split() got input.size()=" + to_string(input.size()) + " different from numberOfSlots=" + to_string(numberOfSlots));
         exitProcess();
     }
 
@@ -142,7 +140,7 @@ void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input,
     {
         if (input[i].size() != 1600)
         {
-            zklog.error("KeccakFExecutor::execute() got input i=" + to_string(i) + " size=" + to_string(input[i].size()) + " different from 1600");
+            zklog.error("KeccakFExecutor::split() got input i=" + to_string(i) + " size=" + to_string(input[i].size()) + " different from 1600");
             exitProcess();
         }
     }
@@ -155,19 +153,23 @@ void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input,
         pols.c[i][KeccakGateConfig.zeroRef] = fr.fromU64(fr.toU64(pols.a[i][KeccakGateConfig.zeroRef]) ^ fr.toU64(pols.b[i][KeccakGateConfig.zeroRef]));
     }
 
-    // Set Sin values
-    for (uint64_t slot = 0; slot < numberOfSlots; slot++)
+    // Every slot only reads its own gates and the zeroRef gate, so the slots are split into ranges of at least one slot
+    return TraceChunks(numberOfSlots, KeccakGateConfig.slotSize, nChunks, 1);
+}
+
+void KeccakFExecutor::execute (const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols, const TraceChunks &chunks, uint64_t chunk)
+{
+    const uint64_t keccakMask = 0xFFFFFFFFFFF;
+
+    for (uint64_t slot = chunks.begin(chunk); slot < chunks.end(chunk); slot++)
     {
+        // Set Sin values
         for (uint64_t i = 0; i < 1600; i++)
         {
             setPol(pols.a, KeccakGateConfig.relRef2AbsRef(KeccakGateConfig.sinRef0 + i * 44, slot), fr.toU64(input[slot][i]));
         }
-    }
 
-    // Execute the program
-#pragma omp parallel for
-    for (uint64_t slot = 0; slot < numberOfSlots; slot++)
-    {
+        // Execute the program
         for (uint64_t i = 0; i < program.size(); i++)
         {
             uint64_t absRefa = KeccakGateConfig.relRef2AbsRef(program[i].refa, slot);
@@ -225,6 +227,18 @@ void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input,
             }
         }
     }
+}
+
+/* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
+void KeccakFExecutor::execute(const vector<vector<Goldilocks::Element>> &input, KeccakFCommitPols &pols)
+{
+    TraceChunks chunks = split(input, pols, config.executorTraceFillThreads);
+
+#pragma omp parallel for schedule(static, 1) num_threads(chunks.size())
+    for (uint64_t chunk = 0; chunk < chunks.size(); chunk++)
+    {
+        execute(input, pols, chunks, chunk);
+    }
 
     zklog.info("KeccakFExecutor successfully processed " + to_string(numberOfSlots) + " Keccak-F actions (" + to_string((double(input.size()) * KeccakGateConfig.slotSize * 100) / N) + "%)");
 }
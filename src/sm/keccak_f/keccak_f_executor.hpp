@@ -10,6 +10,7 @@
 #include "timer.hpp"
 #include "gate_state.hpp"
 #include "keccak.hpp"
+#include "trace_chunks.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
 
@@ -69,6 +70,11 @@ public:
     /* Input is a vector of numberOfSlots*1600 fe, output is KeccakPols */
     void execute (const vector<vector<Goldilocks::Element>> &input, PROVER_FORK_NAMESPACE::KeccakFCommitPols &pols);
 
+    /* Checks the input, sets the zeroRef gate, and splits the slots into nChunks chunks, that can be executed in any
+       order and in parallel by calling execute() per chunk */
+    TraceChunks split (const vector<vector<Goldilocks::Element>> &input, PROVER_FORK_NAMESPACE::KeccakFCommitPols &pols, uint64_t nChunks);
+    void execute (const vector<vector<Goldilocks::Element>> &input, PROVER_FORK_NAMESPACE::KeccakFCommitPols &pols, const TraceChunks &chunks, uint64_t chunk);
+
     void setPol (PROVER_FORK_NAMESPACE::CommitPol (&pol)[4], uint64_t index, uint64_t value);
     uint64_t getPol (PROVER_FORK_NAMESPACE::CommitPol (&pol)[4], uint64_t index);
 
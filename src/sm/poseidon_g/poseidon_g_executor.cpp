@@ -121,184 +121,131 @@ void PoseidonGExecutor::execute (   vector<array<Goldilocks::Element, 17>> &inpu
         exitProcess();
     }
 
-    uint64_t p = 0;
-    uint64_t pDone = 0;
+    // Every hash takes nRoundsF + nRoundsP + 1 rows, and the hashes are placed in order (main, padding, storage),
+    // so the first row of every hash is known in advance and all of them can be computed in parallel
+    const uint64_t rowsPerHash = nRoundsF + nRoundsP + 1;
 
-    vector<array<Goldilocks::Element, 17>> * input = NULL;
-    uint64_t sizeIn=0;
-
-    for(int k=0; k<3; k++){
-        
+#pragma omp parallel for schedule(static)
+    for (uint64_t h=0; h<size; h++)
+    {
         //Select input
-        if(k==0){
+        uint64_t k, i;
+        vector<array<Goldilocks::Element, 17>> * input = NULL;
+        if (h < sizeMain)
+        {
             input = &inputMain;
-            sizeIn = sizeMain;
-        } else if(k==1){
+            k = 0;
+            i = h;
+        }
+        else if (h < sizeMain + sizePadding)
+        {
             input = &inputPadding;
-            sizeIn = sizePadding;
-        } else if(k==2){
-            input = &inputStorage;
-            sizeIn = sizeStorage;
+            k = 1;
+            i = h - sizeMain;
         }
-        
-        //Execute
-        for (uint64_t i=0; i<sizeIn; i++)
+        else
         {
-            
-            pols.in0[p] = (*input)[i][0];
-            pols.in1[p] = (*input)[i][1];
-            pols.in2[p] = (*input)[i][2];
-            pols.in3[p] = (*input)[i][3];
-            pols.in4[p] = (*input)[i][4];
-            pols.in5[p] = (*input)[i][5];
-            pols.in6[p] = (*input)[i][6];
-            pols.in7[p] = (*input)[i][7];
-            pols.hashType[p] = (*input)[i][8];
-            pols.cap1[p] = (*input)[i][9];
-            pols.cap2[p] = (*input)[i][10];
-            pols.cap3[p] = (*input)[i][11];
-            pols.hash0[p] = (*input)[i][12];
-            pols.hash1[p] = (*input)[i][13];
-            pols.hash2[p] = (*input)[i][14];
-            pols.hash3[p] = (*input)[i][15];
-            uint64_t permutation = fr.toU64((*input)[i][16]);
-            switch (permutation)
-            {
-                case POSEIDONG_PERMUTATION1_ID:
-                    pols.result1[p] = fr.one();
-                    break;
-                case POSEIDONG_PERMUTATION2_ID:
-                    pols.result2[p] = fr.one();
-                    break;
-                case POSEIDONG_PERMUTATION3_ID:
-                    pols.result3[p] = fr.one();
-                    break;
-                case POSEIDONG_PERMUTATION4_ID:
-                    // pols.result4[p] = fr.one();
-                    break;
-                default:
-                    zklog.error("PoseidonGExecutor::execute() got an invalid permutation=" + to_string(permutation) + " at input k=" + to_string(k) + " i=" + to_string(i));
-                    exitProcess();
-                    break;
-            }
+            input = &inputStorage;
+            k = 2;
+            i = h - sizeMain - sizePadding;
+        }
+
+        uint64_t p = h*rowsPerHash;
 
-            p += 1;
-            
-            array<Goldilocks::Element,12> state= {
-                pols.in0[p-1], 
-                pols.in1[p-1], 
-                pols.in2[p-1], 
-                pols.in3[p-1], 
-                pols.in4[p-1], 
-                pols.in5[p-1], 
-                pols.in6[p-1], 
-                pols.in7[p-1], 
-                pols.hashType[p-1], 
-                pols.cap1[p-1], 
-                pols.cap2[p-1], 
-                pols.cap3[p-1] };
+        pols.in0[p] = (*input)[i][0];
+        pols.in1[p] = (*input)[i][1];
+        pols.in2[p] = (*input)[i][2];
+        pols.in3[p] = (*input)[i][3];
+        pols.in4[p] = (*input)[i][4];
+        pols.in5[p] = (*input)[i][5];
+        pols.in6[p] = (*input)[i][6];
+        pols.in7[p] = (*input)[i][7];
+        pols.hashType[p] = (*input)[i][8];
+        pols.cap1[p] = (*input)[i][9];
+        pols.cap2[p] = (*input)[i][10];
+        pols.cap3[p] = (*input)[i][11];
+        pols.hash0[p] = (*input)[i][12];
+        pols.hash1[p] = (*input)[i][13];
+        pols.hash2[p] = (*input)[i][14];
+        pols.hash3[p] = (*input)[i][15];
+        uint64_t permutation = fr.toU64((*input)[i][16]);
+        switch (permutation)
+        {
+            case POSEIDONG_PERMUTATION1_ID:
+                pols.result1[p] = fr.one();
+                break;
+            case POSEIDONG_PERMUTATION2_ID:
+                pols.result2[p] = fr.one();
+                break;
+            case POSEIDONG_PERMUTATION3_ID:
+                pols.result3[p] = fr.one();
+                break;
+            case POSEIDONG_PERMUTATION4_ID:
+                // pols.result4[p] = fr.one();
+                break;
+            default:
+                zklog.error("PoseidonGExecutor::execute() got an invalid permutation=" + to_string(permutation) + " at input k=" + to_string(k) + " i=" + to_string(i));
+                exitProcess();
+                break;
+        }
 
-            for (uint64_t r=0; r < nRoundsF + nRoundsP; r++)
-            {
-                for (uint64_t s=0; s<12; s++)
-                {
-                    state[s] = fr.add(state[s], C[r*t + s]);
-                }
+        p += 1;
 
-                if ( (r < (nRoundsF/2)) || (r >= ((nRoundsF/2) + nRoundsP)) )
-                {
-                    for (uint64_t s=0; s<12; s++)
-                    {
-                        state[s] = pow7(state[s]);
-                    }
-                }
-                else
-                {
-                    state[0] = pow7(state[0]);
-                }
+        array<Goldilocks::Element,12> state= {
+            pols.in0[p-1], 
+            pols.in1[p-1], 
+            pols.in2[p-1], 
+            pols.in3[p-1], 
+            pols.in4[p-1], 
+            pols.in5[p-1], 
+            pols.in6[p-1], 
+            pols.in7[p-1], 
+            pols.hashType[p-1], 
+            pols.cap1[p-1], 
+            pols.cap2[p-1], 
+            pols.cap3[p-1] };
 
-                Goldilocks::Element acc[12];
-                for (uint64_t x=0; x<state.size(); x++)
-                {
-                    acc[x] = fr.zero();
-                    for (uint64_t y=0; y<state.size(); y++)
-                    {
-                        acc[x] = fr.add(acc[x], fr.mul(state[y], M[x][y]));
-                    }
-                }
-                for (uint64_t x=0; x<state.size(); x++)
-                {
-                    state[x] = acc[x];
-                }
+        for (uint64_t r=0; r < nRoundsF + nRoundsP; r++)
+        {
+            round(state, r);
 
-                pols.in0[p] = state[0];
-                pols.in1[p] = state[1];
-                pols.in2[p] = state[2];
-                pols.in3[p] = state[3];
-                pols.in4[p] = state[4];
-                pols.in5[p] = state[5];
-                pols.in6[p] = state[6];
-                pols.in7[p] = state[7];
-                pols.hashType[p] = state[8];
-                pols.cap1[p] = state[9];
-                pols.cap2[p] = state[10];
-                pols.cap3[p] = state[11];
-                pols.hash0[p] = (*input)[i][12];
-                pols.hash1[p] = (*input)[i][13];
-                pols.hash2[p] = (*input)[i][14];
-                pols.hash3[p] = (*input)[i][15];
-                p+=1;
-            }
+            pols.in0[p] = state[0];
+            pols.in1[p] = state[1];
+            pols.in2[p] = state[2];
+            pols.in3[p] = state[3];
+            pols.in4[p] = state[4];
+            pols.in5[p] = state[5];
+            pols.in6[p] = state[6];
+            pols.in7[p] = state[7];
+            pols.hashType[p] = state[8];
+            pols.cap1[p] = state[9];
+            pols.cap2[p] = state[10];
+            pols.cap3[p] = state[11];
+            pols.hash0[p] = (*input)[i][12];
+            pols.hash1[p] = (*input)[i][13];
+            pols.hash2[p] = (*input)[i][14];
+            pols.hash3[p] = (*input)[i][15];
+            p+=1;
         }
     }
 
-    vector<array<Goldilocks::Element,12>> st0;
+    vector<array<Goldilocks::Element,12>> st0(nRoundsF + nRoundsP + 1);
 
-    array<Goldilocks::Element, 12> aux;
     for (uint64_t i=0; i<12; i++)
     {
-        aux[i] = fr.zero();
+        st0[0][i] = fr.zero();
     };
-    st0.push_back(aux);
 
     for (uint64_t r=0; r<nRoundsF + nRoundsP; r++)
     {
-        for (uint64_t s=0; s<12; s++)
-        {
-            aux[s] = fr.add(st0[r][s], C[r*t + s]);
-        }
-        st0.push_back(aux);
-
-        if ( (r < (nRoundsF/2)) || (r >= ((nRoundsF/2) + nRoundsP)) )
-        {
-            for (uint64_t s=0; s<12; s++)
-            {
-                st0[r+1][s] = pow7(st0[r+1][s]);
-            }
-        }
-        else
-        {
-            st0[r+1][0] = pow7(st0[r+1][0]);
-        }
-
-        Goldilocks::Element acc[12];
-        for (uint64_t x=0; x<st0[r+1].size(); x++)
-        {
-            acc[x] = fr.zero();
-            for (uint64_t y=0; y<st0[r+1].size(); y++)
-            {
-                acc[x] = fr.add(acc[x], fr.mul(st0[r+1][y], M[x][y]));
-            }
-        }
-        for (uint64_t x=0; x<st0[r+1].size(); x++)
-        {
-            st0[r+1][x] = acc[x];
-        }
+        st0[r+1] = st0[r];
+        round(st0[r+1], r);
     }
 
-    pDone = p;
+    uint64_t pDone = size*rowsPerHash;
 
-    while ( p < N ) // TODO: Can we skip this final part?
+#pragma omp parallel for schedule(static)
+    for (uint64_t p=pDone; p<N; p++) // TODO: Can we skip this final part?
     {
         pols.in0[p] = st0[p%(nRoundsP + nRoundsF + 1)][0];
         pols.in1[p] = st0[p%(nRoundsP + nRoundsF + 1)][1];
@@ -316,10 +263,64 @@ void PoseidonGExecutor::execute (   vector<array<Goldilocks::Element, 17>> &inpu
         pols.hash1[p] = st0[nRoundsP + nRoundsF][1];
         pols.hash2[p] = st0[nRoundsP + nRoundsF][2];
         pols.hash3[p] = st0[nRoundsP + nRoundsF][3];
-        p+=1;
     }
 
-    zklog.info("PoseidonGExecutor successfully processed " + to_string(size) + " Poseidon hashes p=" + to_string(p) + " pDone=" + to_string(pDone) + " (" + to_string((double(pDone)*100)/N) + "%)");
+    zklog.info("PoseidonGExecutor successfully processed " + to_string(size) + " Poseidon hashes p=" + to_string(N) + " pDone=" + to_string(pDone) + " (" + to_string((double(pDone)*100)/N) + "%)");
+}
+
+void PoseidonGExecutor::round (array<Goldilocks::Element,12> &state, uint64_t r)
+{
+    for (uint64_t s=0; s<12; s++)
+    {
+        state[s] = fr.add(state[s], C[r*t + s]);
+    }
+
+    if ( (r < (nRoundsF/2)) || (r >= ((nRoundsF/2) + nRoundsP)) )
+    {
+        for (uint64_t s=0; s<12; s++)
+        {
+            state[s] = pow7(state[s]);
+        }
+    }
+    else
+    {
+        state[0] = pow7(state[0]);
+    }
+
+    // MDS matrix product with lazy reduction: the matrix coefficients are small, so every row
+    // accumulates its 12 products in 128 bits and is reduced only once
+    uint64_t in[12];
+    for (uint64_t x=0; x<12; x++)
+    {
+        in[x] = fr.toU64(state[x]);
+    }
+    for (uint64_t x=0; x<12; x++)
+    {
+        unsigned __int128 acc = 0;
+        for (uint64_t y=0; y<12; y++)
+        {
+            acc += (unsigned __int128)in[y] * M64[x][y];
+        }
+        state[x] = reduce128(acc);
+    }
+}
+
+Goldilocks::Element PoseidonGExecutor::reduce128 (unsigned __int128 a)
+{
+    // 2^64 = 2^32 - 1 (mod p), and the high part is small since acc < 2^64 * sum(M[x])
+    uint64_t lo = (uint64_t)a;
+    uint64_t hi = (uint64_t)(a >> 64);
+    uint64_t hiReduced = hi * 0xFFFFFFFFULL;
+    uint64_t result = lo + hiReduced;
+    if (result < lo)
+    {
+        result += 0xFFFFFFFFULL;
+    }
+    if (result >= 0xFFFFFFFF00000001ULL)
+    {
+        result -= 0xFFFFFFFF00000001ULL;
+    }
+    return fr.fromU64(result);
 }
 
 Goldilocks::Element PoseidonGExecutor::pow7 (Goldilocks::Element &a)
@@ -329,4 +330,3 @@ Goldilocks::Element PoseidonGExecutor::pow7 (Goldilocks::Element &a)
     Goldilocks::Element a3 = fr.mul(a, a2);
     return fr.mul(a3, a4);
 }
-
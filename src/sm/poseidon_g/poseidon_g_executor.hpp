@@ -25,6 +25,9 @@ private:
     const array<Goldilocks::Element,12> MCIRC;
     const array<Goldilocks::Element,12> MDIAG;
     array<array<Goldilocks::Element,12>,12> M;
+    array<array<uint64_t,12>,12> M64; // M as integers, used by the lazy reduction matrix product
+    void round(array<Goldilocks::Element,12> &state, uint64_t r);
+    Goldilocks::Element reduce128(unsigned __int128 a);
 public:
     PoseidonGExecutor(Goldilocks &fr, PoseidonGoldilocks &poseidon) :
         fr(fr),
@@ -46,6 +49,7 @@ public:
                 {
                     M[i][j] = fr.add(M[i][j], MDIAG[i]);
                 }
+                M64[i][j] = fr.toU64(M[i][j]);
             }
         }
     };
@@ -1,3 +1,4 @@
+#include <unordered_set>
 #include "sha256_f_executor.hpp"
 #include "utils.hpp"
 #include "exit_process.hpp"
@@ -153,17 +154,38 @@ void Sha256FExecutor::loadScript(json j)
         program.push_back(instruction);
     }
 
+    // The slots can be executed in parallel only if no row of a slot is touched by the previous slot, i.e. if the rows
+    // that the gates of a slot touch beyond its end, like the carry of an add gate at ref+1, are not touched by any gate
+    unordered_set<uint64_t> touched;
+    for (uint64_t i = 0; i < program.size(); i++)
+    {
+        touched.insert(program[i].ref);
+        if (program[i].op == GateOperation::gop_add) touched.insert(program[i].ref + 1);
+        for (uint64_t k = 0; k < 3; k++)
+        {
+            if (program[i].in[k] && (program[i].type[k] == TypeSha256Gate::type_wired) && (program[i].gate[k] > 0)) touched.insert(program[i].gate[k]);
+        }
+    }
+    bIndependentSlots = (touched.find(0) == touched.end());
+    for (unordered_set<uint64_t>::const_iterator it = touched.begin(); bIndependentSlots && (it != touched.end()); it++)
+    {
+        if ((*it >= slotSize) && (touched.find(*it - slotSize) != touched.end()))
+        {
+            bIndependentSlots = false;
+        }
+    }
+
     bLoaded = true;
 }
 
-void Sha256FExecutor::execute(const vector<Sha256FExecutorInput> &input, Sha256FCommitPols &pols)
+TraceChunks Sha256FExecutor::split (const vector<Sha256FExecutorInput> &input, Sha256FCommitPols &pols, uint64_t nChunks)
 {
     zkassertpermanent(bLoaded);
 
     // Check input size
     if (input.size() != nSlots)
     {
-        zklog.error("Sha256FExecutor::execute() got input.size()=" + to_string(input.size()) + " different from numberOfSlots=" + to_string(nSlots));
+        zklog.error("Sha256FExecutor::split() got input.size()=" + to_string(input.size()) + " different from numberOfSlots=" + to_string(nSlots));
         exitProcess();
     }
 
@@ -172,12 +194,12 @@ void Sha256FExecutor::execute(const vector<Sha256FExecutorInput> &input, Sha256F
     {
         if (input[i].stIn.size() != 256)
         {
-            zklog.error("Sha256FExecutor::execute() got input i=" + to_string(i) + " stIn size=" + to_string(input[i].stIn.size()) + " different from 256");
+            zklog.error("Sha256FExecutor::split() got input i=" + to_string(i) + " stIn size=" + to_string(input[i].stIn.size()) + " different from 256");
             exitProcess();
         }
         if (input[i].rIn.size() != 512)
         {
-            zklog.error("Sha256FExecutor::execute() got input i=" + to_string(i) + " rIn size=" + to_string(input[i].stIn.size()) + " different from 512");
+            zklog.error("Sha256FExecutor::split() got input i=" + to_string(i) + " rIn size=" + to_string(input[i].stIn.size()) + " different from 512");
             exitProcess();
         }
     }
@@ -185,9 +207,14 @@ void Sha256FExecutor::execute(const vector<Sha256FExecutorInput> &input, Sha256F
     pols.input[1][0] = fr.fromU64((1 << bitsPerElement) - 1);
     pols.output[0] = fr.fromU64((1 << bitsPerElement) - 1);
 
+    // If the program makes a slot depend on the previous one, all the slots are executed in order by a single chunk
+    return TraceChunks(nSlots, slotSize, bIndependentSlots ? nChunks : 1, bIndependentSlots ? 1 : nSlots);
+}
+
+void Sha256FExecutor::execute (const vector<Sha256FExecutorInput> &input, Sha256FCommitPols &pols, const TraceChunks &chunks, uint64_t chunk)
+{
     // Execute the program
-//#pragma omp parallel for
-    for (uint64_t i = 0; i < nSlots; i++)
+    for (uint64_t i = chunks.begin(chunk); i < chunks.end(chunk); i++)
     {
         uint64_t offset = i * slotSize;
         for (uint64_t j = 0; j < program.size(); j++)
@@ -213,6 +240,17 @@ void Sha256FExecutor::execute(const vector<Sha256FExecutorInput> &input, Sha256F
             }           
         }
     }
+}
+
+void Sha256FExecutor::execute(const vector<Sha256FExecutorInput> &input, Sha256FCommitPols &pols)
+{
+    TraceChunks chunks = split(input, pols, config.executorTraceFillThreads);
+
+#pragma omp parallel for schedule(static, 1) num_threads(chunks.size())
+    for (uint64_t chunk = 0; chunk < chunks.size(); chunk++)
+    {
+        execute(input, pols, chunks, chunk);
+    }
 
     zklog.info("Sha256FExecutor successfully processed " + to_string(nSlots) + " Sha256-F actions (" + to_string((double(input.size()) * slotSize * 100) / N) + "%)");
 }
@@ -10,6 +10,7 @@
 #include "gate_state.hpp"
 #include "sha256.hpp"
 #include "sha256_config.hpp"
+#include "trace_chunks.hpp"
 
 USING_PROVER_FORK_NAMESPACE;
 
@@ -36,6 +37,7 @@ class Sha256FExecutor
     const uint64_t nSlots;
     vector<Sha256Instruction> program;
     bool bLoaded;
+    bool bIndependentSlots; // True if no slot touches the rows of the next one, so that slots can be executed in parallel
 public:
 
     /* Constructor */
@@ -48,6 +50,7 @@ public:
         nSlots((N-1)/slotSize)
     {
         bLoaded = false;
+        bIndependentSlots = false;
 
         // Avoid initialization if we are not going to generate any proof
         if (!config.generateProof() && !config.runFileExecute) return;
@@ -65,6 +68,11 @@ public:
 
     void execute (const vector<Sha256FExecutorInput> &input, PROVER_FORK_NAMESPACE::Sha256FCommitPols &pols);
 
+    /* Checks the input, sets the row 0 gate, and splits the slots into chunks, that can be executed in any order and
+       in parallel by calling execute() per chunk */
+    TraceChunks split (const vector<Sha256FExecutorInput> &input, PROVER_FORK_NAMESPACE::Sha256FCommitPols &pols, uint64_t nChunks);
+    void execute (const vector<Sha256FExecutorInput> &input, PROVER_FORK_NAMESPACE::Sha256FCommitPols &pols, const TraceChunks &chunks, uint64_t chunk);
+
 private:
     Goldilocks::Element getVal(const vector<Sha256FExecutorInput> &input, Sha256FCommitPols &pols, uint64_t block, uint64_t j, uint16_t i);
 };
@@ -0,0 +1,74 @@
+#ifndef STORAGE_CHUNKS_HPP
+#define STORAGE_CHUNKS_HPP
+
+#include <vector>
+#include <array>
+#include "goldilocks_base_field.hpp"
+#include "climb_key_executor.hpp"
+
+using namespace std;
+
+// Execution modes of the storage ROM interpreter
+enum StorageExecutionMode
+{
+    storageDirect = 0, // Fills the polynomials, calculating the hashes and storing the required data, in a single pass
+    storageCount = 1,  // Runs over a 2 rows scratch to count the rows, calculating the hashes and storing the required data
+    storageFill = 2    // Fills the polynomials at the counted rows, replaying the hashes calculated when counting
+};
+
+// Range of consecutive SMT actions executed by the storage ROM, or the empty list tail if firstAction == lastAction
+class StorageChunk
+{
+public:
+    uint64_t firstAction; // Actions [firstAction, lastAction) are executed by this chunk
+    uint64_t lastAction;
+    bool bTail; // Executes the empty list after the actions, until the end of the polynomials
+    uint64_t firstRow; // First row, known after joining the counted chunks
+    uint64_t firstLine; // ROM line of the first row
+    uint64_t firstIncCounter; // Value of incCounter at the first row
+    uint64_t nRows; // Number of rows, known after counting
+    uint64_t lastStep; // First row that called isAlmostEndPolynomial, or 0
+    vector<array<Goldilocks::Element, 4>> hashes; // Poseidon hashes calculated when counting, in order
+    vector<array<Goldilocks::Element, 17>> poseidonRequired;
+    vector<ClimbKeyAction> climbKeyRequired;
+
+    // Set by the tail when counting, if it reaches a ROM line that jumps to itself without changing any register,
+    // so that the rows after it until the end of the polynomials are copies of its row
+    bool bLoop;
+    uint64_t loopLine;
+    uint64_t loopIncCounter;
+    vector<Goldilocks::Element> loopRow; // Storage pols of the row at the loop line
+
+    StorageChunk () : firstAction(0), lastAction(0), bTail(false), firstRow(0), firstLine(0), firstIncCounter(0), nRows(0), lastStep(0), bLoop(false), loopLine(0), loopIncCounter(0) {};
+};
+
+/*
+    Split of the storage SM trace into chunks that can be executed in parallel.
+
+    Every SMT action starts at ROM line 0, which resets all the registers, and ends with a latch that jumps to it,
+    so a range of actions does not depend on the previous ones, but it does not know its first row until the rows of
+    all the previous ranges are counted; the actions are split into ranges, which are counted in parallel, then joined
+    to get their first rows and to concatenate their required data in order, and then filled in parallel.
+
+    After the actions, the tail executes the empty list until it reaches the loop that waits for the end of the
+    polynomials; the rows of this loop are copies of the same row, which are filled in parallel ranges, and the
+    last rows, which exit the loop, are executed by the last range.
+*/
+class StorageChunks
+{
+public:
+    vector<StorageChunk> chunks; // Ranges of actions
+    StorageChunk tail; // Empty list tail, until the first loop row
+    uint64_t nLoopChunks; // Number of ranges of loop rows
+    uint64_t loopFirstRow; // Rows [loopFirstRow, loopLastRow) are copies of tail.loopRow, filled by the loop ranges
+    uint64_t loopLastRow;
+    StorageChunk end; // Last 3 rows, exiting the loop, filled by the last loop range
+
+    StorageChunks () : nLoopChunks(0), loopFirstRow(0), loopLastRow(0) {};
+
+    // Number of chunks to count, and number of chunks to fill: the ranges of actions, the tail and the loop ranges
+    uint64_t countSize (void) const { return chunks.size(); }
+    uint64_t fillSize (void) const { return chunks.size() + 1 + nLoopChunks; }
+};
+
+#endif
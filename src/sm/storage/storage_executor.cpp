@@ -8,6 +8,8 @@
 #include "zklog.hpp"
 #include "exit_process.hpp"
 #include "climb_key_executor.hpp"
+#include "trace_chunks.hpp"
+#include "zkmax.hpp"
 
 using json = nlohmann::json;
 using namespace std;
@@ -17,12 +19,16 @@ using namespace std;
 //#define LOG_STORAGE_EXECUTOR
 //#define LOG_STORAGE_EXECUTOR_ROM_LINE
 
-void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pols, vector<array<Goldilocks::Element, 17>> &poseidonRequired, vector<ClimbKeyAction> &climbKeyRequired)
+void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pols, StorageChunk &chunk, StorageExecutionMode mode)
 {
-    uint64_t l=0; // rom line number, so current line is rom.line[l]
-    uint64_t a=0; // action number, so current action is action[a]
-    bool actionListEmpty = (action.size()==0); // becomes true when we run out of actions
-    uint64_t lastStep = 0; // Set to the first evaluation that calls isAlmostEndPolynomial
+    const bool bScratch = (mode == storageCount); // pols is a 2 rows scratch, so that the row of a step is step%2
+    const bool bReplay = (mode == storageFill); // Hashes are replayed, and required data was already stored when counting
+    uint64_t l = chunk.firstLine; // rom line number, so current line is rom.line[l]
+    uint64_t a = chunk.firstAction; // action number, so current action is action[a]
+    bool actionListEmpty = (a >= action.size()); // becomes true when we run out of actions
+    uint64_t incCounter = chunk.firstIncCounter; // Kept locally, since the first row of a chunk is written by the previous one
+    uint64_t hashIndex = 0; // Next hash to replay
+    bool bLoop = false; // Set when counting the tail reaches the loop line
 
     // Init the context if the list is not empty
     SmtActionContext ctx;
@@ -32,16 +38,28 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
     }
 
     // For all polynomial evaluations
-    for (uint64_t i=0; i<N; i++) // TODO: How do we control if we run out of space?  exit(-1)?
+    uint64_t step;
+    for (step = chunk.firstRow; step < N; step++)
     {
+        // A range of actions ends after the latch of its last action, and the tail, when filled, after its counted rows
+        if (!chunk.bTail && (a == chunk.lastAction)) break;
+        if (chunk.bTail && bReplay && (step == chunk.firstRow + chunk.nRows)) break;
+
+        // Set the evaluation index and the next one, which will be 0 when we reach the last evaluation
+        const uint64_t i = bScratch ? (step % 2) : step;
+        const uint64_t nexti = bScratch ? ((step + 1) % 2) : ((step + 1) % N);
+
+        // The scratch next row still contains the previous step, so clear it before setting the next registers
+        if (bScratch)
+        {
+            memset(&pols.free0[nexti], 0, StorageCommitPols::numPols()*sizeof(Goldilocks::Element));
+        }
+
         // op is the internal register, reset to 0 at every evaluation
         Goldilocks::Element op[4] = {fr.zero(), fr.zero(), fr.zero(), fr.zero()};
 
-        // Current rom line is set by the program counter of this evaluation
-        l = fr.toU64(pols.pc[i]);
-
-        // Set the next evaluation index, which will be 0 when we reach the last evaluation
-        uint64_t nexti = (i+1)%N;
+        // Next rom line, set by the instructions of this evaluation
+        uint64_t nextl;
 
 #ifdef LOG_STORAGE_EXECUTOR_ROM_LINE
         string source = "";
@@ -481,7 +499,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 else if (rom.line[l].funcName=="isAlmostEndPolynomial")
                 {
                     // Return one if this is the one before the last evaluation of the polynomials
-                    if (i == (N-2))
+                    if (step == (N-2))
                     {
                         op[0] = fr.one();
 #ifdef LOG_STORAGE_EXECUTOR
@@ -490,7 +508,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                     }
 
                     // Record the first time isAlmostEndPolynomial is called
-                    if (lastStep == 0) lastStep = i;
+                    if (chunk.lastStep == 0) chunk.lastStep = step;
                 }
                 else
                 {
@@ -674,12 +692,12 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         {
             if (fr.isZero(op[0]))
             {
-                pols.pc[nexti] = fr.fromU64(rom.line[l].jmpAddress);
+                nextl = rom.line[l].jmpAddress;
                 //zklog.info("StorageExecutor jmpz jmpAddress=" + to_string(rom.line[l].jmpAddress));
             }
             else
             {
-                pols.pc[nexti] = fr.add(pols.pc[i], fr.one());
+                nextl = l + 1;
             }
             pols.jmpAddress[i] = fr.fromU64(rom.line[l].jmpAddress);
             pols.jmpz[i] = fr.one();
@@ -690,11 +708,11 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         {
             if (fr.isZero(op[0]))
             {
-                pols.pc[nexti] = fr.add(pols.pc[i], fr.one());
+                nextl = l + 1;
             }
             else
             {
-                pols.pc[nexti] = fr.fromU64(rom.line[l].jmpAddress);
+                nextl = rom.line[l].jmpAddress;
                 //zklog.info("StorageExecutor jmpz jmpAddress=" + to_string(rom.line[l].jmpAddress));
             }
             pols.jmpAddress[i] = fr.fromU64(rom.line[l].jmpAddress);
@@ -704,7 +722,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         // JMP: Jump always
         else if (rom.line[l].jmp)
         {
-            pols.pc[nexti] = fr.fromU64(rom.line[l].jmpAddress);
+            nextl = rom.line[l].jmpAddress;
             pols.jmpAddress[i] = fr.fromU64(rom.line[l].jmpAddress);
             //zklog.info("StorageExecutor iJmp jmpAddress=" + to_string(rom.line[l].jmpAddress));
             pols.jmp[i] = fr.one();
@@ -713,8 +731,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         // If not any jump, then simply increment program counter
         else
         {
-            pols.pc[nexti] = fr.add(pols.pc[i], fr.one());
+            nextl = l + 1;
         }
+        pols.pc[nexti] = fr.fromU64(nextl);
 
         // Hash: op = poseidon.hash(HASH_LEFT + HASH_RIGHT + (0 or 1, depending on iHashType))
         if (rom.line[l].hash)
@@ -758,9 +777,26 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 req[j] = fea[j];
             }
 
-            // Call poseidon
+            // Call poseidon, or replay the hash calculated when counting
             Goldilocks::Element feaHash[4];
-            poseidon.hash(feaHash, fea);
+            if (bReplay)
+            {
+                if (hashIndex >= chunk.hashes.size())
+                {
+                    zklog.error("StorageExecutor::execute() ran out of counted hashes at step=" + to_string(step) + " hashes=" + to_string(chunk.hashes.size()));
+                    exitProcess();
+                }
+                for (uint64_t j=0; j<4; j++) feaHash[j] = chunk.hashes[hashIndex][j];
+                hashIndex++;
+            }
+            else
+            {
+                poseidon.hash(feaHash, fea);
+                if (bScratch)
+                {
+                    chunk.hashes.push_back({feaHash[0], feaHash[1], feaHash[2], feaHash[3]});
+                }
+            }
 
             // Get the calculated hash from the first 4 elements
             pols.free0[i] = feaHash[0];
@@ -780,7 +816,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             req[14] = feaHash[2];
             req[15] = feaHash[3];
             req[16] = fr.fromU64(POSEIDONG_PERMUTATION3_ID);
-            poseidonRequired.push_back(req);
+            if (!bReplay) chunk.poseidonRequired.push_back(req);
 
 #ifdef LOG_STORAGE_EXECUTOR
             {
@@ -824,7 +860,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             climbKeyAction.key[3] = rkeys[3];
             climbKeyAction.level = level;
             climbKeyAction.bit = bit;
-            climbKeyRequired.push_back(climbKeyAction);
+            if (!bReplay) chunk.climbKeyRequired.push_back(climbKeyAction);
 
 #ifdef LOG_STORAGE_EXECUTOR
             zklog.info("StorageExecutor iClimbRkey bit=" + to_string(bit) + " rkey=" + fea2string(fr,rkeys)+ " op=" + fea2string(fr, op));
@@ -857,7 +893,7 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             climbKeyAction.key[3] = rkeys[3];
             climbKeyAction.level = level;
             climbKeyAction.bit = bit;
-            climbKeyRequired.push_back(climbKeyAction);
+            if (!bReplay) chunk.climbKeyRequired.push_back(climbKeyAction);
 
 #ifdef LOG_STORAGE_EXECUTOR
             zklog.info("StorageExecutor ClimbSiblingRkey bit=" + to_string(bit) + " rkey=" + fea2string(fr,rkeys)+ " op=" + fea2string(fr, op));
@@ -918,9 +954,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
                 exitProcess();
             }
 
-            if ( fr.toU64(pols.incCounter[i]) != action[a].getResult.proofHashCounter )
+            if ( incCounter != action[a].getResult.proofHashCounter )
             {
-                zklog.error("StorageExecutor() LATCH SET found action " + to_string(a) + " wrong incCounter=" + fr.toString(pols.incCounter[i], 10) + " mode=" + to_string(action[a].getResult.proofHashCounter));
+                zklog.error("StorageExecutor() LATCH SET found action " + to_string(a) + " wrong incCounter=" + to_string(incCounter) + " mode=" + to_string(action[a].getResult.proofHashCounter));
                 exitProcess();
             }
 
@@ -1016,9 +1052,9 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
             }
 
             // Check that final level state is consistent
-            if ( fr.toU64(pols.incCounter[i]) != action[a].setResult.proofHashCounter )
+            if ( incCounter != action[a].setResult.proofHashCounter )
             {
-                zklog.error("StorageExecutor() LATCH SET found action " + to_string(a) + " wrong incCounter=" + fr.toString(pols.incCounter[i], 10) + " mode=" + to_string(action[a].setResult.proofHashCounter));
+                zklog.error("StorageExecutor() LATCH SET found action " + to_string(a) + " wrong incCounter=" + to_string(incCounter) + " mode=" + to_string(action[a].setResult.proofHashCounter));
                 exitProcess();
             }
 
@@ -1243,30 +1279,238 @@ void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pol
         // Increment counter at every hash, and reset it at every latch
         if (rom.line[l].hash)
         {
-            pols.incCounter[nexti] = fr.add(pols.incCounter[i], fr.one());
+            incCounter++;
         }
         else if (rom.line[l].latchGet || rom.line[l].latchSet)
         {
-            pols.incCounter[nexti] = fr.zero();
-        }
-        else
-        {
-            pols.incCounter[nexti] = pols.incCounter[i];
+            incCounter = 0;
         }
+        pols.incCounter[nexti] = fr.fromU64(incCounter);
 
 #ifdef LOG_STORAGE_EXECUTOR
         if ((i%1000) == 0) zklog.info("StorageExecutor step " + to_string(i) + " done");
 #endif
+
+        // A range of actions must end jumping to the first line, where the next range starts
+        if (!chunk.bTail && (a == chunk.lastAction) && (nextl != 0))
+        {
+            zklog.error("StorageExecutor::execute() found action " + to_string(a - 1) + " ending at step=" + to_string(step) + " without jumping to line 0 but to line " + to_string(nextl));
+            exitProcess();
+        }
+
+        // When counting the tail, stop at the first line that jumps to itself without changing anything but its own
+        // row, if there are rows to copy before the last three rows, which are executed again to exit the loop
+        if (bScratch && chunk.bTail && (nextl == l) && (step + 5 <= N) && isLoopLine(l))
+        {
+            bLoop = true;
+            chunk.loopRow.assign(&pols.free0[i], &pols.free0[i] + StorageCommitPols::numPols());
+            chunk.loopLine = l;
+            chunk.loopIncCounter = incCounter;
+            step++;
+            break;
+        }
+
+        l = nextl;
+    }
+
+    if (bScratch)
+    {
+        chunk.nRows = step - chunk.firstRow;
+        chunk.bLoop = bLoop;
+    }
+
+    // Check that all the actions were executed, and, when filling, that all the counted rows and hashes were used
+    if (!chunk.bTail && (a != chunk.lastAction))
+    {
+        zklog.error("StorageExecutor::execute() ran out of rows at step=" + to_string(step) + " with action=" + to_string(a) + " lastAction=" + to_string(chunk.lastAction));
+        exitProcess();
+    }
+    if (bReplay && ((step != chunk.firstRow + chunk.nRows) || (hashIndex != chunk.hashes.size())))
+    {
+        zklog.error("StorageExecutor::execute() filled rows=" + to_string(step - chunk.firstRow) + " hashes=" + to_string(hashIndex) + " but counted rows=" + to_string(chunk.nRows) + " hashes=" + to_string(chunk.hashes.size()));
+        exitProcess();
+    }
+}
+
+void StorageExecutor::execute (vector<SmtAction> &action, StorageCommitPols &pols, vector<array<Goldilocks::Element, 17>> &poseidonRequired, vector<ClimbKeyAction> &climbKeyRequired)
+{
+    // Execute all the actions and the tail in a single pass, unless there are several threads to fill the trace
+    if (config.executorTraceFillThreads <= 1)
+    {
+        StorageChunk chunk;
+        chunk.lastAction = action.size();
+        chunk.bTail = true;
+        execute(action, pols, chunk, storageDirect);
+
+        // Check that ROM has done all its work
+        if (chunk.lastStep == 0)
+        {
+            zklog.error("StorageExecutor::execute() finished execution but ROM did not call isAlmostEndPolynomial");
+            exitProcess();
+        }
+
+        poseidonRequired.insert(poseidonRequired.end(), chunk.poseidonRequired.begin(), chunk.poseidonRequired.end());
+        climbKeyRequired.insert(climbKeyRequired.end(), chunk.climbKeyRequired.begin(), chunk.climbKeyRequired.end());
+
+        zklog.info("StorageExecutor successfully processed " + to_string(action.size()) + " SMT actions (" + to_string((double(chunk.lastStep)*100)/N) + "%)");
+        return;
+    }
+
+    StorageChunks chunks;
+    split(action, config.executorTraceFillThreads, chunks);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(config.executorTraceFillThreads)
+    for (uint64_t chunk = 0; chunk < chunks.countSize(); chunk++)
+    {
+        count(action, chunks, chunk);
     }
 
+    join(action, chunks, poseidonRequired, climbKeyRequired);
+
+#pragma omp parallel for schedule(dynamic, 1) num_threads(config.executorTraceFillThreads)
+    for (uint64_t chunk = 0; chunk < chunks.fillSize(); chunk++)
+    {
+        fill(action, pols, chunks, chunk);
+    }
+}
+
+void StorageExecutor::split (vector<SmtAction> &action, uint64_t nChunks, StorageChunks &chunks)
+{
+    // Actions are much longer than a row, so a range can be as short as a few actions
+    TraceChunks ranges(action.size(), 1, nChunks, 8);
+    for (uint64_t i = 0; i < ranges.size(); i++)
+    {
+        if (ranges.begin(i) == ranges.end(i)) continue;
+        StorageChunk chunk;
+        chunk.firstAction = ranges.begin(i);
+        chunk.lastAction = ranges.end(i);
+        chunks.chunks.emplace_back(chunk);
+    }
+
+    chunks.tail.firstAction = action.size();
+    chunks.tail.lastAction = action.size();
+    chunks.tail.bTail = true;
+    chunks.nLoopChunks = zkmax(nChunks, (uint64_t)1);
+}
+
+void StorageExecutor::count (vector<SmtAction> &action, StorageChunks &chunks, uint64_t chunk)
+{
+    // Every range of actions starts at line 0, which does not read the registers of its first row, so it is counted
+    // from a scratch of 2 rows of all the commit pols, with all the registers set to zero
+    vector<Goldilocks::Element> scratch(2*CommitPols::pilSize()/(CommitPols::pilDegree()*sizeof(Goldilocks::Element)), fr.zero());
+    StorageCommitPols scratchPols(scratch.data(), 2);
+    execute(action, scratchPols, chunks.chunks[chunk], storageCount);
+}
+
+void StorageExecutor::join (vector<SmtAction> &action, StorageChunks &chunks, vector<array<Goldilocks::Element, 17>> &poseidonRequired, vector<ClimbKeyAction> &climbKeyRequired)
+{
+    // Set the first row of every range of actions, and concatenate their required data in order
+    uint64_t row = 0;
+    for (uint64_t i = 0; i < chunks.chunks.size(); i++)
+    {
+        StorageChunk &chunk = chunks.chunks[i];
+        chunk.firstRow = row;
+        row += chunk.nRows;
+        poseidonRequired.insert(poseidonRequired.end(), chunk.poseidonRequired.begin(), chunk.poseidonRequired.end());
+        climbKeyRequired.insert(climbKeyRequired.end(), chunk.climbKeyRequired.begin(), chunk.climbKeyRequired.end());
+    }
+    if (row > N - 2)
+    {
+        zklog.error("StorageExecutor::join() Too many Storage rows=" + to_string(row) + " > N-2=" + to_string(N - 2));
+        exitProcess();
+    }
+
+    // Count the tail, which depends on its first row, until it reaches the loop that waits for the end of the polynomials
+    StorageChunk &tail = chunks.tail;
+    tail.firstRow = row;
+    vector<Goldilocks::Element> scratch(2*CommitPols::pilSize()/(CommitPols::pilDegree()*sizeof(Goldilocks::Element)), fr.zero());
+    StorageCommitPols scratchPols(scratch.data(), 2);
+    execute(action, scratchPols, tail, storageCount);
+    poseidonRequired.insert(poseidonRequired.end(), tail.poseidonRequired.begin(), tail.poseidonRequired.end());
+    climbKeyRequired.insert(climbKeyRequired.end(), tail.climbKeyRequired.begin(), tail.climbKeyRequired.end());
+
     // Check that ROM has done all its work
-    if (lastStep == 0)
+    if (tail.lastStep == 0)
     {
-        zklog.error("StorageExecutor::execute() finished execution but ROM did not call isAlmostEndPolynomial");
+        zklog.error("StorageExecutor::join() finished execution but ROM did not call isAlmostEndPolynomial");
         exitProcess();
     }
 
-    zklog.info("StorageExecutor successfully processed " + to_string(action.size()) + " SMT actions (" + to_string((double(lastStep)*100)/N) + "%)");
+    // The rows after the tail are copies of its loop row, until the last 3 rows, which are executed again from the loop
+    // line, so that the last of them jumps to the first row; the first copy is filled by the tail, since its registers
+    // are also set by the last tail row
+    if (tail.bLoop)
+    {
+        chunks.loopFirstRow = tail.firstRow + tail.nRows + 1;
+        chunks.loopLastRow = N - 3;
+        chunks.end.firstAction = action.size();
+        chunks.end.lastAction = action.size();
+        chunks.end.bTail = true;
+        chunks.end.firstRow = N - 3;
+        chunks.end.firstLine = tail.loopLine;
+        chunks.end.firstIncCounter = tail.loopIncCounter;
+    }
+
+    zklog.info("StorageExecutor successfully processed " + to_string(action.size()) + " SMT actions (" + to_string((double(tail.lastStep)*100)/N) + "%)");
+}
+
+void StorageExecutor::fill (vector<SmtAction> &action, StorageCommitPols &pols, StorageChunks &chunks, uint64_t chunk)
+{
+    // Fill a range of actions, replaying its counted hashes
+    if (chunk < chunks.chunks.size())
+    {
+        execute(action, pols, chunks.chunks[chunk], storageFill);
+        return;
+    }
+
+    // Fill the tail until the loop line, and the next row, whose registers were set by the loop line
+    if (chunk == chunks.chunks.size())
+    {
+        execute(action, pols, chunks.tail, storageFill);
+        if (chunks.tail.bLoop)
+        {
+            memcpy(&pols.free0[chunks.tail.firstRow + chunks.tail.nRows], chunks.tail.loopRow.data(), StorageCommitPols::numPols()*sizeof(Goldilocks::Element));
+        }
+        return;
+    }
+
+    // Fill a range of the loop rows
+    if (!chunks.tail.bLoop)
+    {
+        return;
+    }
+    uint64_t loopChunk = chunk - chunks.chunks.size() - 1;
+    uint64_t rowsPerChunk = (chunks.loopLastRow - chunks.loopFirstRow + chunks.nLoopChunks - 1) / chunks.nLoopChunks;
+    uint64_t firstRow = zkmin(chunks.loopFirstRow + loopChunk*rowsPerChunk, chunks.loopLastRow);
+    uint64_t lastRow = zkmin(firstRow + rowsPerChunk, chunks.loopLastRow);
+    for (uint64_t row = firstRow; row < lastRow; row++)
+    {
+        memcpy(&pols.free0[row], chunks.tail.loopRow.data(), StorageCommitPols::numPols()*sizeof(Goldilocks::Element));
+    }
+
+    // The last range executes the last rows, starting from a copy of the loop row
+    if (loopChunk == chunks.nLoopChunks - 1)
+    {
+        memcpy(&pols.free0[chunks.end.firstRow], chunks.tail.loopRow.data(), StorageCommitPols::numPols()*sizeof(Goldilocks::Element));
+        execute(action, pols, chunks.end, storageDirect);
+        if ((chunks.end.poseidonRequired.size() != 0) || (chunks.end.climbKeyRequired.size() != 0))
+        {
+            zklog.error("StorageExecutor::fill() found required data in the last rows, after the loop line=" + to_string(chunks.end.firstLine));
+            exitProcess();
+        }
+    }
+}
+
+bool StorageExecutor::isLoopLine (uint64_t l)
+{
+    // A line that sets no register, nor hashes, climbs or latches, leaves the registers and incCounter unchanged, and its
+    // free input only depends on the step when it checks for the end of the polynomials
+    const StorageRomLine &line = rom.line[l];
+    if (line.inFREE && (line.funcName != "isAlmostEndPolynomial")) return false;
+    return !line.setRKEY && !line.setRKEY_BIT && !line.setVALUE_LOW && !line.setVALUE_HIGH && !line.setLEVEL &&
+           !line.setOLD_ROOT && !line.setNEW_ROOT && !line.setHASH_LEFT && !line.setHASH_RIGHT &&
+           !line.setSIBLING_RKEY && !line.setSIBLING_VALUE_HASH && !line.hash && !line.climbRkey &&
+           !line.climbSiblingRkey && !line.latchGet && !line.latchSet;
 }
 
 // To be used only for testing, since it allocates a lot of memory
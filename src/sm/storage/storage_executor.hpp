@@ -11,6 +11,7 @@
 #include "utils.hpp"
 #include "sm/pols_generated/commit_pols.hpp"
 #include "climb_key_executor.hpp"
+#include "storage_chunks.hpp"
 
 
 USING_PROVER_FORK_NAMESPACE;
@@ -23,6 +24,12 @@ class StorageExecutor
     const uint64_t N;
     StorageRom rom;
 
+    // Executes the storage ROM over a chunk of actions, or over the tail, in the given mode
+    void execute (vector<SmtAction> &action, PROVER_FORK_NAMESPACE::StorageCommitPols &pols, StorageChunk &chunk, StorageExecutionMode mode);
+
+    // Returns true if a ROM line that jumps to itself produces the same row at every step
+    bool isLoopLine (uint64_t l);
+
 public:
     StorageExecutor (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config) :
         fr(fr),
@@ -39,6 +46,13 @@ public:
     // To be used by prover
     void execute (vector<SmtAction> &action, PROVER_FORK_NAMESPACE::StorageCommitPols &pols, vector<array<Goldilocks::Element, 17>> &poseidonRequired, vector<ClimbKeyAction> &climbKeyRequired);
 
+    // To be used by prover to execute the actions as chunked tasks: split them into nChunks ranges, count every range
+    // (countSize() chunks), join the counts to get the first rows and the required data, and fill (fillSize() chunks)
+    void split (vector<SmtAction> &action, uint64_t nChunks, StorageChunks &chunks);
+    void count (vector<SmtAction> &action, StorageChunks &chunks, uint64_t chunk);
+    void join (vector<SmtAction> &action, StorageChunks &chunks, vector<array<Goldilocks::Element, 17>> &poseidonRequired, vector<ClimbKeyAction> &climbKeyRequired);
+    void fill (vector<SmtAction> &action, PROVER_FORK_NAMESPACE::StorageCommitPols &pols, StorageChunks &chunks, uint64_t chunk);
+
     // To be used only for testing, since it allocates a lot of memory
     void execute (vector<SmtAction> &action);
 };
@@ -0,0 +1,489 @@
+#include <stdio.h>
+#include "chelpers_program.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include "starks.hpp"
+
+#define CHELPERS_NO_SLOT UINT64_MAX
+
+// Fills a polynomial operand from its varPolMap entry
+static void chelpersPolOperand (StarkInfo &starkInfo, uint64_t polId, ChelpersOperand &operand)
+{
+    VarPolMap &map = starkInfo.varPolMap[polId];
+    operand.type = cot_pol;
+    operand.dim = map.dim;
+    operand.index = starkInfo.mapOffsets.section[map.section] + map.sectionPos;
+    operand.stride = starkInfo.mapSectionsN.section[map.section];
+}
+
+// Translates a starkinfo step reference, except temporaries, into an operand
+static bool chelpersOperand (StarkInfo &starkInfo, const StepType &ref, bool bExtended, bool bDest, ChelpersOperand &operand)
+{
+    operand.index = 0;
+    operand.stride = 0;
+    operand.next = ref.prime ? (bExtended ? (1ULL << (starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits)) : 1) : 0;
+
+    switch (ref.type)
+    {
+        case StepType::cm:
+            chelpersPolOperand(starkInfo, bExtended ? starkInfo.cm_2ns[ref.id] : starkInfo.cm_n[ref.id], operand);
+            return true;
+        case StepType::tmpExp:
+            if (bExtended) return false;
+            chelpersPolOperand(starkInfo, starkInfo.tmpExp_n[ref.id], operand);
+            return true;
+        case StepType::exp:
+            if (bExtended) return false;
+            chelpersPolOperand(starkInfo, starkInfo.exps_n[ref.id], operand);
+            return true;
+        case StepType::q:
+            if (!bExtended) return false;
+            if (bDest)
+            {
+                operand.type = cot_q;
+                operand.dim = starkInfo.qDim;
+                return true;
+            }
+            chelpersPolOperand(starkInfo, starkInfo.qs[ref.id], operand);
+            return true;
+        case StepType::f:
+            if (!bExtended || !bDest) return false;
+            operand.type = cot_f;
+            operand.dim = 3;
+            return true;
+        default:
+            break;
+    }
+
+    // The rest of types can only be read
+    if (bDest) return false;
+    operand.dim = 1;
+    switch (ref.type)
+    {
+        case StepType::_const:
+            operand.type = cot_const;
+            operand.index = ref.id;
+            return true;
+        case StepType::number:
+            operand.type = cot_number;
+            operand.index = stoull(ref.value);
+            operand.next = 0;
+            return true;
+        case StepType::_public:
+            operand.type = cot_public;
+            operand.index = ref.id;
+            operand.next = 0;
+            return true;
+        case StepType::challenge:
+            operand.type = cot_challenge;
+            operand.dim = 3;
+            operand.index = ref.id;
+            operand.next = 0;
+            return true;
+        case StepType::eval:
+            operand.type = cot_eval;
+            operand.dim = 3;
+            operand.index = ref.id;
+            operand.next = 0;
+            return true;
+        case StepType::x:
+            operand.type = cot_x;
+            operand.next = 0;
+            return true;
+        case StepType::Zi:
+            if (!bExtended) return false;
+            operand.type = cot_Zi;
+            operand.next = 0;
+            return true;
+        case StepType::xDivXSubXi:
+        case StepType::xDivXSubWXi:
+            if (!bExtended) return false;
+            operand.type = (ref.type == StepType::xDivXSubXi) ? cot_xDivXSubXi : cot_xDivXSubWXi;
+            operand.dim = 3;
+            operand.next = 0;
+            return true;
+        default:
+            return false;
+    }
+}
+
+bool ChelpersStepProgram::compile (StarkInfo &starkInfo, const Step &step, bool bExtended, const string &name)
+{
+    extended = bExtended;
+    N = 1ULL << (bExtended ? starkInfo.starkStruct.nBitsExt : starkInfo.starkStruct.nBits);
+    instructions.clear();
+    instructions.resize(step.first.size());
+
+    // Translate the operations, getting the dimension and the last read of every temporary
+    vector<uint64_t> tmpDim(step.tmpUsed, 0);
+    vector<uint64_t> tmpLastUse(step.tmpUsed, CHELPERS_NO_SLOT);
+    for (uint64_t k = 0; k < step.first.size(); k++)
+    {
+        const StepOperation &operation = step.first[k];
+        ChelpersInstruction &instruction = instructions[k];
+        instruction.op = (uint64_t)operation.op;
+        uint64_t nSrc = (operation.op == StepOperation::copy) ? 1 : 2;
+        if (operation.src.size() != nSrc)
+        {
+            zklog.error("ChelpersStepProgram::compile() " + name + " found " + to_string(operation.src.size()) + " sources in operation=" + to_string(k));
+            return false;
+        }
+        instruction.src[1].type = cot_number;
+        instruction.src[1].dim = 1;
+        instruction.src[1].index = 0;
+        instruction.src[1].stride = 0;
+        instruction.src[1].next = 0;
+
+        uint64_t dim = 1;
+        for (uint64_t s = 0; s < nSrc; s++)
+        {
+            const StepType &ref = operation.src[s];
+            ChelpersOperand &operand = instruction.src[s];
+            if (ref.type == StepType::tmp)
+            {
+                if ((ref.id >= step.tmpUsed) || (tmpDim[ref.id] == 0))
+                {
+                    zklog.error("ChelpersStepProgram::compile() " + name + " found unset tmp=" + to_string(ref.id) + " in operation=" + to_string(k));
+                    return false;
+                }
+                operand.type = cot_tmp;
+                operand.dim = tmpDim[ref.id];
+                operand.index = ref.id;
+                operand.stride = 0;
+                operand.next = 0;
+                tmpLastUse[ref.id] = k;
+            }
+            else if (!chelpersOperand(starkInfo, ref, bExtended, false, operand))
+            {
+                zklog.error("ChelpersStepProgram::compile() " + name + " found unsupported source type=" + to_string(ref.type) + " in operation=" + to_string(k));
+                return false;
+            }
+            if (operand.dim > dim) dim = operand.dim;
+        }
+
+        const StepType &ref = operation.dest;
+        ChelpersOperand &operand = instruction.dest;
+        if (ref.type == StepType::tmp)
+        {
+            if (ref.id >= step.tmpUsed)
+            {
+                zklog.error("ChelpersStepProgram::compile() " + name + " found tmp=" + to_string(ref.id) + " out of range in operation=" + to_string(k));
+                return false;
+            }
+            if ((tmpDim[ref.id] != 0) && (tmpDim[ref.id] != dim))
+            {
+                zklog.error("ChelpersStepProgram::compile() " + name + " found tmp=" + to_string(ref.id) + " reassigned with a different dimension in operation=" + to_string(k));
+                return false;
+            }
+            tmpDim[ref.id] = dim;
+            operand.type = cot_tmp;
+            operand.dim = dim;
+            operand.index = ref.id;
+            operand.stride = 0;
+            operand.next = 0;
+        }
+        else if (!chelpersOperand(starkInfo, ref, bExtended, true, operand))
+        {
+            zklog.error("ChelpersStepProgram::compile() " + name + " found unsupported destination type=" + to_string(ref.type) + " in operation=" + to_string(k));
+            return false;
+        }
+        else if (operand.dim < dim)
+        {
+            zklog.error("ChelpersStepProgram::compile() " + name + " found a destination of dimension " + to_string(operand.dim) + " for a result of dimension " + to_string(dim) + " in operation=" + to_string(k));
+            return false;
+        }
+    }
+
+    // Allocate a slot to every temporary when written, and release it after its last read; the operands are
+    // released before the destination is allocated, so a result can reuse the slot of an operand, which the
+    // interpreter supports since it calculates the result before storing it
+    vector<uint64_t> tmpSlot(step.tmpUsed, CHELPERS_NO_SLOT);
+    vector<uint64_t> free1, free3;
+    nTemp1 = 0;
+    nTemp3 = 0;
+    for (uint64_t k = 0; k < instructions.size(); k++)
+    {
+        ChelpersInstruction &instruction = instructions[k];
+        uint64_t nSrc = (instruction.op == cop_copy) ? 1 : 2;
+        uint64_t srcId[2] = { CHELPERS_NO_SLOT, CHELPERS_NO_SLOT };
+        for (uint64_t s = 0; s < nSrc; s++)
+        {
+            if (instruction.src[s].type != cot_tmp) continue;
+            srcId[s] = instruction.src[s].index;
+            instruction.src[s].index = tmpSlot[srcId[s]];
+        }
+        for (uint64_t s = 0; s < nSrc; s++)
+        {
+            uint64_t id = srcId[s];
+            if ((id == CHELPERS_NO_SLOT) || (tmpLastUse[id] != k)) continue;
+            ((tmpDim[id] == 1) ? free1 : free3).push_back(tmpSlot[id]);
+            tmpSlot[id] = CHELPERS_NO_SLOT;
+            tmpLastUse[id] = CHELPERS_NO_SLOT; // Release it only once, even if read twice by this instruction
+        }
+        if (instruction.dest.type != cot_tmp) continue;
+        uint64_t destId = instruction.dest.index;
+        if (tmpSlot[destId] == CHELPERS_NO_SLOT)
+        {
+            vector<uint64_t> &freeSlots = (tmpDim[destId] == 1) ? free1 : free3;
+            if (freeSlots.empty())
+            {
+                tmpSlot[destId] = (tmpDim[destId] == 1) ? nTemp1++ : nTemp3++;
+            }
+            else
+            {
+                tmpSlot[destId] = freeSlots.back();
+                freeSlots.pop_back();
+            }
+        }
+        instruction.dest.index = tmpSlot[destId];
+        if ((tmpLastUse[destId] == CHELPERS_NO_SLOT) || (tmpLastUse[destId] <= k))
+        {
+            // The written value is never read
+            ((tmpDim[destId] == 1) ? free1 : free3).push_back(tmpSlot[destId]);
+            tmpSlot[destId] = CHELPERS_NO_SLOT;
+        }
+    }
+
+    zklog.info("ChelpersStepProgram::compile() " + name + " instructions=" + to_string(instructions.size()) + " tmpUsed=" + to_string(step.tmpUsed) + " nTemp1=" + to_string(nTemp1) + " nTemp3=" + to_string(nTemp3));
+    return true;
+}
+
+// Adds a value to a FNV-1a style hash
+static inline void chelpersHash (uint64_t &hash, uint64_t value)
+{
+    hash = (hash ^ value) * 0x100000001B3ULL;
+}
+
+static void chelpersHashRef (uint64_t &hash, const StepType &ref)
+{
+    chelpersHash(hash, ref.type);
+    chelpersHash(hash, ref.id);
+    chelpersHash(hash, ref.prime ? 1 : 0);
+    chelpersHash(hash, ref.value.size());
+    for (uint64_t c = 0; c < ref.value.size(); c++) chelpersHash(hash, (uint8_t)ref.value[c]);
+}
+
+static void chelpersHashVector (uint64_t &hash, const vector<uint64_t> &values)
+{
+    chelpersHash(hash, values.size());
+    for (uint64_t i = 0; i < values.size(); i++) chelpersHash(hash, values[i]);
+}
+
+uint64_t ChelpersProgram::getStepsHash (const StarkInfo &starkInfo)
+{
+    uint64_t hash = 0xCBF29CE484222325ULL;
+
+    // Compiled step definitions
+    const Step *steps[5] = { &starkInfo.step2prev, &starkInfo.step3prev, &starkInfo.step3, &starkInfo.step42ns, &starkInfo.step52ns };
+    for (uint64_t s = 0; s < 5; s++)
+    {
+        chelpersHash(hash, steps[s]->tmpUsed);
+        chelpersHash(hash, steps[s]->first.size());
+        for (uint64_t k = 0; k < steps[s]->first.size(); k++)
+        {
+            const StepOperation &operation = steps[s]->first[k];
+            chelpersHash(hash, operation.op);
+            chelpersHashRef(hash, operation.dest);
+            chelpersHash(hash, operation.src.size());
+            for (uint64_t i = 0; i < operation.src.size(); i++) chelpersHashRef(hash, operation.src[i]);
+        }
+    }
+
+    // Polynomial maps, which the pol operand offsets and strides are taken from
+    chelpersHashVector(hash, starkInfo.cm_n);
+    chelpersHashVector(hash, starkInfo.cm_2ns);
+    chelpersHashVector(hash, starkInfo.tmpExp_n);
+    chelpersHashVector(hash, starkInfo.exps_n);
+    chelpersHashVector(hash, starkInfo.qs);
+    chelpersHash(hash, starkInfo.varPolMap.size());
+    for (uint64_t i = 0; i < starkInfo.varPolMap.size(); i++)
+    {
+        chelpersHash(hash, starkInfo.varPolMap[i].section);
+        chelpersHash(hash, starkInfo.varPolMap[i].dim);
+        chelpersHash(hash, starkInfo.varPolMap[i].sectionPos);
+    }
+    for (uint64_t i = 0; i < eSectionMax; i++)
+    {
+        chelpersHash(hash, starkInfo.mapOffsets.section[i]);
+        chelpersHash(hash, starkInfo.mapSectionsN.section[i]);
+    }
+
+    return hash;
+}
+
+bool ChelpersProgram::compile (StarkInfo &starkInfo)
+{
+    nBits = starkInfo.starkStruct.nBits;
+    nBitsExt = starkInfo.starkStruct.nBitsExt;
+    mapTotalN = starkInfo.mapTotalN;
+    nConstants = starkInfo.nConstants;
+    nPublics = starkInfo.nPublics;
+    qDim = starkInfo.qDim;
+    stepsHash = getStepsHash(starkInfo);
+
+    return step2prev.compile(starkInfo, starkInfo.step2prev, false, "step2prev") &&
+           step3prev.compile(starkInfo, starkInfo.step3prev, false, "step3prev") &&
+           step3.compile(starkInfo, starkInfo.step3, false, "step3") &&
+           step42ns.compile(starkInfo, starkInfo.step42ns, true, "step42ns") &&
+           step52ns.compile(starkInfo, starkInfo.step52ns, true, "step52ns");
+}
+
+void ChelpersProgram::save (const string &fileName) const
+{
+    FILE *pFile = fopen(fileName.c_str(), "wb");
+    if (pFile == NULL)
+    {
+        zklog.error("ChelpersProgram::save() failed calling fopen() of file=" + fileName);
+        exitProcess();
+    }
+    uint64_t header[9] = { CHELPERS_PROGRAM_MAGIC, CHELPERS_PROGRAM_VERSION, nBits, nBitsExt, mapTotalN, nConstants, nPublics, qDim, stepsHash };
+    bool bResult = (fwrite(header, sizeof(header), 1, pFile) == 1);
+    const ChelpersStepProgram *steps[5] = { &step2prev, &step3prev, &step3, &step42ns, &step52ns };
+    for (uint64_t s = 0; bResult && (s < 5); s++)
+    {
+        uint64_t stepHeader[5] = { steps[s]->extended ? 1ULL : 0ULL, steps[s]->N, steps[s]->nTemp1, steps[s]->nTemp3, steps[s]->instructions.size() };
+        bResult = (fwrite(stepHeader, sizeof(stepHeader), 1, pFile) == 1) &&
+                  (fwrite(steps[s]->instructions.data(), sizeof(ChelpersInstruction), steps[s]->instructions.size(), pFile) == steps[s]->instructions.size());
+    }
+    if (!bResult)
+    {
+        zklog.error("ChelpersProgram::save() failed calling fwrite() of file=" + fileName);
+        exitProcess();
+    }
+    fclose(pFile);
+}
+
+bool ChelpersProgram::load (const string &fileName, const StarkInfo &starkInfo)
+{
+    FILE *pFile = fopen(fileName.c_str(), "rb");
+    if (pFile == NULL)
+    {
+        zklog.error("ChelpersProgram::load() failed calling fopen() of file=" + fileName);
+        return false;
+    }
+    uint64_t header[9];
+    bool bResult = (fread(header, sizeof(header), 1, pFile) == 1);
+    if (bResult && ((header[0] != CHELPERS_PROGRAM_MAGIC) || (header[1] != CHELPERS_PROGRAM_VERSION)))
+    {
+        zklog.error("ChelpersProgram::load() found invalid magic or version=" + to_string(header[1]) + " in file=" + fileName);
+        bResult = false;
+    }
+    if (bResult && ((header[2] != starkInfo.starkStruct.nBits) || (header[3] != starkInfo.starkStruct.nBitsExt) || (header[4] != starkInfo.mapTotalN) ||
+                    (header[5] != starkInfo.nConstants) || (header[6] != starkInfo.nPublics) || (header[7] != starkInfo.qDim) ||
+                    (header[8] != getStepsHash(starkInfo))))
+    {
+        zklog.error("ChelpersProgram::load() file=" + fileName + " was not compiled from the loaded starkinfo");
+        bResult = false;
+    }
+    if (bResult)
+    {
+        nBits = header[2];
+        nBitsExt = header[3];
+        mapTotalN = header[4];
+        nConstants = header[5];
+        nPublics = header[6];
+        qDim = header[7];
+        stepsHash = header[8];
+    }
+    ChelpersStepProgram *steps[5] = { &step2prev, &step3prev, &step3, &step42ns, &step52ns };
+    for (uint64_t s = 0; bResult && (s < 5); s++)
+    {
+        uint64_t stepHeader[5];
+        bResult = (fread(stepHeader, sizeof(stepHeader), 1, pFile) == 1);
+        if (!bResult) break;
+        steps[s]->extended = (stepHeader[0] != 0);
+        steps[s]->N = stepHeader[1];
+        steps[s]->nTemp1 = stepHeader[2];
+        steps[s]->nTemp3 = stepHeader[3];
+        steps[s]->instructions.resize(stepHeader[4]);
+        bResult = (fread(steps[s]->instructions.data(), sizeof(ChelpersInstruction), steps[s]->instructions.size(), pFile) == steps[s]->instructions.size());
+    }
+    fclose(pFile);
+    if (!bResult)
+    {
+        zklog.error("ChelpersProgram::load() failed reading file=" + fileName);
+        return false;
+    }
+
+    // Check the operands, so that the evaluation does not need to
+    for (uint64_t s = 0; s < 5; s++)
+    {
+        for (uint64_t k = 0; k < steps[s]->instructions.size(); k++)
+        {
+            const ChelpersInstruction &instruction = steps[s]->instructions[k];
+            const ChelpersOperand *operands[3] = { &instruction.dest, &instruction.src[0], &instruction.src[1] };
+            bool bValid = (instruction.op <= cop_copy);
+            for (uint64_t o = 0; bValid && (o < 3); o++)
+            {
+                const ChelpersOperand &operand = *operands[o];
+                bValid = (operand.type <= cot_f) && ((operand.dim == 1) || (operand.dim == 3));
+                if (bValid && (o == 0))
+                {
+                    bValid = (operand.type == cot_tmp) || (operand.type == cot_pol) || (operand.type == cot_q) || (operand.type == cot_f);
+                }
+                if (bValid && (o > 0))
+                {
+                    bValid = (operand.type != cot_q) && (operand.type != cot_f);
+                }
+                if (bValid && (operand.type == cot_tmp))
+                {
+                    bValid = operand.index < ((operand.dim == 1) ? steps[s]->nTemp1 : steps[s]->nTemp3);
+                }
+                if (bValid && (operand.type == cot_pol))
+                {
+                    bValid = (operand.index + (operand.dim - 1) + (steps[s]->N - 1) * operand.stride) < mapTotalN;
+                }
+                if (bValid && (operand.type == cot_const)) bValid = operand.index < nConstants;
+                if (bValid && (operand.type == cot_public)) bValid = operand.index < nPublics;
+                if (bValid && (operand.type == cot_challenge)) bValid = operand.index < NUM_CHALLENGES;
+                if (bValid && (operand.type == cot_eval)) bValid = operand.index < starkInfo.evMap.size();
+            }
+            if (!bValid)
+            {
+                zklog.error("ChelpersProgram::load() found invalid instruction=" + to_string(k) + " of step=" + to_string(s) + " in file=" + fileName);
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+string ChelpersProgram::getFileName (const string &starkInfoFile)
+{
+    const string suffix = ".starkinfo.json";
+    if ((starkInfoFile.size() >= suffix.size()) && (starkInfoFile.compare(starkInfoFile.size() - suffix.size(), suffix.size(), suffix) == 0))
+    {
+        return starkInfoFile.substr(0, starkInfoFile.size() - suffix.size()) + ".chelpers.bin";
+    }
+    return starkInfoFile + ".chelpers.bin";
+}
+
+
+bool ChelpersProgram::compileFile (const Config &config, const string &starkInfoFile)
+{
+    TimerStart(CHELPERS_PROGRAM_COMPILE_FILE);
+
+    // The constructor only loads the file if the configuration generates proofs
+    StarkInfo starkInfo(config, starkInfoFile);
+    if (!config.generateProof())
+    {
+        json starkInfoJson;
+        file2json(starkInfoFile, starkInfoJson);
+        starkInfo.load(starkInfoJson);
+    }
+
+    ChelpersProgram program;
+    if (!program.compile(starkInfo))
+    {
+        zklog.error("ChelpersProgram::compileFile() failed compiling file=" + starkInfoFile);
+        return false;
+    }
+    string fileName = getFileName(starkInfoFile);
+    program.save(fileName);
+    zklog.info("ChelpersProgram::compileFile() saved file=" + fileName);
+
+    TimerStopAndLog(CHELPERS_PROGRAM_COMPILE_FILE);
+    return true;
+}
@@ -0,0 +1,115 @@
+#ifndef CHELPERS_PROGRAM_HPP
+#define CHELPERS_PROGRAM_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+#include "stark_info.hpp"
+
+using namespace std;
+
+#define CHELPERS_PROGRAM_MAGIC 0x4E47505248435A4BULL // "KZCHRPGN"
+#define CHELPERS_PROGRAM_VERSION 2
+
+/*
+    Circuit-agnostic expressions program, compiled from the step code of a starkinfo.json file and saved into a
+    binary file next to it, that is evaluated by ChelpersSteps instead of the per-circuit generated chelpers.
+*/
+
+// Type of an instruction operand
+typedef enum
+{
+    cot_tmp = 0,          // Temporary: index = slot in the tmp1 (dim 1) or tmp3 (dim 3) array
+    cot_pol = 1,          // Commited or intermediate polynomial: index = offset in params.pols, stride = row size
+    cot_const = 2,        // Constant polynomial: index = polynomial id, stride taken from the constant pols
+    cot_number = 3,       // Number: index = value
+    cot_public = 4,       // Public input: index = public id
+    cot_challenge = 5,    // Challenge: index = challenge id
+    cot_eval = 6,         // Evaluation: index = evaluation id
+    cot_x = 7,            // x_n or x_2ns of the row
+    cot_Zi = 8,           // zhInv of the row
+    cot_xDivXSubXi = 9,   // xDivXSubXi of the row
+    cot_xDivXSubWXi = 10, // xDivXSubWXi of the row
+    cot_q = 11,           // Destination only: q_2ns of the row = zhInv * result
+    cot_f = 12            // Destination only: f_2ns of the row = result
+} eChelpersOperandType;
+
+// Instruction operation
+typedef enum
+{
+    cop_add = 0,
+    cop_sub = 1,
+    cop_mul = 2,
+    cop_copy = 3
+} eChelpersOperation;
+
+class ChelpersOperand
+{
+public:
+    uint32_t type;   // eChelpersOperandType
+    uint32_t dim;    // 1 or 3
+    uint64_t index;  // Meaning depends on type
+    uint64_t stride; // Row size of cot_pol operands
+    uint64_t next;   // Row shift of primed operands, 0 otherwise
+};
+
+class ChelpersInstruction
+{
+public:
+    uint64_t op; // eChelpersOperation
+    ChelpersOperand dest;
+    ChelpersOperand src[2]; // src[1] is not used by cop_copy
+};
+
+// Program of a step, i.e. the expressions evaluated for every row of its domain
+class ChelpersStepProgram
+{
+public:
+    bool extended;  // Evaluated over the extended domain (2ns) instead of the base one (n)
+    uint64_t N;     // Number of rows of the domain, used to wrap primed operands
+    uint64_t nTemp1;
+    uint64_t nTemp3;
+    vector<ChelpersInstruction> instructions;
+
+    ChelpersStepProgram() : extended(false), N(0), nTemp1(0), nTemp3(0) {};
+
+    // Compiles the step code, allocating the temporaries so that slots are reused after their last read
+    bool compile (StarkInfo &starkInfo, const Step &step, bool bExtended, const string &name);
+};
+
+class ChelpersProgram
+{
+public:
+    // Starkinfo attributes the program depends on, checked when loaded
+    uint64_t nBits;
+    uint64_t nBitsExt;
+    uint64_t mapTotalN;
+    uint64_t nConstants;
+    uint64_t nPublics;
+    uint64_t qDim;
+    uint64_t stepsHash; // Hash of the step definitions and of the polynomial maps their operands are resolved with
+
+    ChelpersStepProgram step2prev;
+    ChelpersStepProgram step3prev;
+    ChelpersStepProgram step3;
+    ChelpersStepProgram step42ns;
+    ChelpersStepProgram step52ns;
+
+    ChelpersProgram() : nBits(0), nBitsExt(0), mapTotalN(0), nConstants(0), nPublics(0), qDim(0), stepsHash(0) {};
+
+    bool compile (StarkInfo &starkInfo);
+
+    void save (const string &fileName) const;
+    bool load (const string &fileName, const StarkInfo &starkInfo);
+
+    // Returns the hash of the starkinfo attributes a program is compiled from, other than the ones checked one by one
+    static uint64_t getStepsHash (const StarkInfo &starkInfo);
+
+    // Returns the program file name of a starkinfo file, e.g. zkevm.chelpers.bin for zkevm.starkinfo.json
+    static string getFileName (const string &starkInfoFile);
+
+    // Compiles the program of a starkinfo file and saves it into its program file name
+    static bool compileFile (const Config &config, const string &starkInfoFile);
+};
+
+#endif
@@ -0,0 +1,281 @@
+#include <vector>
+#include "chelpers_steps.hpp"
+#include "goldilocks_batch.hpp"
+
+// Evaluation state of a batch of rows
+template <class B>
+class ChelpersBatch
+{
+public:
+    const ChelpersStepProgram &program;
+    StepsParams &params;
+    Goldilocks::Element *pConst;
+    uint64_t numConstPols;
+    Polinomial &x;
+    typename B::Reg *tmp1;
+    typename B::Reg *tmp3;
+    const typename B::Reg *challenges; // 3 Regs per challenge, already set to its value in every row
+    const typename B::Reg *evals; // 3 Regs per evaluation, already set to its value in every row
+    typename B::Reg zero;
+    uint64_t i; // First row of the batch
+    uint64_t offsets[B::SIZE];
+    Goldilocks::Element buffer[B::SIZE];
+
+    ChelpersBatch (const ChelpersStepProgram &program, StepsParams &params, typename B::Reg *tmp1, typename B::Reg *tmp3, const typename B::Reg *challenges, const typename B::Reg *evals) :
+        program(program),
+        params(params),
+        pConst(&(program.extended ? params.pConstPols2ns : params.pConstPols)->getElement(0, 0)),
+        numConstPols((program.extended ? params.pConstPols2ns : params.pConstPols)->numPols()),
+        x(program.extended ? params.x_2ns : params.x_n),
+        tmp1(tmp1),
+        tmp3(tmp3),
+        challenges(challenges),
+        evals(evals),
+        i(0)
+    {
+        B::set(zero, Goldilocks::zero());
+    };
+
+    // Loads dim columns of a polynomial, whose rows are stride elements long
+    inline void loadRows (typename B::Reg *r, const Goldilocks::Element *p, uint64_t stride, uint64_t dim, uint64_t next)
+    {
+        if (next == 0)
+        {
+            for (uint64_t d = 0; d < dim; d++) B::load(r[d], p + i * stride + d, stride);
+            return;
+        }
+        for (uint64_t j = 0; j < B::SIZE; j++) offsets[j] = ((i + j + next) % program.N) * stride;
+        for (uint64_t d = 0; d < dim; d++) B::load(r[d], p + d, offsets);
+    }
+
+    inline void loadZi (typename B::Reg &r)
+    {
+        for (uint64_t j = 0; j < B::SIZE; j++) buffer[j] = params.zi.zhInv(i + j);
+        B::load(r, buffer, 1);
+    }
+
+    // Returns the value of an operand, which is loaded into r unless it is a temporary, a challenge or an evaluation
+    inline const typename B::Reg * load (const ChelpersOperand &operand, typename B::Reg *r)
+    {
+        switch (operand.type)
+        {
+            case cot_tmp:
+                return (operand.dim == 1) ? &tmp1[operand.index] : &tmp3[3 * operand.index];
+            case cot_pol:
+                loadRows(r, params.pols + operand.index, operand.stride, operand.dim, operand.next);
+                break;
+            case cot_const:
+                loadRows(r, pConst + operand.index, numConstPols, 1, operand.next);
+                break;
+            case cot_number:
+                B::set(r[0], Goldilocks::fromU64(operand.index));
+                break;
+            case cot_public:
+                B::set(r[0], params.publicInputs[operand.index]);
+                break;
+            case cot_challenge:
+                return &challenges[3 * operand.index];
+            case cot_eval:
+                return &evals[3 * operand.index];
+            case cot_x:
+                B::load(r[0], x[i], x.offset());
+                break;
+            case cot_Zi:
+                loadZi(r[0]);
+                break;
+            case cot_xDivXSubXi:
+                for (uint64_t d = 0; d < 3; d++) B::load(r[d], params.xDivXSubXi[i] + d, params.xDivXSubXi.offset());
+                break;
+            case cot_xDivXSubWXi:
+                for (uint64_t d = 0; d < 3; d++) B::load(r[d], params.xDivXSubWXi[i] + d, params.xDivXSubWXi.offset());
+                break;
+        }
+        return r;
+    }
+
+    // Stores a result of dimension dim into the destination operand
+    inline void store (const ChelpersOperand &operand, typename B::Reg *r, uint64_t dim)
+    {
+        if (dim < operand.dim)
+        {
+            r[1] = zero;
+            r[2] = zero;
+        }
+        switch (operand.type)
+        {
+            case cot_tmp:
+            {
+                typename B::Reg *t = (operand.dim == 1) ? &tmp1[operand.index] : &tmp3[3 * operand.index];
+                for (uint64_t d = 0; d < operand.dim; d++) t[d] = r[d];
+                break;
+            }
+            case cot_pol:
+            {
+                Goldilocks::Element *p = params.pols + operand.index;
+                if (operand.next == 0)
+                {
+                    for (uint64_t d = 0; d < operand.dim; d++) B::store(p + i * operand.stride + d, operand.stride, r[d]);
+                    break;
+                }
+                for (uint64_t j = 0; j < B::SIZE; j++) offsets[j] = ((i + j + operand.next) % program.N) * operand.stride;
+                for (uint64_t d = 0; d < operand.dim; d++) B::store(p + d, offsets, r[d]);
+                break;
+            }
+            case cot_q:
+            {
+                typename B::Reg zi, q;
+                loadZi(zi);
+                for (uint64_t d = 0; d < operand.dim; d++)
+                {
+                    B::mul(q, r[d], zi);
+                    B::store(params.q_2ns + i * operand.dim + d, operand.dim, q);
+                }
+                break;
+            }
+            case cot_f:
+                for (uint64_t d = 0; d < 3; d++) B::store(params.f_2ns + i * 3 + d, 3, r[d]);
+                break;
+        }
+    }
+
+    // Evaluates all the instructions for the rows [i, i + SIZE)
+    inline void evaluate (uint64_t row)
+    {
+        i = row;
+        typename B::Reg a[3], b[3], res[3];
+        const uint64_t nInstructions = program.instructions.size();
+        for (uint64_t k = 0; k < nInstructions; k++)
+        {
+            const ChelpersInstruction &instruction = program.instructions[k];
+            const typename B::Reg *pa = load(instruction.src[0], a);
+            const uint64_t da = instruction.src[0].dim;
+            uint64_t dim = da;
+            if (instruction.op == cop_copy)
+            {
+                for (uint64_t d = 0; d < da; d++) res[d] = pa[d];
+                store(instruction.dest, res, dim);
+                continue;
+            }
+            const typename B::Reg *pb = load(instruction.src[1], b);
+            const uint64_t db = instruction.src[1].dim;
+            if (db > dim) dim = db;
+            switch (instruction.op)
+            {
+                case cop_add:
+                    B::add(res[0], pa[0], pb[0]);
+                    if (dim == 3)
+                    {
+                        if (da == db)
+                        {
+                            B::add(res[1], pa[1], pb[1]);
+                            B::add(res[2], pa[2], pb[2]);
+                        }
+                        else
+                        {
+                            res[1] = (da == 3) ? pa[1] : pb[1];
+                            res[2] = (da == 3) ? pa[2] : pb[2];
+                        }
+                    }
+                    break;
+                case cop_sub:
+                    B::sub(res[0], pa[0], pb[0]);
+                    if (dim == 3)
+                    {
+                        B::sub(res[1], (da == 3) ? pa[1] : zero, (db == 3) ? pb[1] : zero);
+                        B::sub(res[2], (da == 3) ? pa[2] : zero, (db == 3) ? pb[2] : zero);
+                    }
+                    break;
+                case cop_mul:
+                    if (dim == 1)
+                    {
+                        B::mul(res[0], pa[0], pb[0]);
+                    }
+                    else if (da == db)
+                    {
+                        B::mul3(res, pa, pb);
+                    }
+                    else
+                    {
+                        const typename B::Reg *pv = (da == 3) ? pa : pb;
+                        const typename B::Reg &s = (da == 3) ? pb[0] : pa[0];
+                        for (uint64_t d = 0; d < 3; d++) B::mul(res[d], pv[d], s);
+                    }
+                    break;
+            }
+            store(instruction.dest, res, dim);
+        }
+    }
+};
+
+// Returns the number of elements of an extension field array (challenges or evaluations) read by a step program
+static uint64_t chelpersReadCount (const ChelpersStepProgram &stepProgram, uint32_t type)
+{
+    uint64_t count = 0;
+    for (uint64_t k = 0; k < stepProgram.instructions.size(); k++)
+    {
+        for (uint64_t s = 0; s < 2; s++)
+        {
+            const ChelpersOperand &operand = stepProgram.instructions[k].src[s];
+            if ((operand.type == type) && (operand.index >= count)) count = operand.index + 1;
+        }
+    }
+    return count;
+}
+
+// Sets every row of 3 Regs per element to the values of count extension field elements
+template <class B>
+static void chelpersBroadcast (vector<typename B::Reg> &regs, Polinomial &pol, uint64_t count)
+{
+    regs.resize(3 * count + 1);
+    for (uint64_t e = 0; e < count; e++)
+    {
+        for (uint64_t d = 0; d < 3; d++) B::set(regs[3 * e + d], pol[e][d]);
+    }
+}
+
+template <class B>
+static void chelpersEvaluate (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t nrows)
+{
+    if (stepProgram.instructions.empty()) return;
+
+    // The challenges and evaluations are the same for all the rows, so they are set once per step
+    vector<typename B::Reg> challenges, evals;
+    chelpersBroadcast<B>(challenges, params.challenges, chelpersReadCount(stepProgram, cot_challenge));
+    chelpersBroadcast<B>(evals, params.evals, chelpersReadCount(stepProgram, cot_eval));
+
+#pragma omp parallel
+    {
+        vector<typename B::Reg> tmp1(stepProgram.nTemp1 + 1);
+        vector<typename B::Reg> tmp3(3 * stepProgram.nTemp3 + 1);
+        ChelpersBatch<B> batch(stepProgram, params, tmp1.data(), tmp3.data(), challenges.data(), evals.data());
+#pragma omp for
+        for (uint64_t i = 0; i < nrows; i += B::SIZE)
+        {
+            batch.evaluate(i);
+        }
+    }
+}
+
+void ChelpersSteps::evaluateRow (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t i)
+{
+    // Called for every row, from the caller threads
+    static thread_local vector<Goldilocks::Element> tmp1;
+    static thread_local vector<Goldilocks::Element> tmp3;
+    if (tmp1.size() <= stepProgram.nTemp1) tmp1.resize(stepProgram.nTemp1 + 1);
+    if (tmp3.size() <= 3 * stepProgram.nTemp3) tmp3.resize(3 * stepProgram.nTemp3 + 1);
+    // A scalar Reg is an element, so the challenges and evaluations are read in place
+    ChelpersBatch<BatchScalar> batch(stepProgram, params, tmp1.data(), tmp3.data(), params.challenges[0], params.evals[0]);
+    batch.evaluate(i);
+}
+
+void ChelpersSteps::evaluateAvx (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t nrows)
+{
+    chelpersEvaluate<BatchAvx>(stepProgram, params, nrows);
+}
+
+#ifdef __AVX512__
+void ChelpersSteps::evaluateAvx512 (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t nrows)
+{
+    chelpersEvaluate<BatchAvx512>(stepProgram, params, nrows);
+}
+#endif
@@ -0,0 +1,77 @@
+#ifndef CHELPERS_STEPS_HPP
+#define CHELPERS_STEPS_HPP
+
+#include "goldilocks_cubic_extension.hpp"
+#include "zhInv.hpp"
+#include "starks.hpp"
+#include "constant_pols_starks.hpp"
+#include "chelpers_program.hpp"
+
+// Number of rows evaluated at once by the parser methods
+#ifdef __AVX512__
+#define CHELPERS_NROWS_BATCH 8
+#else
+#define CHELPERS_NROWS_BATCH 4
+#endif
+
+/*
+    Circuit-agnostic steps: evaluates the expressions programs of a ChelpersProgram, loaded from the binary file
+    next to the starkinfo.json, instead of the per-circuit generated chelpers code.
+    The same interpreter is instantiated for 1 row (scalar), 4 rows (AVX2) and 8 rows (AVX-512) per batch.
+*/
+class ChelpersSteps : public Steps
+{
+public:
+    ChelpersProgram program;
+
+    bool load (const string &fileName, const StarkInfo &starkInfo) { return program.load(fileName, starkInfo); };
+
+    void step2prev_first(StepsParams &params, uint64_t i) { evaluateRow(program.step2prev, params, i); };
+    void step2prev_i(StepsParams &params, uint64_t i) { evaluateRow(program.step2prev, params, i); };
+    void step2prev_last(StepsParams &params, uint64_t i) { evaluateRow(program.step2prev, params, i); };
+    void step2prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx(program.step2prev, params, nrows); };
+#ifdef __AVX512__
+    void step2prev_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx512(program.step2prev, params, nrows); };
+#endif
+
+    void step3prev_first(StepsParams &params, uint64_t i) { evaluateRow(program.step3prev, params, i); };
+    void step3prev_i(StepsParams &params, uint64_t i) { evaluateRow(program.step3prev, params, i); };
+    void step3prev_last(StepsParams &params, uint64_t i) { evaluateRow(program.step3prev, params, i); };
+    void step3prev_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx(program.step3prev, params, nrows); };
+#ifdef __AVX512__
+    void step3prev_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx512(program.step3prev, params, nrows); };
+#endif
+
+    void step3_first(StepsParams &params, uint64_t i) { evaluateRow(program.step3, params, i); };
+    void step3_i(StepsParams &params, uint64_t i) { evaluateRow(program.step3, params, i); };
+    void step3_last(StepsParams &params, uint64_t i) { evaluateRow(program.step3, params, i); };
+    void step3_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx(program.step3, params, nrows); };
+#ifdef __AVX512__
+    void step3_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx512(program.step3, params, nrows); };
+#endif
+
+    void step42ns_first(StepsParams &params, uint64_t i) { evaluateRow(program.step42ns, params, i); };
+    void step42ns_i(StepsParams &params, uint64_t i) { evaluateRow(program.step42ns, params, i); };
+    void step42ns_last(StepsParams &params, uint64_t i) { evaluateRow(program.step42ns, params, i); };
+    void step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx(program.step42ns, params, nrows); };
+#ifdef __AVX512__
+    void step42ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx512(program.step42ns, params, nrows); };
+#endif
+
+    void step52ns_first(StepsParams &params, uint64_t i) { evaluateRow(program.step52ns, params, i); };
+    void step52ns_i(StepsParams &params, uint64_t i) { evaluateRow(program.step52ns, params, i); };
+    void step52ns_last(StepsParams &params, uint64_t i) { evaluateRow(program.step52ns, params, i); };
+    void step52ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx(program.step52ns, params, nrows); };
+#ifdef __AVX512__
+    void step52ns_parser_first_avx512(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch) { evaluateAvx512(program.step52ns, params, nrows); };
+#endif
+
+    // Evaluates a step program for one row, or for nrows rows in parallel batches
+    static void evaluateRow (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t i);
+    static void evaluateAvx (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t nrows);
+#ifdef __AVX512__
+    static void evaluateAvx512 (const ChelpersStepProgram &stepProgram, StepsParams &params, uint64_t nrows);
+#endif
+};
+
+#endif
@@ -10,21 +10,36 @@
 #include <sys/mman.h>
 #include <fcntl.h>
 #include <unistd.h>
+#include <vector>
+#include <map>
+#include <memory>
+#include <mutex>
 
 #include "goldilocks_base_field.hpp"
-#include "fr_goldilocks.hpp"
 #include "zklog.hpp"
+#include "exit_process.hpp"
 
+/*
+    Exec file of a verifier circuit: the list of adds (idx_1, idx_2, c_1, c_2), which compute
+    tmp[sizeWitness + i] = tmp[idx_1]*c_1 + tmp[idx_2]*c_2, and the map from the signals to the commited pols.
+    Its values are raw 64-bit integers, already in normal (non Montgomery) form.
+*/
 class ExecFile
 {
 public:
     uint64_t nAdds;
     uint64_t nSMap;
+    uint64_t nCommitedPols;
 
-    FrGElement *p_adds;
-    FrGElement *p_sMap;
+    std::vector<uint64_t> p_adds;
+    std::vector<uint64_t> p_sMap;
 
-    ExecFile(std::string execFile, uint64_t nCommitedPols)
+    // Adds sorted by level, where the adds of a level only depend on the witness or on adds of previous levels,
+    // so that every level can be computed in parallel; addsLevels[l] is the first add of level l in addsOrder
+    std::vector<uint64_t> addsOrder;
+    std::vector<uint64_t> addsLevels;
+
+    ExecFile(std::string execFile, uint64_t _nCommitedPols, uint64_t sizeWitness) : nCommitedPols(_nCommitedPols)
     {
         int fd;
         struct stat sb;
@@ -48,26 +63,68 @@ public:
         nAdds = (uint64_t)p_data[0];
         nSMap = (uint64_t)p_data[1];
 
-        p_adds = new FrGElement[nAdds * 4];
-        p_sMap = new FrGElement[nSMap * nCommitedPols];
-        for (uint64_t i = 0; i < nAdds * 4; i++)
+        p_adds.assign(p_data + 2, p_data + 2 + nAdds * 4);
+        p_sMap.assign(p_data + 2 + nAdds * 4, p_data + 2 + nAdds * 4 + nSMap * nCommitedPols);
+        munmap(p_data, sb.st_size);
+
+        // Compute the level of every add and sort them by level
+        std::vector<uint64_t> level(nAdds);
+        std::vector<uint64_t> levelSize;
+        for (uint64_t i = 0; i < nAdds; i++)
         {
-            p_adds[i].shortVal = 0;
-            p_adds[i].type = FrG_LONG;
-            p_adds[i].longVal[0] = p_data[i + 2];
+            uint64_t l = 0;
+            for (uint64_t k = 0; k < 2; k++)
+            {
+                uint64_t idx = p_adds[i * 4 + k];
+                if (idx >= sizeWitness)
+                {
+                    if (idx - sizeWitness >= i)
+                    {
+                        zklog.error("ExecFile::ExecFile() found add=" + to_string(i) + " depending on a later add idx=" + to_string(idx) + " in file=" + execFile);
+                        exitProcess();
+                    }
+                    l = std::max(l, level[idx - sizeWitness] + 1);
+                }
+            }
+            level[i] = l;
+            if (l == levelSize.size()) levelSize.push_back(0);
+            levelSize[l]++;
         }
-        for (uint64_t j = 0; j < nSMap * nCommitedPols; j++)
+        addsLevels.resize(levelSize.size() + 1);
+        addsLevels[0] = 0;
+        for (uint64_t l = 0; l < levelSize.size(); l++)
         {
-            p_sMap[j].shortVal = 0;
-            p_sMap[j].type = FrG_LONG;
-            p_sMap[j].longVal[0] = p_data[2 + nAdds * 4 + j];
+            addsLevels[l + 1] = addsLevels[l] + levelSize[l];
+        }
+        std::vector<uint64_t> next(addsLevels.begin(), addsLevels.end() - 1);
+        addsOrder.resize(nAdds);
+        for (uint64_t i = 0; i < nAdds; i++)
+        {
+            addsOrder[next[level[i]]++] = i;
         }
-        munmap(p_data, sb.st_size);
     }
-    ~ExecFile()
+
+    inline uint64_t nLevels() const { return addsLevels.size() - 1; }
+
+    // Returns the exec file, which is loaded only the first time it is requested in this process
+    static const ExecFile &get(const std::string &execFile, uint64_t nCommitedPols, uint64_t sizeWitness)
     {
-        delete[] p_adds;
-        delete[] p_sMap;
+        static std::mutex registryMutex;
+        static std::map<std::string, std::unique_ptr<ExecFile>> registry;
+
+        std::lock_guard<std::mutex> guard(registryMutex);
+        std::unique_ptr<ExecFile> &pExecFile = registry[execFile];
+        if (pExecFile == nullptr)
+        {
+            pExecFile.reset(new ExecFile(execFile, nCommitedPols, sizeWitness));
+            zklog.info("ExecFile::get() loaded file=" + execFile + " nAdds=" + to_string(pExecFile->nAdds) + " nSMap=" + to_string(pExecFile->nSMap) + " nLevels=" + to_string(pExecFile->nLevels()));
+        }
+        else if (pExecFile->nCommitedPols != nCommitedPols)
+        {
+            zklog.error("ExecFile::get() called with nCommitedPols=" + to_string(nCommitedPols) + " for file=" + execFile + " loaded with nCommitedPols=" + to_string(pExecFile->nCommitedPols));
+            exitProcess();
+        }
+        return *pExecFile;
     }
 };
 #endif
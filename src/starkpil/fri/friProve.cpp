@@ -1,16 +1,44 @@
 #include "friProve.hpp"
 #include "timer.hpp"
 #include "zklog.hpp"
+#include "zkmax.hpp"
+#include "goldilocks_batch.hpp"
 
-void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo)
+// Groups folded at once, i.e. number of extension field columns of every INTT
+#define FRI_FOLD_BATCH 64
+
+// Evaluates the polynomials of B::SIZE groups, whose coefficients are the rows of coefs, at their points y, using the
+// Horner scheme; the values of consecutive groups are 3 elements apart in coefs, y and res
+template <class B>
+static inline void friHorner(const Goldilocks::Element *coefs, uint64_t nX, uint64_t rowSize, const Goldilocks::Element *y, Goldilocks::Element *res)
 {
-    //TimerStart(STARK_FRI_PROVE);
+    typename B::Reg r[3], yr[3], t[3], c[3];
+    for (uint64_t d = 0; d < 3; d++)
+    {
+        B::load(yr[d], y + d, 3);
+        B::load(r[d], coefs + (nX - 1) * rowSize + d, 3);
+    }
+    for (int64_t i = nX - 2; i >= 0; i--)
+    {
+        B::mul3(t, r, yr);
+        for (uint64_t d = 0; d < 3; d++)
+        {
+            B::load(c[d], coefs + i * rowSize + d, 3);
+            B::add(r[d], t[d], c[d]);
+        }
+    }
+    for (uint64_t d = 0; d < 3; d++)
+    {
+        B::store(res + d, 3, r[d]);
+    }
+}
 
-    Polinomial polShift(1, 1);
-    Polinomial polShiftInv(1, 1);
+void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo &starkInfo)
+{
+    //TimerStart(STARK_FRI_PROVE);
+    zkassert(friPol.offset() == FIELD_EXTENSION);
 
-    *polShift[0] = Goldilocks::shift();
-    *polShiftInv[0] = Goldilocks::inv(Goldilocks::shift());
+    Goldilocks::Element shiftInv = Goldilocks::inv(Goldilocks::shift());
 
     uint64_t pol2N = 0;
 
@@ -26,99 +54,93 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
 
         Polinomial pol2_e(pol2N, FIELD_EXTENSION);
 
-        Polinomial special_x(1, FIELD_EXTENSION);
-        transcript.getField(special_x.address());
+        Goldilocks::Element special_x[FIELD_EXTENSION];
+        transcript.getField(special_x);
 
-        Polinomial sinv(1, 1);
-        Polinomial wi(1, 1);
+        Goldilocks::Element wi = Goldilocks::inv(Goldilocks::w(polBits));
 
-        *sinv[0] = *polShiftInv[0];
-        *wi[0] = Goldilocks::inv(Goldilocks::w(polBits));
-
-        uint64_t nn = ((1 << polBits) / nX);
-        u_int64_t maxth = omp_get_max_threads();
-        if (maxth > nn)
+        // The folded values are also written into the leaves of the next tree, transposed in groups, i.e. the value
+        // g goes to the row g % nGroups, as element g / nGroups of the group
+        Goldilocks::Element *pTreeSource = NULL;
+        uint64_t nGroups = 1;
+        uint64_t groupSize = pol2N;
+        if (si < starkInfo.starkStruct.steps.size() - 1)
         {
-            maxth = nn;
+            nGroups = 1 << starkInfo.starkStruct.steps[si + 1].nBits;
+            groupSize = (1 << starkInfo.starkStruct.steps[si].nBits) / nGroups;
+            treesFRIGL[si + 1] = new MerkleTreeGL(nGroups, groupSize * FIELD_EXTENSION, NULL);
+            pTreeSource = treesFRIGL[si + 1]->source;
         }
-#pragma omp parallel num_threads(maxth)
-        {
-            u_int64_t nth = omp_get_num_threads();
-            u_int64_t thid = omp_get_thread_num();
-            u_int64_t chunk = nn / nth;
-            u_int64_t res = nn - nth * chunk;
-
-            // Evaluate bounds of the loop for the thread
-            uint64_t init = chunk * thid;
-            uint64_t end;
-            if (thid < res)
-            {
-                init += thid;
-                end = init + chunk + 1;
-            }
-            else
-            {
-                init += res;
-                end = init + chunk;
-            }
-            //  Evaluate the starting point for the sinv
-            Goldilocks::Element aux = *wi[0];
-            Goldilocks::Element sinv_ = *sinv[0];
-            for (uint64_t i = 0; i < chunk - 1; ++i)
-            {
-                aux = aux * (*wi[0]);
-            }
-            for (u_int64_t i = 0; i < thid; ++i)
-            {
-                sinv_ = sinv_ * aux;
-            }
-            u_int64_t ncor = res;
-            if (thid < res)
-            {
-                ncor = thid;
-            }
-            for (u_int64_t j = 0; j < ncor; ++j)
-            {
-                sinv_ = sinv_ * (*wi[0]);
-            }
 
-            for (uint64_t g = init; g < end; g++)
+        uint64_t batchSize = zkmin(pol2N, uint64_t(FRI_FOLD_BATCH));
+        uint64_t nBatches = pol2N / batchSize;
+#pragma omp parallel
+        {
+            // Every value g of the folded polynomial is the evaluation at special_x of the polynomial that interpolates
+            // the values g, g + pol2N, g + 2*pol2N... over the coset shift * w^g, i.e. the evaluation at
+            // special_x * shiftInv * wi^g of the polynomial that interpolates them over the roots of unity
+            NTT_Goldilocks ntt(nX, 1);
+            uint64_t rowSize = batchSize * FIELD_EXTENSION;
+            std::vector<Goldilocks::Element> ppar(si == 0 ? 0 : nX * rowSize);
+            std::vector<Goldilocks::Element> ppar_c(si == 0 ? 0 : nX * rowSize);
+            std::vector<Goldilocks::Element> y(si == 0 ? 0 : rowSize);
+
+#pragma omp for
+            for (uint64_t batch = 0; batch < nBatches; batch++)
             {
+                uint64_t g0 = batch * batchSize;
                 if (si == 0)
                 {
-                    Polinomial::copyElement(pol2_e, g, friPol, g);
+                    std::memcpy(pol2_e[g0], friPol[g0], rowSize * sizeof(Goldilocks::Element));
                 }
                 else
                 {
-                    Polinomial ppar(nX, FIELD_EXTENSION);
-                    Polinomial ppar_c(nX, FIELD_EXTENSION);
-
                     for (uint64_t i = 0; i < nX; i++)
                     {
-                        Polinomial::copyElement(ppar, i, friPol, (i * pol2N) + g);
+                        std::memcpy(&ppar[i * rowSize], friPol[i * pol2N + g0], rowSize * sizeof(Goldilocks::Element));
+                    }
+                    ntt.INTT(ppar_c.data(), ppar.data(), nX, rowSize);
+
+                    Goldilocks::Element sinv = shiftInv * Goldilocks::exp(wi, g0);
+                    for (uint64_t b = 0; b < batchSize; b++)
+                    {
+                        for (uint64_t d = 0; d < FIELD_EXTENSION; d++)
+                        {
+                            y[b * FIELD_EXTENSION + d] = special_x[d] * sinv;
+                        }
+                        sinv = sinv * wi;
+                    }
+
+                    uint64_t b = 0;
+#ifdef __AVX512__
+                    for (; b + BatchAvx512::SIZE <= batchSize; b += BatchAvx512::SIZE)
+                    {
+                        friHorner<BatchAvx512>(&ppar_c[b * FIELD_EXTENSION], nX, rowSize, &y[b * FIELD_EXTENSION], pol2_e[g0 + b]);
                     }
-                    NTT_Goldilocks ntt(nX, 1);
+#endif
+                    for (; b + BatchAvx::SIZE <= batchSize; b += BatchAvx::SIZE)
+                    {
+                        friHorner<BatchAvx>(&ppar_c[b * FIELD_EXTENSION], nX, rowSize, &y[b * FIELD_EXTENSION], pol2_e[g0 + b]);
+                    }
+                    for (; b < batchSize; b++)
+                    {
+                        friHorner<BatchScalar>(&ppar_c[b * FIELD_EXTENSION], nX, rowSize, &y[b * FIELD_EXTENSION], pol2_e[g0 + b]);
+                    }
+                }
 
-                    ntt.INTT(ppar_c.address(), ppar.address(), nX, FIELD_EXTENSION);
-                    polMulAxi(ppar_c, Goldilocks::one(), sinv_); // Multiplies coefs by 1, shiftInv, shiftInv^2, shiftInv^3, ......
-                    evalPol(pol2_e, g, ppar_c, special_x);
-                    sinv_ = sinv_ * (*wi[0]);
+                if (pTreeSource != NULL)
+                {
+                    for (uint64_t g = g0; g < g0 + batchSize; g++)
+                    {
+                        std::memcpy(&pTreeSource[((g % nGroups) * groupSize + g / nGroups) * FIELD_EXTENSION], pol2_e[g], FIELD_EXTENSION * sizeof(Goldilocks::Element));
+                    }
                 }
             }
         }
 
         if (si < starkInfo.starkStruct.steps.size() - 1)
         {
-            uint64_t nGroups = 1 << starkInfo.starkStruct.steps[si + 1].nBits;
-            uint64_t groupSize = (1 << starkInfo.starkStruct.steps[si].nBits) / nGroups;
-
-            // Re-org in groups
-            Polinomial aux(pol2N, FIELD_EXTENSION);
-            getTransposed(aux, pol2_e, starkInfo.starkStruct.steps[si + 1].nBits);
-
             Polinomial rootGL(HASH_SIZE, 1);
-            treesFRIGL[si + 1] = new MerkleTreeGL(nGroups, groupSize * FIELD_EXTENSION, NULL);
-            treesFRIGL[si + 1]->copySource(aux.address());
             treesFRIGL[si + 1]->merkelize();
             treesFRIGL[si + 1]->getRoot(rootGL.address());
             zklog.info("rootGL[" + to_string(si + 1) + "]: " + rootGL.toString(4));
@@ -143,8 +165,7 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
 
         for (uint64_t j = 0; j < reductionBits; j++)
         {
-            Goldilocks::mul(*polShiftInv[0], *polShiftInv[0], *polShiftInv[0]);
-            Goldilocks::mul(*polShift[0], *polShift[0], *polShift[0]);
+            Goldilocks::mul(shiftInv, shiftInv, shiftInv);
         }
     }
     //TimerStopAndLog(STARK_FRI_PROVE_STEPS);
@@ -152,25 +173,31 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
 
     //TimerStart(STARK_FRI_QUERIES);
 
-    uint64_t ys[starkInfo.starkStruct.nQueries];
-    transcript.getPermutations(ys, starkInfo.starkStruct.nQueries, starkInfo.starkStruct.steps[0].nBits);
+    uint64_t nQueries = starkInfo.starkStruct.nQueries;
+    uint64_t ys[nQueries];
+    transcript.getPermutations(ys, nQueries, starkInfo.starkStruct.steps[0].nBits);
 
     for (uint64_t si = 0; si < starkInfo.starkStruct.steps.size(); si++)
     {
-        for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
+        // The queries only read the trees, so they are extracted in parallel into their final position
+        std::vector<std::vector<MerkleProof>> &polQueries = fproof.proofs.fri.trees[si].polQueries;
+        uint64_t firstQuery = polQueries.size();
+        polQueries.resize(firstQuery + nQueries);
+#pragma omp parallel for
+        for (uint64_t i = 0; i < nQueries; i++)
         {
             if (si == 0)
             {
-                queryPol(fproof, treesGL, ys[i], si);
+                queryPol(polQueries[firstQuery + i], treesGL, ys[i]);
             }
             else
             {
-                queryPol(fproof, treesFRIGL[si], ys[i], si);
+                queryPol(polQueries[firstQuery + i], treesFRIGL[si], ys[i]);
             }
         }
         if (si < starkInfo.starkStruct.steps.size() - 1)
         {
-            for (uint64_t i = 0; i < starkInfo.starkStruct.nQueries; i++)
+            for (uint64_t i = 0; i < nQueries; i++)
             {
                 ys[i] = ys[i] % (1 << starkInfo.starkStruct.steps[si + 1].nBits);
             }
@@ -189,83 +216,24 @@ void FRIProve::prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transc
     return;
 }
 
-void FRIProve::polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc)
-{
-    Goldilocks::Element r = init;
-    for (uint64_t i = 0; i < pol.degree(); i++)
-    {
-        Polinomial::mulElement(pol, i, pol, i, r);
-        r = r * acc;
-    }
-}
-void FRIProve::evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x)
-{
-    if (p.degree() == 0)
-    {
-        res[res_idx][0] = Goldilocks::zero();
-        res[res_idx][1] = Goldilocks::zero();
-        res[res_idx][2] = Goldilocks::zero();
-        return;
-    }
-    Polinomial::copyElement(res, res_idx, p, p.degree() - 1);
-    for (int64_t i = p.degree() - 2; i >= 0; i--)
-    {
-        Polinomial aux(1, 3);
-        Polinomial::mulElement(aux, 0, res, res_idx, x, 0);
-        Polinomial::addElement(res, res_idx, aux, 0, p, i);
-    }
-}
-
-void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL *treesGL[5], uint64_t idx, uint64_t treeIdx)
+void FRIProve::queryPol(vector<MerkleProof> &vMkProof, MerkleTreeGL *treesGL[5], uint64_t idx)
 {
-    vector<MerkleProof> vMkProof;
     for (uint i = 0; i < 5; i++)
     {
         MerkleTreeGL *treesGLTmp = treesGL[i];
-        Goldilocks::Element buff[treesGLTmp->width + treesGLTmp->MerkleProofSize() * HASH_SIZE] = {Goldilocks::zero()};
+        vector<Goldilocks::Element> buff(treesGLTmp->width + treesGLTmp->MerkleProofSize() * HASH_SIZE, Goldilocks::zero());
 
-        treesGLTmp->getGroupProof(&buff[0], idx);
+        treesGLTmp->getGroupProof(buff.data(), idx);
 
-        MerkleProof mkProof(treesGLTmp->width, treesGLTmp->MerkleProofSize(), &buff[0]);
-        vMkProof.push_back(mkProof);
+        vMkProof.push_back(MerkleProof(treesGLTmp->width, treesGLTmp->MerkleProofSize(), buff.data()));
     }
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
-
-    return;
 }
 
-void FRIProve::queryPol(FRIProof &fproof, MerkleTreeGL *treeGL, uint64_t idx, uint64_t treeIdx)
+void FRIProve::queryPol(vector<MerkleProof> &vMkProof, MerkleTreeGL *treeGL, uint64_t idx)
 {
-    vector<MerkleProof> vMkProof;
-
-    Goldilocks::Element buff[treeGL->width * treeGL->width + treeGL->MerkleProofSize() * HASH_SIZE] = {Goldilocks::zero()};
-    treeGL->getGroupProof(&buff[0], idx);
-
-    MerkleProof mkProof(treeGL->width, treeGL->MerkleProofSize(), &buff[0]);
-    vMkProof.push_back(mkProof);
+    vector<Goldilocks::Element> buff(treeGL->width + treeGL->MerkleProofSize() * HASH_SIZE, Goldilocks::zero());
 
-    fproof.proofs.fri.trees[treeIdx].polQueries.push_back(vMkProof);
+    treeGL->getGroupProof(buff.data(), idx);
 
-    return;
+    vMkProof.push_back(MerkleProof(treeGL->width, treeGL->MerkleProofSize(), buff.data()));
 }
-
-void FRIProve::getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasposeBits)
-{
-    uint64_t w = (1 << trasposeBits);
-    uint64_t h = pol.degree() / w;
-
-#pragma omp parallel for
-    for (uint64_t i = 0; i < w; i++)
-    {
-        for (uint64_t j = 0; j < h; j++)
-        {
-
-            uint64_t fi = j * w + i;
-            uint64_t di = i * h + j;
-            assert(di < aux.degree());
-            assert(fi < pol.degree());
-
-            Polinomial::copyElement(aux, di, pol, fi);
-        }
-    }
-}
\ No newline at end of file
@@ -13,12 +13,11 @@
 class FRIProve
 {
 public:
-    static void prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo starkInfo);
-    static void polMulAxi(Polinomial &pol, Goldilocks::Element init, Goldilocks::Element acc);
-    static void evalPol(Polinomial &res, uint64_t res_idx, Polinomial &p, Polinomial &x);
-    static void queryPol(FRIProof &fproof, MerkleTreeGL **treeGL, uint64_t idx, uint64_t treeIdx);
-    static void queryPol(FRIProof &fproof, MerkleTreeGL *treeGL, uint64_t idx, uint64_t treeIdx);
-    static void getTransposed(Polinomial &aux, Polinomial &pol, uint64_t trasposeBits);
+    static void prove(FRIProof &fproof, MerkleTreeGL **treesGL, Transcript transcript, Polinomial &friPol, uint64_t polBits, StarkInfo &starkInfo);
+
+    // Appends the group proofs of a query to vMkProof, from the 5 stark trees or from a FRI step tree
+    static void queryPol(vector<MerkleProof> &vMkProof, MerkleTreeGL **treeGL, uint64_t idx);
+    static void queryPol(vector<MerkleProof> &vMkProof, MerkleTreeGL *treeGL, uint64_t idx);
 };
 
 #endif
\ No newline at end of file
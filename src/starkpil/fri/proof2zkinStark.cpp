@@ -81,6 +81,75 @@ ordered_json proof2zkinStark(ordered_json &proof)
     return zkinOut;
 };
 
+void merkleProof2zkin(MerkleProof &merkleProof, std::vector<Goldilocks::Element> &vals, std::vector<Goldilocks::Element> &siblings)
+{
+    for (uint64_t i = 0; i < merkleProof.v.size(); i++)
+    {
+        vals.insert(vals.end(), merkleProof.v[i].begin(), merkleProof.v[i].end());
+    }
+    for (uint64_t i = 0; i < merkleProof.mp.size(); i++)
+    {
+        siblings.insert(siblings.end(), merkleProof.mp[i].begin(), merkleProof.mp[i].end());
+    }
+}
+
+void proof2zkinStark(FRIProof &fproof, ZkinStark &zkin)
+{
+    Proofs &proof = fproof.proofs;
+
+    zkin.addSignal("root1", proof.root1);
+    zkin.addSignal("root2", proof.root2);
+    zkin.addSignal("root3", proof.root3);
+    zkin.addSignal("root4", proof.root4);
+
+    std::vector<Goldilocks::Element> evals;
+    for (uint64_t i = 0; i < proof.evals.size(); i++)
+    {
+        evals.insert(evals.end(), proof.evals[i].begin(), proof.evals[i].end());
+    }
+    zkin.addSignal("evals", std::move(evals));
+
+    std::vector<ProofTree> &trees = proof.fri.trees;
+    for (uint64_t i = 1; i < trees.size(); i++)
+    {
+        std::vector<Goldilocks::Element> vals;
+        std::vector<Goldilocks::Element> siblings;
+        for (uint64_t q = 0; q < trees[0].polQueries.size(); q++)
+        {
+            merkleProof2zkin(trees[i].polQueries[q][0], vals, siblings);
+        }
+        zkin.addSignal("s" + std::to_string(i) + "_root", trees[i].root);
+        zkin.addSignal("s" + std::to_string(i) + "_vals", std::move(vals));
+        zkin.addSignal("s" + std::to_string(i) + "_siblings", std::move(siblings));
+    }
+
+    // Step 0 queries contain one merkle proof per tree: cm1, cm2, cm3, cm4 and constants;
+    // cm2 and cm3 can be empty, in which case their signals are not part of the circuit
+    static const char *treeNames[5] = {"1", "2", "3", "4", "C"};
+    for (uint64_t t = 0; t < 5; t++)
+    {
+        if (((t == 1) || (t == 2)) && (trees[0].polQueries[0][t].v.size() == 0))
+        {
+            continue;
+        }
+        std::vector<Goldilocks::Element> vals;
+        std::vector<Goldilocks::Element> siblings;
+        for (uint64_t q = 0; q < trees[0].polQueries.size(); q++)
+        {
+            merkleProof2zkin(trees[0].polQueries[q][t], vals, siblings);
+        }
+        zkin.addSignal(std::string("s0_vals") + treeNames[t], std::move(vals));
+        zkin.addSignal(std::string("s0_siblings") + treeNames[t], std::move(siblings));
+    }
+
+    std::vector<Goldilocks::Element> finalPol;
+    for (uint64_t i = 0; i < proof.fri.pol.size(); i++)
+    {
+        finalPol.insert(finalPol.end(), proof.fri.pol[i].begin(), proof.fri.pol[i].end());
+    }
+    zkin.addSignal("finalPol", std::move(finalPol));
+}
+
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey, uint64_t steps)
 {
     ordered_json zkinOut = ordered_json::object();
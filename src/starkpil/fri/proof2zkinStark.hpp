@@ -1,12 +1,32 @@
 #ifndef PROOF2ZKIN__STARK_HPP
 #define PROOF2ZKIN__STARK_HPP
 
+#include <string>
+#include <vector>
 #include <nlohmann/json.hpp>
 #include "friProof.hpp"
 
 using ordered_json = nlohmann::ordered_json;
 
+// Binary zkin: the input signals of a stark verifier circuit, as (name, values) pairs, where the values are
+// flattened in the same order as the json zkin arrays; it is consumed directly by the circom witness generators
+class ZkinStark
+{
+public:
+    std::vector<std::pair<std::string, std::vector<Goldilocks::Element>>> signals;
+
+    void addSignal(const std::string &name, std::vector<Goldilocks::Element> &&values)
+    {
+        signals.emplace_back(name, std::move(values));
+    }
+    void addSignal(const std::string &name, const std::vector<Goldilocks::Element> &values)
+    {
+        signals.emplace_back(name, values);
+    }
+};
+
 ordered_json proof2zkinStark(ordered_json &fproof);
+void proof2zkinStark(FRIProof &fproof, ZkinStark &zkin);
 ordered_json joinzkin(ordered_json &zkin1, ordered_json &zkin2, ordered_json &verKey, uint64_t steps);
 
 #endif
\ No newline at end of file
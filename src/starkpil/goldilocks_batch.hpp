@@ -0,0 +1,64 @@
+#ifndef GOLDILOCKS_BATCH_HPP
+#define GOLDILOCKS_BATCH_HPP
+
+#include <immintrin.h>
+#include "goldilocks_base_field.hpp"
+#include "goldilocks_cubic_extension.hpp"
+
+/*
+    Batch backends, used by the chelpers interpreter and by the FRI folding: every one of them processes SIZE
+    consecutive rows at once, storing a base field value of every row in a Reg, and an extension field value in
+    3 consecutive Regs
+*/
+
+class BatchScalar
+{
+public:
+    static const uint64_t SIZE = 1;
+    typedef Goldilocks::Element Reg;
+    static inline void load (Reg &r, const Goldilocks::Element *p, uint64_t stride) { r = p[0]; };
+    static inline void load (Reg &r, const Goldilocks::Element *p, uint64_t *offsets) { r = p[offsets[0]]; };
+    static inline void store (Goldilocks::Element *p, uint64_t stride, const Reg &r) { p[0] = r; };
+    static inline void store (Goldilocks::Element *p, uint64_t *offsets, const Reg &r) { p[offsets[0]] = r; };
+    static inline void set (Reg &r, const Goldilocks::Element &e) { r = e; };
+    static inline void add (Reg &c, const Reg &a, const Reg &b) { Goldilocks::add(c, a, b); };
+    static inline void sub (Reg &c, const Reg &a, const Reg &b) { Goldilocks::sub(c, a, b); };
+    static inline void mul (Reg &c, const Reg &a, const Reg &b) { Goldilocks::mul(c, a, b); };
+    static inline void mul3 (Reg *c, const Reg *a, const Reg *b) { Goldilocks3::mul(*(Goldilocks3::Element *)c, *(const Goldilocks3::Element *)a, *(const Goldilocks3::Element *)b); };
+};
+
+class BatchAvx
+{
+public:
+    static const uint64_t SIZE = 4;
+    typedef __m256i Reg;
+    static inline void load (Reg &r, const Goldilocks::Element *p, uint64_t stride) { Goldilocks::copy_avx(r, p, stride); };
+    static inline void load (Reg &r, const Goldilocks::Element *p, uint64_t *offsets) { Goldilocks::copy_avx(r, p, offsets); };
+    static inline void store (Goldilocks::Element *p, uint64_t stride, const Reg &r) { Goldilocks::copy_avx(p, stride, r); };
+    static inline void store (Goldilocks::Element *p, uint64_t *offsets, const Reg &r) { Goldilocks::copy_avx(p, offsets, r); };
+    static inline void set (Reg &r, const Goldilocks::Element &e) { Goldilocks::copy_avx(r, e); };
+    static inline void add (Reg &c, const Reg &a, const Reg &b) { Goldilocks::add_avx(c, a, b); };
+    static inline void sub (Reg &c, const Reg &a, const Reg &b) { Goldilocks::sub_avx(c, a, b); };
+    static inline void mul (Reg &c, const Reg &a, const Reg &b) { Goldilocks::mult_avx(c, a, b); };
+    static inline void mul3 (Reg *c, const Reg *a, const Reg *b) { Goldilocks3::mul_avx(*(Goldilocks3::Element_avx *)c, *(const Goldilocks3::Element_avx *)a, *(const Goldilocks3::Element_avx *)b); };
+};
+
+#ifdef __AVX512__
+class BatchAvx512
+{
+public:
+    static const uint64_t SIZE = 8;
+    typedef __m512i Reg;
+    static inline void load (Reg &r, const Goldilocks::Element *p, uint64_t stride) { Goldilocks::copy_avx512(r, p, stride); };
+    static inline void load (Reg &r, const Goldilocks::Element *p, uint64_t *offsets) { Goldilocks::copy_avx512(r, p, offsets); };
+    static inline void store (Goldilocks::Element *p, uint64_t stride, const Reg &r) { Goldilocks::copy_avx512(p, stride, r); };
+    static inline void store (Goldilocks::Element *p, uint64_t *offsets, const Reg &r) { Goldilocks::copy_avx512(p, offsets, r); };
+    static inline void set (Reg &r, const Goldilocks::Element &e) { Goldilocks::copy_avx512(r, e); };
+    static inline void add (Reg &c, const Reg &a, const Reg &b) { Goldilocks::add_avx512(c, a, b); };
+    static inline void sub (Reg &c, const Reg &a, const Reg &b) { Goldilocks::sub_avx512(c, a, b); };
+    static inline void mul (Reg &c, const Reg &a, const Reg &b) { Goldilocks::mult_avx512(c, a, b); };
+    static inline void mul3 (Reg *c, const Reg *a, const Reg *b) { Goldilocks3::mul_avx512(*(Goldilocks3::Element_avx512 *)c, *(const Goldilocks3::Element_avx512 *)a, *(const Goldilocks3::Element_avx512 *)b); };
+};
+#endif
+
+#endif
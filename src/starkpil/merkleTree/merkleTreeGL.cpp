@@ -1,6 +1,8 @@
 #include "merkleTreeGL.hpp"
 #include <cassert>
 #include <algorithm> // std::max
+#include <omp.h>
+#include <unistd.h>
 
 void MerkleTreeGL::getElement(Goldilocks::Element &element, uint64_t idx, uint64_t subIdx)
 {
@@ -18,27 +20,224 @@ void MerkleTreeGL::getGroupProof(Goldilocks::Element *proof, uint64_t idx)
         getElement(proof[i], idx, i);
     }
 
-    genMerkleProof(&proof[width], idx, 0, height * HASH_SIZE);
+    genMerkleProof(&proof[width], idx, 0, height);
 }
 
 void MerkleTreeGL::genMerkleProof(Goldilocks::Element *proof, uint64_t idx, uint64_t offset, uint64_t n)
 {
-    if (n <= HASH_SIZE)
+    // n is the number of hashes of the current level, which starts at nodes[offset]
+    if (n <= 1)
         return;
-    uint64_t nextIdx = idx >> 1;
-    uint64_t si = (idx ^ 1) * HASH_SIZE;
 
-    std::memcpy(proof, &nodes[offset + si], HASH_SIZE * sizeof(Goldilocks::Element));
+    uint64_t currIdx = idx % arity;
+    uint64_t groupIdx = idx - currIdx;
+    uint64_t p = 0;
+    for (uint64_t i = 0; i < arity; i++)
+    {
+        if (i == currIdx)
+            continue;
+        if (groupIdx + i < n)
+        {
+            std::memcpy(&proof[p * HASH_SIZE], &nodes[offset + (groupIdx + i) * HASH_SIZE], HASH_SIZE * sizeof(Goldilocks::Element));
+        }
+        else
+        {
+            std::memset(&proof[p * HASH_SIZE], 0, HASH_SIZE * sizeof(Goldilocks::Element));
+        }
+        p++;
+    }
 
-    uint64_t nextN = (std::floor((n - 1) / 8) + 1) * HASH_SIZE;
-    genMerkleProof(&proof[HASH_SIZE], nextIdx, offset + nextN * 2, nextN);
+    uint64_t nextN = (n + arity - 1) / arity;
+    genMerkleProof(&proof[(arity - 1) * HASH_SIZE], idx / arity, offset + n * HASH_SIZE, nextN);
 }
 
-void MerkleTreeGL::merkelize()
+// Linear hash of a leaf or a node, with the same vectorized Poseidon that merkletree_avx* used for the whole tree
+static inline void linearHashAvx(Goldilocks::Element *output, Goldilocks::Element *input, uint64_t size)
 {
 #ifdef __AVX512__
-    PoseidonGoldilocks::merkletree_avx512(nodes, source, width, height);
+    PoseidonGoldilocks::linear_hash_avx512(output, input, size);
 #else
-    PoseidonGoldilocks::merkletree_avx(nodes, source, width, height);
+    PoseidonGoldilocks::linear_hash_avx(output, input, size);
 #endif
 }
+
+void MerkleTreeGL::hashNode(Goldilocks::Element *parent, const Goldilocks::Element *children, uint64_t nChildren)
+{
+    // Missing children of the last node of a level are hashed as zeros; for arity 2 this is the same hash
+    // as PoseidonGoldilocks::merkletree, i.e. 8 elements plus a zero capacity
+    Goldilocks::Element input[MERKLEHASHGL_MAX_ARITY * HASH_SIZE];
+    std::memcpy(input, children, nChildren * HASH_SIZE * sizeof(Goldilocks::Element));
+    std::memset(&input[nChildren * HASH_SIZE], 0, (arity - nChildren) * HASH_SIZE * sizeof(Goldilocks::Element));
+    linearHashAvx(parent, input, arity * HASH_SIZE);
+}
+
+void MerkleTreeGL::merkelizeLevel(uint64_t levelOffset, uint64_t levelSize, uint64_t nextLevelOffset, uint64_t firstNode, uint64_t lastNode)
+{
+    for (uint64_t i = firstNode; i < lastNode; i++)
+    {
+        uint64_t firstChild = i * arity;
+        uint64_t nChildren = std::min(arity, levelSize - firstChild);
+        hashNode(&nodes[nextLevelOffset + i * HASH_SIZE], &nodes[levelOffset + firstChild * HASH_SIZE], nChildren);
+    }
+}
+
+uint64_t MerkleTreeGL::getTileRows(uint64_t nThreads)
+{
+    int64_t l2Size = sysconf(_SC_LEVEL2_CACHE_SIZE);
+    uint64_t tileBytes = (l2Size > 0) ? l2Size : MERKLEHASHGL_DEFAULT_TILE_BYTES;
+    uint64_t rowBytes = (width + HASH_SIZE) * sizeof(Goldilocks::Element);
+
+    // Biggest power of arity that fits in the cache
+    uint64_t tileRows = arity;
+    while ((tileRows * arity * rowBytes <= tileBytes) && (tileRows < height))
+    {
+        tileRows *= arity;
+    }
+
+    // Keep several tiles per thread, so that small trees are still hashed by all of them
+    while ((tileRows > arity) && (((height + tileRows - 1) / tileRows) < 4 * nThreads))
+    {
+        tileRows /= arity;
+    }
+    return tileRows;
+}
+
+void MerkleTreeGL::merkelize()
+{
+    if (height == 0)
+        return;
+
+    uint64_t nThreads = omp_get_max_threads();
+    uint64_t tileRows = getTileRows(nThreads);
+    uint64_t nTiles = (height + tileRows - 1) / tileRows;
+
+    // Number of levels above the leaves whose nodes belong to a single tile
+    uint64_t tileLevels = 0;
+    for (uint64_t r = tileRows; r > 1; r /= arity)
+    {
+        tileLevels++;
+    }
+
+#pragma omp parallel for schedule(dynamic)
+    for (uint64_t t = 0; t < nTiles; t++)
+    {
+        uint64_t firstNode = t * tileRows;
+        uint64_t lastNode = std::min(height, firstNode + tileRows);
+        for (uint64_t i = firstNode; i < lastNode; i++)
+        {
+            linearHashAvx(&nodes[i * HASH_SIZE], &source[i * width], width);
+        }
+
+        uint64_t levelOffset = 0;
+        uint64_t levelSize = height;
+        for (uint64_t l = 0; (l < tileLevels) && (levelSize > 1); l++)
+        {
+            uint64_t nextLevelOffset = levelOffset + levelSize * HASH_SIZE;
+            firstNode = firstNode / arity;
+            lastNode = (lastNode + arity - 1) / arity;
+            merkelizeLevel(levelOffset, levelSize, nextLevelOffset, firstNode, lastNode);
+            levelOffset = nextLevelOffset;
+            levelSize = (levelSize + arity - 1) / arity;
+        }
+    }
+
+    // Upper levels, with nodes that depend on more than one tile
+    uint64_t levelOffset = 0;
+    uint64_t levelSize = height;
+    for (uint64_t l = 0; (l < tileLevels) && (levelSize > 1); l++)
+    {
+        levelOffset += levelSize * HASH_SIZE;
+        levelSize = (levelSize + arity - 1) / arity;
+    }
+    while (levelSize > 1)
+    {
+        uint64_t nextLevelOffset = levelOffset + levelSize * HASH_SIZE;
+        uint64_t nextLevelSize = (levelSize + arity - 1) / arity;
+#pragma omp parallel for
+        for (uint64_t i = 0; i < nextLevelSize; i++)
+        {
+            merkelizeLevel(levelOffset, levelSize, nextLevelOffset, i, i + 1);
+        }
+        levelOffset = nextLevelOffset;
+        levelSize = nextLevelSize;
+    }
+}
+
+void MerkleTreeGL::initLeaves()
+{
+    // Leaf hashes are used as the sponge capacity between absorbed blocks; the first block starts from zero
+#pragma omp parallel for
+    for (uint64_t i = 0; i < height; i++)
+    {
+        std::memset(&nodes[i * HASH_SIZE], 0, HASH_SIZE * sizeof(Goldilocks::Element));
+    }
+}
+
+void MerkleTreeGL::absorbLeaves(uint64_t firstCol, uint64_t nCols, uint64_t nThreads)
+{
+    // Block boundaries must be aligned to the sponge rate, except for the last block, so that the result
+    // is identical to the linear hash of the complete row
+    assert((firstCol % MERKLEHASHGL_RATE) == 0);
+    assert((firstCol + nCols == width) || ((nCols % MERKLEHASHGL_RATE) == 0));
+    assert(firstCol + nCols <= width);
+
+    if (nThreads == 0)
+    {
+        nThreads = omp_get_max_threads();
+    }
+
+    // Rows narrower than the capacity are not hashed, but copied and padded with zeros
+    if (width <= MERKLEHASHGL_CAPACITY)
+    {
+#pragma omp parallel for num_threads(nThreads)
+        for (uint64_t i = 0; i < height; i++)
+        {
+            for (uint64_t j = firstCol; j < firstCol + nCols; j++)
+            {
+                nodes[i * HASH_SIZE + j] = source[i * width + j];
+            }
+        }
+        return;
+    }
+
+#pragma omp parallel for num_threads(nThreads)
+    for (uint64_t i = 0; i < height; i++)
+    {
+        Goldilocks::Element state[MERKLEHASHGL_SPONGE_WIDTH];
+        Goldilocks::Element *pRow = &source[i * width];
+        Goldilocks::Element *pLeaf = &nodes[i * HASH_SIZE];
+        for (uint64_t j = firstCol; j < firstCol + nCols; j += MERKLEHASHGL_RATE)
+        {
+            uint64_t n = std::min<uint64_t>(MERKLEHASHGL_RATE, firstCol + nCols - j);
+            std::memcpy(state, &pRow[j], n * sizeof(Goldilocks::Element));
+            std::memset(&state[n], 0, (MERKLEHASHGL_RATE - n) * sizeof(Goldilocks::Element));
+            std::memcpy(&state[MERKLEHASHGL_RATE], pLeaf, MERKLEHASHGL_CAPACITY * sizeof(Goldilocks::Element));
+            PoseidonGoldilocks::hash_full_result(state, state);
+            std::memcpy(pLeaf, state, MERKLEHASHGL_CAPACITY * sizeof(Goldilocks::Element));
+        }
+    }
+}
+
+void MerkleTreeGL::merkelizeNodes(uint64_t nThreads)
+{
+    if (nThreads == 0)
+    {
+        nThreads = omp_get_max_threads();
+    }
+
+    // Same layout as merkelize(): leaf hashes first, then every level after the previous one
+    uint64_t levelOffset = 0;
+    uint64_t levelSize = height;
+    while (levelSize > 1)
+    {
+        uint64_t nextLevelOffset = levelOffset + levelSize * HASH_SIZE;
+        uint64_t nextLevelSize = (levelSize + arity - 1) / arity;
+#pragma omp parallel for num_threads(nThreads)
+        for (uint64_t i = 0; i < nextLevelSize; i++)
+        {
+            merkelizeLevel(levelOffset, levelSize, nextLevelOffset, i, i + 1);
+        }
+        levelOffset = nextLevelOffset;
+        levelSize = nextLevelSize;
+    }
+}
@@ -4,8 +4,15 @@
 #include "goldilocks_base_field.hpp"
 #include "poseidon_goldilocks.hpp"
 #include <math.h>
+#include <cassert>
+
+#define MERKLEHASHGL_ARITY 2 // Default arity, used by the constant trees and the stark proofs
+#define MERKLEHASHGL_MAX_ARITY 8
+#define MERKLEHASHGL_RATE 8
+#define MERKLEHASHGL_CAPACITY 4
+#define MERKLEHASHGL_SPONGE_WIDTH 12
+#define MERKLEHASHGL_DEFAULT_TILE_BYTES (1024 * 1024) // Used when the L2 cache size cannot be retrieved from the system
 
-#define MERKLEHASHGL_ARITY 2
 class MerkleTreeGL
 {
 private:
@@ -13,9 +20,19 @@ private:
     void getElement(Goldilocks::Element &element, uint64_t idx, uint64_t subIdx);
     void genMerkleProof(Goldilocks::Element *proof, uint64_t idx, uint64_t offset, uint64_t n);
 
+    // Hashes arity consecutive child hashes into its parent hash
+    void hashNode(Goldilocks::Element *parent, const Goldilocks::Element *children, uint64_t nChildren);
+
+    // Builds the nodes [firstNode, lastNode) of a level, reading the children from the previous level
+    void merkelizeLevel(uint64_t levelOffset, uint64_t levelSize, uint64_t nextLevelOffset, uint64_t firstNode, uint64_t lastNode);
+
+    // Returns the number of rows of a tile, i.e. a power of arity whose source data fits in the L2 cache
+    uint64_t getTileRows(uint64_t nThreads);
+
 public:
     uint64_t height;
     uint64_t width;
+    uint64_t arity = MERKLEHASHGL_ARITY;
     Goldilocks::Element *source;
     Goldilocks::Element *nodes;
     bool isSourceAllocated = false;
@@ -23,6 +40,7 @@ public:
     MerkleTreeGL(){};
     MerkleTreeGL(Goldilocks::Element *tree)
     {
+        // Constant trees are generated by bctree, always with the default arity
         width = Goldilocks::toU64(tree[0]);
         height = Goldilocks::toU64(tree[1]);
         source = &tree[2];
@@ -30,8 +48,9 @@ public:
         isNodesAllocated = false;
         isSourceAllocated = false;
     };
-    MerkleTreeGL(uint64_t _height, uint64_t _width, Goldilocks::Element *_source) : height(_height), width(_width), source(_source)
+    MerkleTreeGL(uint64_t _height, uint64_t _width, Goldilocks::Element *_source, uint64_t _arity = MERKLEHASHGL_ARITY) : height(_height), width(_width), arity(_arity), source(_source)
     {
+        assert((arity == 2) || (arity == 4) || (arity == 8));
 
         if (source == NULL)
         {
@@ -57,10 +76,30 @@ public:
         std::memcpy(source, _source, height * width * sizeof(Goldilocks::Element));
     }
 
+    // Hashes the leaves in tiles that fit in the L2 cache, building the lower levels of every tile while
+    // its hashes are still hot, and then builds the upper levels, where there are less nodes than tiles
     void merkelize();
+
+    // Incremental merkelization: the leaf hashes are computed absorbing source columns block by block,
+    // so that hashing can start before all the columns are available, and then the upper levels are built
+    void initLeaves();
+    void absorbLeaves(uint64_t firstCol, uint64_t nCols, uint64_t nThreads = 0);
+    void merkelizeNodes(uint64_t nThreads = 0);
+
     uint64_t getTreeNumElements()
     {
-        return height * HASH_SIZE + (height - 1) * HASH_SIZE;
+        if (arity == 2)
+        {
+            return height * HASH_SIZE + (height - 1) * HASH_SIZE;
+        }
+        uint64_t numNodes = height;
+        uint64_t levelSize = height;
+        while (levelSize > 1)
+        {
+            levelSize = (levelSize + arity - 1) / arity;
+            numNodes += levelSize;
+        }
+        return numNodes * HASH_SIZE;
     }
     void getRoot(Goldilocks::Element *root)
     {
@@ -68,13 +107,17 @@ public:
     }
     void getGroupProof(Goldilocks::Element *proof, uint64_t idx);
 
+    // Returns the number of hashes of a Merkle proof, i.e. arity-1 siblings per level
     uint64_t MerkleProofSize()
     {
-        if (height > 1)
+        uint64_t nLevels = 0;
+        uint64_t levelSize = height;
+        while (levelSize > 1)
         {
-            return (uint64_t)ceil(log10(height) / log10(MERKLEHASHGL_ARITY));
+            levelSize = (levelSize + arity - 1) / arity;
+            nLevels++;
         }
-        return 0;
+        return nLevels * (arity - 1);
     }
 };
 
@@ -0,0 +1,473 @@
+#include <stdio.h>
+#include <algorithm>
+#include "parser_program.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+// Mixes a 64-bit value (splitmix64 finalizer), used to hash programs and values
+static inline uint64_t parserMix (uint64_t x)
+{
+    x += 0x9E3779B97F4A7C15ULL;
+    x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ULL;
+    x = (x ^ (x >> 27)) * 0x94D049BB133111EBULL;
+    return x ^ (x >> 31);
+}
+
+void ParserIsa::addOp (uint64_t op, const string &args)
+{
+    if (op >= ops.size()) ops.resize(op + 1);
+    Op &info = ops[op];
+    info.args.clear();
+    info.sequence.clear();
+
+    uint64_t i = 0;
+    while (i < args.size())
+    {
+        if (args[i] == ' ')
+        {
+            i++;
+            continue;
+        }
+        string token;
+        while ((i < args.size()) && (args[i] != ' ')) token += args[i++];
+        if (token == "X") info.args.push_back(PARSER_ARG_OTHER);
+        else if (token == "R1") info.args.push_back(PARSER_ARG_READ1);
+        else if (token == "R3") info.args.push_back(PARSER_ARG_READ3);
+        else if (token == "W1") info.args.push_back(PARSER_ARG_WRITE1);
+        else if (token == "W3") info.args.push_back(PARSER_ARG_WRITE3);
+        else
+        {
+            zklog.error("ParserIsa::addOp() " + name + " found invalid argument role=" + token + " in op=" + to_string(op));
+            exitProcess();
+        }
+    }
+    info.defined = true;
+}
+
+void ParserIsa::addSuperOp (uint64_t op, const vector<uint64_t> &sequence)
+{
+    for (uint64_t i = 0; i < sequence.size(); i++)
+    {
+        if (!isDefined(sequence[i]) || isSuperOp(sequence[i]))
+        {
+            zklog.error("ParserIsa::addSuperOp() " + name + " found op=" + to_string(op) + " made of an invalid op=" + to_string(sequence[i]));
+            exitProcess();
+        }
+    }
+    if (op >= ops.size()) ops.resize(op + 1);
+    ops[op].args.clear();
+    ops[op].sequence = sequence;
+    ops[op].defined = true;
+}
+
+uint64_t ParserIsa::nArgs (uint64_t op) const
+{
+    if (!isSuperOp(op)) return ops[op].args.size();
+    uint64_t n = 0;
+    for (uint64_t i = 0; i < ops[op].sequence.size(); i++)
+    {
+        n += ops[ops[op].sequence[i]].args.size();
+    }
+    return n;
+}
+
+void ParserProgram::set (const uint64_t *pOps, uint64_t nOps, const uint64_t *pArgs, uint64_t nArgs, uint64_t _nTemp1, uint64_t _nTemp3)
+{
+    ops.assign(pOps, pOps + nOps);
+    args.assign(pArgs, pArgs + nArgs);
+    nTemp1 = _nTemp1;
+    nTemp3 = _nTemp3;
+    sourceHash = 0;
+}
+
+uint64_t ParserProgram::hash (void) const
+{
+    uint64_t h = parserMix(ops.size()) ^ parserMix(args.size() + 1);
+    for (uint64_t i = 0; i < ops.size(); i++) h = parserMix(h ^ ops[i]);
+    for (uint64_t i = 0; i < args.size(); i++) h = parserMix(h ^ args[i]);
+    return h;
+}
+
+bool ParserProgram::check (const ParserIsa &isa) const
+{
+    uint64_t a = 0;
+    for (uint64_t k = 0; k < ops.size(); k++)
+    {
+        if (!isa.isDefined(ops[k]))
+        {
+            zklog.error("ParserProgram::check() " + isa.name + " found undefined op=" + to_string(ops[k]) + " at position=" + to_string(k));
+            return false;
+        }
+        const vector<uint64_t> single(1, ops[k]);
+        const vector<uint64_t> &sequence = isa.isSuperOp(ops[k]) ? isa.ops[ops[k]].sequence : single;
+        for (uint64_t s = 0; s < sequence.size(); s++)
+        {
+            const vector<uint8_t> &roles = isa.ops[sequence[s]].args;
+            if (a + roles.size() > args.size())
+            {
+                zklog.error("ParserProgram::check() " + isa.name + " ran out of arguments at position=" + to_string(k));
+                return false;
+            }
+            for (uint64_t r = 0; r < roles.size(); r++, a++)
+            {
+                bool bTemp1 = (roles[r] == PARSER_ARG_READ1) || (roles[r] == PARSER_ARG_WRITE1);
+                bool bTemp3 = (roles[r] == PARSER_ARG_READ3) || (roles[r] == PARSER_ARG_WRITE3);
+                if ((bTemp1 && (args[a] >= nTemp1)) || (bTemp3 && (args[a] >= nTemp3)))
+                {
+                    zklog.error("ParserProgram::check() " + isa.name + " found slot=" + to_string(args[a]) + " out of range at position=" + to_string(k));
+                    return false;
+                }
+            }
+        }
+    }
+    if (a != args.size())
+    {
+        zklog.error("ParserProgram::check() " + isa.name + " used " + to_string(a) + " arguments of " + to_string(args.size()));
+        return false;
+    }
+    return true;
+}
+
+void ParserProgram::save (const string &fileName) const
+{
+    FILE *pFile = fopen(fileName.c_str(), "wb");
+    if (pFile == NULL)
+    {
+        zklog.error("ParserProgram::save() failed calling fopen() of file=" + fileName);
+        exitProcess();
+    }
+    uint64_t header[7] = { PARSER_PROGRAM_MAGIC, PARSER_PROGRAM_VERSION, sourceHash, ops.size(), args.size(), nTemp1, nTemp3 };
+    if ((fwrite(header, sizeof(header), 1, pFile) != 1) ||
+        (fwrite(ops.data(), sizeof(uint64_t), ops.size(), pFile) != ops.size()) ||
+        (fwrite(args.data(), sizeof(uint64_t), args.size(), pFile) != args.size()))
+    {
+        zklog.error("ParserProgram::save() failed calling fwrite() of file=" + fileName);
+        exitProcess();
+    }
+    fclose(pFile);
+}
+
+bool ParserProgram::load (const string &fileName, const ParserIsa &isa, uint64_t expectedSourceHash)
+{
+    FILE *pFile = fopen(fileName.c_str(), "rb");
+    if (pFile == NULL)
+    {
+        zklog.error("ParserProgram::load() failed calling fopen() of file=" + fileName);
+        return false;
+    }
+    uint64_t header[7];
+    bool bResult = (fread(header, sizeof(header), 1, pFile) == 1);
+    if (bResult && ((header[0] != PARSER_PROGRAM_MAGIC) || (header[1] != PARSER_PROGRAM_VERSION)))
+    {
+        zklog.error("ParserProgram::load() found invalid magic or version=" + to_string(header[1]) + " in file=" + fileName);
+        bResult = false;
+    }
+    if (bResult && (header[2] != expectedSourceHash))
+    {
+        zklog.error("ParserProgram::load() file=" + fileName + " was not optimized from the " + isa.name + " program of this build");
+        bResult = false;
+    }
+    if (bResult)
+    {
+        sourceHash = header[2];
+        ops.resize(header[3]);
+        args.resize(header[4]);
+        nTemp1 = header[5];
+        nTemp3 = header[6];
+        bResult = (fread(ops.data(), sizeof(uint64_t), ops.size(), pFile) == ops.size()) &&
+                  (fread(args.data(), sizeof(uint64_t), args.size(), pFile) == args.size());
+        if (!bResult)
+        {
+            zklog.error("ParserProgram::load() failed calling fread() of file=" + fileName);
+        }
+    }
+    fclose(pFile);
+
+    if (bResult)
+    {
+        bResult = check(isa);
+    }
+    if (!bResult)
+    {
+        ops.clear();
+        args.clear();
+    }
+    return bResult;
+}
+
+void ParserProgram::expand (const ParserIsa &isa)
+{
+    vector<uint64_t> newOps;
+    newOps.reserve(ops.size());
+    for (uint64_t k = 0; k < ops.size(); k++)
+    {
+        if (isa.isSuperOp(ops[k]))
+        {
+            newOps.insert(newOps.end(), isa.ops[ops[k]].sequence.begin(), isa.ops[ops[k]].sequence.end());
+        }
+        else
+        {
+            newOps.push_back(ops[k]);
+        }
+    }
+    ops.swap(newOps);
+}
+
+uint64_t ParserProgram::eliminateDeadOps (const ParserIsa &isa)
+{
+    expand(isa);
+
+    // Get the first argument of every operation
+    vector<uint64_t> firstArg(ops.size());
+    uint64_t a = 0;
+    for (uint64_t k = 0; k < ops.size(); k++)
+    {
+        firstArg[k] = a;
+        a += isa.ops[ops[k]].args.size();
+    }
+
+    // Walk the program backwards, keeping the set of slots whose current value will be read
+    vector<bool> live1(nTemp1, false);
+    vector<bool> live3(nTemp3, false);
+    vector<bool> dead(ops.size(), false);
+    uint64_t nDead = 0;
+    for (uint64_t k = ops.size(); k-- > 0; )
+    {
+        const vector<uint8_t> &roles = isa.ops[ops[k]].args;
+        const uint64_t *pArgs = &args[firstArg[k]];
+        bool bWrites = false;
+        bool bLive = false;
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            if (roles[r] == PARSER_ARG_WRITE1) { bWrites = true; bLive = bLive || live1[pArgs[r]]; }
+            if (roles[r] == PARSER_ARG_WRITE3) { bWrites = true; bLive = bLive || live3[pArgs[r]]; }
+        }
+        if (bWrites && !bLive)
+        {
+            dead[k] = true;
+            nDead++;
+            continue;
+        }
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            if (roles[r] == PARSER_ARG_WRITE1) live1[pArgs[r]] = false;
+            if (roles[r] == PARSER_ARG_WRITE3) live3[pArgs[r]] = false;
+        }
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            if (roles[r] == PARSER_ARG_READ1) live1[pArgs[r]] = true;
+            if (roles[r] == PARSER_ARG_READ3) live3[pArgs[r]] = true;
+        }
+    }
+
+    if (nDead > 0)
+    {
+        vector<uint64_t> newOps;
+        vector<uint64_t> newArgs;
+        for (uint64_t k = 0; k < ops.size(); k++)
+        {
+            if (dead[k]) continue;
+            newOps.push_back(ops[k]);
+            newArgs.insert(newArgs.end(), args.begin() + firstArg[k], args.begin() + firstArg[k] + isa.ops[ops[k]].args.size());
+        }
+        ops.swap(newOps);
+        args.swap(newArgs);
+    }
+    return nDead;
+}
+
+void ParserProgram::allocateTemps (const ParserIsa &isa)
+{
+    expand(isa);
+
+    const uint64_t NO_DEF = UINT64_MAX;
+
+    // Number the values (definitions), and get the definition used by every slot argument and the last
+    // operation that reads every definition
+    vector<uint64_t> argDef(args.size(), NO_DEF);
+    vector<uint64_t> defLastUse;
+    vector<uint64_t> current1(nTemp1, NO_DEF);
+    vector<uint64_t> current3(nTemp3, NO_DEF);
+    uint64_t a = 0;
+    for (uint64_t k = 0; k < ops.size(); k++)
+    {
+        const vector<uint8_t> &roles = isa.ops[ops[k]].args;
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            if ((roles[r] != PARSER_ARG_READ1) && (roles[r] != PARSER_ARG_READ3)) continue;
+            vector<uint64_t> &current = (roles[r] == PARSER_ARG_READ1) ? current1 : current3;
+            if (current[args[a + r]] == NO_DEF)
+            {
+                // Read before written: the value is a program input, defined before the first operation
+                current[args[a + r]] = defLastUse.size();
+                defLastUse.push_back(0);
+            }
+            argDef[a + r] = current[args[a + r]];
+            defLastUse[argDef[a + r]] = k;
+        }
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            if ((roles[r] != PARSER_ARG_WRITE1) && (roles[r] != PARSER_ARG_WRITE3)) continue;
+            vector<uint64_t> &current = (roles[r] == PARSER_ARG_WRITE1) ? current1 : current3;
+            current[args[a + r]] = defLastUse.size();
+            argDef[a + r] = defLastUse.size();
+            defLastUse.push_back(k);
+        }
+        a += roles.size();
+    }
+
+    // Assign a slot to every definition when it is written, and release it after its last read; the slot
+    // of an operation result is allocated before releasing its operands, so they never alias
+    vector<uint64_t> defSlot(defLastUse.size(), NO_DEF);
+    vector<uint64_t> free1, free3;
+    uint64_t newTemp1 = 0;
+    uint64_t newTemp3 = 0;
+    a = 0;
+    for (uint64_t k = 0; k < ops.size(); k++)
+    {
+        const vector<uint8_t> &roles = isa.ops[ops[k]].args;
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            bool bRead1 = (roles[r] == PARSER_ARG_READ1);
+            if (!bRead1 && (roles[r] != PARSER_ARG_READ3)) continue;
+            uint64_t def = argDef[a + r];
+            if (defSlot[def] == NO_DEF) defSlot[def] = bRead1 ? newTemp1++ : newTemp3++; // Program input
+            args[a + r] = defSlot[def];
+        }
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            bool bWrite1 = (roles[r] == PARSER_ARG_WRITE1);
+            if (!bWrite1 && (roles[r] != PARSER_ARG_WRITE3)) continue;
+            vector<uint64_t> &freeSlots = bWrite1 ? free1 : free3;
+            uint64_t slot;
+            if (freeSlots.empty())
+            {
+                slot = bWrite1 ? newTemp1++ : newTemp3++;
+            }
+            else
+            {
+                slot = freeSlots.back();
+                freeSlots.pop_back();
+            }
+            defSlot[argDef[a + r]] = slot;
+            args[a + r] = slot;
+        }
+        for (uint64_t r = 0; r < roles.size(); r++)
+        {
+            uint64_t def = argDef[a + r];
+            if ((def == NO_DEF) || (defLastUse[def] != k)) continue;
+            bool bTemp1 = (roles[r] == PARSER_ARG_READ1) || (roles[r] == PARSER_ARG_WRITE1);
+            (bTemp1 ? free1 : free3).push_back(defSlot[def]);
+            defLastUse[def] = NO_DEF; // Release it only once, even if read twice by the same operation
+        }
+        a += roles.size();
+    }
+    nTemp1 = newTemp1;
+    nTemp3 = newTemp3;
+}
+
+uint64_t ParserProgram::fuse (const ParserIsa &isa)
+{
+    expand(isa);
+
+    // Superinstructions, longest first
+    vector<uint64_t> superOps;
+    for (uint64_t op = 0; op < isa.ops.size(); op++)
+    {
+        if (isa.isSuperOp(op)) superOps.push_back(op);
+    }
+    stable_sort(superOps.begin(), superOps.end(), [&isa](uint64_t a, uint64_t b) { return isa.ops[a].sequence.size() > isa.ops[b].sequence.size(); });
+
+    vector<uint64_t> newOps;
+    uint64_t nFused = 0;
+    uint64_t k = 0;
+    while (k < ops.size())
+    {
+        bool bFused = false;
+        for (uint64_t s = 0; s < superOps.size(); s++)
+        {
+            const vector<uint64_t> &sequence = isa.ops[superOps[s]].sequence;
+            if ((k + sequence.size() <= ops.size()) && equal(sequence.begin(), sequence.end(), ops.begin() + k))
+            {
+                newOps.push_back(superOps[s]);
+                k += sequence.size();
+                nFused++;
+                bFused = true;
+                break;
+            }
+        }
+        if (!bFused) newOps.push_back(ops[k++]);
+    }
+    ops.swap(newOps);
+    return nFused;
+}
+
+bool ParserProgram::optimize (const ParserIsa &isa)
+{
+    ParserProgram original = *this;
+    uint64_t originalOps = ops.size();
+
+    expand(isa);
+    uint64_t simpleOps = ops.size();
+    uint64_t nDead = eliminateDeadOps(isa);
+    allocateTemps(isa);
+    uint64_t nFused = fuse(isa);
+    sourceHash = original.hash();
+
+    zklog.info("ParserProgram::optimize() " + isa.name + " ops=" + to_string(originalOps) + " simpleOps=" + to_string(simpleOps) +
+        " deadOps=" + to_string(nDead) + " superOps=" + to_string(nFused) + " finalOps=" + to_string(ops.size()) +
+        " tmp1=" + to_string(original.nTemp1) + "->" + to_string(nTemp1) + " tmp3=" + to_string(original.nTemp3) + "->" + to_string(nTemp3));
+
+    return check(isa) && equivalent(original, isa);
+}
+
+void ParserProgram::getEffects (const ParserIsa &isa, vector<uint64_t> &effects) const
+{
+    // Every slot holds the hash of the expression that computed its current value
+    vector<uint64_t> value1(nTemp1, 0);
+    vector<uint64_t> value3(nTemp3, 0);
+    effects.clear();
+
+    uint64_t a = 0;
+    for (uint64_t k = 0; k < ops.size(); k++)
+    {
+        const vector<uint64_t> single(1, ops[k]);
+        const vector<uint64_t> &sequence = isa.isSuperOp(ops[k]) ? isa.ops[ops[k]].sequence : single;
+        for (uint64_t s = 0; s < sequence.size(); s++)
+        {
+            const vector<uint8_t> &roles = isa.ops[sequence[s]].args;
+            uint64_t h = parserMix(sequence[s]);
+            bool bWrites = false;
+            for (uint64_t r = 0; r < roles.size(); r++)
+            {
+                switch (roles[r])
+                {
+                    case PARSER_ARG_OTHER: h = parserMix(h ^ args[a + r]); break;
+                    case PARSER_ARG_READ1: h = parserMix(h ^ value1[args[a + r]]); break;
+                    case PARSER_ARG_READ3: h = parserMix(h ^ value3[args[a + r]]); break;
+                    default: bWrites = true;
+                }
+            }
+            for (uint64_t r = 0; r < roles.size(); r++)
+            {
+                if (roles[r] == PARSER_ARG_WRITE1) value1[args[a + r]] = parserMix(h + r);
+                if (roles[r] == PARSER_ARG_WRITE3) value3[args[a + r]] = parserMix(h + r);
+            }
+            if (!bWrites) effects.push_back(h);
+            a += roles.size();
+        }
+    }
+}
+
+bool ParserProgram::equivalent (const ParserProgram &other, const ParserIsa &isa) const
+{
+    vector<uint64_t> effects, otherEffects;
+    getEffects(isa, effects);
+    other.getEffects(isa, otherEffects);
+    if (effects != otherEffects)
+    {
+        zklog.error("ParserProgram::equivalent() " + isa.name + " programs have different side effects");
+        return false;
+    }
+    return true;
+}
@@ -0,0 +1,104 @@
+#ifndef PARSER_PROGRAM_HPP
+#define PARSER_PROGRAM_HPP
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+#define PARSER_PROGRAM_MAGIC 0x4D47525048435A4BULL // "KZCHPRGM"
+#define PARSER_PROGRAM_VERSION 1
+
+// Role of every argument of a parser operation
+#define PARSER_ARG_OTHER  0 // Constant, polynomial offset, stride, challenge index, etc.
+#define PARSER_ARG_READ1  1 // Index of a tmp1 slot read by the operation
+#define PARSER_ARG_READ3  2 // Index of a tmp3 slot read by the operation
+#define PARSER_ARG_WRITE1 3 // Index of a tmp1 slot written by the operation
+#define PARSER_ARG_WRITE3 4 // Index of a tmp3 slot written by the operation
+
+/*
+    Instruction set of a chelpers parser, i.e. the cases of its switch.
+
+    Simple operations are described by the role of their arguments, e.g. "W1 R1 X" for tmp1 = f(tmp1, constant).
+    An operation without a written slot has side effects, i.e. it stores a result out of the temporaries.
+    Superinstructions are cases that execute a fixed sequence of simple operations, consuming their arguments
+    one after the other, so that a single dispatch runs several operations.
+*/
+class ParserIsa
+{
+public:
+    class Op
+    {
+    public:
+        vector<uint8_t> args; // Role of every argument of a simple operation
+        vector<uint64_t> sequence; // Simple operations of a superinstruction, empty for simple operations
+        bool defined;
+        Op() : defined(false) {};
+    };
+
+    string name;
+    vector<Op> ops;
+
+    void addOp (uint64_t op, const string &args);
+    void addSuperOp (uint64_t op, const vector<uint64_t> &sequence);
+
+    bool isDefined (uint64_t op) const { return (op < ops.size()) && ops[op].defined; };
+    bool isSuperOp (uint64_t op) const { return isDefined(op) && !ops[op].sequence.empty(); };
+    uint64_t nArgs (uint64_t op) const;
+};
+
+/*
+    Program of a chelpers parser: a straight-line list of operations and their arguments, executed for every
+    batch of rows, that stores intermediate values in tmp1 (base field) and tmp3 (extension field) slots.
+
+    The program can be optimized offline and saved into a binary file, to be loaded at startup instead of the
+    program compiled into the parser:
+    - expand() replaces superinstructions by their simple operations
+    - eliminateDeadOps() removes the operations whose written slot is never read
+    - allocateTemps() renames the slots as a linear scan register allocator, reusing the most recently freed slot
+      first, so that the working set of temporaries is as small and as hot in cache as possible
+    - fuse() replaces sequences of simple operations by superinstructions, longest first
+*/
+class ParserProgram
+{
+public:
+    vector<uint64_t> ops;
+    vector<uint64_t> args;
+    uint64_t nTemp1;
+    uint64_t nTemp3;
+    uint64_t sourceHash; // Hash of the program this one was optimized from
+
+    ParserProgram() : nTemp1(0), nTemp3(0), sourceHash(0) {};
+
+    void set (const uint64_t *pOps, uint64_t nOps, const uint64_t *pArgs, uint64_t nArgs, uint64_t _nTemp1, uint64_t _nTemp3);
+    bool empty (void) const { return ops.empty(); };
+
+    // Hash of the operations and arguments
+    uint64_t hash (void) const;
+
+    // Checks that all operations are defined in the instruction set, and that the number of arguments and the
+    // slot indexes are consistent
+    bool check (const ParserIsa &isa) const;
+
+    // Binary file, checked against the instruction set and the hash of the program it was optimized from
+    void save (const string &fileName) const;
+    bool load (const string &fileName, const ParserIsa &isa, uint64_t expectedSourceHash);
+
+    void expand (const ParserIsa &isa);
+    uint64_t eliminateDeadOps (const ParserIsa &isa);
+    void allocateTemps (const ParserIsa &isa);
+    uint64_t fuse (const ParserIsa &isa);
+
+    // Runs all the optimization passes and checks that the result is equivalent to the original program
+    bool optimize (const ParserIsa &isa);
+
+    // Returns true if both programs produce the same side effects from the same inputs, which is checked by
+    // hashing the expression tree of every value (value numbering) through the simple operations
+    bool equivalent (const ParserProgram &other, const ParserIsa &isa) const;
+
+private:
+    void getEffects (const ParserIsa &isa, vector<uint64_t> &effects) const;
+};
+
+#endif
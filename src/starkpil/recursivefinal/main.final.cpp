@@ -116,6 +116,43 @@ namespace CircomFinal
     delete circuit;
   }
 
+  // Circuits loaded in this process, by .dat file name, and witness contexts ready to be reused
+  static std::mutex circuitRegistryMutex;
+  static std::map<std::string, Circom_Circuit *> circuitRegistry;
+  static std::vector<Circom_CalcWit *> calcWitPool;
+
+  Circom_Circuit *getCircuit(std::string const &datFileName)
+  {
+    std::lock_guard<std::mutex> guard(circuitRegistryMutex);
+    Circom_Circuit *&circuit = circuitRegistry[datFileName];
+    if (circuit == NULL)
+    {
+      circuit = loadCircuit(datFileName);
+    }
+    return circuit;
+  }
+
+  Circom_CalcWit *acquireCalcWit(Circom_Circuit *circuit)
+  {
+    {
+      std::lock_guard<std::mutex> guard(circuitRegistryMutex);
+      if (!calcWitPool.empty())
+      {
+        Circom_CalcWit *ctx = calcWitPool.back();
+        calcWitPool.pop_back();
+        ctx->reset(circuit);
+        return ctx;
+      }
+    }
+    return new Circom_CalcWit(circuit);
+  }
+
+  void releaseCalcWit(Circom_CalcWit *ctx)
+  {
+    std::lock_guard<std::mutex> guard(circuitRegistryMutex);
+    calcWitPool.push_back(ctx);
+  }
+
   bool check_valid_number(std::string &s, uint base)
   {
     bool is_valid = true;
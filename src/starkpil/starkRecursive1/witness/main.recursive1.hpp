@@ -11,6 +11,7 @@
 #include <iostream>
 #include <unistd.h>
 #include "commit_pols_starks.hpp"
+#include "proof2zkinStark.hpp"
 using namespace std;
 
 namespace CircomRecursive1
@@ -18,11 +19,16 @@ namespace CircomRecursive1
     using json = nlohmann::json;
     Circom_Circuit *loadCircuit(std::string const &datFileName);
     void freeCircuit(Circom_Circuit *circuit);
+    Circom_Circuit *getCircuit(std::string const &datFileName); // Loaded only once per process
+    Circom_CalcWit *acquireCalcWit(Circom_Circuit *circuit);
+    void releaseCalcWit(Circom_CalcWit *ctx);
     void loadJson(Circom_CalcWit *ctx, std::string filename);
     void loadJsonImpl(Circom_CalcWit *ctx, json &j);
     void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName);
     void getBinWitness(Circom_CalcWit *ctx, FrGElement *&pWitness, uint64_t &witnessSize);
+    void loadZkinImpl(Circom_CalcWit *ctx, ZkinStark &zkin);
     void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N, uint64_t nCols);
+    void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, ZkinStark &zkin, uint64_t N, uint64_t nCols);
     bool check_valid_number(std::string &s, uint base);
 }
 #endif
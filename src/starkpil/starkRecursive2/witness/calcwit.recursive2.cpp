@@ -56,6 +56,23 @@ namespace CircomRecursive2
     delete[] componentMemory;
   }
 
+  void Circom_CalcWit::reset(Circom_Circuit *aCircuit)
+  {
+    if (circuit != aCircuit)
+    {
+      circuit = aCircuit;
+      circuitConstants = circuit->circuitConstants;
+      templateInsId2IOSignalInfo = circuit->templateInsId2IOSignalInfo;
+    }
+    inputSignalAssignedCounter = get_main_input_signal_no();
+    for (uint i = 0; i < inputSignalAssignedCounter; i++)
+    {
+      inputSignalAssigned[i] = false;
+    }
+    FrG_str2element(&signalValues[0], "1", 10);
+    numThread = 0;
+  }
+
   uint Circom_CalcWit::getInputSignalHashPosition(u64 h)
   {
     uint n = get_size_of_input_hashmap();
@@ -42,6 +42,9 @@ namespace CircomRecursive2
     Circom_CalcWit(Circom_Circuit *aCircuit, uint numTh = NMUTEXES);
     ~Circom_CalcWit();
 
+    // Prepares the context for a new witness computation of aCircuit, reusing its memory
+    void reset(Circom_Circuit *aCircuit);
+
     // Public functions
     void setInputSignal(u64 h, uint i, FrGElement &val);
     void tryRunCircuit();
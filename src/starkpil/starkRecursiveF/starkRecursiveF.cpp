@@ -71,15 +71,15 @@ StarkRecursiveF::StarkRecursiveF(const Config &config, void *_pAddress) : config
         pConstTreeAddress = copyFile(config.recursivefConstantsTree, getTreeSize((1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants));
         zklog.info("StarkRecursiveF::StarkRecursiveF() successfully copied " + to_string(getTreeSize((1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants)) + " bytes from constant file " + config.recursivefConstantsTree);
     }
+    if (config.prefaultConstantsTree)
+    {
+        prefaultMemory(pConstTreeAddress, getTreeSize((1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants));
+    }
     TimerStopAndLog(LOAD_RECURSIVE_F_CONST_TREE_TO_MEMORY);
 
-    // Initialize and allocate ConstantPols2ns
-    TimerStart(LOAD_RECURSIVE_F_CONST_POLS_2NS_TO_MEMORY);
-    pConstPolsAddress2ns = (void *)calloc(starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt), sizeof(Goldilocks::Element));
+    // The constant tree starts with its width and height, followed by the 2ns constant polynomials, row by row
+    pConstPolsAddress2ns = (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element);
     pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
-    std::memcpy(pConstPolsAddress2ns, (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element), starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element));
-
-    TimerStopAndLog(LOAD_RECURSIVE_F_CONST_POLS_2NS_TO_MEMORY);
 
     // TODO x_n and x_2ns could be precomputed
     TimerStart(COMPUTE_X_N_AND_X_2_NS);
@@ -118,7 +118,6 @@ StarkRecursiveF::~StarkRecursiveF()
 
     delete pConstPols;
     delete pConstPols2ns;
-    free(pConstPolsAddress2ns);
 
     if (config.mapConstPolsFile)
     {
@@ -31,7 +31,7 @@ public:
 
 private:
     void *pConstPolsAddress;
-    void *pConstPolsAddress2ns;
+    void *pConstPolsAddress2ns; // Points into the constant tree, not allocated
     ConstantPolsStarks *pConstPols;
     ConstantPolsStarks *pConstPols2ns;
     void *pConstTreeAddress;
@@ -126,6 +126,43 @@ namespace CircomRecursiveF
     delete circuit;
   }
 
+  // Circuits loaded in this process, by .dat file name, and witness contexts ready to be reused
+  static std::mutex circuitRegistryMutex;
+  static std::map<std::string, Circom_Circuit *> circuitRegistry;
+  static std::vector<Circom_CalcWit *> calcWitPool;
+
+  Circom_Circuit *getCircuit(std::string const &datFileName)
+  {
+    std::lock_guard<std::mutex> guard(circuitRegistryMutex);
+    Circom_Circuit *&circuit = circuitRegistry[datFileName];
+    if (circuit == NULL)
+    {
+      circuit = loadCircuit(datFileName);
+    }
+    return circuit;
+  }
+
+  Circom_CalcWit *acquireCalcWit(Circom_Circuit *circuit)
+  {
+    {
+      std::lock_guard<std::mutex> guard(circuitRegistryMutex);
+      if (!calcWitPool.empty())
+      {
+        Circom_CalcWit *ctx = calcWitPool.back();
+        calcWitPool.pop_back();
+        ctx->reset(circuit);
+        return ctx;
+      }
+    }
+    return new Circom_CalcWit(circuit);
+  }
+
+  void releaseCalcWit(Circom_CalcWit *ctx)
+  {
+    std::lock_guard<std::mutex> guard(circuitRegistryMutex);
+    calcWitPool.push_back(ctx);
+  }
+
   bool check_valid_number(std::string &s, uint base)
   {
     bool is_valid = true;
@@ -316,32 +353,17 @@ namespace CircomRecursiveF
     inStream.close();
     loadJsonImpl(ctx, j);
   }
-  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N, uint64_t nCols)
+  void calcCommitedPols(CommitPolsStarks *commitPols, Circom_CalcWit *ctx, const std::string execFile, uint64_t N, uint64_t nCols)
   {
-    //-------------------------------------------
-    // Verifier stark proof
-    //-------------------------------------------
-    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_F);
-    Circom_Circuit *circuit = loadCircuit(zkevmVerifier);
-    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_F);
-    TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
-    Circom_CalcWit *ctx = new Circom_CalcWit(circuit);
-
-    loadJsonImpl(ctx, zkin);
-    if (ctx->getRemaingInputsToBeSet() != 0)
-    {
-      zklog.error("Prover::genBatchProof() Not all inputs have been set. Only " + to_string(get_main_input_signal_no() - ctx->getRemaingInputsToBeSet()) + " out of " + to_string(get_main_input_signal_no()));
-      exitProcess();
-    }
-    TimerStopAndLog(CIRCOM_LOAD_JSON_BATCH_PROOF);
     //-------------------------------------------
     // Compute witness and commited pols
     //-------------------------------------------
     TimerStart(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
 
-    ExecFile exec(execFile, nCols);
     uint64_t sizeWitness = get_size_of_witness();
+    const ExecFile &exec = ExecFile::get(execFile, nCols, sizeWitness);
     Goldilocks::Element *tmp = new Goldilocks::Element[exec.nAdds + sizeWitness];
+#pragma omp parallel for
     for (uint64_t i = 0; i < sizeWitness; i++)
     {
       FrGElement aux;
@@ -349,41 +371,31 @@ namespace CircomRecursiveF
       FrG_toLongNormal(&aux, &aux);
       tmp[i] = Goldilocks::fromU64(aux.longVal[0]);
     }
-    delete ctx;
-    for (uint64_t i = 0; i < exec.nAdds; i++)
-    {
-      FrG_toLongNormal(&exec.p_adds[i * 4], &exec.p_adds[i * 4]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 1], &exec.p_adds[i * 4 + 1]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 2], &exec.p_adds[i * 4 + 2]);
-      FrG_toLongNormal(&exec.p_adds[i * 4 + 3], &exec.p_adds[i * 4 + 3]);
-
-      uint64_t idx_1 = exec.p_adds[i * 4].longVal[0];
-      uint64_t idx_2 = exec.p_adds[i * 4 + 1].longVal[0];
+    releaseCalcWit(ctx);
 
-      Goldilocks::Element c = tmp[idx_1] * Goldilocks::fromU64(exec.p_adds[i * 4 + 2].longVal[0]);
-      Goldilocks::Element d = tmp[idx_2] * Goldilocks::fromU64(exec.p_adds[i * 4 + 3].longVal[0]);
-      tmp[sizeWitness + i] = c + d;
+    // The exec file values are already normal, so they are used as they are
+    for (uint64_t l = 0; l < exec.nLevels(); l++)
+    {
+#pragma omp parallel for
+      for (uint64_t k = exec.addsLevels[l]; k < exec.addsLevels[l + 1]; k++)
+      {
+        uint64_t i = exec.addsOrder[k];
+        Goldilocks::Element c = tmp[exec.p_adds[i * 4]] * Goldilocks::fromU64(exec.p_adds[i * 4 + 2]);
+        Goldilocks::Element d = tmp[exec.p_adds[i * 4 + 1]] * Goldilocks::fromU64(exec.p_adds[i * 4 + 3]);
+        tmp[sizeWitness + i] = c + d;
+      }
     }
 
-    // #pragma omp parallel for
+#pragma omp parallel for
     for (uint i = 0; i < exec.nSMap; i++)
     {
       for (uint j = 0; j < nCols; j++)
       {
-        FrGElement aux;
-        FrG_toLongNormal(&aux, &exec.p_sMap[nCols * i + j]);
-        uint64_t idx_1 = aux.longVal[0];
-        if (idx_1 != 0)
-        {
-          uint64_t idx_2 = Goldilocks::toU64(tmp[idx_1]);
-          commitPols->Compressor.a[j][i] = Goldilocks::fromU64(idx_2);
-        }
-        else
-        {
-          commitPols->Compressor.a[j][i] = Goldilocks::zero();
-        }
+        uint64_t idx_1 = exec.p_sMap[nCols * i + j];
+        commitPols->Compressor.a[j][i] = (idx_1 != 0) ? Goldilocks::fromU64(Goldilocks::toU64(tmp[idx_1])) : Goldilocks::zero();
       }
     }
+#pragma omp parallel for
     for (uint i = exec.nSMap; i < N; i++)
     {
       for (uint j = 0; j < nCols; j++)
@@ -392,8 +404,28 @@ namespace CircomRecursiveF
       }
     }
     delete[] tmp;
-    freeCircuit(circuit);
     TimerStopAndLog(STARK_WITNESS_AND_COMMITED_POLS_BATCH_PROOF);
   }
 
+  void getCommitedPols(CommitPolsStarks *commitPols, const std::string zkevmVerifier, const std::string execFile, nlohmann::json &zkin, uint64_t N, uint64_t nCols)
+  {
+    //-------------------------------------------
+    // Verifier stark proof
+    //-------------------------------------------
+    TimerStart(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_F);
+    Circom_Circuit *circuit = getCircuit(zkevmVerifier);
+    TimerStopAndLog(CIRCOM_LOAD_CIRCUIT_BATCH_PROOF_F);
+    TimerStart(CIRCOM_LOAD_JSON_BATCH_PROOF);
+    Circom_CalcWit *ctx = acquireCalcWit(circuit);
+
+    loadJsonImpl(ctx, zkin);
+    if (ctx->getRemaingInputsToBeSet() != 0)
+    {
+      zklog.error("Prover::genBatchProof() Not all inputs have been set. Only " + to_string(get_main_input_signal_no() - ctx->getRemaingInputsToBeSet()) + " out of " + to_string(get_main_input_signal_no()));
+      exitProcess();
+    }
+    TimerStopAndLog(CIRCOM_LOAD_JSON_BATCH_PROOF);
+    calcCommitedPols(commitPols, ctx, execFile, N, nCols);
+  }
+
 }
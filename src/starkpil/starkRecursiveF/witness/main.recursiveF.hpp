@@ -18,6 +18,9 @@ namespace CircomRecursiveF
     using json = nlohmann::json;
     Circom_Circuit *loadCircuit(std::string const &datFileName);
     void freeCircuit(Circom_Circuit *circuit);
+    Circom_Circuit *getCircuit(std::string const &datFileName); // Loaded only once per process
+    Circom_CalcWit *acquireCalcWit(Circom_Circuit *circuit);
+    void releaseCalcWit(Circom_CalcWit *ctx);
     void loadJson(Circom_CalcWit *ctx, std::string filename);
     void loadJsonImpl(Circom_CalcWit *ctx, json &j);
     void writeBinWitness(Circom_CalcWit *ctx, std::string wtnsFileName);
@@ -0,0 +1,205 @@
+#include <stdio.h>
+#include <unistd.h>
+#include <omp.h>
+#include "stark_setup_cache.hpp"
+#include "zhInv.hpp"
+#include "utils.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "zkmax.hpp"
+
+#define STARK_SETUP_CACHE_HEADER_SIZE 6 // magic, version, nBits, nBitsExt, zhInvSize, checksum
+#define STARK_SETUP_CACHE_SAMPLES 64    // Number of x_n and x_2ns values recomputed when loading the file
+
+// Position dependent checksum of n elements, computed in parallel
+static uint64_t starkSetupCacheChecksum (const Goldilocks::Element *p, uint64_t n)
+{
+    uint64_t checksum = 0;
+#pragma omp parallel for reduction(+ : checksum)
+    for (uint64_t i = 0; i < n; i++)
+    {
+        checksum += Goldilocks::toU64(p[i]) ^ ((i + 1) * 0x9E3779B97F4A7C15ULL);
+    }
+    return checksum;
+}
+
+// Sets p[i] = start * w^i for i in [0, n), every thread computing its own range of rows from its first power
+static void starkSetupCachePowers (Goldilocks::Element *p, uint64_t n, const Goldilocks::Element &start, const Goldilocks::Element &w)
+{
+#pragma omp parallel
+    {
+        uint64_t nThreads = omp_get_num_threads();
+        uint64_t chunk = (n + nThreads - 1) / nThreads;
+        uint64_t from = zkmin(omp_get_thread_num() * chunk, n);
+        uint64_t to = zkmin(from + chunk, n);
+        if (from < to)
+        {
+            Goldilocks::Element xx = start * Goldilocks::exp(w, from);
+            for (uint64_t i = from; i < to; i++)
+            {
+                p[i] = xx;
+                Goldilocks::mul(xx, xx, w);
+            }
+        }
+    }
+}
+
+StarkSetupCache::~StarkSetupCache()
+{
+    if (pAddress == NULL) return;
+    if (bMapped)
+    {
+        unmapFile(pAddress, size);
+    }
+    else
+    {
+        free(pAddress);
+    }
+}
+
+bool StarkSetupCache::load (const string &fileName, uint64_t _nBits, uint64_t _nBitsExt)
+{
+    zkassert(pAddress == NULL);
+
+    if (!fileExists(fileName))
+    {
+        zklog.info("StarkSetupCache::load() did not find file=" + fileName);
+        return false;
+    }
+
+    uint64_t N = 1ULL << _nBits;
+    uint64_t NExtended = 1ULL << _nBitsExt;
+    uint64_t _zhInvSize = 1ULL << (_nBitsExt - _nBits);
+    uint64_t nElements = N + NExtended + _zhInvSize;
+    uint64_t expectedSize = (STARK_SETUP_CACHE_HEADER_SIZE + nElements) * sizeof(uint64_t);
+    if (fileSize(fileName) != expectedSize)
+    {
+        zklog.warning("StarkSetupCache::load() found file=" + fileName + " with size=" + to_string(fileSize(fileName)) + " instead of " + to_string(expectedSize));
+        return false;
+    }
+
+    uint64_t *header = (uint64_t *)mapFile(fileName, expectedSize, false);
+    Goldilocks::Element *pTables = (Goldilocks::Element *)(header + STARK_SETUP_CACHE_HEADER_SIZE);
+    bool bValid = (header[0] == STARK_SETUP_CACHE_MAGIC) &&
+                  (header[1] == STARK_SETUP_CACHE_VERSION) &&
+                  (header[2] == _nBits) &&
+                  (header[3] == _nBitsExt) &&
+                  (header[4] == _zhInvSize) &&
+                  (header[5] == starkSetupCacheChecksum(pTables, nElements));
+
+    // Recompute a sample of the values, to reject a file that is consistent but wrong
+    if (bValid)
+    {
+        Goldilocks::Element *pX_n = pTables;
+        Goldilocks::Element *pX_2ns = pTables + N;
+        Goldilocks::Element *pZhInv = pTables + N + NExtended;
+        for (uint64_t s = 0; bValid && (s < STARK_SETUP_CACHE_SAMPLES); s++)
+        {
+            uint64_t i = (s * 0x9E3779B97F4A7C15ULL) % N;
+            uint64_t j = (s * 0x9E3779B97F4A7C15ULL) % NExtended;
+            bValid = Goldilocks::equal(pX_n[i], Goldilocks::exp(Goldilocks::w(_nBits), i)) &&
+                     Goldilocks::equal(pX_2ns[j], Goldilocks::shift() * Goldilocks::exp(Goldilocks::w(_nBitsExt), j));
+        }
+        ZhInv zi(_nBits, _nBitsExt);
+        for (uint64_t i = 0; bValid && (i < _zhInvSize); i++)
+        {
+            bValid = Goldilocks::equal(pZhInv[i], zi.zhInv(i));
+        }
+    }
+
+    if (!bValid)
+    {
+        zklog.warning("StarkSetupCache::load() found invalid contents in file=" + fileName);
+        unmapFile(header, expectedSize);
+        return false;
+    }
+
+    pAddress = header;
+    size = expectedSize;
+    bMapped = true;
+    nBits = _nBits;
+    nBitsExt = _nBitsExt;
+    x_n = pTables;
+    x_2ns = pTables + N;
+    zhInv = pTables + N + NExtended;
+    zhInvSize = _zhInvSize;
+
+    zklog.info("StarkSetupCache::load() mapped " + to_string(size) + " bytes from file=" + fileName);
+    return true;
+}
+
+void StarkSetupCache::generate (uint64_t _nBits, uint64_t _nBitsExt)
+{
+    zkassert(pAddress == NULL);
+
+    nBits = _nBits;
+    nBitsExt = _nBitsExt;
+    uint64_t N = 1ULL << nBits;
+    uint64_t NExtended = 1ULL << nBitsExt;
+    zhInvSize = 1ULL << (nBitsExt - nBits);
+    uint64_t nElements = N + NExtended + zhInvSize;
+    size = (STARK_SETUP_CACHE_HEADER_SIZE + nElements) * sizeof(uint64_t);
+
+    pAddress = malloc(size);
+    if (pAddress == NULL)
+    {
+        zklog.error("StarkSetupCache::generate() failed calling malloc() of size=" + to_string(size));
+        exitProcess();
+    }
+    bMapped = false;
+
+    uint64_t *header = (uint64_t *)pAddress;
+    x_n = (Goldilocks::Element *)(header + STARK_SETUP_CACHE_HEADER_SIZE);
+    x_2ns = x_n + N;
+    zhInv = x_2ns + NExtended;
+
+    starkSetupCachePowers(x_n, N, Goldilocks::one(), Goldilocks::w(nBits));
+    starkSetupCachePowers(x_2ns, NExtended, Goldilocks::shift(), Goldilocks::w(nBitsExt));
+    ZhInv zi(nBits, nBitsExt);
+    for (uint64_t i = 0; i < zhInvSize; i++)
+    {
+        zhInv[i] = zi.zhInv(i);
+    }
+
+    header[0] = STARK_SETUP_CACHE_MAGIC;
+    header[1] = STARK_SETUP_CACHE_VERSION;
+    header[2] = nBits;
+    header[3] = nBitsExt;
+    header[4] = zhInvSize;
+    header[5] = starkSetupCacheChecksum(x_n, nElements);
+}
+
+bool StarkSetupCache::save (const string &fileName) const
+{
+    zkassert(pAddress != NULL);
+
+    // Write a temporary file and rename it, so that a concurrent process never maps a partially written file
+    string tmpFileName = fileName + ".tmp." + to_string(getpid());
+    FILE *pFile = fopen(tmpFileName.c_str(), "wb");
+    if (pFile == NULL)
+    {
+        zklog.warning("StarkSetupCache::save() failed calling fopen() of file=" + tmpFileName);
+        return false;
+    }
+    bool bResult = (fwrite(pAddress, size, 1, pFile) == 1);
+    bResult = (fclose(pFile) == 0) && bResult;
+    if (!bResult || (rename(tmpFileName.c_str(), fileName.c_str()) != 0))
+    {
+        zklog.warning("StarkSetupCache::save() failed writing file=" + fileName);
+        remove(tmpFileName.c_str());
+        return false;
+    }
+
+    zklog.info("StarkSetupCache::save() saved " + to_string(size) + " bytes into file=" + fileName);
+    return true;
+}
+
+string StarkSetupCache::getFileName (const string &starkInfoFile)
+{
+    const string suffix = ".starkinfo.json";
+    if ((starkInfoFile.size() >= suffix.size()) && (starkInfoFile.compare(starkInfoFile.size() - suffix.size(), suffix.size(), suffix) == 0))
+    {
+        return starkInfoFile.substr(0, starkInfoFile.size() - suffix.size()) + ".setup.bin";
+    }
+    return starkInfoFile + ".setup.bin";
+}
@@ -0,0 +1,48 @@
+#ifndef STARK_SETUP_CACHE_HPP
+#define STARK_SETUP_CACHE_HPP
+
+#include <stdint.h>
+#include <string>
+#include "goldilocks_base_field.hpp"
+
+using namespace std;
+
+#define STARK_SETUP_CACHE_MAGIC 0x5055544553535453ULL // "STSSETUP"
+#define STARK_SETUP_CACHE_VERSION 1
+
+/*
+    Stark setup cache: the domain tables that only depend on nBits and nBitsExt (x_n, x_2ns and ZhInv), saved into a
+    file next to the starkinfo.json so that the prover can map it at startup instead of computing them.
+    File layout: header (magic, version, nBits, nBitsExt, zhInvSize, checksum), x_n[N], x_2ns[NExtended], zhInv[zhInvSize]
+*/
+class StarkSetupCache
+{
+    void *pAddress;   // Mapped file, or allocated memory if generated
+    uint64_t size;    // Size of pAddress in bytes
+    bool bMapped;     // True if pAddress is a mapped file, false if it was allocated
+
+public:
+    uint64_t nBits;
+    uint64_t nBitsExt;
+    Goldilocks::Element *x_n;
+    Goldilocks::Element *x_2ns;
+    Goldilocks::Element *zhInv;
+    uint64_t zhInvSize;
+
+    StarkSetupCache() : pAddress(NULL), size(0), bMapped(false), nBits(0), nBitsExt(0), x_n(NULL), x_2ns(NULL), zhInv(NULL), zhInvSize(0) {};
+    ~StarkSetupCache();
+
+    // Maps the file and verifies it; returns false if it does not exist or does not match nBits and nBitsExt
+    bool load (const string &fileName, uint64_t nBits, uint64_t nBitsExt);
+
+    // Computes the tables in parallel
+    void generate (uint64_t nBits, uint64_t nBitsExt);
+
+    // Saves the tables into a file; returns false if it could not be written, e.g. in a read-only directory
+    bool save (const string &fileName) const;
+
+    // Returns the cache file name of a starkinfo file, e.g. zkevm.setup.bin for zkevm.starkinfo.json
+    static string getFileName (const string &starkInfoFile);
+};
+
+#endif
@@ -3,6 +3,9 @@
 #include "sm/pols_generated/commit_pols.hpp"
 #include "zklog.hpp"
 #include "exit_process.hpp"
+#include "zkassert.hpp"
+#include "goldilocks_batch.hpp"
+#include <thread>
 
 USING_PROVER_FORK_NAMESPACE;
 
@@ -11,6 +14,8 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     // Initialize vars
     TimerStart(STARK_INITIALIZATION);
 
+    spilledBytes = 0;
+
     uint64_t numCommited = starkInfo.nCm1;
     Transcript transcript;
     Polinomial evals(N, FIELD_EXTENSION);
@@ -48,19 +53,30 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     //--------------------------------
     TimerStart(STARK_STEP_1);
     TimerStart(STARK_STEP_1_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_1_LDE);
-
-    ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
-    TimerStopAndLog(STARK_STEP_1_LDE);
-    TimerStart(STARK_STEP_1_MERKLETREE);
-    treesGL[0]->merkelize();
+    if (nttPipeline != NULL)
+    {
+        extendAndMerkelizePipelined(1, treesGL[0], p_cm1_2ns, p_cm1_n, starkInfo.mapSectionsN.section[eSection::cm1_n]);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_1_LDE);
+        ntt.extendPol(p_cm1_2ns, p_cm1_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm1_n], p_cm2_2ns);
+        TimerStopAndLog(STARK_STEP_1_LDE);
+        TimerStart(STARK_STEP_1_MERKLETREE);
+        treesGL[0]->merkelize();
+        TimerStopAndLog(STARK_STEP_1_MERKLETREE);
+    }
     treesGL[0]->getRoot(root0.address());
-    TimerStopAndLog(STARK_STEP_1_MERKLETREE);
     zklog.info("MerkleTree rootGL 0: [ " + root0.toString(4) + " ]");
     transcript.put(root0.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_1_LDE_AND_MERKLETREE);
     TimerStopAndLog(STARK_STEP_1);
 
+    if (config.starkOutOfCore)
+    {
+        reportOutOfCore("STARK_STEP_1", spillTree(treesGL[0]));
+    }
+
     //--------------------------------
     // 2.- Caluculate plookups h1 and h2
     //--------------------------------
@@ -130,19 +146,31 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStopAndLog(STARK_STEP_2_CALCULATEH1H2_TRANSPOSE_2);
 
     TimerStart(STARK_STEP_2_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_2_LDE);
-    ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_2_LDE);
-    TimerStart(STARK_STEP_2_MERKLETREE);
-    treesGL[1]->merkelize();
+    if (nttPipeline != NULL)
+    {
+        extendAndMerkelizePipelined(2, treesGL[1], p_cm2_2ns, p_cm2_n, starkInfo.mapSectionsN.section[eSection::cm2_n]);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_2_LDE);
+        ntt.extendPol(p_cm2_2ns, p_cm2_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm2_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_2_LDE);
+        TimerStart(STARK_STEP_2_MERKLETREE);
+        treesGL[1]->merkelize();
+        TimerStopAndLog(STARK_STEP_2_MERKLETREE);
+    }
     treesGL[1]->getRoot(root1.address());
-    TimerStopAndLog(STARK_STEP_2_MERKLETREE);
     zklog.info("MerkleTree rootGL 1: [ " + root1.toString(4) + " ]");
     transcript.put(root1.address(), HASH_SIZE);
 
     TimerStopAndLog(STARK_STEP_2_LDE_AND_MERKLETREE);
     TimerStopAndLog(STARK_STEP_2);
 
+    if (config.starkOutOfCore)
+    {
+        reportOutOfCore("STARK_STEP_2", spillTree(treesGL[1]));
+    }
+
     //--------------------------------
     // 3.- Compute Z polynomials
     //--------------------------------
@@ -211,18 +239,33 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     }
 
     TimerStart(STARK_STEP_3_LDE_AND_MERKLETREE);
-    TimerStart(STARK_STEP_3_LDE);
-    ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
-    TimerStopAndLog(STARK_STEP_3_LDE);
-    TimerStart(STARK_STEP_3_MERKLETREE);
-    treesGL[2]->merkelize();
+    if (nttPipeline != NULL)
+    {
+        extendAndMerkelizePipelined(3, treesGL[2], p_cm3_2ns, p_cm3_n, starkInfo.mapSectionsN.section[eSection::cm3_n]);
+    }
+    else
+    {
+        TimerStart(STARK_STEP_3_LDE);
+        ntt.extendPol(p_cm3_2ns, p_cm3_n, NExtended, N, starkInfo.mapSectionsN.section[eSection::cm3_n], pBuffer);
+        TimerStopAndLog(STARK_STEP_3_LDE);
+        TimerStart(STARK_STEP_3_MERKLETREE);
+        treesGL[2]->merkelize();
+        TimerStopAndLog(STARK_STEP_3_MERKLETREE);
+    }
     treesGL[2]->getRoot(root2.address());
-    TimerStopAndLog(STARK_STEP_3_MERKLETREE);
     zklog.info("MerkleTree rootGL 2: [ " + root2.toString(4) + " ]");
     transcript.put(root2.address(), HASH_SIZE);
     TimerStopAndLog(STARK_STEP_3_LDE_AND_MERKLETREE);
     TimerStopAndLog(STARK_STEP_3);
 
+    // The polynomials of the base domain are not used after their extension
+    if (config.starkOutOfCore)
+    {
+        uint64_t stageSpilledBytes = spillTree(treesGL[2]);
+        stageSpilledBytes += spillSections({eSection::cm1_n, eSection::cm2_n, eSection::cm3_n, eSection::tmpExp_n}, {eSection::cm1_2ns, eSection::cm2_2ns, eSection::cm3_2ns, eSection::cm4_2ns, eSection::q_2ns, eSection::f_2ns});
+        reportOutOfCore("STARK_STEP_3", stageSpilledBytes);
+    }
+
     //--------------------------------
     // 4. Compute C Polynomial
     //--------------------------------
@@ -295,6 +338,13 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     TimerStopAndLog(STARK_STEP_4_MERKLETREE);
     TimerStopAndLog(STARK_STEP_4);
 
+    if (config.starkOutOfCore)
+    {
+        uint64_t stageSpilledBytes = spillTree(treesGL[3]);
+        stageSpilledBytes += spillSections({eSection::q_2ns}, {eSection::cm1_2ns, eSection::cm2_2ns, eSection::cm3_2ns, eSection::cm4_2ns, eSection::f_2ns});
+        reportOutOfCore("STARK_STEP_4", stageSpilledBytes);
+    }
+
     //--------------------------------
     // 5. Compute FRI Polynomial
     //--------------------------------
@@ -305,31 +355,24 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     // transcript.getField(challenges[6]); // v2
     transcript.getField(challenges[7]); // xi
 
-    Polinomial LEv(N, 3, "LEv");
-    Polinomial LpEv(N, 3, "LpEv");
+    // LEv and LpEv are interleaved in the same rows, so that they are computed with a single INTT and evmap reads
+    // both of them with one access per row
+    Polinomial LEvLpEv(N, 2 * FIELD_EXTENSION, "LEvLpEv");
     Polinomial xis(1, 3);
     Polinomial wxis(1, 3);
     Polinomial c_w(1, 3);
 
-    Goldilocks3::one((Goldilocks3::Element &)*LEv[0]);
-    Goldilocks3::one((Goldilocks3::Element &)*LpEv[0]);
-
     Polinomial::divElement(xis, 0, challenges, 7, (Goldilocks::Element &)Goldilocks::shift());
     Polinomial::mulElement(c_w, 0, challenges, 7, (Goldilocks::Element &)Goldilocks::w(starkInfo.starkStruct.nBits));
     Polinomial::divElement(wxis, 0, c_w, 0, (Goldilocks::Element &)Goldilocks::shift());
 
-    for (uint64_t k = 1; k < N; k++)
-    {
-        Polinomial::mulElement(LEv, k, LEv, k - 1, xis, 0);
-        Polinomial::mulElement(LpEv, k, LpEv, k - 1, wxis, 0);
-    }
-    ntt.INTT(LEv.address(), LEv.address(), N, 3);
-    ntt.INTT(LpEv.address(), LpEv.address(), N, 3);
+    evmapPowers(LEvLpEv.address(), N, *(Goldilocks3::Element *)xis[0], *(Goldilocks3::Element *)wxis[0]);
+    ntt.INTT(LEvLpEv.address(), LEvLpEv.address(), N, 2 * FIELD_EXTENSION);
 
     TimerStopAndLog(STARK_STEP_5_LEv_LpEv);
 
     TimerStart(STARK_STEP_5_EVMAP);
-    evmap(pAddress, evals, LEv, LpEv);
+    evmap(pAddress, evals, LEvLpEv);
     TimerStopAndLog(STARK_STEP_5_EVMAP);
     TimerStart(STARK_STEP_5_XDIVXSUB);
 
@@ -389,6 +432,18 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     }
 
     TimerStopAndLog(STARK_STEP_5);
+
+    // The FRI folding only reads the FRI polynomial; the committed sections and the constant tree are only read by
+    // the queries, but a prefaulted constant tree is kept resident, since it is shared by all the proofs
+    if (config.starkOutOfCore)
+    {
+        uint64_t stageSpilledBytes = spillSections({eSection::cm1_2ns, eSection::cm2_2ns, eSection::cm3_2ns, eSection::cm4_2ns}, {eSection::f_2ns});
+        if (config.mapConstantsTreeFile && !config.prefaultConstantsTree)
+        {
+            stageSpilledBytes += spillMemory(pConstTreeAddress, starkInfo.getConstTreeSizeInBytes());
+        }
+        reportOutOfCore("STARK_STEP_5", stageSpilledBytes);
+    }
     TimerStart(STARK_STEP_FRI);
 
     Polinomial friPol = Polinomial(p_f_2ns, NExtended, 3, 3, "friPol");
@@ -401,6 +456,11 @@ void Starks::genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldil
     std::memcpy(&proof.proofs.root3[0], root2.address(), HASH_SIZE * sizeof(Goldilocks::Element));
     std::memcpy(&proof.proofs.root4[0], root3.address(), HASH_SIZE * sizeof(Goldilocks::Element));
     TimerStopAndLog(STARK_STEP_FRI);
+
+    if (config.starkOutOfCore)
+    {
+        reportOutOfCore("STARK_STEP_FRI", 0);
+    }
 }
 
 Polinomial *Starks::transposeH1H2Columns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer)
@@ -553,119 +613,349 @@ void Starks::transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *t
         delete[] transPols;
     }
 }
-void Starks::evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv)
+// Sets the rows of L to (xis^k, wxis^k), every thread computing its own range of rows from its first powers
+void Starks::evmapPowers(Goldilocks::Element *L, uint64_t n, const Goldilocks3::Element &xis, const Goldilocks3::Element &wxis)
+{
+#pragma omp parallel
+    {
+        uint64_t nThreads = omp_get_num_threads();
+        uint64_t chunk = (n + nThreads - 1) / nThreads;
+        uint64_t from = zkmin(omp_get_thread_num() * chunk, n);
+        uint64_t to = zkmin(from + chunk, n);
+        if (from < to)
+        {
+            // Square and multiply the first powers of the range
+            Goldilocks3::Element x, wx, xSquare, wxSquare;
+            Goldilocks3::one(x);
+            Goldilocks3::one(wx);
+            Goldilocks3::copy(xSquare, xis);
+            Goldilocks3::copy(wxSquare, wxis);
+            for (uint64_t e = from; e > 0; e >>= 1)
+            {
+                if (e & 1)
+                {
+                    Goldilocks3::mul(x, x, xSquare);
+                    Goldilocks3::mul(wx, wx, wxSquare);
+                }
+                Goldilocks3::mul(xSquare, xSquare, xSquare);
+                Goldilocks3::mul(wxSquare, wxSquare, wxSquare);
+            }
+            for (uint64_t k = from; k < to; k++)
+            {
+                Goldilocks3::copy(*(Goldilocks3::Element *)&L[k * 2 * FIELD_EXTENSION], x);
+                Goldilocks3::copy(*(Goldilocks3::Element *)&L[k * 2 * FIELD_EXTENSION + FIELD_EXTENSION], wx);
+                Goldilocks3::mul(x, x, xis);
+                Goldilocks3::mul(wx, wx, wxis);
+            }
+        }
+    }
+}
+
+// Column of the extended domain opened by the evaluations, at xi and/or at w*xi
+class EvmapColumn
+{
+public:
+    const Goldilocks::Element *p; // First element of the column
+    uint64_t stride;              // Row size of its section
+    uint64_t dim;
+    bool bX;                      // Opened at xi
+    bool bWX;                     // Opened at w*xi
+};
+
+// Accumulates acc += l * v, being l an extension field value and v a value of dimension dim
+template <class B>
+static inline void evmapMulAdd(typename B::Reg *acc, const typename B::Reg *l, const typename B::Reg *v, uint64_t dim)
+{
+    typename B::Reg t[3];
+    if (dim == 1)
+    {
+        for (uint64_t d = 0; d < 3; d++) B::mul(t[d], l[d], v[0]);
+    }
+    else
+    {
+        B::mul3(t, l, v);
+    }
+    for (uint64_t d = 0; d < 3; d++) B::add(acc[d], acc[d], t[d]);
+}
+
+// Computes sum_k L[k] * column[k << extendBits] of all the columns in a single pass over the rows: every batch of
+// B::SIZE rows reads LEv and LpEv once and every opened column once, whatever the number of its openings, and the
+// per-thread sums of each lane are added into res (6 elements per column: the opening at xi and at w*xi)
+template <class B>
+static void evmapEvaluate(const vector<EvmapColumn> &columns, const Goldilocks::Element *L, uint64_t N, uint64_t extendBits, Goldilocks::Element *res)
+{
+    uint64_t nColumns = columns.size();
+#pragma omp parallel
+    {
+        typename B::Reg zero;
+        B::set(zero, Goldilocks::zero());
+        vector<typename B::Reg> acc(nColumns * 2 * FIELD_EXTENSION, zero);
+
+#pragma omp for nowait
+        for (uint64_t k = 0; k < N; k += B::SIZE)
+        {
+            typename B::Reg l[2 * FIELD_EXTENSION];
+            for (uint64_t d = 0; d < 2 * FIELD_EXTENSION; d++)
+            {
+                B::load(l[d], &L[k * 2 * FIELD_EXTENSION + d], 2 * FIELD_EXTENSION);
+            }
+            for (uint64_t c = 0; c < nColumns; c++)
+            {
+                const EvmapColumn &column = columns[c];
+                const Goldilocks::Element *p = column.p + (k << extendBits) * column.stride;
+                typename B::Reg v[3];
+                for (uint64_t d = 0; d < column.dim; d++)
+                {
+                    B::load(v[d], p + d, column.stride << extendBits);
+                }
+                if (column.bX) evmapMulAdd<B>(&acc[c * 2 * FIELD_EXTENSION], l, v, column.dim);
+                if (column.bWX) evmapMulAdd<B>(&acc[c * 2 * FIELD_EXTENSION + FIELD_EXTENSION], l + FIELD_EXTENSION, v, column.dim);
+            }
+        }
+
+        // Add the lanes of the thread accumulators
+        vector<Goldilocks::Element> sums(nColumns * 2 * FIELD_EXTENSION, Goldilocks::zero());
+        Goldilocks::Element lanes[B::SIZE];
+        for (uint64_t i = 0; i < sums.size(); i++)
+        {
+            B::store(lanes, 1, acc[i]);
+            for (uint64_t j = 0; j < B::SIZE; j++) sums[i] = sums[i] + lanes[j];
+        }
+#pragma omp critical
+        for (uint64_t i = 0; i < sums.size(); i++)
+        {
+            res[i] = res[i] + sums[i];
+        }
+    }
+}
+
+void Starks::evmap(void *pAddress, Polinomial &evals, Polinomial &LEvLpEv)
 {
     Goldilocks::Element *mem = (Goldilocks::Element *)pAddress;
     uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
     u_int64_t size_eval = starkInfo.evMap.size();
-    // Order polinomials by address, note that there are collisions!
-    map<uintptr_t, vector<uint>> map_offsets;
+
+    // Order the opened columns by address, so that the columns of every section are read together; note that
+    // several evaluations can open the same column, at xi and/or at w*xi
+    map<uintptr_t, uint64_t> map_offsets;
+    vector<EvmapColumn> columns;
+    vector<uint64_t> evColumn(size_eval);
     for (uint64_t i = 0; i < size_eval; i++)
     {
         EvMap ev = starkInfo.evMap[i];
+        EvmapColumn column;
         if (ev.type == EvMap::eType::_const)
         {
-            map_offsets[reinterpret_cast<std::uintptr_t>(&((Goldilocks::Element *)pConstPols2ns->address())[ev.id])].push_back(i);
+            column.p = &((Goldilocks::Element *)pConstPols2ns->address())[ev.id];
+            column.stride = pConstPols2ns->numPols();
+            column.dim = 1;
+        }
+        else if (ev.type == EvMap::eType::cm || ev.type == EvMap::eType::q)
+        {
+            Polinomial pol = starkInfo.getPolinomial(mem, (ev.type == EvMap::eType::cm) ? starkInfo.cm_2ns[ev.id] : starkInfo.qs[ev.id]);
+            column.p = pol.address();
+            column.stride = pol.offset();
+            column.dim = pol.dim();
+        }
+        else
+        {
+            throw std::invalid_argument("Invalid ev type: " + ev.type);
         }
-        else if (ev.type == EvMap::eType::cm)
+        column.bX = false;
+        column.bWX = false;
+        uintptr_t key = reinterpret_cast<std::uintptr_t>(column.p);
+        if (map_offsets.find(key) == map_offsets.end())
         {
-            Polinomial pol = starkInfo.getPolinomial(mem, starkInfo.cm_2ns[ev.id]);
-            map_offsets[reinterpret_cast<std::uintptr_t>(pol.address())].push_back(i);
+            map_offsets[key] = columns.size();
+            columns.push_back(column);
         }
-        else if (ev.type == EvMap::eType::q)
+        evColumn[i] = map_offsets[key];
+        if (ev.prime)
         {
-            Polinomial pol = starkInfo.getPolinomial(mem, starkInfo.qs[ev.id]);
-            map_offsets[reinterpret_cast<std::uintptr_t>(pol.address())].push_back(i);
+            columns[evColumn[i]].bWX = true;
         }
         else
         {
-            throw std::invalid_argument("Invalid ev type: " + ev.type);
+            columns[evColumn[i]].bX = true;
         }
     }
-    Polinomial *ordPols = new Polinomial[size_eval];
-    vector<bool> isPrime(size_eval);
-    vector<uint> indx(size_eval);
-    //   build and store ordered polinomials that need to be computed
-    uint kk = 0;
-    for (std::map<uintptr_t, std::vector<uint>>::const_iterator it = map_offsets.begin(); it != map_offsets.end(); ++it)
+    vector<EvmapColumn> ordColumns;
+    vector<uint64_t> ordIndex(columns.size());
+    for (std::map<uintptr_t, uint64_t>::const_iterator it = map_offsets.begin(); it != map_offsets.end(); ++it)
+    {
+        ordIndex[it->second] = ordColumns.size();
+        ordColumns.push_back(columns[it->second]);
+    }
+
+    vector<Goldilocks::Element> res(ordColumns.size() * 2 * FIELD_EXTENSION, Goldilocks::zero());
+#ifdef __AVX512__
+    if (N % BatchAvx512::SIZE == 0)
+    {
+        evmapEvaluate<BatchAvx512>(ordColumns, LEvLpEv.address(), N, extendBits, res.data());
+    }
+    else
+#endif
+    if (N % BatchAvx::SIZE == 0)
+    {
+        evmapEvaluate<BatchAvx>(ordColumns, LEvLpEv.address(), N, extendBits, res.data());
+    }
+    else
+    {
+        evmapEvaluate<BatchScalar>(ordColumns, LEvLpEv.address(), N, extendBits, res.data());
+    }
+
+    for (uint64_t i = 0; i < size_eval; i++)
     {
-        for (std::vector<uint>::const_iterator it2 = it->second.begin(); it2 != it->second.end(); ++it2)
+        uint64_t offset = (ordIndex[evColumn[i]] * 2 + (starkInfo.evMap[i].prime ? 1 : 0)) * FIELD_EXTENSION;
+        (evals[i])[0] = res[offset];
+        (evals[i])[1] = res[offset + 1];
+        (evals[i])[2] = res[offset + 2];
+    }
+}
+
+uint64_t Starks::spillSections(const vector<eSection> &coldSections, const vector<eSection> &liveSections)
+{
+    uint64_t stageSpilledBytes = 0;
+    for (uint64_t i = 0; i < coldSections.size(); i++)
+    {
+        uint64_t coldOffset = starkInfo.mapOffsets.section[coldSections[i]];
+        uint64_t coldSize = starkInfo.mapSectionsN.section[coldSections[i]] * starkInfo.mapDeg.section[coldSections[i]];
+
+        // The sections of the memory map can share memory, since the ones that are no longer used are reused
+        bool bOverlaps = false;
+        for (uint64_t j = 0; j < liveSections.size(); j++)
         {
-            EvMap ev = starkInfo.evMap[*it2];
-            if (ev.type == EvMap::eType::_const)
+            uint64_t liveOffset = starkInfo.mapOffsets.section[liveSections[j]];
+            uint64_t liveSize = starkInfo.mapSectionsN.section[liveSections[j]] * starkInfo.mapDeg.section[liveSections[j]];
+            if ((liveSize > 0) && (coldOffset < liveOffset + liveSize) && (liveOffset < coldOffset + coldSize))
             {
-                ordPols[kk].potConstruct(&((Goldilocks::Element *)pConstPols2ns->address())[ev.id], pConstPols2ns->degree(), 1, pConstPols2ns->numPols());
+                bOverlaps = true;
+                break;
             }
-            else if (ev.type == EvMap::eType::cm)
-            {
-                ordPols[kk] = starkInfo.getPolinomial(mem, starkInfo.cm_2ns[ev.id]);
-            }
-            else if (ev.type == EvMap::eType::q)
-            {
-                ordPols[kk] = starkInfo.getPolinomial(mem, starkInfo.qs[ev.id]);
-            }
-            isPrime[kk] = ev.prime;
-            indx[kk] = *it2;
-            ++kk;
         }
+        if (bOverlaps || (coldSize == 0))
+        {
+            continue;
+        }
+        stageSpilledBytes += spillMemory(&mem[coldOffset], coldSize * sizeof(Goldilocks::Element));
     }
-    assert(kk == size_eval);
-    // Build buffer for partial results of the matrix-vector product (columns distribution)  .
-    int num_threads = omp_get_max_threads();
-    Goldilocks::Element **evals_acc = (Goldilocks::Element **)malloc(num_threads * sizeof(Goldilocks::Element *));
-    for (int i = 0; i < num_threads; ++i)
+    return stageSpilledBytes;
+}
+
+uint64_t Starks::spillTree(MerkleTreeGL *tree)
+{
+    return spillMemory(tree->nodes, tree->getTreeNumElements() * sizeof(Goldilocks::Element));
+}
+
+void Starks::reportOutOfCore(const string &stage, uint64_t stageSpilledBytes)
+{
+    spilledBytes += stageSpilledBytes;
+    zklog.info("Starks::genProof() out-of-core stage=" + stage +
+               " RSS=" + to_string(getCurrentRSS() >> 20) + "MB" +
+               " peakRSS=" + to_string(getPeakRSS() >> 20) + "MB" +
+               " spilled=" + to_string(stageSpilledBytes >> 20) + "MB" +
+               " totalSpilled=" + to_string(spilledBytes >> 20) + "MB");
+}
+
+void Starks::extendAndMerkelizePipelined(uint64_t step, MerkleTreeGL *tree, Goldilocks::Element *pol_2ns, Goldilocks::Element *pol_n, uint64_t nCols)
+{
+    zkassert(tree->width == nCols);
+    zkassert(tree->height == NExtended);
+
+    if (nCols == 0)
     {
-        evals_acc[i] = (Goldilocks::Element *)malloc(size_eval * FIELD_EXTENSION * sizeof(Goldilocks::Element));
+        tree->initLeaves();
+        tree->merkelizeNodes();
+        return;
     }
-#pragma omp parallel
+
+    // Split the columns in blocks aligned to the sponge rate, so that the leaf hashes are identical to the non-pipelined ones
+    uint64_t blockCols = (nCols + config.starkLDEPipelineBlocks - 1) / config.starkLDEPipelineBlocks;
+    blockCols = ((blockCols + MERKLEHASHGL_RATE - 1) / MERKLEHASHGL_RATE) * MERKLEHASHGL_RATE;
+    uint64_t nBlocks = (nCols + blockCols - 1) / blockCols;
+
+    Goldilocks::Element *pBlockN = (Goldilocks::Element *)malloc(N * blockCols * sizeof(Goldilocks::Element));
+    Goldilocks::Element *pBlock2ns = (Goldilocks::Element *)malloc(NExtended * blockCols * sizeof(Goldilocks::Element));
+    Goldilocks::Element *pBlockBuffer = (Goldilocks::Element *)malloc(NExtended * blockCols * sizeof(Goldilocks::Element));
+    if ((pBlockN == NULL) || (pBlock2ns == NULL) || (pBlockBuffer == NULL))
     {
-        int thread_idx = omp_get_thread_num();
-        for (uint64_t i = 0; i < size_eval * FIELD_EXTENSION; ++i)
+        zklog.error("Starks::extendAndMerkelizePipelined() failed calling malloc() for blockCols=" + to_string(blockCols));
+        exitProcess();
+    }
+
+    uint64_t ldeTime = 0;
+    uint64_t hashTime = 0;
+    struct timeval wallStart;
+    gettimeofday(&wallStart, NULL);
+
+    tree->initLeaves();
+
+    // Block b is extended by this thread while block b-1 is absorbed into the leaf hashes by the hashing thread
+    for (uint64_t b = 0; b <= nBlocks; b++)
+    {
+        std::thread hashThread;
+        if (b > 0)
         {
-            evals_acc[thread_idx][i] = Goldilocks::zero();
+            uint64_t hashFirstCol = (b - 1) * blockCols;
+            uint64_t hashCols = zkmin(blockCols, nCols - hashFirstCol);
+            hashThread = std::thread([this, tree, hashFirstCol, hashCols, &hashTime]()
+            {
+                struct timeval t;
+                gettimeofday(&t, NULL);
+                tree->absorbLeaves(hashFirstCol, hashCols, nThreadsPipelineHash);
+                hashTime += TimeDiff(t);
+            });
         }
-#pragma omp for
-        for (uint64_t k = 0; k < N; k++)
+
+        if (b < nBlocks)
         {
-            Goldilocks::Element *LpEv_ = &(LpEv[k][0]);
-            Goldilocks::Element *LEv_ = &(LEv[k][0]);
-            for (uint64_t i = 0; i < size_eval; i++)
+            struct timeval t;
+            gettimeofday(&t, NULL);
+            uint64_t firstCol = b * blockCols;
+            uint64_t cols = zkmin(blockCols, nCols - firstCol);
+
+#pragma omp parallel for num_threads(nThreadsPipelineLDE)
+            for (uint64_t i = 0; i < N; i++)
             {
-                Polinomial::mulAddElement_adim3(&(evals_acc[thread_idx][i * FIELD_EXTENSION]), isPrime[i] ? LpEv_ : LEv_, ordPols[i], k << extendBits);
+                std::memcpy(&pBlockN[i * cols], &pol_n[i * nCols + firstCol], cols * sizeof(Goldilocks::Element));
             }
-        }
-#pragma omp for
-        for (uint64_t i = 0; i < size_eval; ++i)
-        {
-            Goldilocks::Element sum0 = Goldilocks::zero();
-            Goldilocks::Element sum1 = Goldilocks::zero();
-            Goldilocks::Element sum2 = Goldilocks::zero();
-            int offset = i * FIELD_EXTENSION;
-            for (int k = 0; k < num_threads; ++k)
+
+            nttPipeline->extendPol(pBlock2ns, pBlockN, NExtended, N, cols, pBlockBuffer);
+
+#pragma omp parallel for num_threads(nThreadsPipelineLDE)
+            for (uint64_t i = 0; i < NExtended; i++)
             {
-                sum0 = sum0 + evals_acc[k][offset];
-                sum1 = sum1 + evals_acc[k][offset + 1];
-                sum2 = sum2 + evals_acc[k][offset + 2];
+                std::memcpy(&pol_2ns[i * nCols + firstCol], &pBlock2ns[i * cols], cols * sizeof(Goldilocks::Element));
             }
-            evals_acc[0][offset] = sum0;
-            evals_acc[0][offset + 1] = sum1;
-            evals_acc[0][offset + 2] = sum2;
+            ldeTime += TimeDiff(t);
         }
-#pragma omp single
-        for (uint64_t i = 0; i < size_eval; ++i)
+
+        if (hashThread.joinable())
         {
-            int offset = i * FIELD_EXTENSION;
-            (evals[indx[i]])[0] = evals_acc[0][offset];
-            (evals[indx[i]])[1] = evals_acc[0][offset + 1];
-            (evals[indx[i]])[2] = evals_acc[0][offset + 2];
+            hashThread.join();
         }
     }
-    delete[] ordPols;
-    for (int i = 0; i < num_threads; ++i)
-    {
-        free(evals_acc[i]);
-    }
-    free(evals_acc);
+
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    tree->merkelizeNodes();
+    uint64_t nodesTime = TimeDiff(t);
+    uint64_t wallTime = TimeDiff(wallStart);
+
+    free(pBlockN);
+    free(pBlock2ns);
+    free(pBlockBuffer);
+
+    // Overlap is the time saved with respect to running the three phases one after the other
+    uint64_t serialTime = ldeTime + hashTime + nodesTime;
+    zklog.info("Starks::extendAndMerkelizePipelined() step=" + to_string(step) +
+        " nCols=" + to_string(nCols) +
+        " nBlocks=" + to_string(nBlocks) +
+        " lde=" + to_string(double(ldeTime)/1000000) + " s" +
+        " leaves=" + to_string(double(hashTime)/1000000) + " s" +
+        " nodes=" + to_string(double(nodesTime)/1000000) + " s" +
+        " wall=" + to_string(double(wallTime)/1000000) + " s" +
+        " overlap=" + to_string(serialTime > wallTime ? double(serialTime - wallTime)/1000000 : 0) + " s");
 }
 
 void Starks::merkelizeMemory()
@@ -11,9 +11,11 @@
 #include "friProve.hpp"
 #include "transcript.hpp"
 #include "zhInv.hpp"
+#include "stark_setup_cache.hpp"
 #include "steps.hpp"
 #include "zklog.hpp"
 #include "exit_process.hpp"
+#include "zkmax.hpp"
 
 #define STARK_C12_A_NUM_TREES 5
 #define NUM_CHALLENGES 8
@@ -35,16 +37,20 @@ public:
 
 private:
     void *pConstPolsAddress;
-    void *pConstPolsAddress2ns;
+    void *pConstPolsAddress2ns; // Points into the constant tree, not allocated
     ConstantPolsStarks *pConstPols;
     ConstantPolsStarks *pConstPols2ns;
     void *pConstTreeAddress;
     StarkFiles starkFiles;
+    StarkSetupCache setupCache;
     ZhInv zi;
     uint64_t N;
     uint64_t NExtended;
     NTT_Goldilocks ntt;
     NTT_Goldilocks nttExtended;
+    NTT_Goldilocks *nttPipeline; // LDE of the pipelined mode, using only part of the threads
+    uint64_t nThreadsPipelineLDE;
+    uint64_t nThreadsPipelineHash;
     Polinomial x_n;
     Polinomial x_2ns;
     uint64_t constPolsSize;
@@ -70,22 +76,30 @@ private:
 
     void merkelizeMemory(); // function for DBG purposes
 
+    // Extends the polynomials and merkelizes them by blocks of columns, hashing the leaves of a block while the next one is extended
+    void extendAndMerkelizePipelined(uint64_t step, MerkleTreeGL *tree, Goldilocks::Element *pol_2ns, Goldilocks::Element *pol_n, uint64_t nCols);
+
+    // Out-of-core mode: pages out the cold sections, skipping the ones that share memory with a live section, or the
+    // nodes of a tree, returning the number of bytes; the FRI queries fault back the rows they read
+    uint64_t spilledBytes; // Bytes paged out during the current proof
+    uint64_t spillSections(const vector<eSection> &coldSections, const vector<eSection> &liveSections);
+    uint64_t spillTree(MerkleTreeGL *tree);
+    void reportOutOfCore(const string &stage, uint64_t stageSpilledBytes);
+
 public:
     Starks(const Config &config, StarkFiles starkFiles, void *_pAddress) : config(config),
                                                                            starkInfo(config, starkFiles.zkevmStarkInfo),
                                                                            starkFiles(starkFiles),
-                                                                           zi(config.generateProof() ? starkInfo.starkStruct.nBits : 0,
-                                                                              config.generateProof() ? starkInfo.starkStruct.nBitsExt : 0),
                                                                            N(config.generateProof() ? 1 << starkInfo.starkStruct.nBits : 0),
                                                                            NExtended(config.generateProof() ? 1 << starkInfo.starkStruct.nBitsExt : 0),
                                                                            ntt(config.generateProof() ? 1 << starkInfo.starkStruct.nBits : 0),
                                                                            nttExtended(config.generateProof() ? 1 << starkInfo.starkStruct.nBitsExt : 0),
-                                                                           x_n(config.generateProof() ? N : 0, config.generateProof() ? 1 : 0),
-                                                                           x_2ns(config.generateProof() ? NExtended : 0, config.generateProof() ? 1 : 0),
                                                                            pAddress(_pAddress),
                                                                            x(config.generateProof() ? N << (starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits) : 0, config.generateProof() ? FIELD_EXTENSION : 0)
     {
         nrowsStepBatch = 1;
+        nttPipeline = NULL;
+        spilledBytes = 0;
         // Avoid unnecessary initialization if we are not going to generate any proof
         if (!config.generateProof())
             return;
@@ -134,31 +148,31 @@ public:
             pConstTreeAddress = copyFile(starkFiles.zkevmConstantsTree, starkInfo.getConstTreeSizeInBytes());
             zklog.info("Starks::Starks() successfully copied " + to_string(starkInfo.getConstTreeSizeInBytes()) + " bytes from constant file " + starkFiles.zkevmConstantsTree);
         }
+        if (config.prefaultConstantsTree)
+        {
+            prefaultMemory(pConstTreeAddress, starkInfo.getConstTreeSizeInBytes());
+        }
         TimerStopAndLog(LOAD_CONST_TREE_TO_MEMORY);
 
-        // Initialize and allocate ConstantPols2ns
-        TimerStart(LOAD_CONST_POLS_2NS_TO_MEMORY);
-        pConstPolsAddress2ns = (void *)calloc(starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt), sizeof(Goldilocks::Element));
+        // The constant tree starts with its width and height, followed by the 2ns constant polynomials, row by row
+        pConstPolsAddress2ns = (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element);
         pConstPols2ns = new ConstantPolsStarks(pConstPolsAddress2ns, (1 << starkInfo.starkStruct.nBitsExt), starkInfo.nConstants);
-        std::memcpy(pConstPolsAddress2ns, (uint8_t *)pConstTreeAddress + 2 * sizeof(Goldilocks::Element), starkInfo.nConstants * (1 << starkInfo.starkStruct.nBitsExt) * sizeof(Goldilocks::Element));
 
-        TimerStopAndLog(LOAD_CONST_POLS_2NS_TO_MEMORY);
-
-        // TODO x_n and x_2ns could be precomputed
-        TimerStart(COMPUTE_X_N_AND_X_2_NS);
-        Goldilocks::Element xx = Goldilocks::one();
-        for (uint64_t i = 0; i < N; i++)
-        {
-            *x_n[i] = xx;
-            Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBits));
-        }
-        xx = Goldilocks::shift();
-        for (uint64_t i = 0; i < NExtended; i++)
+        // Map x_n, x_2ns and zhInv from the setup cache file, or compute them and save the file for the next start
+        TimerStart(LOAD_STARK_SETUP_CACHE);
+        string setupCacheFile = StarkSetupCache::getFileName(starkFiles.zkevmStarkInfo);
+        if (!config.starkSetupCache || !setupCache.load(setupCacheFile, starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt))
         {
-            *x_2ns[i] = xx;
-            Goldilocks::mul(xx, xx, Goldilocks::w(starkInfo.starkStruct.nBitsExt));
+            setupCache.generate(starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt);
+            if (config.starkSetupCache)
+            {
+                setupCache.save(setupCacheFile);
+            }
         }
-        TimerStopAndLog(COMPUTE_X_N_AND_X_2_NS);
+        x_n.potConstruct(setupCache.x_n, N, 1, 1);
+        x_2ns.potConstruct(setupCache.x_2ns, NExtended, 1, 1);
+        zi = ZhInv(setupCache.zhInv, setupCache.zhInvSize);
+        TimerStopAndLog(LOAD_STARK_SETUP_CACHE);
 
         mem = (Goldilocks::Element *)pAddress;
         pBuffer = &mem[starkInfo.mapTotalN];
@@ -173,13 +187,11 @@ public:
         p_q_2ns = &mem[starkInfo.mapOffsets.section[eSection::q_2ns]];
         p_f_2ns = &mem[starkInfo.mapOffsets.section[eSection::f_2ns]];
 
-        *x[0] = Goldilocks::shift();
-
-        uint64_t extendBits = starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits;
-
-        for (uint64_t k = 1; k < (N << extendBits); k++)
+        // x holds the same shift * w^k values as x_2ns, as extension field elements
+#pragma omp parallel for
+        for (uint64_t k = 0; k < NExtended; k++)
         {
-            Polinomial::mulElement(x, k, x, k - 1, (Goldilocks::Element &)Goldilocks::w(starkInfo.starkStruct.nBits + extendBits));
+            *x[k] = *x_2ns[k];
         }
 
         TimerStart(MERKLE_TREE_ALLOCATION);
@@ -189,6 +201,15 @@ public:
         treesGL[3] = new MerkleTreeGL(NExtended, starkInfo.mapSectionsN.section[eSection::cm4_2ns], cm4_2ns);
         treesGL[4] = new MerkleTreeGL((Goldilocks::Element *)pConstTreeAddress);
         TimerStopAndLog(MERKLE_TREE_ALLOCATION);
+
+        // Split the threads between LDE and leaf hashing, if the pipelined mode is enabled
+        if (config.starkLDEPipelineBlocks > 1)
+        {
+            uint64_t nThreads = omp_get_max_threads();
+            nThreadsPipelineHash = zkmax(nThreads / 2, 1);
+            nThreadsPipelineLDE = zkmax(nThreads - nThreadsPipelineHash, 1);
+            nttPipeline = new NTT_Goldilocks(N, nThreadsPipelineLDE);
+        }
     };
     ~Starks()
     {
@@ -197,7 +218,6 @@ public:
 
         delete pConstPols;
         delete pConstPols2ns;
-        free(pConstPolsAddress2ns);
 
         if (config.mapConstPolsFile)
         {
@@ -209,7 +229,7 @@ public:
         }
         if (config.mapConstantsTreeFile)
         {
-            unmapFile(pConstTreeAddress, constPolsSize);
+            unmapFile(pConstTreeAddress, starkInfo.getConstTreeSizeInBytes());
         }
         else
         {
@@ -220,6 +240,11 @@ public:
         {
             delete treesGL[i];
         }
+
+        if (nttPipeline != NULL)
+        {
+            delete nttPipeline;
+        }
     };
 
     void genProof(FRIProof &proof, Goldilocks::Element *publicInputs, Goldilocks::Element verkey[4], Steps *steps);
@@ -228,7 +253,8 @@ public:
     void transposeH1H2Rows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
     Polinomial *transposeZColumns(void *pAddress, uint64_t &numCommited, Goldilocks::Element *pBuffer);
     void transposeZRows(void *pAddress, uint64_t &numCommited, Polinomial *transPols);
-    void evmap(void *pAddress, Polinomial &evals, Polinomial &LEv, Polinomial &LpEv);
+    static void evmapPowers(Goldilocks::Element *L, uint64_t n, const Goldilocks3::Element &xis, const Goldilocks3::Element &wxis);
+    void evmap(void *pAddress, Polinomial &evals, Polinomial &LEvLpEv);
 };
 
 #endif // STARKS_H
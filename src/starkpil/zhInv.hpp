@@ -19,6 +19,8 @@ public:
 
     ZhInv(uint64_t nBits, uint64_t nBitsExt);
 
+    ZhInv(const Goldilocks::Element *pZhInv, uint64_t size) : ZHInv(pZhInv, pZhInv + size) {};
+
     inline Goldilocks::Element zhInv(int64_t i)
     {
         return ZHInv[i % ZHInv.size()];
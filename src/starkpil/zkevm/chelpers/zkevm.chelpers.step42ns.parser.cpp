@@ -4,12 +4,177 @@
 #include "constant_pols_starks.hpp"
 #include "zkevmSteps.hpp"
 #include "zkevm.chelpers.step42ns.parser.hpp"
+#include "parser_program.hpp"
+#include "zklog.hpp"
+#include "exit_process.hpp"
+#include "timer.hpp"
 #include <immintrin.h>
 
 #define AVX_SIZE_ 4
 
+// Argument roles of every case of the step42ns parser, NULL for superinstructions
+static const char * step42nsOpArgs[] = {
+    /*  0 */ "W1 R1 R1",
+    /*  1 */ "W1 R1 X X",
+    /*  2 */ "W1 R1 X",
+    /*  3 */ "W1 R1 X",
+    /*  4 */ "W1 X X X X",
+    /*  5 */ "W1 X X X X X X X X",
+    /*  6 */ "W1 X X X",
+    /*  7 */ "W1 X X X",
+    /*  8 */ "W1 X X",
+    /*  9 */ "W1 X X X X X X",
+    /* 10 */ "W1 X X",
+    /* 11 */ "W1 X X X X",
+    /* 12 */ "W3 R1 R3",
+    /* 13 */ "W3 X X",
+    /* 14 */ "W3 R1 X",
+    /* 15 */ "W3 X X R3",
+    /* 16 */ "W3 X X X",
+    /* 17 */ "W3 R3 R3",
+    /* 18 */ "W3 R3 X",
+    /* 19 */ "W3 X X R3",
+    /* 20 */ "W3 X X X",
+    /* 21 */ "W1 R1 R1",
+    /* 22 */ "W1 R1 X X",
+    /* 23 */ "W1 R1 X X X X",
+    /* 24 */ "W1 X X R1",
+    /* 25 */ "W1 X X X X R1",
+    /* 26 */ "W1 R1 X",
+    /* 27 */ "W1 X R1",
+    /* 28 */ "W1 X X X",
+    /* 29 */ "W1 X X X X X",
+    /* 30 */ "W1 X X X",
+    /* 31 */ "W1 X X X X X",
+    /* 32 */ "W1 X X",
+    /* 33 */ "W1 X X X X",
+    /* 34 */ "W1 X X X",
+    /* 35 */ "W1 X X X X X X",
+    /* 36 */ "W1 X X X X X X",
+    /* 37 */ "W1 X X X X",
+    /* 38 */ "W1 X X X X X X X X",
+    /* 39 */ "W1 X X X",
+    /* 40 */ "W1 R1 X",
+    /* 41 */ "W3 X X X",
+    /* 42 */ "W3 R3 R3",
+    /* 43 */ "W3 R3 X",
+    /* 44 */ "W3 R3 X X",
+    /* 45 */ "W1 R1 R1",
+    /* 46 */ "W1 X R1",
+    /* 47 */ "W1 X X R1",
+    /* 48 */ "W1 X X X X R1",
+    /* 49 */ "W1 R1 X",
+    /* 50 */ "W1 X X X X",
+    /* 51 */ "W1 X X X X X X",
+    /* 52 */ "W1 X X X X X X X X",
+    /* 53 */ "W1 X X X",
+    /* 54 */ "W1 X X X",
+    /* 55 */ "W1 X X X X X",
+    /* 56 */ "W1 R1 X X",
+    /* 57 */ "W1 R1 X X X X",
+    /* 58 */ "W1 X R1",
+    /* 59 */ "W3 R1 X",
+    /* 60 */ "W3 X R3",
+    /* 61 */ "W3 R1 R3",
+    /* 62 */ "W3 X X X",
+    /* 63 */ "W3 X X X X X",
+    /* 64 */ "W3 X X R3",
+    /* 65 */ "W3 X X X X R3",
+    /* 66 */ "W3 X X",
+    /* 67 */ "W3 X",
+    /* 68 */ "W3 R3",
+    /* 69 */ "R3",
+    /* 70 */ "W3 X R3",
+    /* 71 */ "W3 R3 R3",
+    /* 72 */ "W3 X X X X",
+    /* 73 */ "W3 X X X X X",
+    /* 74 */ "W3 X X X X R3",
+    /* 75 */ "W3 X X R3",
+    /* 76 */ "W3 X X X",
+    /* 77 */ "W3 X X X X X X",
+    /* 78 */ "W1 R1",
+    /* 79 */ "W1 X X",
+    /* 80 */ "W1 X X X X",
+    /* 81 */ "W1 X",
+    /* 82 */ "W1 X",
+    /* 83 */ "W1 X X X",
+    /* 84 */ NULL,
+    /* 85 */ NULL,
+    /* 86 */ NULL,
+    /* 87 */ NULL,
+    /* 88 */ NULL,
+    /* 89 */ "W3 X X X X X",
+    /* 90 */ "W1 X X X X X X X",
+    /* 91 */ "W1 X X X",
+    /* 92 */ "W1 X R1",
+    /* 93 */ NULL,
+    /* 94 */ NULL,
+    /* 95 */ NULL,
+};
+
+static void step42nsIsa (ParserIsa &isa)
+{
+    isa.name = "step42ns";
+    for (uint64_t op = 0; op < sizeof(step42nsOpArgs) / sizeof(step42nsOpArgs[0]); op++)
+    {
+        if (step42nsOpArgs[op] != NULL) isa.addOp(op, step42nsOpArgs[op]);
+    }
+    isa.addSuperOp(84, { 12, 70 });
+    isa.addSuperOp(85, { 0, 50 });
+    isa.addSuperOp(86, { 32, 47, 21, 32, 48 });
+    isa.addSuperOp(87, { 12, 70, 12, 70, 12, 70, 12, 70 });
+    isa.addSuperOp(88, { 21, 50, 21, 53, 0, 0, 50, 50, 0, 50, 21, 50 });
+    isa.addSuperOp(93, { 53, 0 });
+    isa.addSuperOp(94, { 79, 79 });
+    isa.addSuperOp(95, { 21, 53 });
+}
+
+bool ZkevmSteps::loadStep42nsProgram (const string &fileName, ParserProgram &program)
+{
+    ParserIsa isa;
+    step42nsIsa(isa);
+    ParserProgram compiled;
+    compiled.set(op42, NOPS_, args42, NARGS_, NTEMP1_, NTEMP3_);
+    if (!program.load(fileName, isa, compiled.hash()))
+    {
+        return false;
+    }
+
+    // The parser allocates the temporaries of the compiled program in the stack
+    if ((program.nTemp1 > NTEMP1_) || (program.nTemp3 > NTEMP3_))
+    {
+        zklog.error("ZkevmSteps::loadStep42nsProgram() file=" + fileName + " uses nTemp1=" + to_string(program.nTemp1) + " nTemp3=" + to_string(program.nTemp3) + " but the parser allocates " + to_string(NTEMP1_) + " and " + to_string(NTEMP3_));
+        program = ParserProgram();
+        return false;
+    }
+    return true;
+}
+
+void ZkevmSteps::optimizeStep42nsProgram (const string &fileName)
+{
+    TimerStart(CHELPERS_OPTIMIZE_STEP42NS);
+    ParserIsa isa;
+    step42nsIsa(isa);
+    ParserProgram program;
+    program.set(op42, NOPS_, args42, NARGS_, NTEMP1_, NTEMP3_);
+    if (!program.optimize(isa))
+    {
+        zklog.error("ZkevmSteps::optimizeStep42nsProgram() failed optimizing the step42ns program");
+        exitProcess();
+    }
+    program.save(fileName);
+    zklog.info("ZkevmSteps::optimizeStep42nsProgram() saved the optimized step42ns program into file=" + fileName);
+    TimerStopAndLog(CHELPERS_OPTIMIZE_STEP42NS);
+}
+
 void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows, uint64_t nrowsBatch)
 {
+     // Run the optimized program, if any, or the compiled one
+     const uint64_t *op42 = (pStep42nsProgram != NULL) ? pStep42nsProgram->ops.data() : ::op42;
+     const uint64_t *args42 = (pStep42nsProgram != NULL) ? pStep42nsProgram->args.data() : ::args42;
+     const uint64_t nOps = (pStep42nsProgram != NULL) ? pStep42nsProgram->ops.size() : NOPS_;
+     const uint64_t nArgs = (pStep42nsProgram != NULL) ? pStep42nsProgram->args.size() : NARGS_;
+
 #pragma omp parallel for
      for (uint64_t i = 0; i < nrows; i += nrowsBatch)
      {
@@ -21,7 +186,7 @@ void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows,
           uint64_t offsets1[4], offsets2[4];
           uint64_t numpols = params.pConstPols2ns->numPols();
 
-          for (int kk = 0; kk < NOPS_; ++kk)
+          for (uint64_t kk = 0; kk < nOps; ++kk)
           {
                switch (op42[kk])
                {
@@ -779,6 +944,33 @@ void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows,
                     i_args += 3;
                     break;
                }
+               case 93:
+               {
+                    // 53 - 0
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    Goldilocks::add_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    break;
+               }
+               case 94:
+               {
+                    // 79 - 79
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    Goldilocks::copy_avx(tmp1[(args42[i_args])], &params.pols[args42[i_args + 1] + i * args42[i_args + 2]], args42[i_args + 2]);
+                    i_args += 3;
+                    break;
+               }
+               case 95:
+               {
+                    // 21 - 53
+                    Goldilocks::sub_avx(tmp1[(args42[i_args])], tmp1[args42[i_args + 1]], tmp1[args42[i_args + 2]]);
+                    i_args += 3;
+                    Goldilocks::mul_avx(tmp1[(args42[i_args])], Goldilocks::fromU64(args42[i_args + 1]), &params.pols[args42[i_args + 2] + i * args42[i_args + 3]], args42[i_args + 3]);
+                    i_args += 4;
+                    break;
+               }
                default:
                     std::cout
                         << " Wrong operation in step42ns_first!"
@@ -786,7 +978,7 @@ void ZkevmSteps::step42ns_parser_first_avx(StepsParams &params, uint64_t nrows,
                     exit(1); // rick, use execption
                }
           }
-          assert(i_args == NARGS_);
+          assert(i_args == nArgs);
           // delete (tmp1);
           // delete (tmp3);
      }
@@ -6,10 +6,22 @@
 
 #include "starks.hpp"
 #include "constant_pols_starks.hpp"
+#include "parser_program.hpp"
 
 class ZkevmSteps : public Steps
 {
 public:
+    // Optimized step42ns parser program, used by step42ns_parser_first_avx instead of the compiled one if not NULL
+    const ParserProgram *pStep42nsProgram;
+
+    ZkevmSteps() : pStep42nsProgram(NULL) {};
+
+    // Loads an optimized step42ns parser program, checking that it was generated from the compiled one
+    static bool loadStep42nsProgram (const string &fileName, ParserProgram &program);
+
+    // Optimizes the compiled step42ns parser program and saves it into a file
+    static void optimizeStep42nsProgram (const string &fileName);
+
     void step2prev_first(StepsParams &params, uint64_t i);
     void step2prev_i(StepsParams &params, uint64_t i);
     void step2prev_last(StepsParams &params, uint64_t i);
@@ -0,0 +1,278 @@
+#include "task_graph.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkassert.hpp"
+#include "exit_process.hpp"
+#include "zkmax.hpp"
+
+TaskGraph::~TaskGraph()
+{
+    for (uint64_t i = 0; i < tasks.size(); i++)
+    {
+        pthread_mutex_destroy(&tasks[i].timeMutex);
+    }
+    pthread_mutex_destroy(&mutex);
+    pthread_cond_destroy(&cond);
+}
+
+uint64_t TaskGraph::addTask(const string &name, function<void(void)> func, const vector<uint64_t> &dependencies)
+{
+    return addTask(name, 1, [func](uint64_t chunk) { func(); }, dependencies);
+}
+
+uint64_t TaskGraph::addTask(const string &name, uint64_t nChunks, function<void(uint64_t)> func, const vector<uint64_t> &dependencies)
+{
+    uint64_t id = tasks.size();
+    for (uint64_t i = 0; i < dependencies.size(); i++)
+    {
+        if (dependencies[i] >= id)
+        {
+            zklog.error("TaskGraph::addTask() task " + name + " got an invalid dependency=" + to_string(dependencies[i]));
+            exitProcess();
+        }
+    }
+    for (uint64_t i = 0; i < dependencies.size(); i++)
+    {
+        tasks[dependencies[i]].dependents.push_back(id);
+    }
+
+    tasks.emplace_back();
+    Task &task = tasks.back();
+    task.name = name;
+    task.func = func;
+    task.nChunks = nChunks;
+    task.dependencies = dependencies;
+    task.pendingDependencies = dependencies.size();
+    task.pendingChunks = 0;
+    task.work = 0;
+    pthread_mutex_init(&task.timeMutex, NULL);
+    task.bStarted = false;
+    task.duration = 0;
+    task.criticalPath = 0;
+    return id;
+}
+
+class TaskGraphWorkerArg
+{
+public:
+    TaskGraph *pTaskGraph;
+    uint64_t worker;
+};
+
+void *taskGraphWorkerThread(void *arg)
+{
+    TaskGraphWorkerArg *pArg = (TaskGraphWorkerArg *)arg;
+    pArg->pTaskGraph->worker(pArg->worker);
+    return NULL;
+}
+
+void TaskGraph::run(uint64_t nThreads)
+{
+    // Use one thread per task by default
+    if (nThreads == 0)
+    {
+        nThreads = zkmax(tasks.size(), (uint64_t)1);
+    }
+
+    queues.clear();
+    queues.resize(nThreads);
+    for (uint64_t i = 0; i < nThreads; i++)
+    {
+        pthread_mutex_init(&queues[i].mutex, NULL);
+    }
+    queuedChunks = 0;
+    doneTasks = 0;
+    for (uint64_t i = 0; i < tasks.size(); i++)
+    {
+        tasks[i].pendingDependencies = tasks[i].dependencies.size();
+        tasks[i].work = 0;
+        tasks[i].bStarted = false;
+    }
+
+    gettimeofday(&startTime, NULL);
+
+    // Spread the tasks that are ready from the beginning over the workers
+    uint64_t nextWorker = 0;
+    for (uint64_t i = 0; i < tasks.size(); i++)
+    {
+        if (tasks[i].dependencies.size() == 0)
+        {
+            queueTask(i, nextWorker);
+            nextWorker = (nextWorker + 1) % nThreads;
+        }
+    }
+
+    vector<pthread_t> threads(nThreads);
+    vector<TaskGraphWorkerArg> args(nThreads);
+    for (uint64_t i = 0; i < nThreads; i++)
+    {
+        args[i].pTaskGraph = this;
+        args[i].worker = i;
+        pthread_create(&threads[i], NULL, taskGraphWorkerThread, &args[i]);
+    }
+    for (uint64_t i = 0; i < nThreads; i++)
+    {
+        pthread_join(threads[i], NULL);
+    }
+
+    gettimeofday(&endTime, NULL);
+
+    for (uint64_t i = 0; i < nThreads; i++)
+    {
+        pthread_mutex_destroy(&queues[i].mutex);
+    }
+    queues.clear();
+}
+
+void TaskGraph::queueTask(uint64_t task, uint64_t worker)
+{
+    // A task with no chunks is queued as one empty chunk, so that it is done like any other task
+    uint64_t nChunks = zkmax(tasks[task].nChunks, (uint64_t)1);
+    tasks[task].pendingChunks = nChunks;
+
+    // Queue the chunks in reverse order, so that the owner starts with the first one and thieves with the last ones;
+    // they are counted before releasing the queue, so that a chunk is never taken before being counted
+    WorkerQueue &queue = queues[worker];
+    pthread_mutex_lock(&queue.mutex);
+    for (uint64_t i = nChunks; i > 0; i--)
+    {
+        queue.chunks.emplace_back(task, i - 1);
+    }
+    queuedChunks += nChunks;
+    pthread_mutex_unlock(&queue.mutex);
+
+    lock();
+    pthread_cond_broadcast(&cond);
+    unlock();
+}
+
+bool TaskGraph::takeChunk(uint64_t worker, pair<uint64_t, uint64_t> &chunk)
+{
+    // Take the last chunk of our own queue, or steal the first one of the next non-empty queue
+    for (uint64_t i = 0; i < queues.size(); i++)
+    {
+        WorkerQueue &queue = queues[(worker + i) % queues.size()];
+        pthread_mutex_lock(&queue.mutex);
+        if (queue.chunks.empty())
+        {
+            pthread_mutex_unlock(&queue.mutex);
+            continue;
+        }
+        if (i == 0)
+        {
+            chunk = queue.chunks.back();
+            queue.chunks.pop_back();
+        }
+        else
+        {
+            chunk = queue.chunks.front();
+            queue.chunks.pop_front();
+        }
+        queuedChunks--;
+        pthread_mutex_unlock(&queue.mutex);
+        return true;
+    }
+    return false;
+}
+
+void TaskGraph::executeChunk(uint64_t worker, const pair<uint64_t, uint64_t> &chunk)
+{
+    Task &task = tasks[chunk.first];
+
+    pthread_mutex_lock(&task.timeMutex);
+    if (!task.bStarted)
+    {
+        task.bStarted = true;
+        gettimeofday(&task.startTime, NULL);
+    }
+    pthread_mutex_unlock(&task.timeMutex);
+
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    if (chunk.second < task.nChunks)
+    {
+        task.func(chunk.second);
+    }
+    task.work += TimeDiff(t);
+
+    // The last chunk of a task marks it as done, and releases the tasks that only depended on it
+    if (task.pendingChunks.fetch_sub(1) != 1)
+    {
+        return;
+    }
+    gettimeofday(&task.endTime, NULL);
+    task.duration = TimeDiff(task.startTime, task.endTime);
+    for (uint64_t i = 0; i < task.dependents.size(); i++)
+    {
+        Task &dependent = tasks[task.dependents[i]];
+        zkassert(dependent.pendingDependencies > 0);
+        if (dependent.pendingDependencies.fetch_sub(1) == 1)
+        {
+            queueTask(task.dependents[i], worker);
+        }
+    }
+    if (doneTasks.fetch_add(1) + 1 == tasks.size())
+    {
+        lock();
+        pthread_cond_broadcast(&cond);
+        unlock();
+    }
+}
+
+void TaskGraph::worker(uint64_t worker)
+{
+    pair<uint64_t, uint64_t> chunk;
+    while (true)
+    {
+        if (takeChunk(worker, chunk))
+        {
+            executeChunk(worker, chunk);
+            continue;
+        }
+
+        // Wait for a chunk to be queued, or exit when all tasks are done
+        lock();
+        while ((queuedChunks == 0) && (doneTasks < tasks.size()))
+        {
+            pthread_cond_wait(&cond, &mutex);
+        }
+        bool bDone = (doneTasks == tasks.size());
+        unlock();
+        if (bDone)
+        {
+            break;
+        }
+    }
+}
+
+void TaskGraph::print(const char *pTitle, bool bTasks)
+{
+    // Tasks are added after their dependencies, so the critical paths can be computed in order
+    uint64_t criticalPath = 0;
+    uint64_t criticalTask = 0;
+    uint64_t totalWork = 0;
+    for (uint64_t i = 0; i < tasks.size(); i++)
+    {
+        Task &task = tasks[i];
+        uint64_t dependenciesPath = 0;
+        for (uint64_t d = 0; d < task.dependencies.size(); d++)
+        {
+            dependenciesPath = zkmax(dependenciesPath, tasks[task.dependencies[d]].criticalPath);
+        }
+        task.criticalPath = dependenciesPath + task.duration;
+        totalWork += task.work;
+        if (task.criticalPath > criticalPath)
+        {
+            criticalPath = task.criticalPath;
+            criticalTask = i;
+        }
+    }
+
+    uint64_t wallTime = TimeDiff(startTime, endTime);
+    zklog.info(string(pTitle) + " wall=" + to_string(double(wallTime) / 1000000) + "s tasks=" + to_string(totalWork / 1000000.0) + "s criticalPath=" + to_string(double(criticalPath) / 1000000) + "s" + (tasks.size() > 0 ? " (" + tasks[criticalTask].name + ")" : "") + " averageParallelism=" + to_string(wallTime == 0 ? 0 : double(totalWork) / wallTime));
+    for (uint64_t i = 0; bTasks && (i < tasks.size()); i++)
+    {
+        Task &task = tasks[i];
+        zklog.info(string(pTitle) + " " + task.name + " chunks=" + to_string(task.nChunks) + " start=" + to_string(double(TimeDiff(startTime, task.startTime)) / 1000000) + "s duration=" + to_string(double(task.duration) / 1000000) + "s work=" + to_string(double(task.work) / 1000000) + "s criticalPath=" + to_string(double(task.criticalPath) / 1000000) + "s");
+    }
+}
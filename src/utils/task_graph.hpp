@@ -0,0 +1,93 @@
+#ifndef TASK_GRAPH_HPP
+#define TASK_GRAPH_HPP
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <atomic>
+#include <functional>
+#include <pthread.h>
+#include <sys/time.h>
+
+using namespace std;
+
+// Set of tasks with explicit dependencies, executed by a pool of worker threads; a task can be split into chunks,
+// which are executed in any order and in parallel, and it is done when all its chunks are done; a task becomes ready
+// when all the tasks it depends on are done, and then its chunks are queued to the worker that released it; every
+// worker executes the chunks of its own queue, last queued first, and when it is empty it steals the oldest chunk of
+// another worker queue, so that the chunks of a long task are spread over all the idle workers
+class TaskGraph
+{
+private:
+    class Task
+    {
+    public:
+        string name;
+        function<void(uint64_t)> func; // Called once per chunk, with the chunk index
+        uint64_t nChunks;
+        vector<uint64_t> dependents; // Tasks that depend on this one
+        vector<uint64_t> dependencies;
+        atomic<uint64_t> pendingDependencies;
+        atomic<uint64_t> pendingChunks;
+        atomic<uint64_t> work; // Sum of the durations of its chunks, in us
+        pthread_mutex_t timeMutex; // Mutex to protect the start and end times, set by the first and last chunks
+        struct timeval startTime;
+        struct timeval endTime;
+        bool bStarted;
+        uint64_t duration; // From the start of its first chunk to the end of its last chunk, in us
+        uint64_t criticalPath; // Longest chain of durations ending with this task, in us
+    };
+
+    // Queue of chunks of a worker, as (task, chunk) pairs
+    class WorkerQueue
+    {
+    public:
+        pthread_mutex_t mutex;
+        deque<pair<uint64_t, uint64_t>> chunks;
+    };
+
+    deque<Task> tasks; // A deque, since tasks cannot be moved
+    vector<WorkerQueue> queues;
+    atomic<uint64_t> queuedChunks;
+    atomic<uint64_t> doneTasks;
+    struct timeval startTime;
+    struct timeval endTime;
+
+    pthread_mutex_t mutex; // Mutex to sleep the idle workers
+    pthread_cond_t cond; // Condition to wakeup the idle workers when a chunk is queued or all tasks are done
+    void lock(void) { pthread_mutex_lock(&mutex); };
+    void unlock(void) { pthread_mutex_unlock(&mutex); };
+
+    // Queues all the chunks of a ready task to the queue of a worker, and wakes up the idle workers
+    void queueTask(uint64_t task, uint64_t worker);
+
+    // Takes a chunk from the queue of a worker, or steals one from another queue; returns false if all are empty
+    bool takeChunk(uint64_t worker, pair<uint64_t, uint64_t> &chunk);
+
+    // Executes a chunk and, if it was the last one of its task, releases the tasks that depend on it
+    void executeChunk(uint64_t worker, const pair<uint64_t, uint64_t> &chunk);
+
+public:
+    TaskGraph()
+    {
+        pthread_mutex_init(&mutex, NULL);
+        pthread_cond_init(&cond, NULL);
+    };
+    ~TaskGraph();
+
+    // Adds a task and returns its id; dependencies must be ids of previously added tasks
+    uint64_t addTask(const string &name, function<void(void)> function, const vector<uint64_t> &dependencies = {});
+
+    // Adds a task split into nChunks chunks, and returns its id; function is called once per chunk, with the chunk index
+    uint64_t addTask(const string &name, uint64_t nChunks, function<void(uint64_t)> function, const vector<uint64_t> &dependencies = {});
+
+    // Executes all the tasks using nThreads worker threads (0 means one per task), and returns when all of them are done
+    void run(uint64_t nThreads);
+
+    // Logs the critical path of the whole graph and, if bTasks, the duration and critical path of every task
+    void print(const char *pTitle, bool bTasks = true);
+
+    void worker(uint64_t worker);
+};
+
+#endif
@@ -0,0 +1,61 @@
+#ifndef TRACE_CHUNKS_HPP
+#define TRACE_CHUNKS_HPP
+
+#include <stdint.h>
+#include <vector>
+
+using namespace std;
+
+// Default minimum number of actions per chunk, below which the threads synchronization costs more than it saves
+#define TRACE_CHUNKS_MIN_ACTIONS 256
+
+// Number of rows that makes a row offset a multiple of a 64-bytes cache line, whatever the commit pols row width
+#define TRACE_CHUNKS_ROW_ALIGNMENT 8
+
+/*
+    Partition of the actions of a secondary state machine into contiguous ranges, one per thread, used to fill
+    its commit polynomials in parallel.
+
+    Every action writes a fixed block of rowsPerAction rows, so a range of actions is a range of rows owned by
+    one thread.  The first row of every range is a multiple of TRACE_CHUNKS_ROW_ALIGNMENT, i.e. it starts at a
+    cache line boundary, so threads only share the cache lines of the boundary row, where the previous range
+    writes the next-row columns and the next one writes the current-row columns.
+*/
+class TraceChunks
+{
+private:
+    vector<uint64_t> firstAction; // First action of every chunk, plus the total number of actions
+
+public:
+    // minActions is the minimum number of actions per chunk, which can be lower for state machines with few but
+    // long actions, like the permutation slots
+    TraceChunks (uint64_t nActions, uint64_t rowsPerAction, uint64_t nThreads, uint64_t minActions = TRACE_CHUNKS_MIN_ACTIONS)
+    {
+        // Round the actions per chunk up so that every chunk starts at an aligned row
+        uint64_t alignment = 1;
+        while (((alignment * rowsPerAction) % TRACE_CHUNKS_ROW_ALIGNMENT) != 0) alignment++;
+
+        if (nThreads == 0) nThreads = 1;
+        uint64_t actionsPerChunk = (nActions + nThreads - 1) / nThreads;
+        if (actionsPerChunk < minActions) actionsPerChunk = minActions;
+        actionsPerChunk = ((actionsPerChunk + alignment - 1) / alignment) * alignment;
+
+        // There is always at least one chunk, even if empty
+        uint64_t i = 0;
+        do
+        {
+            firstAction.push_back(i);
+            i += actionsPerChunk;
+        } while (i < nActions);
+        firstAction.push_back(nActions);
+    }
+
+    // Returns the number of chunks, which is also the number of threads to use
+    uint64_t size (void) const { return firstAction.size() - 1; }
+
+    // Returns the range of actions [begin, end) of a chunk
+    uint64_t begin (uint64_t chunk) const { return firstAction[chunk]; }
+    uint64_t end (uint64_t chunk) const { return firstAction[chunk + 1]; }
+};
+
+#endif
@@ -0,0 +1,420 @@
+#ifndef U256_HPP
+#define U256_HPP
+
+#include <stdint.h>
+#include <string.h>
+#include <string>
+#include <gmpxx.h>
+#include "zklog.hpp"
+#include "exit_process.hpp"
+
+using namespace std;
+
+/*
+    Fixed width unsigned integers of N 64-bit limbs, stored in little endian order.
+
+    They are used instead of mpz_class in the hot paths of the arithmetic and ECRecover code, where every
+    mpz_class temporary costs a heap allocation.  Additions and subtractions wrap around modulo 2^(64*N), so
+    they can also be used as two's complement signed integers.
+*/
+
+template <unsigned N>
+class UInt
+{
+public:
+    uint64_t v[N];
+
+    UInt() : v() {};
+    UInt(uint64_t a) : v() { v[0] = a; };
+
+    // Parses a hexadecimal string, with or without 0x prefix
+    static UInt fromHex (const char * s)
+    {
+        UInt r;
+        if ((s[0] == '0') && ((s[1] == 'x') || (s[1] == 'X'))) s += 2;
+        uint64_t len = strlen(s);
+        if (len > N*16)
+        {
+            zklog.error("UInt::fromHex() got a too long string s=" + string(s));
+            exitProcess();
+        }
+        for (uint64_t i=0; i<len; i++)
+        {
+            char c = s[len - 1 - i];
+            uint64_t nibble;
+            if ((c >= '0') && (c <= '9')) nibble = c - '0';
+            else if ((c >= 'a') && (c <= 'f')) nibble = c - 'a' + 10;
+            else if ((c >= 'A') && (c <= 'F')) nibble = c - 'A' + 10;
+            else
+            {
+                zklog.error("UInt::fromHex() got an invalid character in s=" + string(s));
+                exitProcess();
+                nibble = 0;
+            }
+            r.v[i/16] |= nibble << (4*(i%16));
+        }
+        return r;
+    }
+
+    void fromScalar (const mpz_class &s)
+    {
+        if ((mpz_sgn(s.get_mpz_t()) < 0) || (mpz_sizeinbase(s.get_mpz_t(), 2) > N*64))
+        {
+            zklog.error("UInt::fromScalar() got a value out of range s=" + s.get_str(16));
+            exitProcess();
+        }
+        memset(v, 0, sizeof(v));
+        mpz_export(v, NULL, -1, 8, -1, 0, s.get_mpz_t());
+    }
+
+    void toScalar (mpz_class &s) const
+    {
+        mpz_import(s.get_mpz_t(), N, -1, 8, -1, 0, v);
+    }
+
+    bool isZero (void) const
+    {
+        for (unsigned i=0; i<N; i++) if (v[i] != 0) return false;
+        return true;
+    }
+
+    bool bit (unsigned i) const { return (v[i/64] >> (i%64)) & 1; };
+    bool isOdd (void) const { return v[0] & 1; };
+    bool isNegative (void) const { return v[N-1] >> 63; };
+
+    void setBit (unsigned i) { v[i/64] |= uint64_t(1) << (i%64); };
+
+    // Returns the number of significant bits
+    unsigned bits (void) const
+    {
+        for (int i=N-1; i>=0; i--)
+        {
+            if (v[i] != 0) return i*64 + 64 - __builtin_clzll(v[i]);
+        }
+        return 0;
+    }
+
+    int compare (const UInt &b) const
+    {
+        for (int i=N-1; i>=0; i--)
+        {
+            if (v[i] != b.v[i]) return (v[i] < b.v[i]) ? -1 : 1;
+        }
+        return 0;
+    }
+
+    bool operator== (const UInt &b) const { return compare(b) == 0; };
+    bool operator!= (const UInt &b) const { return compare(b) != 0; };
+    bool operator< (const UInt &b) const { return compare(b) < 0; };
+    bool operator<= (const UInt &b) const { return compare(b) <= 0; };
+    bool operator> (const UInt &b) const { return compare(b) > 0; };
+    bool operator>= (const UInt &b) const { return compare(b) >= 0; };
+
+    // this += b, returning the carry
+    uint64_t add (const UInt &b)
+    {
+        unsigned __int128 carry = 0;
+        for (unsigned i=0; i<N; i++)
+        {
+            carry += (unsigned __int128)v[i] + b.v[i];
+            v[i] = (uint64_t)carry;
+            carry >>= 64;
+        }
+        return (uint64_t)carry;
+    }
+
+    // this -= b, returning the borrow
+    uint64_t sub (const UInt &b)
+    {
+        uint64_t borrow = 0;
+        for (unsigned i=0; i<N; i++)
+        {
+            unsigned __int128 d = (unsigned __int128)v[i] - b.v[i] - borrow;
+            v[i] = (uint64_t)d;
+            borrow = (d >> 64) ? 1 : 0;
+        }
+        return borrow;
+    }
+
+    // this = -this, in two's complement
+    void negate (void)
+    {
+        UInt zero;
+        zero.sub(*this);
+        *this = zero;
+    }
+
+    // Returns this value zero-extended or truncated to M limbs
+    template <unsigned M>
+    UInt<M> resize (void) const
+    {
+        UInt<M> r;
+        for (unsigned i=0; (i<N) && (i<M); i++) r.v[i] = v[i];
+        return r;
+    }
+};
+
+typedef UInt<4> U256;
+typedef UInt<8> U512;
+
+// Full product of a N-limb and a M-limb integers
+template <unsigned N, unsigned M>
+inline UInt<N+M> mul (const UInt<N> &a, const UInt<M> &b)
+{
+    UInt<N+M> r;
+    for (unsigned i=0; i<M; i++)
+    {
+        unsigned __int128 carry = 0;
+        for (unsigned j=0; j<N; j++)
+        {
+            carry += (unsigned __int128)a.v[j]*b.v[i] + r.v[i+j];
+            r.v[i+j] = (uint64_t)carry;
+            carry >>= 64;
+        }
+        r.v[i+N] = (uint64_t)carry;
+    }
+    return r;
+}
+
+// q = a / b and r = a % b, using Knuth's algorithm D on 64-bit limbs; b must not be zero
+template <unsigned N, unsigned M>
+inline void divmod (const UInt<N> &a, const UInt<M> &b, UInt<N> &q, UInt<M> &r)
+{
+    static_assert(N >= M, "divmod() requires the dividend to be at least as wide as the divisor");
+
+    // Get the number of significant limbs
+    int n = M;
+    while ((n > 0) && (b.v[n-1] == 0)) n--;
+    int m = N;
+    while ((m > 0) && (a.v[m-1] == 0)) m--;
+    if (n == 0)
+    {
+        zklog.error("divmod() division by zero");
+        exitProcess();
+    }
+
+    q = UInt<N>();
+    r = UInt<M>();
+
+    // If a < b, the quotient is zero
+    if (m < n)
+    {
+        for (int i=0; i<m; i++) r.v[i] = a.v[i];
+        return;
+    }
+
+    // Single limb divisor
+    if (n == 1)
+    {
+        unsigned __int128 rem = 0;
+        for (int i=m-1; i>=0; i--)
+        {
+            rem = (rem << 64) | a.v[i];
+            q.v[i] = (uint64_t)(rem / b.v[0]);
+            rem = rem % b.v[0];
+        }
+        r.v[0] = (uint64_t)rem;
+        return;
+    }
+
+    // Normalize, so that the most significant bit of the divisor is set
+    int s = __builtin_clzll(b.v[n-1]);
+    uint64_t bn[M];
+    uint64_t an[N+1];
+    for (int i=n-1; i>0; i--) bn[i] = (b.v[i] << s) | (s ? (b.v[i-1] >> (64-s)) : 0);
+    bn[0] = b.v[0] << s;
+    an[m] = s ? (a.v[m-1] >> (64-s)) : 0;
+    for (int i=m-1; i>0; i--) an[i] = (a.v[i] << s) | (s ? (a.v[i-1] >> (64-s)) : 0);
+    an[0] = a.v[0] << s;
+
+    for (int j=m-n; j>=0; j--)
+    {
+        // Estimate the quotient limb, which can be at most 2 units too big
+        unsigned __int128 num = ((unsigned __int128)an[j+n] << 64) | an[j+n-1];
+        unsigned __int128 qhat = num / bn[n-1];
+        unsigned __int128 rhat = num % bn[n-1];
+        while ((qhat >> 64) || (qhat*bn[n-2] > ((rhat << 64) | an[j+n-2])))
+        {
+            qhat--;
+            rhat += bn[n-1];
+            if (rhat >> 64) break;
+        }
+
+        // Multiply and subtract
+        uint64_t borrow = 0;
+        uint64_t carry = 0;
+        for (int i=0; i<n; i++)
+        {
+            unsigned __int128 p = qhat*bn[i] + carry;
+            carry = (uint64_t)(p >> 64);
+            unsigned __int128 d = (unsigned __int128)an[i+j] - (uint64_t)p - borrow;
+            an[i+j] = (uint64_t)d;
+            borrow = (d >> 64) ? 1 : 0;
+        }
+        unsigned __int128 d = (unsigned __int128)an[j+n] - carry - borrow;
+        an[j+n] = (uint64_t)d;
+
+        // If the result is negative, add the divisor back
+        if (d >> 64)
+        {
+            qhat--;
+            unsigned __int128 c = 0;
+            for (int i=0; i<n; i++)
+            {
+                c += (unsigned __int128)an[i+j] + bn[i];
+                an[i+j] = (uint64_t)c;
+                c >>= 64;
+            }
+            an[j+n] += (uint64_t)c;
+        }
+        q.v[j] = (uint64_t)qhat;
+    }
+
+    // Unnormalize the remainder
+    for (int i=0; i<n; i++) r.v[i] = (an[i] >> s) | (s ? (an[i+1] << (64-s)) : 0);
+}
+
+/*
+    Prime field of less than 2^256 elements, with elements in Montgomery form, i.e. a is stored as a*2^256 mod p.
+    Elements must be converted with toMontgomery() before operating with them, and back with fromMontgomery().
+*/
+
+class MontgomeryField
+{
+public:
+    U256 p;
+    U256 r2; // 2^512 mod p, used to convert to Montgomery form
+    U256 mOne; // 2^256 mod p, i.e. 1 in Montgomery form
+    uint64_t pInv; // -p^-1 mod 2^64
+
+    MontgomeryField (const U256 &_p) : p(_p)
+    {
+        // Newton iteration: every step doubles the number of correct low bits of p^-1
+        uint64_t inv = 1;
+        for (uint64_t i=0; i<6; i++) inv *= 2 - p.v[0]*inv;
+        pInv = -inv;
+
+        UInt<9> twoTo512;
+        twoTo512.setBit(512);
+        UInt<9> q9;
+        divmod(twoTo512, p, q9, r2);
+
+        UInt<5> twoTo256;
+        twoTo256.setBit(256);
+        UInt<5> q5;
+        divmod(twoTo256, p, q5, mOne);
+    }
+
+    // r = a*b/2^256 mod p, using the coarsely integrated operand scanning method; a*b must be < p*2^256
+    void mul (U256 &r, const U256 &a, const U256 &b) const
+    {
+        uint64_t t[6] = {0, 0, 0, 0, 0, 0};
+        for (unsigned i=0; i<4; i++)
+        {
+            unsigned __int128 c = 0;
+            for (unsigned j=0; j<4; j++)
+            {
+                c += (unsigned __int128)a.v[j]*b.v[i] + t[j];
+                t[j] = (uint64_t)c;
+                c >>= 64;
+            }
+            c += t[4];
+            t[4] = (uint64_t)c;
+            t[5] = (uint64_t)(c >> 64);
+
+            uint64_t m = t[0]*pInv;
+            c = (unsigned __int128)m*p.v[0] + t[0];
+            c >>= 64;
+            for (unsigned j=1; j<4; j++)
+            {
+                c += (unsigned __int128)m*p.v[j] + t[j];
+                t[j-1] = (uint64_t)c;
+                c >>= 64;
+            }
+            c += t[4];
+            t[3] = (uint64_t)c;
+            t[4] = t[5] + (uint64_t)(c >> 64);
+        }
+        for (unsigned i=0; i<4; i++) r.v[i] = t[i];
+        if ((t[4] != 0) || (r >= p)) r.sub(p);
+    }
+
+    void square (U256 &r, const U256 &a) const { mul(r, a, a); };
+
+    // The result can be any of the operands
+    void add (U256 &r, const U256 &a, const U256 &b) const
+    {
+        U256 result = a;
+        uint64_t carry = result.add(b);
+        if (carry || (result >= p)) result.sub(p);
+        r = result;
+    }
+
+    void sub (U256 &r, const U256 &a, const U256 &b) const
+    {
+        U256 result = a;
+        if (result.sub(b)) result.add(p);
+        r = result;
+    }
+
+    void neg (U256 &r, const U256 &a) const
+    {
+        U256 result = p;
+        result.sub(a);
+        r = a.isZero() ? a : result;
+    }
+
+    // Converts any 256-bit integer, even if it is not reduced modulo p
+    void toMontgomery (U256 &r, const U256 &a) const { mul(r, a, r2); };
+    void fromMontgomery (U256 &r, const U256 &a) const { mul(r, a, U256(1)); };
+
+    // r = a^e, with a in Montgomery form and e a plain integer
+    void exp (U256 &r, const U256 &a, const U256 &e) const
+    {
+        U256 result = mOne;
+        for (int i=e.bits()-1; i>=0; i--)
+        {
+            square(result, result);
+            if (e.bit(i)) mul(result, result, a);
+        }
+        r = result;
+    }
+
+    // r = a^-1, using Fermat's little theorem; a must not be zero
+    void inv (U256 &r, const U256 &a) const
+    {
+        U256 e = p;
+        e.sub(U256(2));
+        exp(r, a, e);
+    }
+
+    // r = sqrt(a), valid only if p = 3 mod 4; returns false if a is not a square
+    bool sqrt3mod4 (U256 &r, const U256 &a) const
+    {
+        // e = (p+1)/4, calculated as (p>>2) + 1 since p = 3 mod 4
+        U256 e;
+        for (unsigned i=0; i<4; i++) e.v[i] = (p.v[i] >> 2) | ((i < 3) ? (p.v[i+1] << 62) : 0);
+        e.add(U256(1));
+        U256 root, check;
+        exp(root, a, e);
+        square(check, root);
+        if (check != a) return false;
+        r = root;
+        return true;
+    }
+};
+
+// secp256k1 base field and scalar field, built the first time they are used
+inline const MontgomeryField & Secp256k1Fp (void)
+{
+    static const MontgomeryField field(U256::fromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEFFFFFC2F"));
+    return field;
+}
+
+inline const MontgomeryField & Secp256k1Fn (void)
+{
+    static const MontgomeryField field(U256::fromHex("FFFFFFFFFFFFFFFFFFFFFFFFFFFFFFFEBAAEDCE6AF48A03BBFD25E8CD0364141"));
+    return field;
+}
+
+#endif
@@ -5,9 +5,11 @@
 #include <uuid/uuid.h>
 #include <sys/mman.h>
 #include <sys/stat.h>
+#include <sys/resource.h>
 #include <fcntl.h>
 #include <sys/types.h>
 #include <unistd.h>
+#include <errno.h>
 #include "utils.hpp"
 #include "scalar.hpp"
 #include <openssl/md5.h>
@@ -23,6 +25,11 @@
 using namespace std;
 using namespace std::filesystem;
 
+// Available since Linux 5.4; older kernels fail the madvise() call with EINVAL
+#ifndef MADV_PAGEOUT
+#define MADV_PAGEOUT 21
+#endif
+
 void printBa(uint8_t *pData, uint64_t dataSize, string name)
 {
     string s = name + " = ";
@@ -415,6 +422,128 @@ void *copyFile(const string &fileName, uint64_t size)
     return mapFileInternal(fileName, size, false, false);
 }
 
+void prefaultMemory(void *pAddress, uint64_t size)
+{
+    if (size == 0)
+        return;
+
+    // madvise() requires a page aligned address
+    uint64_t pageSize = sysconf(_SC_PAGESIZE);
+    uint8_t *pBegin = (uint8_t *)((uint64_t)pAddress & ~(pageSize - 1));
+    uint64_t alignedSize = (uint8_t *)pAddress + size - pBegin;
+
+    // Huge pages only apply to anonymous memory, i.e. to copied files, so its failure is expected for mapped files
+    madvise(pBegin, alignedSize, MADV_HUGEPAGE);
+    if (madvise(pBegin, alignedSize, MADV_WILLNEED) != 0)
+    {
+        zklog.warning("prefaultMemory() failed calling madvise(MADV_WILLNEED) of size=" + to_string(size) + " errno=" + to_string(errno));
+    }
+
+    // Read a byte of every page; volatile, so that the reads are not optimized away
+    uint64_t nPages = (alignedSize + pageSize - 1) / pageSize;
+#pragma omp parallel for
+    for (uint64_t page = 0; page < nPages; page++)
+    {
+        (void)((volatile uint8_t *)pBegin)[page * pageSize];
+    }
+}
+
+void *mapSpillFile(const string &directory, uint64_t size)
+{
+    string fileName = directory + "/zkprover.spill.XXXXXX";
+    vector<char> fileNameBuffer(fileName.begin(), fileName.end());
+    fileNameBuffer.push_back(0);
+    int fd = mkstemp(fileNameBuffer.data());
+    if (fd < 0)
+    {
+        zklog.error("mapSpillFile() failed calling mkstemp() of file: " + fileName + " errno=" + to_string(errno));
+        exitProcess();
+    }
+
+    // Unlink the file, so that its blocks are released as soon as it is unmapped, even if the process is killed
+    unlink(fileNameBuffer.data());
+
+    if (ftruncate(fd, size) != 0)
+    {
+        zklog.error("mapSpillFile() failed calling ftruncate() of size: " + to_string(size) + " errno=" + to_string(errno));
+        exitProcess();
+    }
+
+    void *pAddress = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    if (pAddress == MAP_FAILED)
+    {
+        zklog.error("mapSpillFile() failed calling mmap() of size: " + to_string(size) + " errno=" + to_string(errno));
+        exitProcess();
+    }
+    close(fd);
+
+    return pAddress;
+}
+
+// Returns the number of pages of a page aligned memory area that are resident, or 0 if it cannot be known
+static uint64_t countResidentPages(uint8_t *pBegin, uint64_t size, uint64_t pageSize)
+{
+    vector<unsigned char> residency(size / pageSize);
+    if (mincore(pBegin, size, residency.data()) != 0)
+    {
+        zklog.warning("countResidentPages() failed calling mincore() of size=" + to_string(size) + " errno=" + to_string(errno));
+        return 0;
+    }
+    uint64_t residentPages = 0;
+    for (uint64_t i = 0; i < residency.size(); i++)
+    {
+        residentPages += residency[i] & 1;
+    }
+    return residentPages;
+}
+
+uint64_t spillMemory(void *pAddress, uint64_t size)
+{
+    // madvise() requires a page aligned address; the partial pages at both ends may be shared with live data
+    uint64_t pageSize = sysconf(_SC_PAGESIZE);
+    uint8_t *pBegin = (uint8_t *)(((uint64_t)pAddress + pageSize - 1) & ~(pageSize - 1));
+    uint8_t *pEnd = (uint8_t *)(((uint64_t)pAddress + size) & ~(pageSize - 1));
+    if (pEnd <= pBegin)
+        return 0;
+
+    // The kernel can skip pages, e.g. the ones mapped by other processes or locked, so count the reclaimed ones
+    uint64_t residentPagesBefore = countResidentPages(pBegin, pEnd - pBegin, pageSize);
+
+    if (madvise(pBegin, pEnd - pBegin, MADV_PAGEOUT) != 0)
+    {
+        zklog.warning("spillMemory() failed calling madvise() of size=" + to_string(pEnd - pBegin) + " errno=" + to_string(errno));
+        return 0;
+    }
+
+    uint64_t residentPagesAfter = countResidentPages(pBegin, pEnd - pBegin, pageSize);
+    if (residentPagesAfter >= residentPagesBefore)
+        return 0;
+    return (residentPagesBefore - residentPagesAfter) * pageSize;
+}
+
+uint64_t getCurrentRSS(void)
+{
+    // The second field of statm is the number of resident pages
+    ifstream statm("/proc/self/statm");
+    uint64_t totalPages = 0;
+    uint64_t residentPages = 0;
+    if (!(statm >> totalPages >> residentPages))
+    {
+        return 0;
+    }
+    return residentPages * sysconf(_SC_PAGESIZE);
+}
+
+uint64_t getPeakRSS(void)
+{
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) != 0)
+    {
+        return 0;
+    }
+    return uint64_t(usage.ru_maxrss) * 1024; // ru_maxrss is in KB
+}
+
 void unmapFile(void *pAddress, uint64_t size)
 {
     int err = munmap(pAddress, size);
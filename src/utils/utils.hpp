@@ -70,6 +70,24 @@ void unmapFile (void * pAddress, uint64_t size);
 // Copies file content into memory; use free after use
 void * copyFile (const string &fileName, uint64_t size);
 
+// Advises huge pages and read-ahead for a memory area, and touches all its pages in parallel so that they are resident
+void prefaultMemory (void * pAddress, uint64_t size);
+
+// Maps memory into a new temporary file of the directory, removed when unmapped or when the process exits
+void * mapSpillFile (const string &directory, uint64_t size);
+
+// Advises the kernel to page out a memory area that will not be used for a while, i.e. to write it back to its file
+// or to swap; only the pages fully inside the area are advised, and the size in bytes of the resident pages that the
+// kernel actually reclaimed is returned, as counted by mincore(), i.e. dirty pages still being written back are not
+// counted
+uint64_t spillMemory (void * pAddress, uint64_t size);
+
+// Returns the current resident set size of the process, in bytes
+uint64_t getCurrentRSS (void);
+
+// Returns the peak resident set size of the process, in bytes
+uint64_t getPeakRSS (void);
+
 // Compute the sha256 hash of a string
 string sha256(string str);
 
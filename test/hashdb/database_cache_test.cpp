@@ -17,37 +17,77 @@ uint64_t DatabaseCacheTest (void)
     Database::dbMTCache.setMaxSize(2000000);
 
     Goldilocks fr;
-    mpz_class keyScalar;
-    string keyString;
+    Goldilocks::Element key[4];
     vector<Goldilocks::Element> value;
     bool bResult;
     for (uint64_t i=0; i<NUMBER_OF_DB_CACHE_ADDS; i++)
     {
-        keyScalar = i;
-        keyString = PrependZeros(keyScalar.get_str(16), 64);
+        key[0] = fr.fromU64(i);
+        key[1] = fr.fromU64(i);
+        key[2] = fr.zero();
+        key[3] = fr.zero();
         value.clear();
         for (uint64_t j=0; j<12; j++)
         {
-            value.push_back(fr.fromU64(j));
+            value.push_back(fr.fromU64(i + j));
         }
         bool update = false;
-        Database::dbMTCache.add(keyString, value, update);
+        Database::dbMTCache.add(key, value, update);
     }
 
     //Database::dbMTCache.print(true);
 
     for (uint64_t i=0; i<NUMBER_OF_DB_CACHE_ADDS; i++)
     {
-        keyScalar = i;
-        keyString = PrependZeros(keyScalar.get_str(16), 64);
-        bResult = Database::dbMTCache.find(keyString, value);
-        if (!bResult)
+        key[0] = fr.fromU64(i);
+        key[1] = fr.fromU64(i);
+        key[2] = fr.zero();
+        key[3] = fr.zero();
+        bResult = Database::dbMTCache.find(key, value);
+        if (!bResult || (value.size() != 12) || (fr.toU64(value[11]) != i + 11))
         {
-            zklog.error("DatabaseCacheTest() failed calling Database::dbMTCache.find() of key=" + keyString);
+            zklog.error("DatabaseCacheTest() failed calling Database::dbMTCache.find() of key=" + fea2string(fr, key));
             numberOfFailed++;
         }
     }
-    
+
+    // Fill a small cache twice, so that every shard must evict its least recently used records
+    Database::dbMTCache.clear();
+    Database::dbMTCache.setMaxSize(DATABASE_MT_CACHE_SHARDS*DatabaseMTCache::recordSize*4);
+    for (uint64_t i=0; i<2*NUMBER_OF_DB_CACHE_ADDS; i++)
+    {
+        key[0] = fr.fromU64(i);
+        key[1] = fr.fromU64(i);
+        key[2] = fr.zero();
+        key[3] = fr.zero();
+        Database::dbMTCache.add(key, value, false);
+    }
+    uint64_t hits, misses, evictions, totalEvictions = 0;
+    for (uint64_t shard=0; shard<DATABASE_MT_CACHE_SHARDS; shard++)
+    {
+        Database::dbMTCache.getCounters(shard, hits, misses, evictions);
+        totalEvictions += evictions;
+    }
+    if ((totalEvictions != 2*NUMBER_OF_DB_CACHE_ADDS - DATABASE_MT_CACHE_SHARDS*4) || (Database::dbMTCache.getCurrentSize() > Database::dbMTCache.getMaxSize()))
+    {
+        zklog.error("DatabaseCacheTest() found totalEvictions=" + to_string(totalEvictions) + " currentSize=" + to_string(Database::dbMTCache.getCurrentSize()));
+        numberOfFailed++;
+    }
+    key[0] = fr.fromU64(2*NUMBER_OF_DB_CACHE_ADDS - 1);
+    key[1] = key[0];
+    if (!Database::dbMTCache.find(key, value))
+    {
+        zklog.error("DatabaseCacheTest() failed calling Database::dbMTCache.find() of the last added key=" + fea2string(fr, key));
+        numberOfFailed++;
+    }
+    key[0] = fr.zero();
+    key[1] = fr.zero();
+    if (Database::dbMTCache.find(key, value))
+    {
+        zklog.error("DatabaseCacheTest() found the first added key, which should have been evicted");
+        numberOfFailed++;
+    }
+
     Database::dbMTCache.clear();
 
     TimerStopAndLog(DATABASE_CACHE_TEST);
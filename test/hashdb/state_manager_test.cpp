@@ -0,0 +1,255 @@
+#include "state_manager_test.hpp"
+#include "state_manager.hpp"
+#include "database.hpp"
+#include "scalar.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+
+// Size in bytes of the MT and program caches used by this test, which is where a local database writes to
+#define STATE_MANAGER_TEST_CACHE_SIZE (64*1024*1024)
+
+// Returns a hash (a node key, a program key or a state root) that is unique for every scenario and id, since the
+// database caches are shared by all the scenarios
+string StateManagerTestHash (uint64_t scenario, uint64_t id)
+{
+    mpz_class hash = (mpz_class(scenario + 1) << 192) + id;
+    return NormalizeToNFormat(hash.get_str(16), 64);
+}
+
+// Moves the state of a batch from oldRoot to newRoot, writing and deleting the nodes of the given ids
+void StateManagerTestSet (StateManager &stateManager, const string &batchUUID, uint64_t scenario, uint64_t block, uint64_t tx, uint64_t oldRoot, uint64_t newRoot,
+                          const vector<uint64_t> &writes, const vector<uint64_t> &deletes, const Persistence persistence = PERSISTENCE_DATABASE)
+{
+    vector<Goldilocks::Element> value;
+    for (uint64_t i=0; i<12; i++) value.push_back(Goldilocks::fromU64(i));
+
+    stateManager.setOldStateRoot(batchUUID, block, tx, StateManagerTestHash(scenario, oldRoot), persistence);
+    for (uint64_t i=0; i<writes.size(); i++)
+    {
+        stateManager.writeNode(batchUUID, block, tx, StateManagerTestHash(scenario, writes[i]), value, persistence);
+    }
+    for (uint64_t i=0; i<deletes.size(); i++)
+    {
+        stateManager.deleteNode(batchUUID, block, tx, StateManagerTestHash(scenario, deletes[i]), persistence);
+    }
+    stateManager.setNewStateRoot(batchUUID, block, tx, StateManagerTestHash(scenario, newRoot), persistence);
+}
+
+// Flushes a batch and checks that the nodes of the written ids, and only them, were written to database
+uint64_t StateManagerTestFlush (StateManager &stateManager, Database &db, const string &name, const string &batchUUID, uint64_t scenario, uint64_t newRoot,
+                                const vector<uint64_t> &written, const vector<uint64_t> &notWritten)
+{
+    uint64_t numberOfFailed = 0;
+
+    uint64_t flushId, lastSentFlushId;
+    zkresult zkr = stateManager.flush(batchUUID, StateManagerTestHash(scenario, newRoot), PERSISTENCE_DATABASE, db, flushId, lastSentFlushId);
+    if (zkr != ZKR_SUCCESS)
+    {
+        zklog.error("StateManagerTest() " + name + " failed calling stateManager.flush() result=" + zkresult2string(zkr));
+        return 1;
+    }
+
+    Goldilocks::Element vKey[4];
+    vector<Goldilocks::Element> value;
+    for (uint64_t i=0; i<written.size() + notWritten.size(); i++)
+    {
+        bool bWritten = (i < written.size());
+        uint64_t id = bWritten ? written[i] : notWritten[i - written.size()];
+        string2fea(db.fr, StateManagerTestHash(scenario, id), vKey);
+        value.clear();
+        bool bFound = db.usingAssociativeCache() ? Database::dbMTACache.findKey(vKey, value) : Database::dbMTCache.find(vKey, value);
+        if (bFound != bWritten)
+        {
+            zklog.error("StateManagerTest() " + name + " found=" + to_string(bFound) + " but expected=" + to_string(bWritten) + " node id=" + to_string(id));
+            numberOfFailed++;
+        }
+    }
+
+    return numberOfFailed;
+}
+
+// Checks which nodes and programs the state manager writes to database when flushing a batch, after the state
+// changes, rollbacks and detours that the executor does while processing it
+uint64_t StateManagerTest (const Config &config)
+{
+    TimerStart(STATE_MANAGER_TEST);
+
+    uint64_t numberOfFailed = 0;
+
+    // Use a local database, so that the flushed nodes and programs are only stored in its caches
+    Goldilocks fr;
+    Config dbConfig = config;
+    dbConfig.databaseURL = "local";
+    dbConfig.dbMultiWrite = false;
+    Database db(fr, dbConfig);
+    db.init();
+    if (!db.usingAssociativeCache())
+    {
+        Database::dbMTCache.setMaxSize(STATE_MANAGER_TEST_CACHE_SIZE);
+    }
+    Database::dbProgramCache.setMaxSize(STATE_MANAGER_TEST_CACHE_SIZE);
+
+    Config purgeConfig = config;
+    purgeConfig.stateManagerPurge = true;
+    StateManager purgeStateManager;
+    purgeStateManager.init(purgeConfig);
+
+    Config noPurgeConfig = config;
+    noPurgeConfig.stateManagerPurge = false;
+    StateManager noPurgeStateManager;
+    noPurgeStateManager.init(noPurgeConfig);
+
+    // State roots ids, and node or program ids, of every scenario
+    const uint64_t A = 100, B = 101, C = 102, D = 103, E = 104;
+    uint64_t scenario = 0;
+    string batchUUID;
+
+    // Simple batch: the nodes deleted by a later tx of the same block are not written, but the ones deleted in a
+    // later block are, since they belong to the state of a previous block
+    {
+        StateManager &sm = purgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1, 2}, {9});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, B, C, {3}, {1});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, C), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, C), PERSISTENCE_DATABASE);
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, C), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 1, 0, C, D, {4, 5}, {3});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, D), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, D), PERSISTENCE_DATABASE);
+        numberOfFailed += StateManagerTestFlush(sm, db, "simple batch", batchUUID, scenario, D, {2, 3, 4, 5}, {1, 9});
+    }
+    scenario++;
+
+    // Reverted tx: the state goes back to the state root of the previous tx, so its nodes are not written
+    {
+        StateManager &sm = purgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, B, C, {2}, {});
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, C, D, {3}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 2, B, E, {4}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, E), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, E), PERSISTENCE_DATABASE);
+        numberOfFailed += StateManagerTestFlush(sm, db, "reverted tx", batchUUID, scenario, E, {1, 4}, {2, 3});
+    }
+    scenario++;
+
+    // Block that returns to its initial state root: its nodes are not written
+    {
+        StateManager &sm = purgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 1, 0, B, C, {2}, {});
+        StateManagerTestSet(sm, batchUUID, scenario, 1, 0, C, B, {3}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 2, 0, B, D, {4}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, D), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, D), PERSISTENCE_DATABASE);
+        numberOfFailed += StateManagerTestFlush(sm, db, "block returning to its initial root", batchUUID, scenario, D, {1, 4}, {2, 3});
+    }
+    scenario++;
+
+    // Cancelled batch: it is flushed with its initial state root, e.g. because of an OOC, so neither its nodes nor
+    // its programs are written
+    {
+        StateManager &sm = purgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1}, {});
+        sm.writeProgram(batchUUID, 0, 0, StateManagerTestHash(scenario, 2), {1, 2, 3}, PERSISTENCE_DATABASE);
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        numberOfFailed += StateManagerTestFlush(sm, db, "cancelled batch", batchUUID, scenario, A, {}, {1});
+        vector<uint8_t> program;
+        if (Database::dbProgramCache.find(StateManagerTestHash(scenario, 2), program))
+        {
+            zklog.error("StateManagerTest() cancelled batch found a program that should not have been written");
+            numberOfFailed++;
+        }
+    }
+    scenario++;
+
+    // Temporary persistence: its nodes are never written to database
+    {
+        StateManager &sm = purgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1}, {});
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, B, C, {2}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, C), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, C, D, {3}, {}, PERSISTENCE_TEMPORARY);
+        numberOfFailed += StateManagerTestFlush(sm, db, "temporary persistence", batchUUID, scenario, C, {1, 2}, {3});
+    }
+    scenario++;
+
+    // Detour whose state root is revisited by a later tx: the state continues from the first version that produced
+    // that state root, so the nodes of the detour are not written, but the programs of the batch are
+    {
+        StateManager &sm = purgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, B, C, {2}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, C), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 2, C, B, {3}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 3, B, D, {4}, {});
+        sm.writeProgram(batchUUID, 0, 3, StateManagerTestHash(scenario, 5), {1, 2, 3}, PERSISTENCE_DATABASE);
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, D), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, D), PERSISTENCE_DATABASE);
+        numberOfFailed += StateManagerTestFlush(sm, db, "detour with a revisited root", batchUUID, scenario, D, {1, 4}, {2, 3});
+        vector<uint8_t> program;
+        if (!Database::dbProgramCache.find(StateManagerTestHash(scenario, 5), program) || (program.size() != 3))
+        {
+            zklog.error("StateManagerTest() detour with a revisited root did not find a program that should have been written");
+            numberOfFailed++;
+        }
+    }
+    scenario++;
+
+    // Purge disabled: the nodes of every version are written, including the reverted and deleted ones
+    {
+        StateManager &sm = noPurgeStateManager;
+        batchUUID = getUUID();
+        sm.startBlock(batchUUID, StateManagerTestHash(scenario, A), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 0, A, B, {1}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, B, C, {2}, {});
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 1, C, D, {3}, {});
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, B), PERSISTENCE_DATABASE);
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 2, B, E, {4}, {1});
+        StateManagerTestSet(sm, batchUUID, scenario, 0, 2, E, E, {5}, {}, PERSISTENCE_TEMPORARY);
+        sm.finishTx(batchUUID, StateManagerTestHash(scenario, E), PERSISTENCE_DATABASE);
+        sm.finishBlock(batchUUID, StateManagerTestHash(scenario, E), PERSISTENCE_DATABASE);
+        numberOfFailed += StateManagerTestFlush(sm, db, "stateManagerPurge=false", batchUUID, scenario, E, {1, 2, 3, 4}, {5});
+    }
+
+    // Restore the caches configured by main()
+    if (!db.usingAssociativeCache())
+    {
+        Database::dbMTCache.setMaxSize(config.dbMTCacheSize*1024*1024);
+    }
+    Database::dbProgramCache.setMaxSize(config.dbProgramCacheSize*1024*1024);
+
+    TimerStopAndLog(STATE_MANAGER_TEST);
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("StateManagerTest() failed " + to_string(numberOfFailed) + " tests");
+    }
+
+    return numberOfFailed;
+}
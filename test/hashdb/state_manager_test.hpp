@@ -0,0 +1,9 @@
+#ifndef STATE_MANAGER_TEST_HPP
+#define STATE_MANAGER_TEST_HPP
+
+#include <cstdint>
+#include "config.hpp"
+
+uint64_t StateManagerTest (const Config &config);
+
+#endif
@@ -0,0 +1,189 @@
+#include <vector>
+#include <cstring>
+#include <nlohmann/json.hpp>
+#include "main_sm_checkpoint_test.hpp"
+#include "main_sm/fork_9/main/main_executor.hpp"
+#include "main_sm/fork_9/pols_generated/commit_pols.hpp"
+#include "prover_request.hpp"
+#include "utils.hpp"
+#include "exit_process.hpp"
+#include "zklog.hpp"
+
+using namespace std;
+using json = nlohmann::json;
+
+// Trace of a main SM execution: a hash of every evaluation of the main columns, plus a summary of the required data
+class MainSMTrace
+{
+public:
+    vector<uint64_t> rows;
+    vector<uint64_t> requiredSizes;
+    uint64_t memoryHash;
+    uint64_t steps;
+    zkresult result;
+    MainSMTrace () : memoryHash(0), steps(0), result(ZKR_UNSPECIFIED) {};
+};
+
+inline uint64_t MainSMTraceHash (uint64_t hash, uint64_t value)
+{
+    hash ^= value + 0x9E3779B97F4A7C15ULL + (hash << 6) + (hash >> 2);
+    return hash;
+}
+
+// Executes the input file of the configuration in prove mode over a zeroed commit pols buffer, and returns its trace
+void MainSMCheckpointTestExecute (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config, void * pAddress, MainSMTrace &trace)
+{
+    memset(pAddress, 0, fork_9::CommitPols::pilSize());
+
+    ProverRequest proverRequest(fr, config, prt_execute);
+    json inputJson;
+    file2json(config.inputFile, inputJson);
+    zkresult zkResult = proverRequest.input.load(inputJson);
+    if (zkResult != ZKR_SUCCESS)
+    {
+        zklog.error("MainSMCheckpointTestExecute() failed calling proverRequest.input.load() zkResult=" + zkresult2string(zkResult));
+        trace.result = zkResult;
+        return;
+    }
+    proverRequest.CreateFullTracer();
+
+    fork_9::CommitPols commitPols(pAddress, fork_9::CommitPols::pilDegree());
+    fork_9::MainExecRequired required;
+    fork_9::MainExecutor mainExecutor(fr, poseidon, config);
+    mainExecutor.execute(proverRequest, commitPols.Main, required);
+
+    trace.result = proverRequest.result;
+    trace.steps = proverRequest.counters.steps;
+
+    uint64_t N = fork_9::CommitPols::pilDegree();
+    uint64_t numPols = fork_9::MainCommitPols::numPols();
+    trace.rows.resize(N);
+    #pragma omp parallel for
+    for (uint64_t row=0; row<N; row++)
+    {
+        Goldilocks::Element * pRow = &commitPols.Main.A7[row];
+        uint64_t hash = 0;
+        for (uint64_t pol=0; pol<numPols; pol++)
+        {
+            hash = MainSMTraceHash(hash, fr.toU64(pRow[pol]));
+        }
+        trace.rows[row] = hash;
+    }
+
+    trace.requiredSizes = {
+        required.Storage.size(), required.Memory.size(), required.Binary.size(), required.Arith.size(),
+        required.PaddingKK.size(), required.PaddingKKBit.size(), required.Bits2Field.size(), required.KeccakF.size(),
+        required.PaddingSha256.size(), required.PaddingSha256Bit.size(), required.Bits2FieldSha256.size(), required.Sha256F.size(),
+        required.PaddingPG.size(), required.PoseidonG.size(), required.PoseidonGFromPG.size(), required.PoseidonGFromST.size(),
+        required.ClimbKey.size(), required.MemAlign.size() };
+
+    // The memory SM input is sorted by address and pc later, so the pc of every access must match too
+    for (uint64_t i=0; i<required.Memory.size(); i++)
+    {
+        MemoryAccess &access = required.Memory[i];
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, access.bIsWrite);
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, access.address);
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, access.pc);
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe0));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe1));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe2));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe3));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe4));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe5));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe6));
+        trace.memoryHash = MainSMTraceHash(trace.memoryHash, fr.toU64(access.fe7));
+    }
+}
+
+uint64_t MainSMCheckpointTestCompare (const string &name, const MainSMTrace &trace, const MainSMTrace &reference)
+{
+    uint64_t numberOfFailed = 0;
+    if ((trace.result != reference.result) || (trace.steps != reference.steps))
+    {
+        zklog.error("MainSMCheckpointTest() " + name + " got result=" + zkresult2string(trace.result) + " steps=" + to_string(trace.steps) +
+            " expected result=" + zkresult2string(reference.result) + " steps=" + to_string(reference.steps));
+        numberOfFailed++;
+    }
+    uint64_t differentRows = 0;
+    for (uint64_t row=0; row<reference.rows.size(); row++)
+    {
+        if (trace.rows[row] != reference.rows[row])
+        {
+            if (differentRows == 0)
+            {
+                zklog.error("MainSMCheckpointTest() " + name + " got a different first evaluation=" + to_string(row));
+            }
+            differentRows++;
+        }
+    }
+    if (differentRows != 0)
+    {
+        zklog.error("MainSMCheckpointTest() " + name + " got " + to_string(differentRows) + " different evaluations");
+        numberOfFailed++;
+    }
+    if (trace.requiredSizes != reference.requiredSizes)
+    {
+        zklog.error("MainSMCheckpointTest() " + name + " got different required data sizes");
+        numberOfFailed++;
+    }
+    if (trace.memoryHash != reference.memoryHash)
+    {
+        zklog.error("MainSMCheckpointTest() " + name + " got different required memory accesses");
+        numberOfFailed++;
+    }
+    return numberOfFailed;
+}
+
+// Executes the input file with the main SM in direct mode, with and without executorParallelFinalWait, and in
+// checkpoint mode, and checks that the committed main columns and the required data are identical
+uint64_t MainSMCheckpointTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config)
+{
+    uint64_t numberOfFailed = 0;
+    zklog.info("MainSMCheckpointTest() starting with inputFile=" + config.inputFile);
+
+    void * pAddress = calloc(fork_9::CommitPols::pilSize(), 1);
+    if (pAddress == NULL)
+    {
+        zklog.error("MainSMCheckpointTest() failed calling calloc() of size=" + to_string(fork_9::CommitPols::pilSize()));
+        exitProcess();
+    }
+
+    // Reference: direct mode, filling every evaluation serially
+    Config referenceConfig = config;
+    referenceConfig.useMainExecGenerated = false;
+    referenceConfig.executorParallelFinalWait = false;
+    referenceConfig.executorCheckpointSteps = 0;
+    MainSMTrace reference;
+    MainSMCheckpointTestExecute(fr, poseidon, referenceConfig, pAddress, reference);
+    if (reference.result != ZKR_SUCCESS)
+    {
+        zklog.error("MainSMCheckpointTest() failed executing the reference result=" + zkresult2string(reference.result));
+        numberOfFailed++;
+    }
+
+    // Direct mode, filling the finalWait evaluations in parallel
+    Config finalWaitConfig = referenceConfig;
+    finalWaitConfig.executorParallelFinalWait = true;
+    MainSMTrace finalWait;
+    MainSMCheckpointTestExecute(fr, poseidon, finalWaitConfig, pAddress, finalWait);
+    numberOfFailed += MainSMCheckpointTestCompare("executorParallelFinalWait", finalWait, reference);
+
+    // Checkpoint mode, with small segments so that there are many of them even for a short input
+    Config checkpointConfig = referenceConfig;
+    checkpointConfig.executorCheckpointSteps = (config.executorCheckpointSteps > 0) ? config.executorCheckpointSteps : 4096;
+    MainSMTrace checkpoint;
+    MainSMCheckpointTestExecute(fr, poseidon, checkpointConfig, pAddress, checkpoint);
+    numberOfFailed += MainSMCheckpointTestCompare("executorCheckpointSteps=" + to_string(checkpointConfig.executorCheckpointSteps), checkpoint, reference);
+
+    free(pAddress);
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("MainSMCheckpointTest() failed " + to_string(numberOfFailed) + " tests");
+    }
+    else
+    {
+        zklog.info("MainSMCheckpointTest() succeeded");
+    }
+    return numberOfFailed;
+}
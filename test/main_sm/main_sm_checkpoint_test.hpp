@@ -0,0 +1,10 @@
+#ifndef MAIN_SM_CHECKPOINT_TEST_HPP
+#define MAIN_SM_CHECKPOINT_TEST_HPP
+
+#include "config.hpp"
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+
+uint64_t MainSMCheckpointTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
+
+#endif
@@ -5,6 +5,7 @@
 #include "zkmax.hpp"
 #include "check_tree.hpp"
 #include "state_manager_64.hpp"
+#include <google/protobuf/util/message_differencer.h>
 
 using namespace std;
 using json = nlohmann::json;
@@ -382,6 +383,12 @@ bool ExecutorClient::ProcessBatch (const string &inputFile)
             } while (getFlushStatusResponse.stored_flush_id() < processBatchResponse.flush_id());
             zklog.info("ExecutorClient::ProcessBatch() successfully stored returned flush id=" + to_string(processBatchResponse.flush_id()));
         }
+
+        // Check that the streamed version of the call returns the same block responses and batch fields
+        if (config.executorClientCheckStream && !CheckProcessBatchV2Stream(request, processBatchResponse))
+        {
+            return false;
+        }
     }
     else if (!input.publicInputsExtended.publicInputs.witness.empty()) // Stateless
     {
@@ -546,6 +553,71 @@ bool ExecutorClient::ProcessBatch (const string &inputFile)
     return true;
 }
 
+bool ExecutorClient::CheckProcessBatchV2Stream (const ::executor::v1::ProcessBatchRequestV2 &request, const ::executor::v1::ProcessBatchResponseV2 &response)
+{
+    TimerStart(EXECUTOR_CLIENT_CHECK_PROCESS_BATCH_V2_STREAM);
+
+    ::grpc::ClientContext context;
+    std::unique_ptr< ::grpc::ClientReaderInterface< ::executor::v1::ProcessBatchResponseV2>> reader(stub->ProcessBatchV2Stream(&context, request));
+
+    // Every message but the last one must contain exactly one block response, in the same order as in the ProcessBatchV2 response
+    vector< ::executor::v1::ProcessBatchResponseV2> messages;
+    ::executor::v1::ProcessBatchResponseV2 message;
+    while (reader->Read(&message))
+    {
+        messages.emplace_back(message);
+    }
+    ::grpc::Status grpcStatus = reader->Finish();
+    if (grpcStatus.error_code() != grpc::StatusCode::OK)
+    {
+        zklog.error("ExecutorClient::CheckProcessBatchV2Stream() failed calling server error=" + to_string(grpcStatus.error_code()) + "=" + grpcStatus.error_message());
+        return false;
+    }
+    if (messages.size() != (uint64_t)response.block_responses().size() + 1)
+    {
+        zklog.error("ExecutorClient::CheckProcessBatchV2Stream() got messages=" + to_string(messages.size()) + " but expected block responses=" + to_string(response.block_responses().size()) + " plus the final one");
+        return false;
+    }
+    for (int64_t b=0; b < response.block_responses().size(); b++)
+    {
+        if (messages[b].block_responses().size() != 1)
+        {
+            zklog.error("ExecutorClient::CheckProcessBatchV2Stream() got message=" + to_string(b) + " with block responses=" + to_string(messages[b].block_responses().size()) + " != 1");
+            return false;
+        }
+        if (!google::protobuf::util::MessageDifferencer::Equals(messages[b].block_responses()[0], response.block_responses()[b]))
+        {
+            zklog.error("ExecutorClient::CheckProcessBatchV2Stream() got a different block response=" + to_string(b));
+            return false;
+        }
+    }
+
+    // The last message must contain the batch fields and no block responses; the flush IDs belong to each call
+    ::executor::v1::ProcessBatchResponseV2 &last = messages.back();
+    if (last.block_responses().size() != 0)
+    {
+        zklog.error("ExecutorClient::CheckProcessBatchV2Stream() got last message with block responses=" + to_string(last.block_responses().size()) + " != 0");
+        return false;
+    }
+    ::executor::v1::ProcessBatchResponseV2 batchResponse = response;
+    batchResponse.clear_block_responses();
+    batchResponse.clear_flush_id();
+    batchResponse.clear_stored_flush_id();
+    last.clear_flush_id();
+    last.clear_stored_flush_id();
+    if (!google::protobuf::util::MessageDifferencer::Equals(last, batchResponse))
+    {
+        zklog.error("ExecutorClient::CheckProcessBatchV2Stream() got different batch fields in the last message");
+        return false;
+    }
+
+    TimerStopAndLog(EXECUTOR_CLIENT_CHECK_PROCESS_BATCH_V2_STREAM);
+
+    zklog.info("ExecutorClient::CheckProcessBatchV2Stream() successfully checked block responses=" + to_string(response.block_responses().size()));
+
+    return true;
+}
+
 bool ProcessDirectory (ExecutorClient *pClient, const string &directoryName, uint64_t &fileCounter, uint64_t &directoryCounter, uint64_t &skippedFileCounter, uint64_t &skippedDirectoryCounter, bool skipping)
 {
     // Get files sorted alphabetically from the folder
@@ -35,6 +35,7 @@ public:
     int64_t waitForThreads (void);
 
     bool ProcessBatch (const string &inputFile);
+    bool CheckProcessBatchV2Stream (const ::executor::v1::ProcessBatchRequestV2 &request, const ::executor::v1::ProcessBatchResponseV2 &response);
 };
 
 void* executorClientThread  (void* arg); // One process batch
@@ -0,0 +1,94 @@
+#include "hashdb_set_many_test.hpp"
+#include "zklog.hpp"
+#include "zkresult.hpp"
+#include "hashdb_factory.hpp"
+#include "scalar.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+
+uint64_t HashDBSetManyTest (const Config& config)
+{
+    TimerStart(HASHDB_SET_MANY_TEST);
+
+    zklog.info("HashDBSetManyTest() started");
+    Goldilocks fr;
+    PoseidonGoldilocks poseidon;
+    zkresult zkr;
+    Persistence persistence = PERSISTENCE_CACHE;
+    HashDBInterface* pHashDB = HashDBClientFactory::createHashDBClient(fr, config);
+    zkassertpermanent(pHashDB != NULL);
+
+    uint64_t numberOfErrors = 0;
+    string batchUUID = getUUID();
+    uint64_t block = 0;
+    uint64_t tx = 0;
+
+    // Build a batch where some keys are repeated, including keys that are set and then deleted
+    const uint64_t numberOfKeys = 32;
+    vector<KeyValue> keys(numberOfKeys);
+    vector<mpz_class> expectedValues(numberOfKeys);
+    Goldilocks::Element keyfea[12] = {0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0};
+    for (uint64_t i=0; i<numberOfKeys; i++)
+    {
+        keyfea[0] = fr.fromU64(i + 1);
+        poseidon.hash(keys[i].key, keyfea);
+    }
+    vector<KeyValue> keyValues;
+    for (uint64_t i=0; i<numberOfKeys; i++)
+    {
+        KeyValue keyValue = keys[i];
+        keyValue.value = i + 1;
+        keyValues.emplace_back(keyValue);
+        expectedValues[i] = keyValue.value;
+    }
+    for (uint64_t i=0; i<numberOfKeys; i+=5)
+    {
+        KeyValue keyValue = keys[i];
+        keyValue.value = (i % 10 == 0) ? 0 : 1000 + i;
+        keyValues.emplace_back(keyValue);
+        expectedValues[i] = keyValue.value;
+    }
+
+    // Set the keys one by one, in request order
+    Goldilocks::Element root[4] = {0, 0, 0, 0};
+    Goldilocks::Element sequentialRoot[4] = {0, 0, 0, 0};
+    for (uint64_t i=0; i<keyValues.size(); i++)
+    {
+        zkr = pHashDB->set(batchUUID, block, tx, sequentialRoot, keyValues[i].key, keyValues[i].value, persistence, root, NULL, NULL);
+        zkassertpermanent(zkr == ZKR_SUCCESS);
+        for (uint64_t j=0; j<4; j++) sequentialRoot[j] = root[j];
+    }
+
+    // Set the keys as a batch, starting from the empty tree as well
+    Goldilocks::Element oldRoot[4] = {0, 0, 0, 0};
+    Goldilocks::Element batchRoot[4];
+    vector<SmtSetResult> setResults;
+    zkr = pHashDB->setMany(batchUUID, block, tx, oldRoot, keyValues, persistence, batchRoot, &setResults, NULL);
+    zkassertpermanent(zkr == ZKR_SUCCESS);
+    if (fea2string(fr, batchRoot) != fea2string(fr, sequentialRoot))
+    {
+        zklog.error("HashDBSetManyTest() got setMany() root=" + fea2string(fr, batchRoot) + " different from sequential set() root=" + fea2string(fr, sequentialRoot));
+        numberOfErrors++;
+    }
+    if (setResults.size() != keyValues.size())
+    {
+        zklog.error("HashDBSetManyTest() got setMany() results=" + to_string(setResults.size()) + " for keys=" + to_string(keyValues.size()));
+        numberOfErrors++;
+    }
+
+    // Every key must hold the last value it was set to
+    zkr = pHashDB->getMany(batchUUID, batchRoot, keys, NULL, NULL);
+    zkassertpermanent(zkr == ZKR_SUCCESS);
+    for (uint64_t i=0; i<numberOfKeys; i++)
+    {
+        if (keys[i].value != expectedValues[i])
+        {
+            zklog.error("HashDBSetManyTest() got key=" + to_string(i) + " value=" + keys[i].value.get_str(10) + " expected=" + expectedValues[i].get_str(10));
+            numberOfErrors++;
+        }
+    }
+
+    TimerStopAndLog(HASHDB_SET_MANY_TEST);
+
+    return numberOfErrors;
+}
@@ -0,0 +1,8 @@
+#ifndef HASHDB_SET_MANY_TEST_HPP
+#define HASHDB_SET_MANY_TEST_HPP
+
+#include "config.hpp"
+
+uint64_t HashDBSetManyTest (const Config& config);
+
+#endif
@@ -13,6 +13,7 @@
 #include "hashdb64_workflow_test.hpp"
 #include "hashdb64_simple_workflow_test.hpp"
 #include "hashdb_program_test.hpp"
+#include "hashdb_set_many_test.hpp"
 
 uint64_t HashDBTest (const Config& config)
 {
@@ -28,6 +29,7 @@ uint64_t HashDBTest (const Config& config)
     //numberOfFailedTests += HashDBTestMultiWrite(config);
     //numberOfFailedTests += HashDBProgramTest(config);
     numberOfFailedTests += HashDB64WorkflowTest(config);
+    numberOfFailedTests += HashDBSetManyTest(config);
     //numberOfFailedTests += HashDB64SimpleWorkflowTest(config);
     return numberOfFailedTests;
 }
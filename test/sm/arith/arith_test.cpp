@@ -1,10 +1,69 @@
 #include <vector>
 #include "arith_test.hpp"
 #include "arith_action.hpp"
+#include "arith_executor.hpp"
+#include "commit_pols_test.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
 //#include "arith.hpp"
 
 using namespace std;
 
+// Number of random actions used by the trace fill chunks test, half of the Arith SM capacity
+#define ARITH_CHUNKS_TEST_ACTIONS (ArithCommitPols::pilDegree()/32/2)
+
+// Fills the Arith commit pols with random multiplications, first serially and then by row ranges in parallel,
+// and checks that both traces are identical
+uint64_t ArithSMChunksTest (Goldilocks &fr, const Config &config)
+{
+    uint64_t numberOfErrors = 0;
+
+    // Use a copy of the configuration to change the number of trace fill threads of the same executor
+    Config chunksConfig = config;
+    ArithExecutor arithExecutor(fr, chunksConfig);
+
+    // Every action is a valid x1*y1 + x2 = y2*2^256 + y3 equation (selEq0)
+    gmp_randclass randomGenerator(gmp_randinit_default);
+    randomGenerator.seed(0xA217);
+    vector<ArithAction> list;
+    ArithAction action;
+    action.x3 = 0;
+    action.selEq0 = 1;
+    for (uint64_t i = 0; i < ARITH_CHUNKS_TEST_ACTIONS; i++)
+    {
+        action.x1 = randomGenerator.get_z_bits(256);
+        action.y1 = randomGenerator.get_z_bits(256);
+        action.x2 = randomGenerator.get_z_bits(256);
+        mpz_class result = action.x1*action.y1 + action.x2;
+        action.y2 = result >> 256;
+        action.y3 = result & ScalarMask256;
+        list.push_back(action);
+    }
+
+    void * pAddress = calloc(CommitPols::pilSize(), 1);
+    if (pAddress == NULL)
+    {
+        zklog.error("ArithSMChunksTest() failed calling calloc() of size=" + to_string(CommitPols::pilSize()));
+        return 1;
+    }
+    CommitPols cmPols(pAddress, CommitPols::pilDegree());
+
+    chunksConfig.executorTraceFillThreads = 1;
+    arithExecutor.execute(list, cmPols.Arith);
+    uint64_t serialHash = CommitPolsHash(fr, cmPols.Arith.x1[0], ArithCommitPols::numPols());
+
+    CommitPolsClear(fr, cmPols.Arith.x1[0], ArithCommitPols::numPols());
+    chunksConfig.executorTraceFillThreads = zkmax(config.executorTraceFillThreads, 4);
+    arithExecutor.execute(list, cmPols.Arith);
+    uint64_t chunksHash = CommitPolsHash(fr, cmPols.Arith.x1[0], ArithCommitPols::numPols());
+
+    free(pAddress);
+
+    numberOfErrors += CommitPolsCompare("ArithSMChunksTest", chunksHash, serialHash);
+
+    return numberOfErrors;
+}
+
 void ArithSMTest (Goldilocks &fr, Config &config)
 {
     //ArithExecutor arithExecutor(fr, config);
@@ -5,5 +5,6 @@
 #include "config.hpp"
 
 void ArithSMTest (Goldilocks &fr, Config &config);
+uint64_t ArithSMChunksTest (Goldilocks &fr, const Config &config);
 
 #endif
\ No newline at end of file
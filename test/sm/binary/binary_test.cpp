@@ -2,9 +2,64 @@
 #include "binary_test.hpp"
 #include "binary_action.hpp"
 #include "binary_executor.hpp"
+#include "binary_defines.hpp"
+#include "commit_pols_test.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
 
 using namespace std;
 
+// Number of random actions used by the trace fill chunks test, half of the Binary SM capacity
+#define BINARY_CHUNKS_TEST_ACTIONS (BinaryCommitPols::pilDegree()/LATCH_SIZE/2)
+
+// Fills the Binary commit pols with random actions, first serially and then by row ranges in parallel, and
+// checks that both traces are identical
+uint64_t BinarySMChunksTest (Goldilocks &fr, const Config &config)
+{
+    uint64_t numberOfErrors = 0;
+
+    // Use a copy of the configuration to change the number of trace fill threads of the same executor
+    Config chunksConfig = config;
+    BinaryExecutor binaryExecutor(fr, chunksConfig);
+
+    gmp_randclass randomGenerator(gmp_randinit_default);
+    randomGenerator.seed(0xB1AB1);
+    vector<BinaryAction> list;
+    BinaryAction action;
+    for (uint64_t i = 0; i < BINARY_CHUNKS_TEST_ACTIONS; i++)
+    {
+        action.opcode = mpz_class(randomGenerator.get_z_range(9)).get_ui();
+        action.a = randomGenerator.get_z_bits(256);
+        action.b = randomGenerator.get_z_bits(256);
+        action.c = randomGenerator.get_z_bits(256);
+        action.type = 1;
+        list.push_back(action);
+    }
+
+    void * pAddress = calloc(CommitPols::pilSize(), 1);
+    if (pAddress == NULL)
+    {
+        zklog.error("BinarySMChunksTest() failed calling calloc() of size=" + to_string(CommitPols::pilSize()));
+        return 1;
+    }
+    CommitPols cmPols(pAddress, CommitPols::pilDegree());
+
+    chunksConfig.executorTraceFillThreads = 1;
+    binaryExecutor.execute(list, cmPols.Binary);
+    uint64_t serialHash = CommitPolsHash(fr, cmPols.Binary.opcode, BinaryCommitPols::numPols());
+
+    CommitPolsClear(fr, cmPols.Binary.opcode, BinaryCommitPols::numPols());
+    chunksConfig.executorTraceFillThreads = zkmax(config.executorTraceFillThreads, 4);
+    binaryExecutor.execute(list, cmPols.Binary);
+    uint64_t chunksHash = CommitPolsHash(fr, cmPols.Binary.opcode, BinaryCommitPols::numPols());
+
+    free(pAddress);
+
+    numberOfErrors += CommitPolsCompare("BinarySMChunksTest", chunksHash, serialHash);
+
+    return numberOfErrors;
+}
+
 uint64_t BinarySMTest (Goldilocks &fr, const Config &config)
 {
     uint64_t numberOfErrors = 0;
@@ -293,5 +348,7 @@ uint64_t BinarySMTest (Goldilocks &fr, const Config &config)
 
     binaryExecutor.execute(list);
 
+    numberOfErrors += BinarySMChunksTest(fr, config);
+
     return numberOfErrors;
 }
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include <iostream>
+#include <cstring>
 #include "storage_test.hpp"
 #include "storage_executor.hpp"
 #include "goldilocks_base_field.hpp"
@@ -7,6 +8,9 @@
 #include "smt_action_list.hpp"
 #include "scalar.hpp"
 #include "zkassert.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+#include "commit_pols_test.hpp"
 
 using namespace std;
 
@@ -27,6 +31,7 @@ uint64_t StorageSMTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Conf
     StorageSM_ZeroToZeroTest(fr, poseidon, config);
     StorageSM_EmptyTest(fr, poseidon, config);
     StorageSM_UseCaseTest(fr, poseidon, config);
+    numberOfErrors += StorageSM_ChunksTest(fr, poseidon, config);
 
     cout << "StorageSMTest done" << endl;
     return numberOfErrors;
@@ -927,4 +932,97 @@ void StorageSM_GetZeroTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const
     storageExecutor.execute(actionList.action);
 
     cout << "StorageSM_GetZeroTest done" << endl;
-};
\ No newline at end of file
+};
+
+// Executes the same SMT actions in a single pass and split into chunks, and checks that both traces and both
+// lists of required PoseidonG and ClimbKey data are identical
+uint64_t StorageSM_ChunksTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config)
+{
+    cout << "StorageSM_ChunksTest starting..." << endl;
+    uint64_t numberOfErrors = 0;
+
+    string uuid = getUUID();
+    Smt smt(fr);
+    Database db(fr, config);
+    db.init();
+    SmtActionList actionList;
+    SmtSetResult setResult;
+    SmtGetResult getResult;
+    Goldilocks::Element root[4]={0,0,0,0};
+    Goldilocks::Element key[4];
+    mpz_class keyScalar;
+    mpz_class value;
+
+    // Insert, update, read and delete keys, so that there are enough actions of every mode for several chunks
+    for (uint64_t i=0; i<256; i++)
+    {
+        keyScalar = (i%64) + 1;
+        scalar2key(fr, keyScalar, key);
+        value = (i < 192) ? i + 1 : 0;
+        smt.set(uuid, 0, 0, db, root, key, value, PERSISTENCE_CACHE, setResult);
+        actionList.addSetAction(setResult);
+        for (uint64_t j=0; j<4; j++) root[j] = setResult.newRoot[j];
+
+        smt.get(uuid, db, root, key, getResult);
+        actionList.addGetAction(getResult);
+    }
+
+    void * pAddress = calloc(CommitPols::pilSize(), 1);
+    if (pAddress == NULL)
+    {
+        zklog.error("StorageSM_ChunksTest() failed calling calloc() of size=" + to_string(CommitPols::pilSize()));
+        return 1;
+    }
+    CommitPols cmPols(pAddress, CommitPols::pilDegree());
+
+    // Use a copy of the configuration to change the number of chunks of the same executor
+    Config chunksConfig = config;
+    StorageExecutor storageExecutor(fr, poseidon, chunksConfig);
+
+    chunksConfig.executorTraceFillThreads = 1;
+    vector<array<Goldilocks::Element, 17>> sequentialPoseidonRequired;
+    vector<ClimbKeyAction> sequentialClimbKeyRequired;
+    storageExecutor.execute(actionList.action, cmPols.Storage, sequentialPoseidonRequired, sequentialClimbKeyRequired);
+    uint64_t sequentialHash = CommitPolsHash(fr, cmPols.Storage.free0, StorageCommitPols::numPols());
+
+    memset(pAddress, 0, CommitPols::pilSize());
+    chunksConfig.executorTraceFillThreads = zkmax(config.executorTraceFillThreads, 4);
+    vector<array<Goldilocks::Element, 17>> chunksPoseidonRequired;
+    vector<ClimbKeyAction> chunksClimbKeyRequired;
+    storageExecutor.execute(actionList.action, cmPols.Storage, chunksPoseidonRequired, chunksClimbKeyRequired);
+    uint64_t chunksHash = CommitPolsHash(fr, cmPols.Storage.free0, StorageCommitPols::numPols());
+
+    free(pAddress);
+
+    numberOfErrors += CommitPolsCompare("StorageSM_ChunksTest", chunksHash, sequentialHash);
+    bool bPoseidonEqual = (chunksPoseidonRequired.size() == sequentialPoseidonRequired.size());
+    for (uint64_t i=0; bPoseidonEqual && (i<chunksPoseidonRequired.size()); i++)
+    {
+        for (uint64_t j=0; j<17; j++)
+        {
+            bPoseidonEqual = bPoseidonEqual && fr.equal(chunksPoseidonRequired[i][j], sequentialPoseidonRequired[i][j]);
+        }
+    }
+    if (!bPoseidonEqual)
+    {
+        zklog.error("StorageSM_ChunksTest() the chunks PoseidonG required data does not match the sequential one");
+        numberOfErrors++;
+    }
+    bool bClimbKeyEqual = (chunksClimbKeyRequired.size() == sequentialClimbKeyRequired.size());
+    for (uint64_t i=0; bClimbKeyEqual && (i<chunksClimbKeyRequired.size()); i++)
+    {
+        bClimbKeyEqual = (chunksClimbKeyRequired[i].level == sequentialClimbKeyRequired[i].level) && (chunksClimbKeyRequired[i].bit == sequentialClimbKeyRequired[i].bit);
+        for (uint64_t j=0; j<4; j++)
+        {
+            bClimbKeyEqual = bClimbKeyEqual && fr.equal(chunksClimbKeyRequired[i].key[j], sequentialClimbKeyRequired[i].key[j]);
+        }
+    }
+    if (!bClimbKeyEqual)
+    {
+        zklog.error("StorageSM_ChunksTest() the chunks ClimbKey required data does not match the sequential one");
+        numberOfErrors++;
+    }
+
+    cout << "StorageSM_ChunksTest done" << endl;
+    return numberOfErrors;
+}
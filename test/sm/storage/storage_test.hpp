@@ -6,5 +6,6 @@
 #include "poseidon_goldilocks.hpp"
 
 uint64_t StorageSMTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
+uint64_t StorageSM_ChunksTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config);
 
 #endif
\ No newline at end of file
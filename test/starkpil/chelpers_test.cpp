@@ -0,0 +1,286 @@
+#include <sys/mman.h>
+#include <random>
+#include <functional>
+#include "chelpers_test.hpp"
+#include "chelpers_steps.hpp"
+#include "zkevmSteps.hpp"
+#include "utils.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+// Number of rows of the extended domain evaluated by the test, a multiple of CHELPERS_NROWS_BATCH
+#define CHELPERS_TEST_NUMBER_OF_ROWS (1 << 14)
+
+// Maps a buffer of size bytes that only takes memory when its pages are written
+static Goldilocks::Element * chelpersTestMap (uint64_t size)
+{
+    void *pAddress = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+    if (pAddress == MAP_FAILED)
+    {
+        zklog.error("ChelpersTest() failed calling mmap() of size=" + to_string(size));
+        exitProcess();
+    }
+    return (Goldilocks::Element *)pAddress;
+}
+
+static void chelpersTestRandom (std::mt19937_64 &rng, Goldilocks::Element *pAddress, uint64_t size)
+{
+    for (uint64_t i = 0; i < size; i++)
+    {
+        pAddress[i] = Goldilocks::fromU64(rng());
+    }
+}
+
+// Runs a step with the generated and the circuit-agnostic chelpers, and compares their results
+static uint64_t chelpersTestStep (const string &name, Goldilocks::Element *pGenerated, Goldilocks::Element *pChelpers, uint64_t size, std::function<void()> generated, std::function<void()> chelpers)
+{
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    generated();
+    uint64_t generatedTime = TimeDiff(t);
+    gettimeofday(&t, NULL);
+    chelpers();
+    uint64_t chelpersTime = TimeDiff(t);
+
+    zklog.info("ChelpersTest() " + name + " generated=" + to_string(generatedTime) + "us chelpers=" + to_string(chelpersTime) + "us ratio=" + to_string(double(chelpersTime) / double(zkmax(generatedTime, 1))));
+
+    for (uint64_t i = 0; i < size; i++)
+    {
+        if (!Goldilocks::equal(pGenerated[i], pChelpers[i]))
+        {
+            zklog.error("ChelpersTest() " + name + " found different results at element=" + to_string(i) + " generated=" + Goldilocks::toString(pGenerated[i]) + " chelpers=" + Goldilocks::toString(pChelpers[i]));
+            return 1;
+        }
+    }
+    return 0;
+}
+
+// Returns a step reference of a type, with an id, a prime flag or a number value
+static StepType chelpersTestRef (StepType::eType type, uint64_t id = 0, bool prime = false, const string &value = "")
+{
+    StepType ref;
+    ref.type = type;
+    ref.id = id;
+    ref.prime = prime;
+    ref.p = 0;
+    ref.value = value;
+    return ref;
+}
+
+static void chelpersTestOperation (Step &step, StepOperation::eOperation op, const StepType &dest, const StepType &src0, const StepType &src1)
+{
+    StepOperation operation;
+    operation.op = op;
+    operation.dest = dest;
+    operation.src.push_back(src0);
+    if (op != StepOperation::copy) operation.src.push_back(src1);
+    step.first.push_back(operation);
+}
+
+uint64_t ChelpersSyntheticTest (const Config &config)
+{
+    uint64_t numberOfFailedTests = 0;
+
+    // A starkinfo of 16 rows and one section of 4 columns: cm 0 is a base field column and cm 1 an extension one
+    Config syntheticConfig = config;
+    syntheticConfig.runFileGenBatchProof = false;
+    syntheticConfig.runFileGenAggregatedProof = false;
+    syntheticConfig.runFileGenFinalProof = false;
+    syntheticConfig.runAggregatorClient = false;
+    StarkInfo starkInfo(syntheticConfig, "");
+    starkInfo.starkStruct.nBits = 4;
+    starkInfo.starkStruct.nBitsExt = 5;
+    for (uint64_t s = 0; s < eSectionMax; s++)
+    {
+        starkInfo.mapOffsets.section[s] = 0;
+        starkInfo.mapSectionsN.section[s] = 0;
+    }
+    starkInfo.mapSectionsN.section[cm1_n] = 4;
+    starkInfo.varPolMap.resize(2);
+    starkInfo.varPolMap[0].section = cm1_n;
+    starkInfo.varPolMap[0].dim = 1;
+    starkInfo.varPolMap[0].sectionPos = 0;
+    starkInfo.varPolMap[1].section = cm1_n;
+    starkInfo.varPolMap[1].dim = 3;
+    starkInfo.varPolMap[1].sectionPos = 1;
+    starkInfo.cm_n = { 0, 1 };
+    const uint64_t N = 1ULL << starkInfo.starkStruct.nBits;
+
+    // cm1 = (((cm0 * challenge0 - eval1) * ((cm0' + public0) * x)) + 7) * (cm0 + 2), with a dead write of tmp1 that
+    // is its last read, so that its slot must be reused by tmp4
+    Step step;
+    step.tmpUsed = 6;
+    const StepType none = chelpersTestRef(StepType::number, 0, false, "0");
+    chelpersTestOperation(step, StepOperation::mul, chelpersTestRef(StepType::tmp, 0), chelpersTestRef(StepType::cm, 0), chelpersTestRef(StepType::challenge, 0));
+    chelpersTestOperation(step, StepOperation::add, chelpersTestRef(StepType::tmp, 1), chelpersTestRef(StepType::cm, 0, true), chelpersTestRef(StepType::_public, 0));
+    chelpersTestOperation(step, StepOperation::mul, chelpersTestRef(StepType::tmp, 1), chelpersTestRef(StepType::tmp, 1), chelpersTestRef(StepType::x));
+    chelpersTestOperation(step, StepOperation::sub, chelpersTestRef(StepType::tmp, 2), chelpersTestRef(StepType::tmp, 0), chelpersTestRef(StepType::eval, 1));
+    chelpersTestOperation(step, StepOperation::mul, chelpersTestRef(StepType::tmp, 2), chelpersTestRef(StepType::tmp, 2), chelpersTestRef(StepType::tmp, 1));
+    chelpersTestOperation(step, StepOperation::add, chelpersTestRef(StepType::tmp, 3), chelpersTestRef(StepType::tmp, 2), chelpersTestRef(StepType::number, 0, false, "7"));
+    chelpersTestOperation(step, StepOperation::add, chelpersTestRef(StepType::tmp, 1), chelpersTestRef(StepType::tmp, 1), chelpersTestRef(StepType::number, 0, false, "1"));
+    chelpersTestOperation(step, StepOperation::add, chelpersTestRef(StepType::tmp, 4), chelpersTestRef(StepType::cm, 0), chelpersTestRef(StepType::number, 0, false, "2"));
+    chelpersTestOperation(step, StepOperation::mul, chelpersTestRef(StepType::tmp, 5), chelpersTestRef(StepType::tmp, 3), chelpersTestRef(StepType::tmp, 4));
+    chelpersTestOperation(step, StepOperation::copy, chelpersTestRef(StepType::cm, 1), chelpersTestRef(StepType::tmp, 5), none);
+
+    ChelpersStepProgram stepProgram;
+    if (!stepProgram.compile(starkInfo, step, false, "synthetic"))
+    {
+        zklog.error("ChelpersSyntheticTest() failed compiling the synthetic program");
+        return 1;
+    }
+    if ((stepProgram.nTemp1 != 1) || (stepProgram.nTemp3 != 1))
+    {
+        zklog.error("ChelpersSyntheticTest() got nTemp1=" + to_string(stepProgram.nTemp1) + " nTemp3=" + to_string(stepProgram.nTemp3) + " instead of 1 and 1");
+        numberOfFailedTests++;
+    }
+
+    std::mt19937_64 rng(0);
+    vector<Goldilocks::Element> rowPols(N * 4), batchPols(N * 4);
+    chelpersTestRandom(rng, rowPols.data(), rowPols.size());
+    batchPols = rowPols;
+    vector<Goldilocks::Element> constPols(N, Goldilocks::zero());
+    ConstantPolsStarks pConstPols(constPols.data(), N, 1);
+    Polinomial challenges(NUM_CHALLENGES, FIELD_EXTENSION);
+    Polinomial evals(2, FIELD_EXTENSION);
+    Polinomial x_n(N, 1);
+    Polinomial xDivXSub(1, FIELD_EXTENSION);
+    chelpersTestRandom(rng, challenges.address(), challenges.length());
+    chelpersTestRandom(rng, evals.address(), evals.length());
+    chelpersTestRandom(rng, x_n.address(), x_n.length());
+    ZhInv zi;
+    Goldilocks::Element publicInputs[1];
+    chelpersTestRandom(rng, publicInputs, 1);
+
+    StepsParams rowParams = { rowPols.data(), &pConstPols, &pConstPols, challenges, x_n, x_n, zi, evals, xDivXSub, xDivXSub, publicInputs, NULL, NULL };
+    StepsParams batchParams = { batchPols.data(), &pConstPols, &pConstPols, challenges, x_n, x_n, zi, evals, xDivXSub, xDivXSub, publicInputs, NULL, NULL };
+    for (uint64_t i = 0; i < N; i++)
+    {
+        ChelpersSteps::evaluateRow(stepProgram, rowParams, i);
+    }
+#ifdef __AVX512__
+    ChelpersSteps::evaluateAvx512(stepProgram, batchParams, N);
+#else
+    ChelpersSteps::evaluateAvx(stepProgram, batchParams, N);
+#endif
+
+    for (uint64_t i = 0; i < N; i++)
+    {
+        Goldilocks::Element a = rowPols[i * 4];
+        Goldilocks::Element aNext = rowPols[((i + 1) % N) * 4];
+        Goldilocks::Element t1 = Goldilocks::mul(Goldilocks::add(aNext, publicInputs[0]), *x_n[i]);
+        Goldilocks::Element t4 = Goldilocks::add(a, Goldilocks::fromU64(2));
+        for (uint64_t d = 0; d < 3; d++)
+        {
+            Goldilocks::Element t = Goldilocks::mul(Goldilocks::sub(Goldilocks::mul(a, challenges[0][d]), evals[1][d]), t1);
+            if (d == 0) t = Goldilocks::add(t, Goldilocks::fromU64(7));
+            Goldilocks::Element expected = Goldilocks::mul(t, t4);
+            if (!Goldilocks::equal(rowPols[i * 4 + 1 + d], expected) || !Goldilocks::equal(batchPols[i * 4 + 1 + d], expected))
+            {
+                zklog.error("ChelpersSyntheticTest() found a wrong result at row=" + to_string(i) + " dim=" + to_string(d) + " expected=" + Goldilocks::toString(expected) +
+                    " row=" + Goldilocks::toString(rowPols[i * 4 + 1 + d]) + " batch=" + Goldilocks::toString(batchPols[i * 4 + 1 + d]));
+                return numberOfFailedTests + 1;
+            }
+        }
+    }
+
+    return numberOfFailedTests;
+}
+
+uint64_t ChelpersTest (const Config &config)
+{
+    TimerStart(CHELPERS_TEST);
+
+    uint64_t numberOfFailedTests = ChelpersSyntheticTest(config);
+
+    // The constructor only loads the file if the configuration generates proofs
+    StarkInfo starkInfo(config, config.zkevmStarkInfo);
+    if (!config.generateProof())
+    {
+        json starkInfoJson;
+        file2json(config.zkevmStarkInfo, starkInfoJson);
+        starkInfo.load(starkInfoJson);
+    }
+
+    ChelpersSteps chelpersSteps;
+    if (!chelpersSteps.load(ChelpersProgram::getFileName(config.zkevmStarkInfo), starkInfo))
+    {
+        zklog.error("ChelpersTest() failed loading the chelpers program; run runChelpersCompiler first");
+        return 1;
+    }
+    ZkevmSteps zkevmSteps;
+
+    uint64_t N = 1ULL << starkInfo.starkStruct.nBits;
+    uint64_t NExtended = 1ULL << starkInfo.starkStruct.nBitsExt;
+    uint64_t nrows = zkmin(uint64_t(CHELPERS_TEST_NUMBER_OF_ROWS), NExtended);
+    uint64_t nextExtended = 1ULL << (starkInfo.starkStruct.nBitsExt - starkInfo.starkStruct.nBits);
+
+    zklog.info("ChelpersTest() nrows=" + to_string(nrows) + " of NExtended=" + to_string(NExtended));
+
+    // Fill with random values only the rows that are read, so that only them take memory
+    std::mt19937_64 rng(0);
+    Goldilocks::Element *pols = chelpersTestMap(starkInfo.mapTotalN * sizeof(Goldilocks::Element));
+    for (uint64_t s = 0; s < eSectionMax; s++)
+    {
+        uint64_t stride = starkInfo.mapSectionsN.section[s];
+        uint64_t rows = zkmin(nrows + nextExtended, starkInfo.mapDeg.section[s]);
+        chelpersTestRandom(rng, pols + starkInfo.mapOffsets.section[s], rows * stride);
+    }
+    Goldilocks::Element *constPols = chelpersTestMap(N * starkInfo.nConstants * sizeof(Goldilocks::Element));
+    chelpersTestRandom(rng, constPols, zkmin(nrows + 1, N) * starkInfo.nConstants);
+    Goldilocks::Element *constPols2ns = chelpersTestMap(NExtended * starkInfo.nConstants * sizeof(Goldilocks::Element));
+    chelpersTestRandom(rng, constPols2ns, (nrows + nextExtended) * starkInfo.nConstants);
+    ConstantPolsStarks pConstPols(constPols, N, starkInfo.nConstants);
+    ConstantPolsStarks pConstPols2ns(constPols2ns, NExtended, starkInfo.nConstants);
+
+    Polinomial challenges(NUM_CHALLENGES, FIELD_EXTENSION);
+    Polinomial evals(starkInfo.evMap.size(), FIELD_EXTENSION);
+    Polinomial x_n(nrows, 1);
+    Polinomial x_2ns(nrows, 1);
+    Polinomial xDivXSubXi(nrows, FIELD_EXTENSION);
+    Polinomial xDivXSubWXi(nrows, FIELD_EXTENSION);
+    chelpersTestRandom(rng, challenges.address(), challenges.length());
+    chelpersTestRandom(rng, evals.address(), evals.length());
+    chelpersTestRandom(rng, x_n.address(), x_n.length());
+    chelpersTestRandom(rng, x_2ns.address(), x_2ns.length());
+    chelpersTestRandom(rng, xDivXSubXi.address(), xDivXSubXi.length());
+    chelpersTestRandom(rng, xDivXSubWXi.address(), xDivXSubWXi.length());
+    ZhInv zi(starkInfo.starkStruct.nBits, starkInfo.starkStruct.nBitsExt);
+    vector<Goldilocks::Element> publicInputs(starkInfo.nPublics);
+    chelpersTestRandom(rng, publicInputs.data(), publicInputs.size());
+
+    // Every implementation writes its own q and f results
+    vector<Goldilocks::Element> generatedQ(nrows * starkInfo.qDim), chelpersQ(nrows * starkInfo.qDim);
+    vector<Goldilocks::Element> generatedF(nrows * FIELD_EXTENSION), chelpersF(nrows * FIELD_EXTENSION);
+    StepsParams generatedParams = { pols, &pConstPols, &pConstPols2ns, challenges, x_n, x_2ns, zi, evals, xDivXSubXi, xDivXSubWXi, publicInputs.data(), generatedQ.data(), generatedF.data() };
+    StepsParams chelpersParams = { pols, &pConstPols, &pConstPols2ns, challenges, x_n, x_2ns, zi, evals, xDivXSubXi, xDivXSubWXi, publicInputs.data(), chelpersQ.data(), chelpersF.data() };
+
+#ifdef __AVX512__
+    numberOfFailedTests += chelpersTestStep("step42ns", generatedQ.data(), chelpersQ.data(), generatedQ.size(),
+        [&]() { zkevmSteps.step42ns_parser_first_avx512(generatedParams, nrows, CHELPERS_NROWS_BATCH); },
+        [&]() { chelpersSteps.step42ns_parser_first_avx512(chelpersParams, nrows, CHELPERS_NROWS_BATCH); });
+    numberOfFailedTests += chelpersTestStep("step52ns", generatedF.data(), chelpersF.data(), generatedF.size(),
+        [&]() { zkevmSteps.step52ns_parser_first_avx512(generatedParams, nrows, CHELPERS_NROWS_BATCH); },
+        [&]() { chelpersSteps.step52ns_parser_first_avx512(chelpersParams, nrows, CHELPERS_NROWS_BATCH); });
+#else
+    numberOfFailedTests += chelpersTestStep("step42ns", generatedQ.data(), chelpersQ.data(), generatedQ.size(),
+        [&]() { zkevmSteps.step42ns_parser_first_avx(generatedParams, nrows, CHELPERS_NROWS_BATCH); },
+        [&]() { chelpersSteps.step42ns_parser_first_avx(chelpersParams, nrows, CHELPERS_NROWS_BATCH); });
+    numberOfFailedTests += chelpersTestStep("step52ns", generatedF.data(), chelpersF.data(), generatedF.size(),
+        [&]() { zkevmSteps.step52ns_parser_first_avx(generatedParams, nrows, CHELPERS_NROWS_BATCH); },
+        [&]() { chelpersSteps.step52ns_parser_first_avx(chelpersParams, nrows, CHELPERS_NROWS_BATCH); });
+#endif
+
+    munmap(pols, starkInfo.mapTotalN * sizeof(Goldilocks::Element));
+    munmap(constPols, N * starkInfo.nConstants * sizeof(Goldilocks::Element));
+    munmap(constPols2ns, NExtended * starkInfo.nConstants * sizeof(Goldilocks::Element));
+
+    if (numberOfFailedTests == 0)
+    {
+        zklog.info("ChelpersTest() succeeded");
+    }
+
+    TimerStopAndLog(CHELPERS_TEST);
+
+    return numberOfFailedTests;
+}
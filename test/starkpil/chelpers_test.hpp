@@ -0,0 +1,12 @@
+#ifndef CHELPERS_TEST_HPP
+#define CHELPERS_TEST_HPP
+
+#include <cstdint>
+#include "config.hpp"
+
+uint64_t ChelpersTest (const Config &config);
+
+// Evaluates a small hand-built program, which does not need any circuit file
+uint64_t ChelpersSyntheticTest (const Config &config);
+
+#endif
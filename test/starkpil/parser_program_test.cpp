@@ -0,0 +1,116 @@
+#include <vector>
+#include "parser_program_test.hpp"
+#include "parser_program.hpp"
+#include "zklog.hpp"
+
+using namespace std;
+
+// Checks a program against the expected operations, arguments and number of tmp1 slots
+static uint64_t parserProgramTestCompare (const string &name, const ParserProgram &program, const vector<uint64_t> &ops, const vector<uint64_t> &args, uint64_t nTemp1)
+{
+    if ((program.ops != ops) || (program.args != args) || (program.nTemp1 != nTemp1))
+    {
+        zklog.error("ParserProgramTest() " + name + " got ops=" + to_string(program.ops.size()) + " args=" + to_string(program.args.size()) +
+            " nTemp1=" + to_string(program.nTemp1) + " but expected ops=" + to_string(ops.size()) + " args=" + to_string(args.size()) + " nTemp1=" + to_string(nTemp1));
+        return 1;
+    }
+    return 0;
+}
+
+uint64_t ParserProgramTest (void)
+{
+    uint64_t numberOfFailed = 0;
+
+    // Instruction set: tmp1 = tmp1 + tmp1, tmp1 = constant, store tmp1, and a load-and-add superinstruction
+    ParserIsa isa;
+    isa.name = "test";
+    isa.addOp(0, "W1 R1 R1");
+    isa.addOp(1, "W1 X");
+    isa.addOp(2, "R1 X");
+    isa.addSuperOp(3, {1, 0});
+
+    // store((c10 + c11) + c13), with a load of c12 into slot 5 that is never read
+    const uint64_t ops[] = { 1, 1, 1, 0, 1, 0, 2 };
+    const uint64_t args[] = {
+        0, 10,
+        1, 11,
+        5, 12,
+        2, 0, 1,
+        3, 13,
+        4, 2, 3,
+        4, 0 };
+    ParserProgram source;
+    source.set(ops, sizeof(ops)/sizeof(ops[0]), args, sizeof(args)/sizeof(args[0]), 6, 0);
+    if (!source.check(isa))
+    {
+        zklog.error("ParserProgramTest() failed checking the source program");
+        return 1;
+    }
+
+    // Dead code removal drops the load of c12 and nothing else
+    ParserProgram program = source;
+    uint64_t nDead = program.eliminateDeadOps(isa);
+    if (nDead != 1)
+    {
+        zklog.error("ParserProgramTest() eliminateDeadOps() removed " + to_string(nDead) + " ops instead of 1");
+        numberOfFailed++;
+    }
+    numberOfFailed += parserProgramTestCompare("eliminateDeadOps()", program,
+        { 1, 1, 0, 1, 0, 2 },
+        { 0, 10, 1, 11, 2, 0, 1, 3, 13, 4, 2, 3, 4, 0 }, 6);
+
+    // The slots are renamed so that a result never aliases its operands, and freed slots are reused last-in first-out
+    program.allocateTemps(isa);
+    numberOfFailed += parserProgramTestCompare("allocateTemps()", program,
+        { 1, 1, 0, 1, 0, 2 },
+        { 0, 10, 1, 11, 2, 0, 1, 1, 13, 0, 2, 1, 0, 0 }, 3);
+
+    // Every load followed by an add is folded into one superinstruction that consumes the operands of both
+    uint64_t nFused = program.fuse(isa);
+    if (nFused != 2)
+    {
+        zklog.error("ParserProgramTest() fuse() created " + to_string(nFused) + " superinstructions instead of 2");
+        numberOfFailed++;
+    }
+    numberOfFailed += parserProgramTestCompare("fuse()", program,
+        { 1, 3, 3, 2 },
+        { 0, 10, 1, 11, 2, 0, 1, 1, 13, 0, 2, 1, 0, 0 }, 3);
+
+    // optimize() runs the same passes and checks the result
+    ParserProgram optimized = source;
+    if (!optimized.optimize(isa) || !optimized.check(isa))
+    {
+        zklog.error("ParserProgramTest() optimize() failed");
+        numberOfFailed++;
+    }
+    numberOfFailed += parserProgramTestCompare("optimize()", optimized, program.ops, program.args, program.nTemp1);
+    if (optimized.sourceHash != source.hash())
+    {
+        zklog.error("ParserProgramTest() optimize() did not record the hash of the source program");
+        numberOfFailed++;
+    }
+
+    // Expanding the superinstructions gives back the simple operations
+    ParserProgram expanded = optimized;
+    expanded.expand(isa);
+    if ((expanded.ops != vector<uint64_t>({ 1, 1, 0, 1, 0, 2 })) || !expanded.check(isa) || !expanded.equivalent(source, isa))
+    {
+        zklog.error("ParserProgramTest() expand() did not give back the simple operations");
+        numberOfFailed++;
+    }
+
+    // A program that stores a different value is not equivalent
+    ParserProgram different = optimized;
+    different.args[3] = 12;
+    if (different.equivalent(source, isa))
+    {
+        zklog.error("ParserProgramTest() equivalent() did not detect a different constant");
+        numberOfFailed++;
+    }
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("ParserProgramTest() failed " + to_string(numberOfFailed) + " checks");
+    }
+    return numberOfFailed;
+}
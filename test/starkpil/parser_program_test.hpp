@@ -0,0 +1,8 @@
+#ifndef PARSER_PROGRAM_TEST_HPP
+#define PARSER_PROGRAM_TEST_HPP
+
+#include <stdint.h>
+
+uint64_t ParserProgramTest (void);
+
+#endif
@@ -5,13 +5,20 @@
 #include "sha256_test.hpp"
 #include "mem_align_test.hpp"
 #include "binary_test.hpp"
+#include "arith_test.hpp"
 #include "storage_test.hpp"
 #include "climb_key_test.hpp"
 #include "keccak_executor_test.hpp"
 #include "get_string_increment_test.hpp"
 #include "database_cache_test.hpp"
 #include "hashdb_test.hpp"
+#include "state_manager_test.hpp"
 #include "key_utils_unit_tests.hpp"
+#include "task_graph_test.hpp"
+#include "paged_map_test.hpp"
+#include "parser_program_test.hpp"
+#include "chelpers_test.hpp"
+#include "u256_test.hpp"
 
 
 uint64_t UnitTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &config)
@@ -36,10 +43,18 @@ uint64_t UnitTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &c
     numberOfErrors += BinarySMTest(fr, config);
     TimerStopAndLog(UNIT_TEST_BINARY);
 
+    TimerStart(UNIT_TEST_ARITH_CHUNKS);
+    numberOfErrors += ArithSMChunksTest(fr, config);
+    TimerStopAndLog(UNIT_TEST_ARITH_CHUNKS);
+
     //TimerStart(UNIT_TEST_STORAGESM);
     //numberOfErrors += StorageSMTest(fr, poseidon, config);
     //TimerStopAndLog(UNIT_TEST_STORAGESM);
 
+    TimerStart(UNIT_TEST_STORAGESM_CHUNKS);
+    numberOfErrors += StorageSM_ChunksTest(fr, poseidon, config);
+    TimerStopAndLog(UNIT_TEST_STORAGESM_CHUNKS);
+
     //TimerStart(UNIT_TEST_CLIMBKEYSM);
     //numberOfErrors += ClimbKeySMTest(fr, config);
     //TimerStopAndLog(UNIT_TEST_CLIMBKEYSM);
@@ -52,6 +67,26 @@ uint64_t UnitTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &c
     numberOfErrors += GetStringIncrementTest();
     TimerStopAndLog(UNIT_TEST_GET_STRING_INCREMENT);
 
+    TimerStart(UNIT_TEST_TASK_GRAPH);
+    numberOfErrors += TaskGraphTest();
+    TimerStopAndLog(UNIT_TEST_TASK_GRAPH);
+
+    TimerStart(UNIT_TEST_PAGED_MAP);
+    numberOfErrors += PagedMapTest();
+    TimerStopAndLog(UNIT_TEST_PAGED_MAP);
+
+    TimerStart(UNIT_TEST_PARSER_PROGRAM);
+    numberOfErrors += ParserProgramTest();
+    TimerStopAndLog(UNIT_TEST_PARSER_PROGRAM);
+
+    TimerStart(UNIT_TEST_CHELPERS);
+    numberOfErrors += ChelpersSyntheticTest(config);
+    TimerStopAndLog(UNIT_TEST_CHELPERS);
+
+    TimerStart(UNIT_TEST_U256);
+    numberOfErrors += U256Test();
+    TimerStopAndLog(UNIT_TEST_U256);
+
     TimerStart(UNIT_TEST_DATABASE_CACHE);
     numberOfErrors += DatabaseCacheTest();
     TimerStopAndLog(UNIT_TEST_DATABASE_CACHE);
@@ -60,6 +95,10 @@ uint64_t UnitTest (Goldilocks &fr, PoseidonGoldilocks &poseidon, const Config &c
     numberOfErrors += HashDBTest(config);
     TimerStopAndLog(UNIT_TEST_HASH_DB);
 
+    TimerStart(UNIT_TEST_STATE_MANAGER);
+    numberOfErrors += StateManagerTest(config);
+    TimerStopAndLog(UNIT_TEST_STATE_MANAGER);
+
     TimerStart(SPLITKEY9_UNIT_TEST);
     splitKey9Test();
     TimerStopAndLog(SPLITKEY9_UNIT_TEST);
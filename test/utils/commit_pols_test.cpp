@@ -0,0 +1,12 @@
+#include "commit_pols_test.hpp"
+#include "zklog.hpp"
+
+uint64_t CommitPolsCompare (const string &testName, uint64_t hash, uint64_t referenceHash)
+{
+    if (hash != referenceHash)
+    {
+        zklog.error(testName + "() the trace hash=" + to_string(hash) + " does not match the reference trace hash=" + to_string(referenceHash));
+        return 1;
+    }
+    return 0;
+}
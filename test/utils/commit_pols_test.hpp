@@ -0,0 +1,46 @@
+#ifndef COMMIT_POLS_TEST_HPP
+#define COMMIT_POLS_TEST_HPP
+
+#include <string>
+#include "goldilocks_base_field.hpp"
+
+using namespace std;
+
+// Helpers to compare the traces of a state machine filled in different ways, e.g. serially and by chunks.
+// The numPols commit pols of a state machine are contiguous within every row, starting at firstPol.
+
+// Returns a hash of all the evaluations of the commit pols of a state machine
+template <class CommitPolT>
+uint64_t CommitPolsHash (Goldilocks &fr, CommitPolT &firstPol, uint64_t numPols)
+{
+    uint64_t hash = 0;
+    for (uint64_t row = 0; row < firstPol.degree(); row++)
+    {
+        Goldilocks::Element *pRow = &firstPol[row];
+        for (uint64_t col = 0; col < numPols; col++)
+        {
+            hash = (hash ^ fr.toU64(pRow[col])) * 0x100000001B3ULL;
+        }
+    }
+    return hash;
+}
+
+// Zeroes all the evaluations of the commit pols of a state machine, so that a trace fill cannot reuse values of a
+// previous fill
+template <class CommitPolT>
+void CommitPolsClear (Goldilocks &fr, CommitPolT &firstPol, uint64_t numPols)
+{
+    for (uint64_t row = 0; row < firstPol.degree(); row++)
+    {
+        Goldilocks::Element *pRow = &firstPol[row];
+        for (uint64_t col = 0; col < numPols; col++)
+        {
+            pRow[col] = fr.zero();
+        }
+    }
+}
+
+// Logs an error and returns 1 if the trace hash does not match the reference trace hash, or returns 0 otherwise
+uint64_t CommitPolsCompare (const string &testName, uint64_t hash, uint64_t referenceHash);
+
+#endif
@@ -0,0 +1,182 @@
+#include <vector>
+#include <unordered_map>
+#include <random>
+#include "paged_map_test.hpp"
+#include "main_sm/fork_9/main/paged_map.hpp"
+#include "zklog.hpp"
+
+using namespace std;
+
+// Small pages, tables and directory, so that the test crosses all their boundaries and reaches the overflow map:
+// pages of 16 entries, tables of 8 pages, and a directory of 16 tables, i.e. addresses >= 2048 overflow
+#define PAGED_MAP_TEST_PAGE_BITS 4
+#define PAGED_MAP_TEST_TABLE_BITS 3
+#define PAGED_MAP_TEST_DIRECTORY_BITS 4
+#define PAGED_MAP_TEST_LIMIT (1ULL << (PAGED_MAP_TEST_PAGE_BITS + PAGED_MAP_TEST_TABLE_BITS + PAGED_MAP_TEST_DIRECTORY_BITS))
+
+typedef fork_9::PagedMap<uint64_t, PAGED_MAP_TEST_PAGE_BITS, PAGED_MAP_TEST_TABLE_BITS, PAGED_MAP_TEST_DIRECTORY_BITS> TestPagedMap;
+
+// Checks that every address of a list is found, or not found, in both maps, with the same value
+uint64_t PagedMapCompare (TestPagedMap &pagedMap, unordered_map<uint64_t, uint64_t> &reference, const vector<uint64_t> &addresses)
+{
+    uint64_t numberOfFailed = 0;
+    for (uint64_t i=0; i<addresses.size(); i++)
+    {
+        uint64_t addr = addresses[i];
+        TestPagedMap::iterator it = pagedMap.find(addr);
+        unordered_map<uint64_t, uint64_t>::const_iterator referenceIt = reference.find(addr);
+        if (referenceIt == reference.end())
+        {
+            if (it != pagedMap.end())
+            {
+                zklog.error("PagedMapTest() found absent addr=" + to_string(addr) + " value=" + to_string(it->second));
+                numberOfFailed++;
+            }
+            continue;
+        }
+        if (it == pagedMap.end())
+        {
+            zklog.error("PagedMapTest() did not find addr=" + to_string(addr));
+            numberOfFailed++;
+            continue;
+        }
+        if ((it->first != addr) || (it->second != referenceIt->second))
+        {
+            zklog.error("PagedMapTest() found addr=" + to_string(addr) + " with entry addr=" + to_string(it->first) + " value=" + to_string(it->second) + " expected value=" + to_string(referenceIt->second));
+            numberOfFailed++;
+        }
+    }
+    if (pagedMap.size() != reference.size())
+    {
+        zklog.error("PagedMapTest() got size=" + to_string(pagedMap.size()) + " expected=" + to_string(reference.size()));
+        numberOfFailed++;
+    }
+    return numberOfFailed;
+}
+
+uint64_t PagedMapTest (void)
+{
+    uint64_t numberOfFailed = 0;
+
+    TestPagedMap pagedMap;
+    unordered_map<uint64_t, uint64_t> reference;
+
+    // Addresses at both sides of the page, table and directory boundaries, and beyond the directory limit
+    const uint64_t pageSize = 1ULL << PAGED_MAP_TEST_PAGE_BITS;
+    const uint64_t tableSize = pageSize << PAGED_MAP_TEST_TABLE_BITS;
+    const uint64_t limit = PAGED_MAP_TEST_LIMIT;
+    vector<uint64_t> boundaries = {pageSize, 2*pageSize, tableSize, 3*tableSize, limit, 2*limit};
+    vector<uint64_t> addresses;
+    for (uint64_t i=0; i<boundaries.size(); i++)
+    {
+        addresses.push_back(boundaries[i] - 1);
+        addresses.push_back(boundaries[i]);
+        addresses.push_back(boundaries[i] + 1);
+    }
+    addresses.push_back(0);
+    addresses.push_back(1ULL << 40);
+    addresses.push_back(0xFFFFFFFFFFFFFFFFULL);
+
+    // Random addresses, mostly below the directory limit, some of them repeated
+    mt19937_64 randomGenerator(0x9A6ED);
+    for (uint64_t i=0; i<4000; i++)
+    {
+        uint64_t addr = (i % 16 == 0) ? randomGenerator() : randomGenerator() % (limit + 256);
+        addresses.push_back(addr);
+    }
+
+    // Nothing is found before the first access
+    numberOfFailed += PagedMapCompare(pagedMap, reference, addresses);
+
+    // Access half of the addresses: the first access must return a value-initialized value, and later accesses the
+    // last written one; after every step, all the addresses, accessed or not, must be found as in the reference
+    for (uint64_t i=0; i<addresses.size(); i+=2)
+    {
+        uint64_t addr = addresses[i];
+        bool bNew = (reference.find(addr) == reference.end());
+        uint64_t &value = pagedMap[addr];
+        if (bNew && (value != 0))
+        {
+            zklog.error("PagedMapTest() got new addr=" + to_string(addr) + " with value=" + to_string(value) + " instead of 0");
+            numberOfFailed++;
+        }
+        if (!bNew && (value != reference[addr]))
+        {
+            zklog.error("PagedMapTest() got addr=" + to_string(addr) + " with value=" + to_string(value) + " expected=" + to_string(reference[addr]));
+            numberOfFailed++;
+        }
+        value = i + 1;
+        reference[addr] = i + 1;
+        if ((i % 512 == 0) || (i < 64))
+        {
+            numberOfFailed += PagedMapCompare(pagedMap, reference, addresses);
+        }
+    }
+    numberOfFailed += PagedMapCompare(pagedMap, reference, addresses);
+
+    // Entries are never moved, so the entry of an address is the same after many other accesses
+    TestPagedMap::iterator first = pagedMap.find(addresses[0]);
+    for (uint64_t i=1; i<addresses.size(); i+=2)
+    {
+        pagedMap[addresses[i]] = i + 1;
+        reference[addresses[i]] = i + 1;
+    }
+    if (pagedMap.find(addresses[0]) != first)
+    {
+        zklog.error("PagedMapTest() found addr=" + to_string(addresses[0]) + " moved after other accesses");
+        numberOfFailed++;
+    }
+    numberOfFailed += PagedMapCompare(pagedMap, reference, addresses);
+
+    // forEach() visits every accessed address once, with its value, in ascending order below the directory limit
+    unordered_map<uint64_t, uint64_t> visited;
+    uint64_t lastAddr = 0;
+    bool bFirst = true;
+    pagedMap.forEach([&](uint64_t addr, uint64_t value) {
+        if (visited.find(addr) != visited.end())
+        {
+            zklog.error("PagedMapTest() forEach() visited addr=" + to_string(addr) + " twice");
+            numberOfFailed++;
+        }
+        visited[addr] = value;
+        if (addr < limit)
+        {
+            if (!bFirst && (addr <= lastAddr))
+            {
+                zklog.error("PagedMapTest() forEach() visited addr=" + to_string(addr) + " after addr=" + to_string(lastAddr));
+                numberOfFailed++;
+            }
+            lastAddr = addr;
+            bFirst = false;
+        }
+    });
+    if (visited != reference)
+    {
+        zklog.error("PagedMapTest() forEach() visited " + to_string(visited.size()) + " addresses that do not match the " + to_string(reference.size()) + " reference ones");
+        numberOfFailed++;
+    }
+
+    // A copy finds the same addresses and values, and it is independent of the original after new accesses
+    TestPagedMap *pCopy = new TestPagedMap(pagedMap);
+    unordered_map<uint64_t, uint64_t> copyReference = reference;
+    numberOfFailed += PagedMapCompare(*pCopy, copyReference, addresses);
+    for (uint64_t i=0; i<addresses.size(); i+=3)
+    {
+        (*pCopy)[addresses[i]] = 2*i + 1;
+        copyReference[addresses[i]] = 2*i + 1;
+    }
+    numberOfFailed += PagedMapCompare(*pCopy, copyReference, addresses);
+    numberOfFailed += PagedMapCompare(pagedMap, reference, addresses);
+    delete pCopy;
+    numberOfFailed += PagedMapCompare(pagedMap, reference, addresses);
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("PagedMapTest() failed " + to_string(numberOfFailed) + " tests");
+    }
+    else
+    {
+        zklog.info("PagedMapTest() succeeded");
+    }
+    return numberOfFailed;
+}
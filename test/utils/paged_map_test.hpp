@@ -0,0 +1,8 @@
+#ifndef PAGED_MAP_TEST_HPP
+#define PAGED_MAP_TEST_HPP
+
+#include <stdint.h>
+
+uint64_t PagedMapTest (void);
+
+#endif
@@ -0,0 +1,116 @@
+#include <vector>
+#include <atomic>
+#include "task_graph_test.hpp"
+#include "task_graph.hpp"
+#include "zklog.hpp"
+
+using namespace std;
+
+uint64_t TaskGraphTest (void)
+{
+    uint64_t numberOfFailed = 0;
+
+    // Build a graph of chains and joins, where every task records the order in which it was executed
+    const uint64_t nTasks = 64;
+    atomic<uint64_t> counter(0);
+    vector<uint64_t> order(nTasks, 0);
+    vector<vector<uint64_t>> dependencies(nTasks);
+
+    for (uint64_t nThreads=1; nThreads<=8; nThreads*=2)
+    {
+        TaskGraph taskGraph;
+        counter = 0;
+        for (uint64_t i=0; i<nTasks; i++)
+        {
+            dependencies[i].clear();
+            if (i >= 4)
+            {
+                dependencies[i].push_back(i - 4);
+            }
+            if ((i % 8 == 7) && (i >= 8))
+            {
+                dependencies[i].push_back(i - 7);
+            }
+            taskGraph.addTask("task" + to_string(i), [&order, &counter, i]() {
+                order[i] = counter++;
+            }, dependencies[i]);
+        }
+
+        taskGraph.run(nThreads);
+
+        if (counter != nTasks)
+        {
+            zklog.error("TaskGraphTest() failed nThreads=" + to_string(nThreads) + " executed tasks=" + to_string(counter) + " expected=" + to_string(nTasks));
+            numberOfFailed++;
+            continue;
+        }
+
+        for (uint64_t i=0; i<nTasks; i++)
+        {
+            for (uint64_t d=0; d<dependencies[i].size(); d++)
+            {
+                if (order[dependencies[i][d]] >= order[i])
+                {
+                    zklog.error("TaskGraphTest() failed nThreads=" + to_string(nThreads) + " task=" + to_string(i) + " executed before its dependency=" + to_string(dependencies[i][d]));
+                    numberOfFailed++;
+                }
+            }
+        }
+    }
+
+    // Build chains of chunked tasks, where every chunk checks that all the chunks of the previous task of its chain
+    // are done, and counts its executions, so that a chunk executed twice, or never, is detected
+    const uint64_t nChains = 3;
+    const uint64_t nLinks = 4;
+    const uint64_t nChunks = 37;
+    vector<atomic<uint64_t>> executions(nChains * nLinks * nChunks);
+    for (uint64_t nThreads=1; nThreads<=8; nThreads*=2)
+    {
+        TaskGraph taskGraph;
+        atomic<uint64_t> wrongOrder(0);
+        for (uint64_t i=0; i<executions.size(); i++) executions[i] = 0;
+        for (uint64_t c=0; c<nChains; c++)
+        {
+            uint64_t previousTask = 0;
+            for (uint64_t l=0; l<nLinks; l++)
+            {
+                uint64_t first = (c * nLinks + l) * nChunks;
+                auto func = [&executions, &wrongOrder, first, l, nChunks](uint64_t chunk) {
+                    for (uint64_t i = 0; (l > 0) && (i < nChunks); i++)
+                    {
+                        if (executions[first - nChunks + i] != 1) wrongOrder++;
+                    }
+                    executions[first + chunk]++;
+                };
+                previousTask = (l == 0) ? taskGraph.addTask("chain" + to_string(c), nChunks, func) : taskGraph.addTask("chain" + to_string(c), nChunks, func, {previousTask});
+            }
+        }
+
+        taskGraph.run(nThreads);
+
+        if (wrongOrder != 0)
+        {
+            zklog.error("TaskGraphTest() failed nThreads=" + to_string(nThreads) + " found " + to_string(wrongOrder) + " chunks executed before their dependencies");
+            numberOfFailed++;
+        }
+        for (uint64_t i=0; i<executions.size(); i++)
+        {
+            if (executions[i] != 1)
+            {
+                zklog.error("TaskGraphTest() failed nThreads=" + to_string(nThreads) + " chunk=" + to_string(i) + " executed " + to_string(executions[i]) + " times");
+                numberOfFailed++;
+                break;
+            }
+        }
+    }
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("TaskGraphTest() failed " + to_string(numberOfFailed) + " tests");
+    }
+    else
+    {
+        zklog.info("TaskGraphTest() succeeded");
+    }
+    return numberOfFailed;
+}
@@ -0,0 +1,8 @@
+#ifndef TASK_GRAPH_TEST_HPP
+#define TASK_GRAPH_TEST_HPP
+
+#include <stdint.h>
+
+uint64_t TaskGraphTest (void);
+
+#endif
@@ -0,0 +1,146 @@
+#include <gmpxx.h>
+#include "u256_test.hpp"
+#include "u256.hpp"
+#include "timer.hpp"
+#include "zklog.hpp"
+#include "zkmax.hpp"
+
+using namespace std;
+
+#define U256_TEST_ITERATIONS 10000
+#define U256_BENCHMARK_ITERATIONS 1000000
+
+uint64_t U256Test (void)
+{
+    uint64_t numberOfFailed = 0;
+
+    gmp_randclass randomGenerator(gmp_randinit_default);
+    randomGenerator.seed(0x5EC9256B1);
+
+    const MontgomeryField &Fp = Secp256k1Fp();
+    const MontgomeryField &Fn = Secp256k1Fn();
+    mpz_class p, n;
+    Fp.p.toScalar(p);
+    Fn.p.toScalar(n);
+
+    // Check the integer and field operations against mpz_class
+    for (uint64_t i=0; i<U256_TEST_ITERATIONS; i++)
+    {
+        mpz_class a = randomGenerator.get_z_bits(256);
+        mpz_class b = randomGenerator.get_z_bits((i % 256) + 1);
+        U256 ua, ub;
+        ua.fromScalar(a);
+        ub.fromScalar(b);
+
+        // Integer product and division
+        U512 product = mul(ua, ub);
+        mpz_class result;
+        product.toScalar(result);
+        if (result != a*b)
+        {
+            zklog.error("U256Test() failed mul() a=" + a.get_str(16) + " b=" + b.get_str(16));
+            numberOfFailed++;
+        }
+        if (b != 0)
+        {
+            mpz_class c = randomGenerator.get_z_bits(512);
+            U512 uc, q;
+            uc.fromScalar(c);
+            U256 r;
+            divmod(uc, ub, q, r);
+            mpz_class qScalar, rScalar;
+            q.toScalar(qScalar);
+            r.toScalar(rScalar);
+            if ((qScalar != c/b) || (rScalar != c%b))
+            {
+                zklog.error("U256Test() failed divmod() c=" + c.get_str(16) + " b=" + b.get_str(16));
+                numberOfFailed++;
+            }
+        }
+
+        // Field multiplication, inverse and square root
+        const MontgomeryField &F = (i & 1) ? Fn : Fp;
+        mpz_class prime = (i & 1) ? n : p;
+        U256 ma, mb, mr, ur;
+        F.toMontgomery(ma, ua);
+        F.toMontgomery(mb, ub);
+        F.mul(mr, ma, mb);
+        F.fromMontgomery(ur, mr);
+        ur.toScalar(result);
+        if (result != (a*b) % prime)
+        {
+            zklog.error("U256Test() failed field mul() a=" + a.get_str(16) + " b=" + b.get_str(16));
+            numberOfFailed++;
+        }
+        if ((a % prime) != 0)
+        {
+            F.inv(mr, ma);
+            F.fromMontgomery(ur, mr);
+            ur.toScalar(result);
+            if (((result * a) % prime) != 1)
+            {
+                zklog.error("U256Test() failed field inv() a=" + a.get_str(16));
+                numberOfFailed++;
+            }
+        }
+        if ((i & 1) == 0)
+        {
+            F.square(mr, ma);
+            U256 root;
+            if (!F.sqrt3mod4(root, mr))
+            {
+                zklog.error("U256Test() failed sqrt3mod4() of a square a=" + a.get_str(16));
+                numberOfFailed++;
+            }
+            F.square(root, root);
+            if (root != mr)
+            {
+                zklog.error("U256Test() failed sqrt3mod4() a=" + a.get_str(16));
+                numberOfFailed++;
+            }
+        }
+    }
+
+    // Compare the performance of the field multiplication against the mpz_class one, calculating b^(n+1)
+    mpz_class b = randomGenerator.get_z_bits(255);
+    mpz_class a = b;
+    struct timeval t;
+    gettimeofday(&t, NULL);
+    for (uint64_t i=0; i<U256_BENCHMARK_ITERATIONS; i++)
+    {
+        a = (a * b) % p;
+    }
+    uint64_t mpzTime = TimeDiff(t);
+
+    U256 ua, ub;
+    ua.fromScalar(b);
+    Fp.toMontgomery(ub, ua);
+    ua = ub;
+    gettimeofday(&t, NULL);
+    for (uint64_t i=0; i<U256_BENCHMARK_ITERATIONS; i++)
+    {
+        Fp.mul(ua, ua, ub);
+    }
+    uint64_t u256Time = TimeDiff(t);
+
+    zklog.info("U256Test() benchmark of " + to_string(U256_BENCHMARK_ITERATIONS) + " secp256k1 field multiplications: mpz_class=" + to_string(mpzTime) + "us U256=" + to_string(u256Time) + "us speedup=" + to_string(double(mpzTime)/zkmax(u256Time, 1)));
+
+    mpz_class result;
+    Fp.fromMontgomery(ub, ua);
+    ub.toScalar(result);
+    if (result != a)
+    {
+        zklog.error("U256Test() failed benchmark result=" + result.get_str(16) + " expected=" + a.get_str(16));
+        numberOfFailed++;
+    }
+
+    if (numberOfFailed != 0)
+    {
+        zklog.error("U256Test() failed " + to_string(numberOfFailed) + " tests");
+    }
+    else
+    {
+        zklog.info("U256Test() succeeded");
+    }
+    return numberOfFailed;
+}
@@ -0,0 +1,8 @@
+#ifndef U256_TEST_HPP
+#define U256_TEST_HPP
+
+#include <stdint.h>
+
+uint64_t U256Test (void);
+
+#endif
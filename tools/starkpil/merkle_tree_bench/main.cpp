@@ -0,0 +1,108 @@
+#include <iostream>
+#include <string>
+#include <cstdlib>
+#include <sys/time.h>
+#include <omp.h>
+#include "goldilocks_base_field.hpp"
+#include "poseidon_goldilocks.hpp"
+#include "merkleTreeGL.hpp"
+
+// Micro-benchmark of MerkleTreeGL::merkelize(), reporting the GB/s of leaf data hashed for every
+// supported arity, and for the PoseidonGoldilocks::merkletree_avx full-width level passes as reference
+
+#define MERKLE_TREE_BENCH_VERSION "0.1.0.0"
+
+using namespace std;
+
+uint64_t TimeDiff(const struct timeval &startTime)
+{
+    struct timeval endTime;
+    gettimeofday(&endTime, NULL);
+    return (endTime.tv_sec - startTime.tv_sec) * 1000000 + endTime.tv_usec - startTime.tv_usec;
+}
+
+void printResult(const string &name, uint64_t nBytes, uint64_t time, uint64_t loops)
+{
+    double seconds = double(time) / 1000000 / loops;
+    cout << name << ": " << seconds << " s, " << double(nBytes) / seconds / 1000000000 << " GB/s" << endl;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 3)
+    {
+        cerr << "merkleTreeBench: version " << MERKLE_TREE_BENCH_VERSION << endl;
+        cerr << "usage: merkleTreeBench <nBits> <nCols> [<loops>]" << endl;
+        cerr << "example: merkleTreeBench 20 64 3" << endl;
+        return EXIT_FAILURE;
+    }
+
+    uint64_t height = 1ULL << atoi(argv[1]);
+    uint64_t width = atoi(argv[2]);
+    uint64_t loops = (argc > 3) ? atoi(argv[3]) : 1;
+    uint64_t nBytes = height * width * sizeof(Goldilocks::Element);
+
+    cout << "merkleTreeBench: height=" << height << " width=" << width << " loops=" << loops << " threads=" << omp_get_max_threads() << " leafData=" << nBytes << " B" << endl;
+
+    Goldilocks::Element *source = (Goldilocks::Element *)malloc(nBytes);
+    if (source == NULL)
+    {
+        cerr << "merkleTreeBench: failed calling malloc() of size " << nBytes << endl;
+        return EXIT_FAILURE;
+    }
+#pragma omp parallel for
+    for (uint64_t i = 0; i < height * width; i++)
+    {
+        source[i] = Goldilocks::fromU64(i * 0x9E3779B97F4A7C15ULL);
+    }
+
+    // Reference: full tree built level by level
+    Goldilocks::Element rootReference[HASH_SIZE];
+    {
+        MerkleTreeGL tree(height, width, source);
+        struct timeval t;
+        gettimeofday(&t, NULL);
+        for (uint64_t l = 0; l < loops; l++)
+        {
+#ifdef __AVX512__
+            PoseidonGoldilocks::merkletree_avx512(tree.nodes, source, width, height);
+#else
+            PoseidonGoldilocks::merkletree_avx(tree.nodes, source, width, height);
+#endif
+        }
+        printResult("reference arity=2", nBytes, TimeDiff(t), loops);
+        tree.getRoot(rootReference);
+    }
+
+    uint64_t arities[] = {2, 4, 8};
+    for (uint64_t arity : arities)
+    {
+        MerkleTreeGL tree(height, width, source, arity);
+        struct timeval t;
+        gettimeofday(&t, NULL);
+        for (uint64_t l = 0; l < loops; l++)
+        {
+            tree.merkelize();
+        }
+        printResult("tiled arity=" + to_string(arity), nBytes, TimeDiff(t), loops);
+
+        // Arity 2 must produce the same root as the reference
+        if (arity == 2)
+        {
+            Goldilocks::Element root[HASH_SIZE];
+            tree.getRoot(root);
+            for (uint64_t i = 0; i < HASH_SIZE; i++)
+            {
+                if (Goldilocks::toU64(root[i]) != Goldilocks::toU64(rootReference[i]))
+                {
+                    cerr << "merkleTreeBench: tiled root does not match the reference root" << endl;
+                    free(source);
+                    return EXIT_FAILURE;
+                }
+            }
+        }
+    }
+
+    free(source);
+    return EXIT_SUCCESS;
+}